@@ -102,6 +102,58 @@ DEVICE_FUNCTION_PARAM_TYPE = {
     'VkQueue',
 }
 
+# These functions are implemented manually in the null driver
+NULL_DRIVER_CUSTOM_FUNCTIONS = {
+    'vkAllocateCommandBuffers',
+    'vkAllocateDescriptorSets',
+    'vkAllocateMemory',
+    'vkCreateDevice',
+    'vkCreateInstance',
+    'vkDestroyCommandPool',
+    'vkDestroyDevice',
+    'vkDestroyInstance',
+    'vkEnumerateDeviceExtensionProperties',
+    'vkEnumerateInstanceExtensionProperties',
+    'vkEnumeratePhysicalDevices',
+    'vkFreeCommandBuffers',
+    'vkFreeMemory',
+    'vkGetDeviceProcAddr',
+    'vkGetDeviceQueue',
+    'vkGetDeviceQueue2',
+    'vkGetEventStatus',
+    'vkGetInstanceProcAddr',
+    'vkGetPhysicalDeviceFeatures',
+    'vkGetPhysicalDeviceFeatures2',
+    'vkGetPhysicalDeviceFeatures2KHR',
+    'vkGetPhysicalDeviceImageFormatProperties',
+    'vkGetPhysicalDeviceImageFormatProperties2',
+    'vkGetPhysicalDeviceImageFormatProperties2KHR',
+    'vkGetPhysicalDeviceMemoryProperties',
+    'vkGetPhysicalDeviceMemoryProperties2',
+    'vkGetPhysicalDeviceMemoryProperties2KHR',
+    'vkGetPhysicalDeviceProperties',
+    'vkGetPhysicalDeviceProperties2',
+    'vkGetPhysicalDeviceProperties2KHR',
+    'vkGetPhysicalDeviceQueueFamilyProperties',
+    'vkGetPhysicalDeviceQueueFamilyProperties2',
+    'vkGetPhysicalDeviceQueueFamilyProperties2KHR',
+    'vkGetQueryPoolResults',
+    'vkMapMemory',
+    'vkMapMemory2',
+    'vkMapMemory2KHR',
+}
+
+# Scalar output types that null driver stubs zero before returning
+NULL_DRIVER_SCALAR_TYPES = {
+    'int32_t',
+    'size_t',
+    'uint32_t',
+    'uint64_t',
+    'VkBool32',
+    'VkDeviceAddress',
+    'VkDeviceSize',
+}
+
 
 class VersionInfo(dict):
     '''
@@ -970,6 +1022,167 @@ def generate_device_queries(
     file.write('// clang-format on\n')
 
 
+def load_non_dispatchable_handles(root: ET.Element) -> set[str]:
+    '''
+    Load the names of all non-dispatchable handle types, including aliases.
+
+    Args:
+        root: The root of the Vulkan spec XML document.
+
+    Returns:
+        The set of non-dispatchable handle type names.
+    '''
+    handles = set()
+    aliases = {}
+
+    for node in root.findall('.//types/type[@category="handle"]'):
+        alias = node.get('alias')
+        if alias:
+            aliases[node.get('name')] = alias
+            continue
+
+        macro = node.find('type')
+        name = node.find('name')
+        assert macro is not None and name is not None
+
+        if macro.text == 'VK_DEFINE_NON_DISPATCHABLE_HANDLE':
+            handles.add(name.text)
+
+    for name, alias in aliases.items():
+        if alias in handles:
+            handles.add(name)
+
+    return handles
+
+
+def get_null_driver_stub_body(
+        command: Command, handles: set[str]) -> tuple[list[str], set[str]]:
+    '''
+    Generate the body of a null driver stub function.
+
+    Stubs zero any scalar outputs, such as query counts, so callers see empty
+    results, and return unique handle values for any created non-dispatchable
+    objects so that layers tracking objects by handle see distinct objects.
+
+    Args:
+        command: The command to generate.
+        handles: The set of non-dispatchable handle types.
+
+    Returns:
+        The body lines, and the set of parameter names used by the body.
+    '''
+    lines = []
+    used = set()
+
+    count_name = None
+    count_is_pointer = False
+
+    for ptype, pname, array in command.params:
+        is_output = ptype.endswith('*') and not ptype.startswith('const') \
+            and not ptype.endswith('**') and not array
+        base_type = ptype.rstrip('*')
+
+        # Track the most recent count parameter for array outputs
+        if base_type == 'uint32_t' and pname.endswith('Count') and not array:
+            count_name = pname
+            count_is_pointer = is_output
+
+        if not is_output:
+            continue
+
+        if base_type in NULL_DRIVER_SCALAR_TYPES:
+            lines.append(f'    *{pname} = 0;')
+            used.add(pname)
+
+        elif base_type in handles:
+            # Arrays sized by a queried count are returned empty
+            if count_is_pointer:
+                continue
+
+            if count_name:
+                create = f'createHandle<{base_type}>()'
+                lines.append(
+                    f'    for (uint32_t i = 0; i < {count_name}; i++)')
+                lines.append('    {')
+                lines.append(f'        {pname}[i] = {create};')
+                lines.append('    }')
+                used.add(count_name)
+            else:
+                lines.append(f'    *{pname} = createHandle<{base_type}>();')
+
+            used.add(pname)
+
+    if command.rtype == 'VkResult':
+        lines.append('    return VK_SUCCESS;')
+    elif command.rtype != 'void':
+        lines.append('    return {};')
+
+    return lines, used
+
+
+def generate_null_driver_defs(
+        file: TextIO, mapping: VersionInfo, commands: list[Command],
+        handles: set[str]) -> None:
+    '''
+    Generate the null driver stub function definitions.
+
+    Args:
+        file: The file to write.
+        mapping: The version mapping information for the commands.
+        commands: The list of commands read from the spec.
+        handles: The set of non-dispatchable handle types.
+    '''
+    # Write the copyright header to the file
+    write_copyright_header(file)
+
+    data = load_template('null_driver_defs.txt')
+
+    # Create a listing of API versions and API extensions
+    lines = []
+    table = []
+    for command in commands:
+        assert command.name
+        if command.name in NULL_DRIVER_CUSTOM_FUNCTIONS:
+            continue
+
+        body, used = get_null_driver_stub_body(command, handles)
+
+        plat_define = mapping.get_platform_define(command.name)
+        if plat_define:
+            lines.append(f'#if defined({plat_define})\n')
+            table.append(f'#if defined({plat_define})')
+
+        lines.append('/* See Vulkan API for documentation. */')
+        decl = f'static VKAPI_ATTR {command.rtype} ' \
+               f'VKAPI_CALL null_{command.name}('
+        lines.append(decl)
+
+        for i, (ptype, pname, array) in enumerate(command.params):
+            ending = ','
+            if i == len(command.params) - 1:
+                ending = ''
+
+            if pname not in used:
+                pname = f'/* {pname} */'
+
+            parl = f'    {ptype} {pname}{array}{ending}'
+            lines.append(parl)
+
+        lines.append(') {')
+        lines.extend(body)
+        lines.append('}\n')
+
+        table.append(f'    ENTRY({command.name}),')
+
+        if plat_define:
+            lines.append('#endif\n')
+            table.append('#endif')
+
+    data = data.replace('{FUNCTION_DEFS}', '\n'.join(lines))
+    data = data.replace('{FUNCTION_TABLE}', '\n'.join(table))
+    file.write(data)
+
+
 def main() -> int:
     '''
     Tool main function.
@@ -1046,6 +1259,13 @@ def main() -> int:
     with open(outfile, 'w', encoding='utf-8', newline='\n') as handle:
         generate_device_defs(handle, mapping, commands)
 
+    handles = load_non_dispatchable_handles(root)
+
+    outdir = os.path.join(base_dir, '..', 'source_common', 'null_driver')
+    outfile = os.path.join(outdir, 'null_driver_functions.cpp')
+    with open(outfile, 'w', encoding='utf-8', newline='\n') as handle:
+        generate_null_driver_defs(handle, mapping, commands, handles)
+
     return 0
 
 
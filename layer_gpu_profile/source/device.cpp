@@ -22,19 +22,22 @@
  * IN THE SOFTWARE.
  * ----------------------------------------------------------------------------
  */
+#include <cstdint>
+#include <optional>
+#include <variant>
 #include <vector>
 #include <sys/stat.h>
 #include <unistd.h>
 
-#include <nlohmann/json.hpp>
-
 #include "comms/comms_module.hpp"
 #include "device.hpp"
 #include "framework/manual_functions.hpp"
 #include "framework/utils.hpp"
 #include "instance.hpp"
+#include "profile_counters.hpp"
+#include "profile_protobuf_encoder.hpp"
 
-using json = nlohmann::json;
+#include <vulkan/utility/vk_struct_helper.hpp>
 
 /**
  * @brief The dispatch lookup for all of the created Vulkan devices.
@@ -42,7 +45,9 @@ using json = nlohmann::json;
 static std::unordered_map<void*, std::unique_ptr<Device>> g_devices;
 
 /* See header for documentation. */
-const std::vector<DeviceCreatePatchPtr> Device::createInfoPatches {};
+const std::vector<DeviceCreatePatchPtr> Device::createInfoPatches {
+    enableDeviceVkKhrTimelineSemaphore
+};
 
 /* See header for documentation. */
 std::unique_ptr<Comms::CommsModule> Device::commsModule;
@@ -52,6 +57,142 @@ std::unique_ptr<ProfileComms> Device::commsWrapper;
 
 extern std::mutex g_vulkanLock;
 
+namespace
+{
+/**
+ * @brief The trap-relevant properties of a recorded workload.
+ */
+struct TrapWorkload
+{
+    /**
+     * @brief The workload in the command stream.
+     */
+    Tracker::LCSWorkload* workload;
+
+    /**
+     * @brief The coarse workload type.
+     */
+    ProfileWorkloadType type;
+
+    /**
+     * @brief Is this a render pass continuation?
+     */
+    bool isContinuation;
+};
+
+/**
+ * @brief Visitor to extract trap properties from a command stream instruction.
+ */
+struct TrapWorkloadVisitor
+{
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionMarkerPush&) const
+    {
+        return std::nullopt;
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionMarkerPop&) const
+    {
+        return std::nullopt;
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSRenderPass>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::RENDER_PASS, false};
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSRenderPassContinuation>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::RENDER_PASS, true};
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSDispatch>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::COMPUTE, false};
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSDispatchDataGraph>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::DATA_GRAPH, false};
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSTraceRays>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::TRACE_RAYS, false};
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSImageTransfer>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::IMAGE_TRANSFER, false};
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSBufferTransfer>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::BUFFER_TRANSFER, false};
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSAccelerationStructureBuild>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::AS_BUILD, false};
+    }
+
+    std::optional<TrapWorkload> operator()(Tracker::LCSInstructionWorkload<Tracker::LCSAccelerationStructureTransfer>& instruction) const
+    {
+        return TrapWorkload {&instruction.getWorkload(), ProfileWorkloadType::AS_TRANSFER, false};
+    }
+};
+
+/**
+ * @brief Get the debug label stack at a point in a command stream.
+ *
+ * Only labels pushed in this command stream are visible, so labels pushed in
+ * an earlier command buffer on the same queue are not included.
+ *
+ * @param stream   The command stream.
+ * @param end      The number of instructions to process.
+ *
+ * @return The debug label stack.
+ */
+std::vector<std::string> getCommandStreamLabels(
+    const std::vector<Tracker::LCSInstruction>& stream,
+    size_t end
+) {
+    std::vector<std::string> labels;
+    for (size_t i = 0; i < end; i++)
+    {
+        if (const auto* push = std::get_if<Tracker::LCSInstructionMarkerPush>(&stream[i]))
+        {
+            labels.push_back(push->getLabel());
+        }
+        else if (std::holds_alternative<Tracker::LCSInstructionMarkerPop>(stream[i]) && !labels.empty())
+        {
+            labels.pop_back();
+        }
+    }
+
+    return labels;
+}
+
+/**
+ * @brief Test if timeline semaphores are enabled in a device create info.
+ *
+ * @param createInfo   The create info used to create the device.
+ *
+ * @return @c true if the feature is enabled, @c false otherwise.
+ */
+bool isTimelineSemaphoreEnabled(
+    const VkDeviceCreateInfo& createInfo
+) {
+    auto* config1 = vku::FindStructInPNextChain<VkPhysicalDeviceTimelineSemaphoreFeatures>(createInfo.pNext);
+    if (config1 && config1->timelineSemaphore)
+    {
+        return true;
+    }
+
+    auto* config2 = vku::FindStructInPNextChain<VkPhysicalDeviceVulkan12Features>(createInfo.pNext);
+    return config2 && config2->timelineSemaphore;
+}
+}
+
 /* See header for documentation. */
 void Device::store(VkDevice handle, std::unique_ptr<Device> device)
 {
@@ -105,8 +246,6 @@ Device::Device(Instance* _instance,
       physicalDevice(_physicalDevice),
       device(_device)
 {
-    UNUSED(createInfo);
-
     initDriverDeviceDispatchTable(device, nlayerGetProcAddress, driver);
 
     // Emit a log if debug utils entry points did not load. In this scenario
@@ -130,23 +269,14 @@ Device::Device(Instance* _instance,
         }
     }
 
-    // Create events for CPU<>GPU synchronization
-    VkEventCreateInfo eventCreateInfo {
-        .sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO,
-        .pNext = nullptr,
-        .flags = 0,
-    };
-
-    auto result = driver.vkCreateEvent(device, &eventCreateInfo, nullptr, &gpuToCpuEvent);
-    if (result != VK_SUCCESS)
-    {
-        LAYER_ERR("Failed vkCreateEvent() for gpu->cpu synchronization");
-    }
-
-    result = driver.vkCreateEvent(device, &eventCreateInfo, nullptr, &cpuToGpuEvent);
-    if (result != VK_SUCCESS)
+    // Queue isolation uses timeline semaphores if the feature was enabled, which
+    // may not be the case even if the entry points are available
+    bool hasWait = driver.vkWaitSemaphores || driver.vkWaitSemaphoresKHR;
+    hasTimelineSemaphores = hasWait && isTimelineSemaphoreEnabled(createInfo);
+    if (!hasTimelineSemaphores)
     {
-        LAYER_ERR("Failed vkCreateEvent() for cpu->gpu synchronization");
+        LAYER_LOG("  - ERROR: Device does not support VK_KHR_timeline_semaphore");
+        LAYER_LOG("           Frame isolation will wait for the device to idle");
     }
 
     // Create the counter context
@@ -157,81 +287,456 @@ Device::Device(Instance* _instance,
         return;
     }
 
-    // Create the counter sampler config
-    auto config = hwcpipe::sampler_config(*lgcGpu.get());
+    // Older CSF drivers need a delay after a sync before reading counters
+    VkPhysicalDeviceProperties deviceProperties;
+    instance->driver.vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperties);
+
+    uint32_t driverMajor = VK_VERSION_MAJOR(deviceProperties.driverVersion);
+    bool isCSF = lgcGpu->get_gpu_frontend() == hwcpipe::gpu_frontend::csf;
+    needsWorkaroundDelay = isCSF && (driverMajor < 54);
+    if (needsWorkaroundDelay)
+    {
+        LAYER_LOG("Enabling counter sync workaround delay for r%u driver", driverMajor);
+    }
 
     LAYER_LOG("Configuring libGPUCounters:");
 
-    // Queue cycles, not all of these are available on all GPUs - the ones that
+    // Counter names were validated against the catalog when parsing the
+    // config, but not all counters are available on all GPUs - the ones that
     // are not available will be transparently dropped
-    addCounter(config, MaliCompQueueActiveCy, "Compute queue active cycles");
-    addCounter(config, MaliVertQueueActiveCy, "Vertex queue active cycles");
-    addCounter(config, MaliBinningQueueActiveCy, "Binning phase queue active cycles");
-    addCounter(config, MaliNonFragQueueActiveCy, "Non-fragment queue active cycles");
-    addCounter(config, MaliFragQueueActiveCy, "Fragment queue active cycles");
-    addCounter(config, MaliMainQueueActiveCy, "Main phase queue active cycles");
-
-    // External bandwidth
-    addCounter(config, MaliExtBusRdBy, "External read bytes");
-    addCounter(config, MaliExtBusWrBy, "External write bytes");
-
-    // Primitive counts
-    addCounter(config, MaliGeomTotalPrim, "Input primitives");
-    addCounter(config, MaliGeomVisiblePrim, "Visible primitives");
-
-    // Thread counts
-    addCounter(config, MaliNonFragThread, "Non-fragment threads");
-    addCounter(config, MaliFragThread, "Fragment threads");
-
-    // Functional unit counters
-    // TODO HIVE-1307: Currently libGPUCounters doesn't expose a MaliALUIssueCy
-    // counter, so we use instruction counts as a measure of relative
-    // arithmetic complexity across workloads, but note that it is not directly
-    // comparable with the other "* unit cycles" counters.
-    addCounter(config, MaliEngInstr, "Arithmetic unit instructions");
-    addCounter(config, MaliEngFMAInstr, "Arithmetic unit FMA instructions");
-    addCounter(config, MaliEngCVTInstr, "Arithmetic unit CVT instructions");
-    addCounter(config, MaliEngSFUInstr, "Arithmetic unit SFU instructions");
-    addCounter(config, MaliVarIssueCy, "Varying unit cycles");
-    addCounter(config, MaliTexIssueCy, "Texture unit cycles");
-    addCounter(config, MaliLSIssueCy, "Load/store unit cycles");
-
-    // Create the counter sampler and set it running
-    lgcSampler = std::make_unique<hwcpipe::sampler<>>(config);
-    auto ec = lgcSampler->start_sampling();
-    if (ec)
+    size_t passSize = instance->config.getCountersPerPass();
+    std::vector<std::pair<hwcpipe_counter, std::string>> passCounters;
+
+    for (const auto& key : instance->config.getCounters())
     {
-        LAYER_ERR("Failed libGPUCounters GPU sampler creation");
+        const auto* counter = findProfileCounter(key);
+        assert(counter);
+        if (!isCounterAvailable(counter->id, counter->name))
+        {
+            continue;
+        }
+
+        // Start a new pass if the current pass is full
+        if (passSize && passCounters.size() == passSize)
+        {
+            lgcCounterPasses.push_back(std::move(passCounters));
+            passCounters.clear();
+        }
+
+        passCounters.emplace_back(counter->id, counter->name);
+    }
+
+    if (!passCounters.empty() || lgcCounterPasses.empty())
+    {
+        lgcCounterPasses.push_back(std::move(passCounters));
+    }
+
+    if (lgcCounterPasses[0].empty())
+    {
+        LAYER_ERR("None of the selected counters are available on this GPU");
+    }
+
+    if (lgcCounterPasses.size() > 1)
+    {
+        LAYER_LOG("Counters split into %zu passes", lgcCounterPasses.size());
+    }
+
+    // Bind the derived metrics to the counter order of each pass, metrics
+    // that need counters from more than one pass cannot be computed
+    const auto& derivedMetrics = instance->config.getDerivedMetrics();
+    std::vector<bool> isMetricBound(derivedMetrics.size(), false);
+
+    for (const auto& passCounters : lgcCounterPasses)
+    {
+        auto& passMetrics = lgcDerivedMetrics.emplace_back();
+        for (size_t i = 0; i < derivedMetrics.size(); i++)
+        {
+            auto metric = derivedMetrics[i].bind(passCounters);
+            if (metric)
+            {
+                passMetrics.push_back(std::move(*metric));
+                isMetricBound[i] = true;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < derivedMetrics.size(); i++)
+    {
+        if (!isMetricBound[i])
+        {
+            LAYER_ERR("Derived metric %s cannot be computed in any counter pass",
+                      derivedMetrics[i].getName().c_str());
+        }
+    }
+
+    // Create the counter sampler for the first pass and set it running
+    selectCounterPass(0);
+
+    // Send the counter names once, so samples only need to send values
+    for (size_t i = 0; i < lgcCounterPasses.size(); i++)
+    {
+        ProfileProtobufEncoder::emitSchema(*this, i);
+    }
+
+    // Workload traps are serviced by a scheduler thread
+    if (instance->config.isSamplingWorkloads())
+    {
+        trapScheduler = std::make_unique<ProfileTrapScheduler>(*this);
+    }
+
+    // Periodic sampling runs in the background and ignores frame selection
+    if (instance->config.isSamplingPeriodic())
+    {
+        uint32_t period = instance->config.getPeriodicSamplePeriod();
+        periodicSampler = std::make_unique<ProfilePeriodicSampler>(*this, period);
+        return;
     }
 
     // Configure frame selection here so we can profile frame zero
     isFrameOfInterest = instance->config.isFrameOfInterest(0);
+    if (isFrameOfInterest)
+    {
+        frameOfInterestCount++;
+    }
 
     // Start the next frame if it is "of interest"
-    if (isFrameOfInterest)
+    if (isFrameOfInterest && instance->config.isSamplingWorkloads())
+    {
+        resetFrameState();
+        ProfileProtobufEncoder::emitStartFrame(*this, 0);
+    }
+}
+
+/* See header for documentation. */
+Device::~Device()
+{
+    // Stop the background threads before the counter sampler is destroyed
+    if (periodicSampler)
+    {
+        periodicSampler->stop();
+    }
+
+    if (trapScheduler)
+    {
+        trapScheduler->stop();
+    }
+
+    for (const auto& slot : trapSlots)
+    {
+        driver.vkDestroyEvent(device, slot.gpuToCpuEvent, nullptr);
+        driver.vkDestroyEvent(device, slot.cpuToGpuEvent, nullptr);
+    }
+
+    for (auto& [queue, fence] : queueFences)
+    {
+        if (fence.semaphore)
+        {
+            driver.vkDestroySemaphore(device, fence.semaphore, nullptr);
+        }
+    }
+}
+
+/* See header for documentation. */
+void Device::markQueueActive(
+    VkQueue queue
+) {
+    auto& fence = queueFences[queue];
+    fence.isActive = true;
+
+    // Create the semaphore the first time a queue is used
+    if (fence.semaphore || !hasTimelineSemaphores)
+    {
+        return;
+    }
+
+    VkSemaphoreTypeCreateInfo timelineCreateInfo {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+        .pNext = nullptr,
+        .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+        .initialValue = fence.value,
+    };
+
+    VkSemaphoreCreateInfo semCreateInfo {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+        .pNext = &timelineCreateInfo,
+        .flags = 0,
+    };
+
+    auto result = driver.vkCreateSemaphore(device, &semCreateInfo, nullptr, &fence.semaphore);
+    if (result != VK_SUCCESS)
+    {
+        LAYER_ERR("Failed vkCreateSemaphore() for queue isolation");
+        fence.semaphore = nullptr;
+    }
+}
+
+/* See header for documentation. */
+void Device::waitForActiveQueues()
+{
+    std::vector<VkSemaphore> semaphores;
+    std::vector<uint64_t> values;
+    bool waitIdle = !hasTimelineSemaphores;
+
+    // Signal the next timeline value after the last submit on active queues
+    for (auto& [queue, fence] : queueFences)
     {
-        json startFrameMessage {
-            { "type", "start_frame" },
-            { "frame", 0 },
+        if (!fence.isActive)
+        {
+            continue;
+        }
+
+        fence.isActive = false;
+        if (!fence.semaphore)
+        {
+            waitIdle = true;
+            continue;
+        }
+
+        uint64_t signalValue = fence.value + 1;
+
+        VkTimelineSemaphoreSubmitInfo timelineInfo {
+            .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .waitSemaphoreValueCount = 0,
+            .pWaitSemaphoreValues = nullptr,
+            .signalSemaphoreValueCount = 1,
+            .pSignalSemaphoreValues = &signalValue,
         };
 
-        txMessage(startFrameMessage.dump());
+        VkSubmitInfo submitInfo {
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .pNext = &timelineInfo,
+            .waitSemaphoreCount = 0,
+            .pWaitSemaphores = nullptr,
+            .pWaitDstStageMask = nullptr,
+            .commandBufferCount = 0,
+            .pCommandBuffers = nullptr,
+            .signalSemaphoreCount = 1,
+            .pSignalSemaphores = &fence.semaphore,
+        };
+
+        auto result = driver.vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
+        if (result != VK_SUCCESS)
+        {
+            LAYER_ERR("Failed vkQueueSubmit() for queue isolation");
+            waitIdle = true;
+            continue;
+        }
+
+        fence.value = signalValue;
+        semaphores.push_back(fence.semaphore);
+        values.push_back(signalValue);
+    }
+
+    if (waitIdle)
+    {
+        driver.vkDeviceWaitIdle(device);
+        return;
+    }
+
+    if (semaphores.empty())
+    {
+        return;
+    }
+
+    VkSemaphoreWaitInfo waitInfo {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .semaphoreCount = static_cast<uint32_t>(semaphores.size()),
+        .pSemaphores = semaphores.data(),
+        .pValues = values.data(),
+    };
+
+    auto waitSemaphores = driver.vkWaitSemaphores ? driver.vkWaitSemaphores : driver.vkWaitSemaphoresKHR;
+    auto result = waitSemaphores(device, &waitInfo, UINT64_MAX);
+    if (result != VK_SUCCESS)
+    {
+        LAYER_ERR("Failed vkWaitSemaphores() for queue isolation");
+        driver.vkDeviceWaitIdle(device);
     }
 }
 
-void Device::addCounter(
-    hwcpipe::sampler_config& config,
+/* See header for documentation. */
+bool Device::isCounterAvailable(
     hwcpipe_counter counterID,
     const char* counterName
 ) {
-    auto ec = config.add_counter(counterID);
+    auto probeConfig = hwcpipe::sampler_config(*lgcGpu.get());
+    auto ec = probeConfig.add_counter(counterID);
     if (ec)
     {
         LAYER_LOG(" - %s not available", counterName);
+        return false;
+    }
+
+    LAYER_LOG(" + %s selected", counterName);
+    return true;
+}
+
+/* See header for documentation. */
+void Device::selectCounterPass(
+    size_t pass
+) {
+    assert(pass < lgcCounterPasses.size());
+
+    // Nothing to do if the pass is already running
+    if (lgcSampler && pass == lgcCounterPass)
+    {
+        return;
+    }
+
+    if (lgcSampler)
+    {
+        auto ec = lgcSampler->stop_sampling();
+        if (ec)
+        {
+            LAYER_ERR("Failed libGPUCounters GPU sampler stop");
+        }
+    }
+
+    lgcCounterPass = pass;
+    lgcActiveCounters = lgcCounterPasses[pass];
+
+    auto config = hwcpipe::sampler_config(*lgcGpu.get());
+    for (const auto& pair : lgcActiveCounters)
+    {
+        config.add_counter(pair.first);
+    }
+
+    lgcSampler = std::make_unique<hwcpipe::sampler<>>(config);
+    auto ec = lgcSampler->start_sampling();
+    if (ec)
+    {
+        LAYER_ERR("Failed libGPUCounters GPU sampler creation");
+    }
+}
+
+/* See header for documentation. */
+void Device::resetFrameState()
+{
+    workloadSamples.reset(lgcCounterPasses[frameCounterPass].size());
+    recordedWorkloadCount = 0;
+}
+
+/* See header for documentation. */
+bool Device::selectCPUTrap(
+    VkCommandBuffer commandBuffer,
+    ProfileTrapSlot& slot
+) {
+    const auto& config = instance->config;
+
+    std::lock_guard<std::mutex> lock { g_vulkanLock };
+
+    auto& cb = stateTracker.getCommandBuffer(commandBuffer);
+    auto& stream = cb.getSubmitCommandStream();
+
+    // The trap follows the workload it samples, so find the last workload
+    std::optional<TrapWorkload> workload;
+    size_t index = stream.size();
+    while (index > 0 && !workload)
+    {
+        index--;
+        workload = std::visit(TrapWorkloadVisitor {}, stream[index]);
+    }
+
+    // Don't trap untracked workloads, or a workload that already has a trap
+    if (!workload ||
+        workload->workload->getInstrumentationSlot() != Tracker::LCSWorkload::NO_INSTRUMENTATION_SLOT)
+    {
+        return false;
+    }
+
+    if (!workload->isContinuation && config.isTrapFilterEnabled())
+    {
+        uint64_t workloadIndex = recordedWorkloadCount++;
+
+        std::vector<std::string> labels;
+        if (config.isTrapLabelFilterEnabled())
+        {
+            labels = getCommandStreamLabels(stream, index);
+        }
+
+        if (!config.isTrapSelected(workload->type, workloadIndex, labels))
+        {
+            return false;
+        }
+    }
+
+    slot = getTrapSlot(commandBuffer);
+    workload->workload->setInstrumentationSlot(slot.index);
+    return true;
+}
+
+/* See header for documentation. */
+ProfileTrapSlot Device::getTrapSlot(
+    VkCommandBuffer commandBuffer
+) {
+    std::lock_guard<std::mutex> lock { trapSlotLock };
+
+    auto it = commandBufferTrapSlots.find(commandBuffer);
+    if (it != commandBufferTrapSlots.end())
+    {
+        return trapSlots[it->second];
+    }
+
+    // Reuse a released slot if possible, otherwise grow the pool
+    uint32_t index;
+    if (!freeTrapSlots.empty())
+    {
+        index = freeTrapSlots.back();
+        freeTrapSlots.pop_back();
     }
     else
     {
-        LAYER_LOG(" + %s selected", counterName);
-        lgcActiveCounters.emplace_back(counterID, counterName);
+        VkEventCreateInfo eventCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+        };
+
+        ProfileTrapSlot slot {static_cast<uint32_t>(trapSlots.size()), nullptr, nullptr};
+
+        auto result = driver.vkCreateEvent(device, &eventCreateInfo, nullptr, &slot.gpuToCpuEvent);
+        if (result != VK_SUCCESS)
+        {
+            LAYER_ERR("Failed vkCreateEvent() for gpu->cpu synchronization");
+        }
+
+        result = driver.vkCreateEvent(device, &eventCreateInfo, nullptr, &slot.cpuToGpuEvent);
+        if (result != VK_SUCCESS)
+        {
+            LAYER_ERR("Failed vkCreateEvent() for cpu->gpu synchronization");
+        }
+
+        index = slot.index;
+        trapSlots.push_back(slot);
     }
+
+    commandBufferTrapSlots.insert({commandBuffer, index});
+    return trapSlots[index];
+}
+
+/* See header for documentation. */
+ProfileTrapSlot Device::getTrapSlotByIndex(
+    uint32_t index
+) {
+    std::lock_guard<std::mutex> lock { trapSlotLock };
+    return trapSlots[index];
+}
+
+/* See header for documentation. */
+void Device::releaseTrapSlot(
+    VkCommandBuffer commandBuffer
+) {
+    std::lock_guard<std::mutex> lock { trapSlotLock };
+
+    auto it = commandBufferTrapSlots.find(commandBuffer);
+    if (it == commandBufferTrapSlots.end())
+    {
+        return;
+    }
+
+    freeTrapSlots.push_back(it->second);
+    commandBufferTrapSlots.erase(it);
 }
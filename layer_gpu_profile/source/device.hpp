@@ -52,7 +52,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -66,6 +69,10 @@
 #include "comms/comms_module.hpp"
 #include "framework/device_dispatch_table.hpp"
 #include "instance.hpp"
+#include "profile_derived_metrics.hpp"
+#include "profile_periodic_sampler.hpp"
+#include "profile_sample_buffer.hpp"
+#include "profile_trap_scheduler.hpp"
 #include "trackers/device.hpp"
 
 /**
@@ -150,16 +157,16 @@ public:
     /**
      * @brief Destroy this layer device object.
      */
-    ~Device() = default;
+    ~Device();
 
     /**
      * @brief Callback for sending some message for the device.
      *
      * @param message   The message to send.
      */
-    void txMessage(const std::string& message)
+    void txMessage(Comms::MessageData&& message)
     {
-        commsWrapper->txMessage(message);
+        commsWrapper->txMessage(std::move(message));
     }
 
     /**
@@ -167,17 +174,102 @@ public:
      */
     Tracker::Device& getStateTracker() { return stateTracker; }
 
+    /**
+     * @brief Reset the per-frame sampling state at the start of a frame.
+     */
+    void resetFrameState();
+
+    /**
+     * @brief Select whether to trap the last workload recorded in a command buffer.
+     *
+     * If selected, the index of the command buffer trap slot is recorded in
+     * the workload, so that the CPU-side of the trap is handled at submit
+     * time without needing any shared layer state. Render pass continuations
+     * are always trapped, because the trap for the original render pass is
+     * recorded at the end of the continuation.
+     *
+     * The caller must not hold the layer lock.
+     *
+     * @param commandBuffer   The command buffer being recorded.
+     * @param slot            The trap slot to use, if selected.
+     *
+     * @return @c true if the workload should be trapped, @c false otherwise.
+     */
+    bool selectCPUTrap(VkCommandBuffer commandBuffer, ProfileTrapSlot& slot);
+
+    /**
+     * @brief Get the trap slot for a command buffer, allocating one if needed.
+     *
+     * The slot is owned by the command buffer until it is freed. This can be
+     * called with or without the layer lock held.
+     *
+     * @param commandBuffer   The command buffer.
+     *
+     * @return The trap slot.
+     */
+    ProfileTrapSlot getTrapSlot(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Get a trap slot by its index in the slot pool.
+     *
+     * Used at submit time to find the slot recorded in a workload, which may
+     * belong to a secondary command buffer rather than the one submitted.
+     *
+     * @param index   The slot index.
+     *
+     * @return The trap slot.
+     */
+    ProfileTrapSlot getTrapSlotByIndex(uint32_t index);
+
+    /**
+     * @brief Release the trap slot for a command buffer, if it has one.
+     *
+     * @param commandBuffer   The command buffer being freed.
+     */
+    void releaseTrapSlot(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Mark that a queue has been submitted to since the last isolation.
+     *
+     * The caller must hold the layer lock.
+     *
+     * @param queue   The queue being submitted to.
+     */
+    void markQueueActive(VkQueue queue);
+
+    /**
+     * @brief Wait for all work on queues that were submitted to since the last
+     *        isolation to complete.
+     *
+     * Each active queue signals a layer-owned timeline semaphore after its last
+     * submit, so queues without work are not waited on. Falls back to waiting
+     * for the device to idle if timeline semaphores are not supported.
+     *
+     * The caller must hold the layer lock.
+     */
+    void waitForActiveQueues();
+
+    /**
+     * @brief Select the counter pass to sample, restarting the sampler if needed.
+     *
+     * The caller must hold the layer lock, and must take a sample to reset the
+     * counters before sampling any workload using the new pass.
+     *
+     * @param pass   The index of the counter pass to select.
+     */
+    void selectCounterPass(size_t pass);
+
 private:
 
     /**
-     * @brief Add a counter to the list of counters, if available.
+     * @brief Test if a counter is available on this GPU.
+     *
+     * @param counterID     The counter to test.
+     * @param counterName   The human-readable counter name.
      *
-     * @param samplerConfig   The sampler configuration to query.
-     * @param counterID       The counter to add to the configuration.
-     * @param counterName     The human-readable counter name.
+     * @return @c true if the counter can be sampled, @c false otherwise.
      */
-    void addCounter(
-        hwcpipe::sampler_config& samplerConfig,
+    bool isCounterAvailable(
         hwcpipe_counter counterID,
         const char* counterName);
 
@@ -212,16 +304,6 @@ public:
      */
     bool isFrameOfInterest {false};
 
-    /**
-     * @brief The event needed to sync execution from GPU to CPU.
-     */
-    VkEvent gpuToCpuEvent;
-
-    /**
-     * @brief The event needed to sync execution from CPU back to GPU.
-     */
-    VkEvent cpuToGpuEvent;
-
     /**
      * @brief The GPU connection for counter sampling.
      */
@@ -237,7 +319,125 @@ public:
      */
     std::vector<std::pair<hwcpipe_counter, std::string>> lgcActiveCounters;
 
+    /**
+     * @brief The available GPU counters, partitioned into sampling passes.
+     *
+     * Contains a single pass unless the config limits the counters per pass.
+     */
+    std::vector<std::vector<std::pair<hwcpipe_counter, std::string>>> lgcCounterPasses;
+
+    /**
+     * @brief The derived metrics for each counter pass, bound to the pass.
+     *
+     * Only contains the metrics with all of their counters in the pass.
+     */
+    std::vector<std::vector<ProfileDerivedMetric>> lgcDerivedMetrics;
+
+    /**
+     * @brief The index of the counter pass used by the active sampler.
+     */
+    size_t lgcCounterPass {0};
+
+    /**
+     * @brief The index of the counter pass used by the current frame of interest.
+     */
+    size_t frameCounterPass {0};
+
+    /**
+     * @brief The number of frames of interest started so far.
+     */
+    uint64_t frameOfInterestCount {0};
+
+    /**
+     * @brief The workload samples for the current frame of interest.
+     */
+    ProfileSampleBuffer workloadSamples;
+
+    /**
+     * @brief The number of workloads recorded in the current frame of interest.
+     */
+    uint64_t recordedWorkloadCount {0};
+
+    /**
+     * @brief The number of the current frame, readable from any thread.
+     */
+    std::atomic<uint64_t> currentFrameID {0};
+
+    /**
+     * @brief The number of queue submits made, readable from any thread.
+     */
+    std::atomic<uint64_t> queueSubmitCount {0};
+
+    /**
+     * @brief The workload trap scheduler, if sampling workloads.
+     */
+    std::unique_ptr<ProfileTrapScheduler> trapScheduler;
+
+    /**
+     * @brief The background sampler, if sampling periodically.
+     */
+    std::unique_ptr<ProfilePeriodicSampler> periodicSampler;
+
+    /**
+     * @brief Does the driver need a delay before reading counters after a sync?
+     *
+     * Set for CSF GPUs running drivers older than r54p0, which need a delay to
+     * workaround a counter sync errata.
+     */
+    bool needsWorkaroundDelay {false};
+
 private:
+    /**
+     * @brief The layer-owned timeline semaphore used to isolate a queue.
+     */
+    struct QueueFence
+    {
+        /**
+         * @brief The timeline semaphore signaled by the queue.
+         */
+        VkSemaphore semaphore {nullptr};
+
+        /**
+         * @brief The last value signaled by the queue.
+         */
+        uint64_t value {0};
+
+        /**
+         * @brief Has the queue been submitted to since the last isolation?
+         */
+        bool isActive {false};
+    };
+
+    /**
+     * @brief The isolation fences for each queue that has been submitted to.
+     */
+    std::unordered_map<VkQueue, QueueFence> queueFences;
+
+    /**
+     * @brief Are timeline semaphores supported by the device?
+     */
+    bool hasTimelineSemaphores {false};
+
+    /**
+     * @brief Lock protecting the trap slot pool.
+     */
+    std::mutex trapSlotLock;
+
+    /**
+     * @brief The pool of trap slots.
+     */
+    std::vector<ProfileTrapSlot> trapSlots;
+
+    /**
+     * @brief The indices of trap slots that are not owned by a command buffer.
+     */
+    std::vector<uint32_t> freeTrapSlots;
+
+    /**
+     * @brief The index of the trap slot owned by each command buffer.
+     */
+    std::unordered_map<VkCommandBuffer, uint32_t> commandBufferTrapSlots;
+
     /**
      * @brief State tracker for this device.
      */
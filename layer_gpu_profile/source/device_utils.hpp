@@ -28,19 +28,61 @@
 #include "device.hpp"
 
 #include <chrono>
+#include <limits>
 #include <thread>
 
 #include <vulkan/vulkan.h>
 
 /**
  * @brief Emit workaround sleep if needed.
+ *
+ * This is only needed for CSF GPUs running drivers older than r54p0.
+ *
+ * @param layer   The layer context for the device.
  */
-[[maybe_unused]] static void workaroundDelay()
-{
-    // We could make this conditional (enable if GPU is CSF and DDK < r54p0).
-    // However the profile is always going to be invasive, and it's quite a bit
-    // of added complexity to handle.
-    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+[[maybe_unused]] static void workaroundDelay(
+    Device& layer
+) {
+    if (layer.needsWorkaroundDelay)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+}
+
+/**
+ * @brief Read the values of the active counters from the last sample.
+ *
+ * Values are returned in the order of the active counter list, which is the
+ * order used by the counter schema. Counters that cannot be read are reported
+ * as NaN so that the remaining values stay aligned with the schema.
+ *
+ * @param layer    The layer context for the device.
+ * @param values   Storage for one value per active counter.
+ */
+[[maybe_unused]] static void readCounterValues(
+    Device& layer,
+    double* values
+) {
+    for (const auto& pair : layer.lgcActiveCounters)
+    {
+        hwcpipe::counter_sample sample;
+        auto ec = layer.lgcSampler->get_counter_value(pair.first, sample);
+        if (ec)
+        {
+            LAYER_ERR("Failed to get libGPUCounters GPU counter value");
+            *values = std::numeric_limits<double>::quiet_NaN();
+        }
+        else if (sample.type == hwcpipe::counter_sample::type::uint64)
+        {
+            *values = static_cast<double>(sample.value.uint64);
+        }
+        else
+        {
+            *values = sample.value.float64;
+        }
+
+        values++;
+    }
 }
 
 /**
@@ -64,17 +106,26 @@
         return;
     }
 
+    // Don't instrument workloads excluded by the trap filter. Each command
+    // buffer uses its own events, so traps on different queues can be
+    // serviced independently
+    ProfileTrapSlot slot {};
+    if (!layer.selectCPUTrap(commandBuffer, slot))
+    {
+        return;
+    }
+
     // Signal the gpuToCpu to wake the CPU to perform its operation
     layer.driver.vkCmdSetEvent(
         commandBuffer,
-        layer.gpuToCpuEvent,
+        slot.gpuToCpuEvent,
         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
 
     // Wait for cpuToGpu to wake the GPU after CPU has finished
     layer.driver.vkCmdWaitEvents(
         commandBuffer,
         1,
-        &layer.cpuToGpuEvent,
+        &slot.cpuToGpuEvent,
         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
         0, nullptr,
@@ -84,67 +135,6 @@
     // Reset cpuToGpu so it's ready to use again
     layer.driver.vkCmdResetEvent(
         commandBuffer,
-        layer.cpuToGpuEvent,
+        slot.cpuToGpuEvent,
         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
 }
-
-/**
- * @brief Perform the CPU-side wait for a CPU-side trap.
- *
- * Note: this relies on an undocumented extension supported by Arm GPUs, which
- * allows the CPU to set/wait/reset events in a command buffer after it has
- * been submitted to a queue.
- *
- * @param layer           The layer context for the device.
- */
-[[maybe_unused]] static void waitForGPU(
-    Device& layer
-) {
-    // Wait for gpuToCpu to wake the CPU after GPU has finished
-    while(true)
-    {
-        auto res = layer.driver.vkGetEventStatus(layer.device, layer.gpuToCpuEvent);
-        if (res == VK_EVENT_SET)
-        {
-            break;
-        }
-
-        if (res != VK_EVENT_RESET)
-        {
-            LAYER_LOG("Failed to wait for gpuToCpuEvent");
-        }
-
-        // Sleep before polling again
-        std::this_thread::sleep_for(std::chrono::microseconds(100));
-    }
-
-    // Reset gpuToCpu so it's ready to use again
-     auto res = layer.driver.vkResetEvent(layer.device, layer.gpuToCpuEvent);
-    if (res != VK_SUCCESS)
-    {
-        LAYER_LOG("Failed to reset gpuToCpuEvent");
-    }
-
-    // Sleep after event set to workaround counter sync errata on older drivers
-    workaroundDelay();
-}
-
-/**
- * @brief Perform the CPU-side notify of the GPU after a CPU-side trap.
- *
- * Note: this relies on an undocumented extension supported by Arm GPUs, which
- * allows the CPU to set/wait/reset events in a command buffer after it has
- * been submitted to a queue.
- *
- * @param layer           The layer context for the device.
- */
-[[maybe_unused]] static void notifyGPU(
-    Device& layer
-) {
-    // Signal cpuToGpu to wake the GPU to keep processing the command stream
-    auto res = layer.driver.vkSetEvent(layer.device, layer.cpuToGpuEvent);
-    if (res != VK_SUCCESS)
-    {
-        LAYER_LOG("Failed to notify cpuToGpuEvent");
-    }
-}
@@ -39,7 +39,7 @@ ProfileComms::ProfileComms(Comms::CommsInterface& _comms)
 }
 
 /* See header for documentation. */
-void ProfileComms::txMessage(const std::string& message)
+void ProfileComms::txMessage(Comms::MessageData&& message)
 {
     // Message endpoint is not available
     if (endpoint == 0)
@@ -47,6 +47,6 @@ void ProfileComms::txMessage(const std::string& message)
         return;
     }
 
-    auto data = std::make_unique<Comms::MessageData>(message.begin(), message.end());
+    auto data = std::make_unique<Comms::MessageData>(std::move(message));
     comms.txAsync(endpoint, std::move(data));
 }
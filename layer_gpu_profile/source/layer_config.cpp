@@ -29,12 +29,15 @@
  */
 
 #include "layer_config.hpp"
+#include "profile_counters.hpp"
 
 #include "framework/utils.hpp"
 #include "utils/misc.hpp"
 #include "version.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <vector>
 
@@ -83,6 +86,16 @@ void LayerConfig::parseSamplingOptions(const json& config)
     {
         samplingMode = COUNTER_SAMPLING_WORKLOADS;
     }
+    else if (rawSampleMode == "periodic")
+    {
+        samplingMode = COUNTER_SAMPLING_PERIODIC;
+        periodicSamplePeriod = config.at("periodic_sample_us");
+        if (periodicSamplePeriod == 0)
+        {
+            LAYER_ERR("Invalid periodic_sample_us: 0, using 1000");
+            periodicSamplePeriod = 1000;
+        }
+    }
     else
     {
         LAYER_ERR("Unknown sample_mode: %s", rawSampleMode.c_str());
@@ -115,11 +128,231 @@ void LayerConfig::parseSamplingOptions(const json& config)
     {
         LAYER_LOG(" - Frame serialization: %u", frameSerialization);
     }
+    else if (samplingMode == COUNTER_SAMPLING_PERIODIC)
+    {
+        LAYER_LOG(" - Sample period: %u us", periodicSamplePeriod);
+    }
+}
+
+/* See header for documentation. */
+void LayerConfig::parseTrapOptions(const json& config)
+{
+    trapSpinTime = config.at("trap_spin_us");
+    trapYieldTime = config.at("trap_yield_us");
+    trapSleepTime = config.at("trap_sleep_us");
+
+    LAYER_LOG("Layer workload trap configuration");
+    LAYER_LOG("=================================");
+    LAYER_LOG(" - Spin time: %u us", trapSpinTime);
+    LAYER_LOG(" - Yield time: %u us", trapYieldTime);
+    LAYER_LOG(" - Sleep time: %u us", trapSleepTime);
+}
+
+/* See header for documentation. */
+void LayerConfig::parseCounterOptions(const json& config)
+{
+    auto presets = config.at("counter_presets").get<std::vector<std::string>>();
+    auto names = config.at("counters").get<std::vector<std::string>>();
+    countersPerPass = config.at("counters_per_pass").get<uint32_t>();
+
+    counters.clear();
+
+    for (const auto& preset : presets)
+    {
+        if (!addCounterPreset(preset))
+        {
+            LAYER_ERR("Unknown counter preset: %s", preset.c_str());
+        }
+    }
+
+    for (const auto& name : names)
+    {
+        if (!addCounter(name))
+        {
+            LAYER_ERR("Unknown counter: %s", name.c_str());
+        }
+    }
+
+    if (counters.empty())
+    {
+        LAYER_ERR("No valid counters selected, using default preset");
+        addCounterPreset("default");
+    }
+
+    LAYER_LOG("Layer counter configuration");
+    LAYER_LOG("===========================");
+    for (const auto& name : counters)
+    {
+        LAYER_LOG(" - %s", name.c_str());
+    }
+
+    if (countersPerPass)
+    {
+        LAYER_LOG(" - Counters per pass: %u", countersPerPass);
+    }
+}
+
+/* See header for documentation. */
+bool LayerConfig::addCounterPreset(const std::string& name)
+{
+    const auto* preset = findProfileCounterPreset(name);
+    if (!preset)
+    {
+        return false;
+    }
+
+    for (const auto& counter : *preset)
+    {
+        addCounter(counter);
+    }
+
+    return true;
+}
+
+/* See header for documentation. */
+bool LayerConfig::addCounter(const std::string& name)
+{
+    if (!findProfileCounter(name))
+    {
+        return false;
+    }
+
+    // Presets may overlap, so only add each counter once
+    if (!isIn(name, counters))
+    {
+        counters.push_back(name);
+    }
+
+    return true;
+}
+
+/* See header for documentation. */
+void LayerConfig::parseDerivedMetricOptions(const json& config)
+{
+    const auto& rawMetrics = config.at("derived_metrics");
+    bool rawCounterConfig = config.at("raw_counters");
+
+    derivedMetrics.clear();
+    for (const auto& rawMetric : rawMetrics)
+    {
+        std::string name = rawMetric.at("name");
+        std::string expression = rawMetric.at("expression");
+
+        std::string error;
+        auto metric = ProfileDerivedMetric::parse(name, expression, error);
+        if (!metric)
+        {
+            LAYER_ERR("Invalid derived metric %s: %s", name.c_str(), error.c_str());
+            continue;
+        }
+
+        // Ensure that every counter used by the metric is sampled
+        for (const auto& counter : metric->getCounters())
+        {
+            addCounter(counter);
+        }
+
+        derivedMetrics.push_back(std::move(*metric));
+    }
+
+    // Raw values can only be omitted if there is something else to send
+    rawCounters = rawCounterConfig || derivedMetrics.empty();
+    if (!rawCounterConfig && derivedMetrics.empty())
+    {
+        LAYER_ERR("No valid derived metrics, sending raw counters");
+    }
+
+    LAYER_LOG("Layer derived metric configuration");
+    LAYER_LOG("==================================");
+    for (const auto& metric : derivedMetrics)
+    {
+        LAYER_LOG(" - %s", metric.getName().c_str());
+    }
+
+    LAYER_LOG(" - Raw counters: %s", rawCounters ? "enabled" : "disabled");
+}
+
+/* See header for documentation. */
+void LayerConfig::parseTrapFilterOptions(const json& config)
+{
+    std::string rawLabelRegex = config.at("trap_label_regex");
+    auto rawTypes = config.at("trap_workload_types").get<std::vector<std::string>>();
+    auto rawIndexRange = config.at("trap_index_range").get<std::vector<uint64_t>>();
+
+    trapLabelFilter = !rawLabelRegex.empty();
+    if (trapLabelFilter)
+    {
+        try
+        {
+            trapLabelRegex = std::regex(rawLabelRegex);
+        }
+        catch (const std::regex_error& e)
+        {
+            LAYER_ERR("Invalid trap_label_regex: %s", rawLabelRegex.c_str());
+            LAYER_ERR("Error: %s", e.what());
+            trapLabelFilter = false;
+            rawLabelRegex = "";
+        }
+    }
+
+    static const std::vector<std::pair<std::string, ProfileWorkloadType>> typeNames {
+        { "render_pass", ProfileWorkloadType::RENDER_PASS },
+        { "compute", ProfileWorkloadType::COMPUTE },
+        { "data_graph", ProfileWorkloadType::DATA_GRAPH },
+        { "trace_rays", ProfileWorkloadType::TRACE_RAYS },
+        { "image_transfer", ProfileWorkloadType::IMAGE_TRANSFER },
+        { "buffer_transfer", ProfileWorkloadType::BUFFER_TRANSFER },
+        { "as_build", ProfileWorkloadType::AS_BUILD },
+        { "as_transfer", ProfileWorkloadType::AS_TRANSFER },
+    };
+
+    trapWorkloadTypes.clear();
+    for (const auto& rawType : rawTypes)
+    {
+        auto it = std::find_if(typeNames.begin(), typeNames.end(),
+                               [&rawType](const auto& entry) { return entry.first == rawType; });
+        if (it == typeNames.end())
+        {
+            LAYER_ERR("Unknown trap workload type: %s", rawType.c_str());
+            continue;
+        }
+
+        trapWorkloadTypes.push_back(it->second);
+    }
+
+    if (rawIndexRange.size() == 2 && rawIndexRange[0] <= rawIndexRange[1])
+    {
+        trapMinIndex = rawIndexRange[0];
+        trapMaxIndex = rawIndexRange[1];
+    }
+    else if (!rawIndexRange.empty())
+    {
+        LAYER_ERR("Invalid trap_index_range, expected [min, max]");
+    }
+
+    LAYER_LOG("Layer workload trap filter configuration");
+    LAYER_LOG("========================================");
+    LAYER_LOG(" - Label regex: %s", trapLabelFilter ? rawLabelRegex.c_str() : "<all>");
+
+    std::stringstream result;
+    std::copy(rawTypes.begin(), rawTypes.end(), std::ostream_iterator<std::string>(result, " "));
+    LAYER_LOG(" - Workload types: %s", trapWorkloadTypes.empty() ? "<all>" : result.str().c_str());
+
+    if (trapMinIndex != 0 || trapMaxIndex != UINT64_MAX)
+    {
+        LAYER_LOG(" - Workload index range: %" PRIu64 " - %" PRIu64, trapMinIndex, trapMaxIndex);
+    }
+    else
+    {
+        LAYER_LOG(" - Workload index range: <all>");
+    }
 }
 
 /* See header for documentation. */
 LayerConfig::LayerConfig()
 {
+    addCounterPreset("default");
+
 #ifdef __ANDROID__
     std::string fileName("/data/local/tmp/");
     fileName.append(LGL_LAYER_CONFIG);
@@ -158,6 +391,46 @@ LayerConfig::LayerConfig()
         LAYER_ERR("Failed to read feature config, using defaults");
         LAYER_ERR("Error: %s", e.what());
     }
+
+    try
+    {
+        parseTrapOptions(data);
+    }
+    catch (const json::out_of_range& e)
+    {
+        LAYER_ERR("Failed to read trap config, using defaults");
+        LAYER_ERR("Error: %s", e.what());
+    }
+
+    try
+    {
+        parseCounterOptions(data);
+    }
+    catch (const json::out_of_range& e)
+    {
+        LAYER_ERR("Failed to read counter config, using defaults");
+        LAYER_ERR("Error: %s", e.what());
+    }
+
+    try
+    {
+        parseDerivedMetricOptions(data);
+    }
+    catch (const json::out_of_range& e)
+    {
+        LAYER_ERR("Failed to read derived metric config, using defaults");
+        LAYER_ERR("Error: %s", e.what());
+    }
+
+    try
+    {
+        parseTrapFilterOptions(data);
+    }
+    catch (const json::out_of_range& e)
+    {
+        LAYER_ERR("Failed to read trap filter config, using defaults");
+        LAYER_ERR("Error: %s", e.what());
+    }
 }
 
 /* See header for documentation. */
@@ -193,11 +466,22 @@ bool LayerConfig::isSamplingFrames() const
            samplingMode == COUNTER_SAMPLING_FRAMES;
 }
 
+/* See header for documentation. */
+bool LayerConfig::isSamplingPeriodic() const
+{
+    return samplingMode == COUNTER_SAMPLING_PERIODIC;
+}
+
 /* See header for documentation. */
 bool LayerConfig::isSamplingAny() const
 {
-    return frameMode != FRAME_SELECTION_DISABLED &&
-           samplingMode != COUNTER_SAMPLING_DISABLED;
+    return isSamplingWorkloads() || isSamplingFrames();
+}
+
+/* See header for documentation. */
+uint32_t LayerConfig::getPeriodicSamplePeriod() const
+{
+    return periodicSamplePeriod;
 }
 
 /* See header for documentation. */
@@ -206,3 +490,88 @@ bool LayerConfig::isSerializingFrames() const
     return isSamplingWorkloads() ||
            (isSamplingFrames() && frameSerialization);
 };
+
+/* See header for documentation. */
+uint32_t LayerConfig::getTrapSpinTime() const
+{
+    return trapSpinTime;
+}
+
+/* See header for documentation. */
+uint32_t LayerConfig::getTrapYieldTime() const
+{
+    return trapYieldTime;
+}
+
+/* See header for documentation. */
+uint32_t LayerConfig::getTrapSleepTime() const
+{
+    return trapSleepTime;
+}
+
+/* See header for documentation. */
+const std::vector<std::string>& LayerConfig::getCounters() const
+{
+    return counters;
+}
+
+/* See header for documentation. */
+uint32_t LayerConfig::getCountersPerPass() const
+{
+    return countersPerPass;
+}
+
+/* See header for documentation. */
+const std::vector<ProfileDerivedMetric>& LayerConfig::getDerivedMetrics() const
+{
+    return derivedMetrics;
+}
+
+/* See header for documentation. */
+bool LayerConfig::isStreamingRawCounters() const
+{
+    return rawCounters;
+}
+
+/* See header for documentation. */
+bool LayerConfig::isTrapFilterEnabled() const
+{
+    return trapLabelFilter ||
+           !trapWorkloadTypes.empty() ||
+           trapMinIndex != 0 ||
+           trapMaxIndex != UINT64_MAX;
+}
+
+/* See header for documentation. */
+bool LayerConfig::isTrapLabelFilterEnabled() const
+{
+    return trapLabelFilter;
+}
+
+/* See header for documentation. */
+bool LayerConfig::isTrapSelected(
+    ProfileWorkloadType type,
+    uint64_t index,
+    const std::vector<std::string>& labels
+) const {
+    if (index < trapMinIndex || index > trapMaxIndex)
+    {
+        return false;
+    }
+
+    if (!trapWorkloadTypes.empty() && !isIn(type, trapWorkloadTypes))
+    {
+        return false;
+    }
+
+    if (trapLabelFilter)
+    {
+        auto match = [this](const std::string& label) {
+            return std::regex_search(label, trapLabelRegex);
+        };
+
+        return std::any_of(labels.begin(), labels.end(), match);
+    }
+
+    return true;
+}
@@ -30,6 +30,14 @@
 
 #pragma once
 
+#include "profile_derived_metrics.hpp"
+#include "profile_sample_buffer.hpp"
+
+#include <cstdint>
+#include <regex>
+#include <string>
+#include <vector>
+
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
@@ -73,12 +81,29 @@ public:
     bool isSamplingFrames() const;
 
     /**
-     * @brief Test if any kind of sampling is active.
+     * @brief Test if we are sampling periodically in a background thread.
+     *
+     * Periodic sampling ignores frame selection, and samples for the whole
+     * lifetime of the device.
      *
-     * @return @c true if profiling, @c false otherwise.
+     * @return @c true if profiling periodically, @c false otherwise.
+     */
+    bool isSamplingPeriodic() const;
+
+    /**
+     * @brief Test if any kind of frame-based sampling is active.
+     *
+     * @return @c true if profiling workloads or frames, @c false otherwise.
      */
     bool isSamplingAny() const;
 
+    /**
+     * @brief Get the period for periodic sampling.
+     *
+     * @return The sampling period, in microseconds.
+     */
+    uint32_t getPeriodicSamplePeriod() const;
+
     /**
      * @brief Test if we are serializing frames.
      *
@@ -86,6 +111,86 @@ public:
      */
     bool isSerializingFrames() const;
 
+    /**
+     * @brief Get the time to busy-poll for a workload trap to trigger.
+     *
+     * @return The spin time, in microseconds.
+     */
+    uint32_t getTrapSpinTime() const;
+
+    /**
+     * @brief Get the time to poll with a thread yield after spinning.
+     *
+     * @return The yield time, in microseconds.
+     */
+    uint32_t getTrapYieldTime() const;
+
+    /**
+     * @brief Get the time to sleep between polls after yielding.
+     *
+     * @return The sleep time, in microseconds.
+     */
+    uint32_t getTrapSleepTime() const;
+
+    /**
+     * @brief Get the counters to sample.
+     *
+     * @return The libGPUCounters names of the selected counters.
+     */
+    const std::vector<std::string>& getCounters() const;
+
+    /**
+     * @brief Get the maximum number of counters to sample in each pass.
+     *
+     * @return The number of counters per pass, or zero to use a single pass.
+     */
+    uint32_t getCountersPerPass() const;
+
+    /**
+     * @brief Get the derived metrics to compute.
+     *
+     * @return The unbound derived metrics, in output order.
+     */
+    const std::vector<ProfileDerivedMetric>& getDerivedMetrics() const;
+
+    /**
+     * @brief Test if raw counter values are sent to the host.
+     *
+     * @return @c true if raw values are sent, @c false if only derived metric
+     *         values are sent.
+     */
+    bool isStreamingRawCounters() const;
+
+    /**
+     * @brief Test if workload traps are filtered.
+     *
+     * @return @c true if only selected workloads are trapped, @c false if all
+     *         workloads are trapped.
+     */
+    bool isTrapFilterEnabled() const;
+
+    /**
+     * @brief Test if workload traps are filtered by debug label.
+     *
+     * @return @c true if filtered by debug label, @c false otherwise.
+     */
+    bool isTrapLabelFilterEnabled() const;
+
+    /**
+     * @brief Test if a workload should be trapped.
+     *
+     * @param type     The coarse type of the workload.
+     * @param index    The index of the workload in the frame.
+     * @param labels   The debug labels of the workload. Only used if label
+     *                 filtering is enabled.
+     *
+     * @return @c true if the workload should be trapped, @c false otherwise.
+     */
+    bool isTrapSelected(
+        ProfileWorkloadType type,
+        uint64_t index,
+        const std::vector<std::string>& labels) const;
+
 private:
     /**
      * @brief Supported frame selection modes.
@@ -104,7 +209,8 @@ private:
     {
         COUNTER_SAMPLING_DISABLED,
         COUNTER_SAMPLING_WORKLOADS,
-        COUNTER_SAMPLING_FRAMES
+        COUNTER_SAMPLING_FRAMES,
+        COUNTER_SAMPLING_PERIODIC
     };
 
     /**
@@ -116,6 +222,60 @@ private:
      */
     void parseSamplingOptions(const json& config);
 
+    /**
+     * @brief Parse the configuration options for the workload trap module.
+     *
+     * @param config   The JSON configuration.
+     *
+     * @throws json::out_of_bounds if required fields are missing.
+     */
+    void parseTrapOptions(const json& config);
+
+    /**
+     * @brief Parse the configuration options for the counter selection.
+     *
+     * @param config   The JSON configuration.
+     *
+     * @throws json::out_of_bounds if required fields are missing.
+     */
+    void parseCounterOptions(const json& config);
+
+    /**
+     * @brief Add the counters from a preset to the counter selection.
+     *
+     * @param name   The preset name.
+     *
+     * @return @c true if the preset exists, @c false otherwise.
+     */
+    bool addCounterPreset(const std::string& name);
+
+    /**
+     * @brief Add a counter to the counter selection.
+     *
+     * @param name   The libGPUCounters counter name.
+     *
+     * @return @c true if the counter is known, @c false otherwise.
+     */
+    bool addCounter(const std::string& name);
+
+    /**
+     * @brief Parse the configuration options for the derived metrics.
+     *
+     * @param config   The JSON configuration.
+     *
+     * @throws json::out_of_bounds if required fields are missing.
+     */
+    void parseDerivedMetricOptions(const json& config);
+
+    /**
+     * @brief Parse the configuration options for the workload trap filters.
+     *
+     * @param config   The JSON configuration.
+     *
+     * @throws json::out_of_bounds if required fields are missing.
+     */
+    void parseTrapFilterOptions(const json& config);
+
     /**
      * @brief The frame selection mode.
      */
@@ -145,4 +305,69 @@ private:
      * @brief The sampling frame list, or empty if disabled.
      */
     std::vector<uint64_t> specificFrames;
+
+    /**
+     * @brief The periodic sampling period, in microseconds.
+     */
+    uint32_t periodicSamplePeriod {1000};
+
+    /**
+     * @brief The time to busy-poll for a trap, in microseconds.
+     */
+    uint32_t trapSpinTime {20};
+
+    /**
+     * @brief The time to poll with a thread yield for a trap, in microseconds.
+     */
+    uint32_t trapYieldTime {200};
+
+    /**
+     * @brief The time to sleep between polls for a trap, in microseconds.
+     */
+    uint32_t trapSleepTime {100};
+
+    /**
+     * @brief The selected counters, in sampling order.
+     */
+    std::vector<std::string> counters;
+
+    /**
+     * @brief The maximum number of counters per pass, or zero if unlimited.
+     */
+    uint32_t countersPerPass {0};
+
+    /**
+     * @brief The derived metrics, in output order.
+     */
+    std::vector<ProfileDerivedMetric> derivedMetrics;
+
+    /**
+     * @brief Are raw counter values sent to the host?
+     */
+    bool rawCounters {true};
+
+    /**
+     * @brief Is the workload trap label filter enabled?
+     */
+    bool trapLabelFilter {false};
+
+    /**
+     * @brief The workload trap label filter, if enabled.
+     */
+    std::regex trapLabelRegex;
+
+    /**
+     * @brief The workload types to trap, or empty if all types are trapped.
+     */
+    std::vector<ProfileWorkloadType> trapWorkloadTypes;
+
+    /**
+     * @brief The first workload index to trap (inclusive).
+     */
+    uint64_t trapMinIndex {0};
+
+    /**
+     * @brief The last workload index to trap (inclusive).
+     */
+    uint64_t trapMaxIndex {UINT64_MAX};
 };
@@ -118,6 +118,7 @@ VKAPI_ATTR void VKAPI_CALL layer_vkFreeCommandBuffers<user_tag>(VkDevice device,
     for (uint32_t i = 0; i < commandBufferCount; i++)
     {
         tracker.freeCommandBuffer(commandPool, pCommandBuffers[i]);
+        layer->releaseTrapSlot(pCommandBuffers[i]);
     }
 
     // Release the lock to call into the driver
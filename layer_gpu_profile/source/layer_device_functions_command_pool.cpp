@@ -91,6 +91,13 @@ VKAPI_ATTR void VKAPI_CALL layer_vkDestroyCommandPool<user_tag>(VkDevice device,
     auto* layer = Device::retrieve(device);
 
     auto& tracker = layer->getStateTracker();
+
+    // Command buffers are implicitly freed with the pool
+    for (const auto& [commandBuffer, trackCB] : tracker.getCommandPool(commandPool).getCommandBuffers())
+    {
+        layer->releaseTrapSlot(commandBuffer);
+    }
+
     tracker.destroyCommandPool(commandPool);
 
     // Release the lock to call into the driver
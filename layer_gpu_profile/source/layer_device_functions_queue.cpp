@@ -25,18 +25,17 @@
 
 #include "device.hpp"
 #include "device_utils.hpp"
+#include "profile_protobuf_encoder.hpp"
 #include "submit_visitor.hpp"
 
 #include "framework/device_dispatch_table.hpp"
 #include "trackers/queue.hpp"
 
-#include <nlohmann/json.hpp>
 #include <mutex>
 #include <time.h>
+#include <vector>
 #include <vulkan/utility/vk_struct_helper.hpp>
 
-using json = nlohmann::json;
-
 extern std::mutex g_vulkanLock;
 
 /**
@@ -61,11 +60,12 @@ static void processLayerCommandStream(Device& layer,
     auto& trackQueue = tracker.getQueue(queue);
     auto& trackCB = tracker.getCommandBuffer(commandBuffer);
 
-    // Play the layer command stream
+    // Play the layer command stream, queuing traps for the trap scheduler
     ProfileSubmitVisitor workloadVisitor(layer);
 
     const auto& cbLCS = trackCB.getSubmitCommandStream();
     trackQueue.runSubmitCommandStream(cbLCS, workloadVisitor);
+    workloadVisitor.flushUntrappedWorkloads();
 }
 
 /**
@@ -80,28 +80,31 @@ static void processFrameBoundaryPreSubmit(
     auto& tracker = layer.getStateTracker();
     tracker.queuePresent();
 
-    // End the previous frame if it was "of interest"
+    uint64_t frameID = tracker.totalStats.getFrameCount();
+    layer.currentFrameID.store(frameID, std::memory_order_relaxed);
+
+    // End the previous frame if it was "of interest", once all of its traps
+    // have been serviced
     if (layer.isFrameOfInterest && config.isSamplingWorkloads())
     {
-        json endFrameMessage {
-            { "type", "end_frame" }
-        };
-
-        layer.txMessage(endFrameMessage.dump());
+        layer.trapScheduler->drain();
+        ProfileProtobufEncoder::emitEndFrame(layer, frameID - 1, layer.workloadSamples);
     }
 
-    uint64_t frameID = tracker.totalStats.getFrameCount();
     layer.isFrameOfInterest = layer.instance->config.isFrameOfInterest(frameID);
 
+    // Cycle through the counter passes on consecutive frames of interest
+    if (layer.isFrameOfInterest)
+    {
+        layer.frameCounterPass = layer.frameOfInterestCount % layer.lgcCounterPasses.size();
+        layer.frameOfInterestCount++;
+    }
+
     // Start the next frame if it is "of interest"
     if (layer.isFrameOfInterest && config.isSamplingWorkloads())
     {
-        json startFrameMessage {
-            { "type", "start_frame" },
-            { "frame", frameID },
-        };
-
-        layer.txMessage(startFrameMessage.dump());
+        layer.resetFrameState();
+        ProfileProtobufEncoder::emitStartFrame(layer, frameID);
     }
 }
 
@@ -142,12 +145,18 @@ static void processFrameBoundaryPostSubmit(
 ) {
     const auto& config = layer.instance->config;
 
+    // Ensure the trap scheduler has finished with the counter sampler
+    if (layer.trapScheduler)
+    {
+        layer.trapScheduler->drain();
+    }
+
     // If we are measuring performance ensure the previous frame has finished
     // and then take an initial sample to reset the counters
     if (config.isSerializingFrames())
     {
-        layer.driver.vkDeviceWaitIdle(layer.device);
-        workaroundDelay();
+        layer.waitForActiveQueues();
+        workaroundDelay(layer);
     }
 
     auto ec = layer.lgcSampler->sample_now();
@@ -156,56 +165,32 @@ static void processFrameBoundaryPostSubmit(
         LAYER_ERR("Failed to make libGPUCounters GPU counter sample");
     }
 
-    // No sample data needed - just use it to reset the counters
-    if (!frameSample)
+    // Emit a frame sample data packet, otherwise sample just resets counters
+    if (frameSample)
     {
-        return;
-    }
+        auto& tracker = layer.getStateTracker();
 
-    // Otherwise emit a frame sample data packet
-    auto& tracker = layer.getStateTracker();
-
-    // Frame count has already been incremented for next frame so decrement
-    // for reporting purposes
-    uint64_t frameID = tracker.totalStats.getFrameCount() - 1;
+        // Frame count has already been incremented for next frame so
+        // decrement for reporting purposes
+        uint64_t frameID = tracker.totalStats.getFrameCount() - 1;
 
-    json message {
-        { "type", "frame" },
-        { "frame", frameID },
-        { "counters", json::array() }
-    };
+        std::vector<double> values(layer.lgcActiveCounters.size());
+        readCounterValues(layer, values.data());
+        ProfileProtobufEncoder::emitFrameSample(layer, frameID, values);
+    }
 
-    for (const auto& pair : layer.lgcActiveCounters)
+    // Switch counter pass if the next frame uses a different pass, and take
+    // another sample to reset the counters of the new sampler
+    if (layer.isFrameOfInterest && layer.frameCounterPass != layer.lgcCounterPass)
     {
-        hwcpipe::counter_sample sample;
-        ec = layer.lgcSampler->get_counter_value(pair.first, sample);
-        if (ec)
-        {
-            LAYER_ERR("Failed to get libGPUCounters GPU counter value");
-            continue;
-        }
-
-        if (sample.type == hwcpipe::counter_sample::type::uint64)
-        {
-            json counter {
-                { pair.second, sample.value.uint64 },
-            };
-
-            message["counters"].push_back(counter);
+        layer.selectCounterPass(layer.frameCounterPass);
 
-        }
-        else
+        ec = layer.lgcSampler->sample_now();
+        if (ec)
         {
-            json counter {
-                { pair.second, sample.value.float64 },
-            };
-
-            message["counters"].push_back(counter);
-
+            LAYER_ERR("Failed to make libGPUCounters GPU counter sample");
         }
     }
-
-    layer.txMessage(message.dump());
 }
 
 /* See Vulkan API for documentation. */
@@ -226,6 +211,9 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueuePresentKHR<user_tag>(VkQueue queue,
 
     bool resetThisFrame = layer->isFrameOfInterest && config.isSamplingAny();
 
+    // Track queues with work so frame isolation only waits for them
+    layer->markQueueActive(queue);
+
     // If a "normal" frame then release the lock before calling in to the
     // driver, otherwise keep the lock to stop other threads using Vulkan
     // while we sync and reset the counter stream
@@ -266,6 +254,9 @@ VKAPI_ATTR VkResult VKAPI_CALL
     sampleLastFrame = isFrameEnd && sampleLastFrame;
     bool resetThisFrame = isFrameEnd && layer->isFrameOfInterest && config.isSamplingAny();
 
+    // Track queues with work so frame isolation only waits for them
+    layer->markQueueActive(queue);
+
     // If a "normal" frame then release the lock before calling in to the
     // driver, otherwise keep the lock to stop other threads using Vulkan
     // while we sync and reset the counter stream
@@ -274,6 +265,9 @@ VKAPI_ATTR VkResult VKAPI_CALL
         lock.unlock();
     }
 
+    // Count submits so periodic samples can be aligned with the workload
+    layer->queueSubmitCount.fetch_add(1, std::memory_order_relaxed);
+
     auto res = layer->driver.vkQueueSubmit(queue, submitCount, pSubmits, fence);
     if (res != VK_SUCCESS)
     {
@@ -324,6 +318,9 @@ VKAPI_ATTR VkResult VKAPI_CALL
     sampleLastFrame = isFrameEnd && sampleLastFrame;
     bool resetThisFrame = isFrameEnd && layer->isFrameOfInterest && config.isSamplingAny();
 
+    // Track queues with work so frame isolation only waits for them
+    layer->markQueueActive(queue);
+
     // If a "normal" frame then release the lock before calling in to the
     // driver, otherwise keep the lock to stop other threads using Vulkan
     // while we sync and reset the counter stream
@@ -332,6 +329,9 @@ VKAPI_ATTR VkResult VKAPI_CALL
         lock.unlock();
     }
 
+    // Count submits so periodic samples can be aligned with the workload
+    layer->queueSubmitCount.fetch_add(1, std::memory_order_relaxed);
+
     auto res = layer->driver.vkQueueSubmit2(queue, submitCount, pSubmits, fence);
     if (res != VK_SUCCESS)
     {
@@ -382,6 +382,9 @@ VKAPI_ATTR VkResult VKAPI_CALL
     sampleLastFrame = isFrameEnd && sampleLastFrame;
     bool resetThisFrame = isFrameEnd && layer->isFrameOfInterest && config.isSamplingAny();
 
+    // Track queues with work so frame isolation only waits for them
+    layer->markQueueActive(queue);
+
     // If a "normal" frame then release the lock before calling in to the
     // driver, otherwise keep the lock to stop other threads using Vulkan
     // while we sync and reset the counter stream
@@ -390,6 +393,9 @@ VKAPI_ATTR VkResult VKAPI_CALL
         lock.unlock();
     }
 
+    // Count submits so periodic samples can be aligned with the workload
+    layer->queueSubmitCount.fetch_add(1, std::memory_order_relaxed);
+
     auto res = layer->driver.vkQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
     if (res != VK_SUCCESS)
     {
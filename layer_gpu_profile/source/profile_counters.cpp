@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines the catalog of performance counters that the layer can sample, and
+ * the named counter presets that can be selected in the layer config.
+ */
+
+#include "profile_counters.hpp"
+
+#include <unordered_map>
+
+/**
+ * @brief Helper to build a catalog entry using the counter enum name as key.
+ */
+#define PROFILE_COUNTER(id, name) { id, #id, name }
+
+/**
+ * @brief The catalog of counters the layer can sample.
+ *
+ * Not all of these are available on all GPUs. Counters that are not available
+ * are dropped when the sampler is configured.
+ */
+static const std::vector<ProfileCounter> profileCounters {
+    // Queue cycles
+    PROFILE_COUNTER(MaliCompQueueActiveCy, "Compute queue active cycles"),
+    PROFILE_COUNTER(MaliVertQueueActiveCy, "Vertex queue active cycles"),
+    PROFILE_COUNTER(MaliBinningQueueActiveCy, "Binning phase queue active cycles"),
+    PROFILE_COUNTER(MaliNonFragQueueActiveCy, "Non-fragment queue active cycles"),
+    PROFILE_COUNTER(MaliFragQueueActiveCy, "Fragment queue active cycles"),
+    PROFILE_COUNTER(MaliMainQueueActiveCy, "Main phase queue active cycles"),
+
+    // External bandwidth
+    PROFILE_COUNTER(MaliExtBusRdBy, "External read bytes"),
+    PROFILE_COUNTER(MaliExtBusWrBy, "External write bytes"),
+
+    // Primitive counts
+    PROFILE_COUNTER(MaliGeomTotalPrim, "Input primitives"),
+    PROFILE_COUNTER(MaliGeomVisiblePrim, "Visible primitives"),
+
+    // Thread counts
+    PROFILE_COUNTER(MaliNonFragThread, "Non-fragment threads"),
+    PROFILE_COUNTER(MaliFragThread, "Fragment threads"),
+
+    // Functional unit counters
+    // TODO HIVE-1307: Currently libGPUCounters doesn't expose a MaliALUIssueCy
+    // counter, so we use instruction counts as a measure of relative
+    // arithmetic complexity across workloads, but note that it is not directly
+    // comparable with the other "* unit cycles" counters.
+    PROFILE_COUNTER(MaliEngInstr, "Arithmetic unit instructions"),
+    PROFILE_COUNTER(MaliEngFMAInstr, "Arithmetic unit FMA instructions"),
+    PROFILE_COUNTER(MaliEngCVTInstr, "Arithmetic unit CVT instructions"),
+    PROFILE_COUNTER(MaliEngSFUInstr, "Arithmetic unit SFU instructions"),
+    PROFILE_COUNTER(MaliVarIssueCy, "Varying unit cycles"),
+    PROFILE_COUNTER(MaliTexIssueCy, "Texture unit cycles"),
+    PROFILE_COUNTER(MaliLSIssueCy, "Load/store unit cycles"),
+};
+
+/**
+ * @brief The named counter presets.
+ */
+static const std::unordered_map<std::string, std::vector<std::string>> profileCounterPresets {
+    { "queue_occupancy", {
+        "MaliCompQueueActiveCy",
+        "MaliVertQueueActiveCy",
+        "MaliBinningQueueActiveCy",
+        "MaliNonFragQueueActiveCy",
+        "MaliFragQueueActiveCy",
+        "MaliMainQueueActiveCy",
+    }},
+    { "bandwidth", {
+        "MaliExtBusRdBy",
+        "MaliExtBusWrBy",
+    }},
+    { "geometry", {
+        "MaliGeomTotalPrim",
+        "MaliGeomVisiblePrim",
+        "MaliNonFragThread",
+    }},
+    { "shader_core", {
+        "MaliNonFragThread",
+        "MaliFragThread",
+        "MaliEngInstr",
+        "MaliEngFMAInstr",
+        "MaliEngCVTInstr",
+        "MaliEngSFUInstr",
+        "MaliVarIssueCy",
+        "MaliTexIssueCy",
+        "MaliLSIssueCy",
+    }},
+};
+
+/* See header for documentation. */
+const ProfileCounter* findProfileCounter(
+    const std::string& key
+) {
+    for (const auto& counter : profileCounters)
+    {
+        if (key == counter.key)
+        {
+            return &counter;
+        }
+    }
+
+    return nullptr;
+}
+
+/* See header for documentation. */
+const std::vector<std::string>* findProfileCounterPreset(
+    const std::string& name
+) {
+    // The default preset is every counter in the catalog
+    if (name == "default")
+    {
+        static const std::vector<std::string> defaultPreset = []() {
+            std::vector<std::string> keys;
+            for (const auto& counter : profileCounters)
+            {
+                keys.emplace_back(counter.key);
+            }
+            return keys;
+        }();
+
+        return &defaultPreset;
+    }
+
+    auto it = profileCounterPresets.find(name);
+    if (it == profileCounterPresets.end())
+    {
+        return nullptr;
+    }
+
+    return &it->second;
+}
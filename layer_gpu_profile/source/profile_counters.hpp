@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the catalog of performance counters that the layer can sample, and
+ * the named counter presets that can be selected in the layer config.
+ *
+ * Role summary
+ * ============
+ *
+ * Sampling counters costs sampling bandwidth and time in each workload trap,
+ * so users select only the counters needed for an investigation. Counters are
+ * selected by their libGPUCounters name, e.g. "MaliExtBusRdBy", or by preset
+ * name. Counters in the catalog that are not available on the current GPU are
+ * dropped when the sampler is configured.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <hwcpipe/hwcpipe_counter.h>
+
+/**
+ * @brief A counter that the layer can sample.
+ */
+struct ProfileCounter
+{
+    /**
+     * @brief The libGPUCounters counter ID.
+     */
+    hwcpipe_counter id;
+
+    /**
+     * @brief The libGPUCounters counter name, used in the layer config.
+     */
+    const char* key;
+
+    /**
+     * @brief The human-readable counter name, used in the output data.
+     */
+    const char* name;
+};
+
+/**
+ * @brief Find a counter in the catalog.
+ *
+ * @param key   The libGPUCounters counter name.
+ *
+ * @return The counter, or @c nullptr if not in the catalog.
+ */
+const ProfileCounter* findProfileCounter(
+    const std::string& key);
+
+/**
+ * @brief Find a counter preset.
+ *
+ * @param name   The preset name.
+ *
+ * @return The list of counter keys in the preset, or @c nullptr if no preset
+ *         exists with this name.
+ */
+const std::vector<std::string>* findProfileCounterPreset(
+    const std::string& name);
@@ -0,0 +1,480 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines the expression engine used to compute derived metrics from counter
+ * samples in the layer.
+ */
+
+#include "profile_derived_metrics.hpp"
+#include "profile_counters.hpp"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+/**
+ * @brief Recursive descent parser for derived metric expressions.
+ *
+ * Grammar:
+ *
+ *     expression := term (('+' | '-') term)*
+ *     term       := unary (('*' | '/') unary)*
+ *     unary      := '-' unary | primary
+ *     primary    := number | counter | '(' expression ')'
+ */
+class ProfileExpressionParser
+{
+public:
+    /**
+     * @brief Create a new parser.
+     *
+     * @param expression   The expression to parse.
+     * @param _metric      The metric to append the program to.
+     * @param _error       Storage for the error message on failure.
+     */
+    ProfileExpressionParser(
+        const std::string& expression,
+        ProfileDerivedMetric& _metric,
+        std::string& _error)
+        : text(expression),
+          metric(_metric),
+          error(_error)
+    {
+    }
+
+    /**
+     * @brief Parse the expression.
+     *
+     * @return @c true on success, @c false on error.
+     */
+    bool parse()
+    {
+        if (!parseExpression())
+        {
+            return false;
+        }
+
+        skipSpace();
+        if (position != text.size())
+        {
+            return fail("unexpected character");
+        }
+
+        return true;
+    }
+
+private:
+    using OpCode = ProfileDerivedMetric::OpCode;
+
+    /**
+     * @brief Parse an additive expression.
+     */
+    bool parseExpression()
+    {
+        if (!parseTerm())
+        {
+            return false;
+        }
+
+        while (true)
+        {
+            skipSpace();
+            if (accept('+'))
+            {
+                if (!parseTerm())
+                {
+                    return false;
+                }
+
+                emit(OpCode::ADD);
+            }
+            else if (accept('-'))
+            {
+                if (!parseTerm())
+                {
+                    return false;
+                }
+
+                emit(OpCode::SUBTRACT);
+            }
+            else
+            {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Parse a multiplicative expression.
+     */
+    bool parseTerm()
+    {
+        if (!parseUnary())
+        {
+            return false;
+        }
+
+        while (true)
+        {
+            skipSpace();
+            if (accept('*'))
+            {
+                if (!parseUnary())
+                {
+                    return false;
+                }
+
+                emit(OpCode::MULTIPLY);
+            }
+            else if (accept('/'))
+            {
+                if (!parseUnary())
+                {
+                    return false;
+                }
+
+                emit(OpCode::DIVIDE);
+            }
+            else
+            {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Parse a unary expression.
+     */
+    bool parseUnary()
+    {
+        skipSpace();
+        if (accept('-'))
+        {
+            if (!parseUnary())
+            {
+                return false;
+            }
+
+            emit(OpCode::NEGATE);
+            return true;
+        }
+
+        return parsePrimary();
+    }
+
+    /**
+     * @brief Parse a number, counter, or parenthesized expression.
+     */
+    bool parsePrimary()
+    {
+        skipSpace();
+        if (position == text.size())
+        {
+            return fail("unexpected end of expression");
+        }
+
+        if (accept('('))
+        {
+            if (!parseExpression())
+            {
+                return false;
+            }
+
+            skipSpace();
+            if (!accept(')'))
+            {
+                return fail("expected ')'");
+            }
+
+            return true;
+        }
+
+        char ch = text[position];
+        if (std::isdigit(static_cast<unsigned char>(ch)) || ch == '.')
+        {
+            const char* start = text.c_str() + position;
+            char* end = nullptr;
+            double value = std::strtod(start, &end);
+            if (end == start)
+            {
+                return fail("invalid number");
+            }
+
+            position += static_cast<size_t>(end - start);
+
+            ProfileDerivedMetric::Instruction instruction {OpCode::CONSTANT};
+            instruction.value = value;
+            metric.program.push_back(instruction);
+            return true;
+        }
+
+        if (std::isalpha(static_cast<unsigned char>(ch)) || ch == '_')
+        {
+            size_t start = position;
+            while (position < text.size() &&
+                   (std::isalnum(static_cast<unsigned char>(text[position])) || text[position] == '_'))
+            {
+                position++;
+            }
+
+            std::string key = text.substr(start, position - start);
+            const auto* counter = findProfileCounter(key);
+            if (!counter)
+            {
+                position = start;
+                return fail("unknown counter " + key);
+            }
+
+            ProfileDerivedMetric::Instruction instruction {OpCode::COUNTER};
+            instruction.counter = counter;
+            metric.program.push_back(instruction);
+            return true;
+        }
+
+        return fail("unexpected character");
+    }
+
+    /**
+     * @brief Skip any whitespace at the current position.
+     */
+    void skipSpace()
+    {
+        while (position < text.size() &&
+               std::isspace(static_cast<unsigned char>(text[position])))
+        {
+            position++;
+        }
+    }
+
+    /**
+     * @brief Consume a character if it is at the current position.
+     */
+    bool accept(char ch)
+    {
+        if (position < text.size() && text[position] == ch)
+        {
+            position++;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Append an operator instruction to the program.
+     */
+    void emit(OpCode op)
+    {
+        metric.program.push_back({op});
+    }
+
+    /**
+     * @brief Record a parse error at the current position.
+     */
+    bool fail(const std::string& message)
+    {
+        error = message + " at offset " + std::to_string(position);
+        return false;
+    }
+
+    /**
+     * @brief The expression text.
+     */
+    const std::string& text;
+
+    /**
+     * @brief The metric to append the program to.
+     */
+    ProfileDerivedMetric& metric;
+
+    /**
+     * @brief Storage for the error message on failure.
+     */
+    std::string& error;
+
+    /**
+     * @brief The current parse position.
+     */
+    size_t position {0};
+};
+
+/* See header for documentation. */
+std::optional<ProfileDerivedMetric> ProfileDerivedMetric::parse(
+    const std::string& name,
+    const std::string& expression,
+    std::string& error
+) {
+    ProfileDerivedMetric metric;
+    metric.name = name;
+
+    ProfileExpressionParser parser(expression, metric, error);
+    if (!parser.parse())
+    {
+        return std::nullopt;
+    }
+
+    return metric;
+}
+
+/* See header for documentation. */
+std::optional<ProfileDerivedMetric> ProfileDerivedMetric::bind(
+    const std::vector<std::pair<hwcpipe_counter, std::string>>& counters
+) const {
+    ProfileDerivedMetric bound = *this;
+
+    for (auto& instruction : bound.program)
+    {
+        if (instruction.op != OpCode::COUNTER)
+        {
+            continue;
+        }
+
+        bool found = false;
+        for (size_t i = 0; i < counters.size(); i++)
+        {
+            if (counters[i].first == instruction.counter->id)
+            {
+                instruction.index = i;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return bound;
+}
+
+/* See header for documentation. */
+double ProfileDerivedMetric::evaluate(
+    const double* values,
+    std::vector<double>& stack
+) const {
+    stack.clear();
+
+    for (const auto& instruction : program)
+    {
+        if (instruction.op == OpCode::CONSTANT)
+        {
+            stack.push_back(instruction.value);
+            continue;
+        }
+
+        if (instruction.op == OpCode::COUNTER)
+        {
+            stack.push_back(values[instruction.index]);
+            continue;
+        }
+
+        if (instruction.op == OpCode::NEGATE)
+        {
+            stack.back() = -stack.back();
+            continue;
+        }
+
+        // Parser guarantees that binary operators have two operands
+        double rhs = stack.back();
+        stack.pop_back();
+        double& lhs = stack.back();
+
+        switch (instruction.op)
+        {
+        case OpCode::ADD:
+            lhs = lhs + rhs;
+            break;
+        case OpCode::SUBTRACT:
+            lhs = lhs - rhs;
+            break;
+        case OpCode::MULTIPLY:
+            lhs = lhs * rhs;
+            break;
+        case OpCode::DIVIDE:
+            lhs = (rhs == 0.0) ? std::numeric_limits<double>::quiet_NaN() : lhs / rhs;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return stack.back();
+}
+
+/* See header for documentation. */
+std::vector<std::string> ProfileDerivedMetric::getCounters() const
+{
+    std::vector<std::string> counters;
+    for (const auto& instruction : program)
+    {
+        if (instruction.op == OpCode::COUNTER)
+        {
+            counters.push_back(instruction.counter->key);
+        }
+    }
+
+    return counters;
+}
+
+/* See header for documentation. */
+std::vector<double> applyDerivedMetrics(
+    const std::vector<ProfileDerivedMetric>& metrics,
+    bool keepRaw,
+    size_t counterCount,
+    const std::vector<double>& values
+) {
+    if (metrics.empty() || counterCount == 0)
+    {
+        return keepRaw ? values : std::vector<double>();
+    }
+
+    size_t sampleCount = values.size() / counterCount;
+    size_t outputCount = (keepRaw ? counterCount : 0) + metrics.size();
+
+    std::vector<double> result;
+    result.reserve(sampleCount * outputCount);
+
+    std::vector<double> stack;
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        const double* sample = values.data() + i * counterCount;
+        if (keepRaw)
+        {
+            result.insert(result.end(), sample, sample + counterCount);
+        }
+
+        for (const auto& metric : metrics)
+        {
+            result.push_back(metric.evaluate(sample, stack));
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the expression engine used to compute derived metrics from counter
+ * samples in the layer.
+ *
+ * Role summary
+ * ============
+ *
+ * Derived metrics are arithmetic expressions over counter values, configured
+ * in the layer config, for example bytes per pixel:
+ *
+ *     (MaliExtBusRdBy + MaliExtBusWrBy) / MaliFragThread
+ *
+ * Expressions support numeric constants, counters named using their
+ * libGPUCounters name, the binary operators +, -, *, and /, unary negation,
+ * and parentheses. Division by zero returns NaN.
+ *
+ * Expressions are parsed once, when the config is loaded, into a postfix
+ * program that references counters by ID. Before use the program is bound to
+ * the counter order of a sampling pass, so evaluating a metric for a sample is
+ * a single pass over the program with no lookups.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hwcpipe/hwcpipe_counter.h>
+
+struct ProfileCounter;
+
+/**
+ * @brief A derived metric computed from counter values.
+ */
+class ProfileDerivedMetric
+{
+public:
+    /**
+     * @brief Parse a derived metric expression.
+     *
+     * @param name         The metric name, used in the output data.
+     * @param expression   The expression to parse.
+     * @param error        Storage for the error message on failure.
+     *
+     * @return The unbound metric, or @c std::nullopt if the expression is
+     *         not valid.
+     */
+    static std::optional<ProfileDerivedMetric> parse(
+        const std::string& name,
+        const std::string& expression,
+        std::string& error);
+
+    /**
+     * @brief Bind this metric to the counter order of a sampling pass.
+     *
+     * @param counters   The counters in the pass, in sample order.
+     *
+     * @return The bound metric, or @c std::nullopt if any counter used by the
+     *         metric is not in the pass.
+     */
+    std::optional<ProfileDerivedMetric> bind(
+        const std::vector<std::pair<hwcpipe_counter, std::string>>& counters) const;
+
+    /**
+     * @brief Evaluate a bound metric for a single sample.
+     *
+     * @param values   The counter values of the sample, in pass order.
+     * @param stack    Scratch storage for the evaluation stack.
+     *
+     * @return The metric value, or NaN if it cannot be computed.
+     */
+    double evaluate(
+        const double* values,
+        std::vector<double>& stack) const;
+
+    /**
+     * @brief Get the metric name.
+     */
+    const std::string& getName() const { return name; }
+
+    /**
+     * @brief Get the counters used by the metric.
+     *
+     * @return The libGPUCounters names of the counters.
+     */
+    std::vector<std::string> getCounters() const;
+
+private:
+    /**
+     * @brief The type of an instruction in the postfix program.
+     */
+    enum class OpCode
+    {
+        CONSTANT,
+        COUNTER,
+        NEGATE,
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        DIVIDE
+    };
+
+    /**
+     * @brief An instruction in the postfix program.
+     */
+    struct Instruction
+    {
+        /**
+         * @brief The instruction type.
+         */
+        OpCode op;
+
+        /**
+         * @brief The value, for CONSTANT instructions.
+         */
+        double value {0.0};
+
+        /**
+         * @brief The counter, for COUNTER instructions.
+         */
+        const ProfileCounter* counter {nullptr};
+
+        /**
+         * @brief The index of the counter in the sample, once bound.
+         */
+        size_t index {0};
+    };
+
+    /**
+     * @brief The recursive descent parser used to build the program.
+     */
+    friend class ProfileExpressionParser;
+
+    /**
+     * @brief The metric name.
+     */
+    std::string name;
+
+    /**
+     * @brief The postfix program.
+     */
+    std::vector<Instruction> program;
+};
+
+/**
+ * @brief Apply derived metrics to a set of counter samples.
+ *
+ * @param metrics        The bound derived metrics.
+ * @param keepRaw        Should the raw counter values be kept?
+ * @param counterCount   The number of counter values in each sample.
+ * @param values         The counter values, in sample and then pass order.
+ *
+ * @return For each sample the raw counter values, if kept, followed by the
+ *         derived metric values.
+ */
+std::vector<double> applyDerivedMetrics(
+    const std::vector<ProfileDerivedMetric>& metrics,
+    bool keepRaw,
+    size_t counterCount,
+    const std::vector<double>& values);
@@ -0,0 +1,168 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Implements the background thread used for periodic counter sampling.
+ */
+
+#include "profile_periodic_sampler.hpp"
+
+#include "device.hpp"
+#include "device_utils.hpp"
+#include "framework/utils.hpp"
+#include "profile_protobuf_encoder.hpp"
+
+#include <chrono>
+
+/* See header for documentation. */
+ProfilePeriodicSampler::ProfilePeriodicSampler(
+    Device& _device,
+    uint32_t _periodUS
+) :
+    device(_device),
+    periodUS(_periodUS)
+{
+    size_t counterCount = device.lgcActiveCounters.size();
+    block.timestamps.reserve(PERIODIC_SAMPLE_BLOCK_SIZE);
+    block.frameIDs.reserve(PERIODIC_SAMPLE_BLOCK_SIZE);
+    block.submitIDs.reserve(PERIODIC_SAMPLE_BLOCK_SIZE);
+    block.values.reserve(PERIODIC_SAMPLE_BLOCK_SIZE * counterCount);
+
+    // Create and start a worker thread
+    worker = std::thread(&ProfilePeriodicSampler::runSampler, this);
+}
+
+/* See header for documentation. */
+ProfilePeriodicSampler::~ProfilePeriodicSampler()
+{
+    // Stop the worker thread if it's not stopped already
+    if (!stopRequested)
+    {
+        stop();
+    }
+}
+
+/* See header for documentation. */
+void ProfilePeriodicSampler::stop()
+{
+    // Mark the sampler as stopping, and wake the worker if it is sleeping
+    {
+        std::lock_guard<std::mutex> lock {stopLock};
+        stopRequested = true;
+    }
+
+    stopCondition.notify_one();
+
+    // Join on the worker thread
+    worker.join();
+}
+
+/* See header for documentation. */
+void ProfilePeriodicSampler::runSampler()
+{
+    using clock = std::chrono::steady_clock;
+
+    auto period = std::chrono::microseconds(periodUS);
+    auto startTime = clock::now();
+    auto nextTime = startTime;
+
+    // Take an initial sample to reset the counters
+    auto ec = device.lgcSampler->sample_now();
+    if (ec)
+    {
+        LAYER_ERR("Failed to make libGPUCounters GPU counter sample");
+    }
+
+    while (true)
+    {
+        // Use absolute deadlines so that the sampling rate does not drift,
+        // but skip any periods that were missed rather than bursting
+        nextTime += period;
+        auto now = clock::now();
+        if (nextTime < now)
+        {
+            nextTime = now;
+        }
+
+        std::unique_lock<std::mutex> lock {stopLock};
+        if (stopCondition.wait_until(lock, nextTime, [this]{ return stopRequested.load(); }))
+        {
+            break;
+        }
+
+        lock.unlock();
+
+        auto sampleTime = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - startTime);
+        takeSample(static_cast<uint64_t>(sampleTime.count()));
+    }
+
+    // Send any remaining samples
+    if (!block.timestamps.empty())
+    {
+        sendBlock();
+    }
+}
+
+/* See header for documentation. */
+void ProfilePeriodicSampler::takeSample(
+    uint64_t timestamp
+) {
+    // Read the tags first, so work submitted during the sample is attributed
+    // to the next sample
+    uint64_t frameID = device.currentFrameID.load(std::memory_order_relaxed);
+    uint64_t submitID = device.queueSubmitCount.load(std::memory_order_relaxed);
+
+    auto ec = device.lgcSampler->sample_now();
+    if (ec)
+    {
+        LAYER_ERR("Failed to make libGPUCounters GPU counter sample");
+        return;
+    }
+
+    block.timestamps.push_back(timestamp);
+    block.frameIDs.push_back(frameID);
+    block.submitIDs.push_back(submitID);
+
+    size_t start = block.values.size();
+    block.values.resize(start + device.lgcActiveCounters.size());
+    readCounterValues(device, block.values.data() + start);
+
+    if (block.timestamps.size() == PERIODIC_SAMPLE_BLOCK_SIZE)
+    {
+        sendBlock();
+    }
+}
+
+/* See header for documentation. */
+void ProfilePeriodicSampler::sendBlock()
+{
+    ProfileProtobufEncoder::emitPeriodicSamples(device, block);
+
+    block.timestamps.clear();
+    block.frameIDs.clear();
+    block.submitIDs.clear();
+    block.values.clear();
+}
@@ -0,0 +1,171 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the background thread used for periodic counter sampling.
+ *
+ * Role summary
+ * ============
+ *
+ * Periodic sampling is the least invasive sampling mode. A background thread
+ * takes a counter sample at a fixed rate, without serializing or blocking any
+ * GPU work. Each sample is tagged with the number of the most recent queue
+ * submit and frame, so the host can align the counter time series with the
+ * application workload.
+ *
+ * Samples are appended to flat arrays and sent to the host in blocks, to keep
+ * the number of messages low at high sampling rates. Any partial block is sent
+ * when the sampler is stopped.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Device;
+
+/**
+ * @brief The number of samples sent in each periodic sample block.
+ */
+static constexpr size_t PERIODIC_SAMPLE_BLOCK_SIZE {256};
+
+/**
+ * @brief A block of periodic counter samples.
+ */
+struct ProfilePeriodicSampleBlock
+{
+    /**
+     * @brief The time of each sample, in nanoseconds since sampling started.
+     */
+    std::vector<uint64_t> timestamps;
+
+    /**
+     * @brief The frame number when each sample was taken.
+     */
+    std::vector<uint64_t> frameIDs;
+
+    /**
+     * @brief The number of queue submits made when each sample was taken.
+     */
+    std::vector<uint64_t> submitIDs;
+
+    /**
+     * @brief The counter values, in sample and then schema order.
+     */
+    std::vector<double> values;
+};
+
+/**
+ * @brief The background thread used for periodic counter sampling.
+ */
+class ProfilePeriodicSampler
+{
+public:
+    /**
+     * @brief Construct a new periodic sampler and start the worker thread.
+     *
+     * The device counter sampler must be running before this is created, and
+     * must not be used by any other thread while this exists.
+     *
+     * @param device     The device to sample.
+     * @param periodUS   The sampling period, in microseconds.
+     */
+    ProfilePeriodicSampler(
+        Device& device,
+        uint32_t periodUS);
+
+    /**
+     * @brief Destroy this periodic sampler.
+     *
+     * This will stop the worker thread if it hasn't stopped already.
+     */
+    ~ProfilePeriodicSampler();
+
+    /**
+     * @brief Stop the worker thread and send any buffered samples.
+     */
+    void stop();
+
+private:
+    /**
+     * @brief Entrypoint for the worker thread.
+     */
+    void runSampler();
+
+    /**
+     * @brief Take a counter sample and append it to the current block.
+     *
+     * @param timestamp   The time of the sample, in nanoseconds.
+     */
+    void takeSample(uint64_t timestamp);
+
+    /**
+     * @brief Send the current block to the host, and start a new block.
+     */
+    void sendBlock();
+
+private:
+    /**
+     * @brief The device being sampled.
+     */
+    Device& device;
+
+    /**
+     * @brief The sampling period, in microseconds.
+     */
+    uint32_t periodUS;
+
+    /**
+     * @brief The samples that have not been sent yet.
+     */
+    ProfilePeriodicSampleBlock block;
+
+    /**
+     * @brief The worker thread running the sampler.
+     */
+    std::thread worker;
+
+    /**
+     * @brief Has the worker been asked to stop?
+     */
+    std::atomic<bool> stopRequested {false};
+
+    /**
+     * @brief Lock used to wake the worker when stopping.
+     */
+    std::mutex stopLock;
+
+    /**
+     * @brief Condition used to wake the worker when stopping.
+     */
+    std::condition_variable stopCondition;
+};
@@ -0,0 +1,322 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+#include "profile_protobuf_encoder.hpp"
+
+#include "comms/comms_interface.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <protopuf/field.h>
+#include <protopuf/message.h>
+#include <protopuf/skip.h>
+
+/* A single counter in the schema */
+using Counter = pp::message<
+    /* The libGPUCounters counter ID */
+    pp::uint32_field<"id", 1>,
+    /* The human-readable counter name */
+    pp::string_field<"name", 2>>;
+
+/* The counter schema, sent once per device before any samples */
+using Schema = pp::message<
+    /* The VkDevice handle */
+    pp::uint64_field<"device", 1>,
+    /* The active counters, in the order that sample values are sent */
+    pp::message_field<"counters", 2, Counter, pp::repeated>,
+    /* The index of the counter pass using this schema */
+    pp::uint32_field<"pass", 3>,
+    /* The total number of counter passes */
+    pp::uint32_field<"pass_count", 4>,
+    /* The derived metrics computed for this pass, sent after the counters */
+    pp::string_field<"derived_metrics", 5, pp::repeated>,
+    /* True if raw counter values are omitted from samples */
+    pp::bool_field<"omit_raw_values", 6>>;
+
+/* The start of a profiled frame */
+using StartFrame = pp::message<
+    /* The VkDevice handle */
+    pp::uint64_field<"device", 1>,
+    /* The frame number */
+    pp::uint64_field<"frame", 2>,
+    /* The index of the counter pass used for the frame */
+    pp::uint32_field<"pass", 3>>;
+
+/* Enumerates possible workload types */
+enum class WorkloadType
+{
+    unknown_workload = 0,
+    render_pass = 1,
+    compute = 2,
+    data_graph = 3,
+    trace_rays = 4,
+    image_transfer = 5,
+    buffer_transfer = 6,
+    as_build = 7,
+    as_transfer = 8,
+};
+
+/* The end of a profiled frame, and the workload samples taken in the frame */
+using EndFrame = pp::message<
+    /* The VkDevice handle */
+    pp::uint64_field<"device", 1>,
+    /* The frame number */
+    pp::uint64_field<"frame", 2>,
+    /* The coarse workload type of each sample */
+    pp::enum_field<"workload_type", 3, WorkloadType, pp::repeated>,
+    /* The number of debug labels of each sample */
+    pp::uint32_field<"debug_label_count", 4, pp::repeated>,
+    /* The user defined debug labels of all samples, in sample order */
+    pp::string_field<"debug_label", 5, pp::repeated>,
+    /* The values of all samples, in sample and then schema order */
+    pp::double_field<"value", 6, pp::repeated>,
+    /* The histogram of trap wait times, bucket N is [2^N, 2^(N+1)) us */
+    pp::uint64_field<"trap_wait_histogram", 7, pp::repeated>,
+    /* The number of workloads covered by each sample */
+    pp::uint32_field<"workload_count", 8, pp::repeated>>;
+
+/* The counter sample for a whole frame */
+using FrameSample = pp::message<
+    /* The VkDevice handle */
+    pp::uint64_field<"device", 1>,
+    /* The frame number */
+    pp::uint64_field<"frame", 2>,
+    /* The values, in schema order */
+    pp::double_field<"value", 3, pp::repeated>,
+    /* The index of the counter pass used for the frame */
+    pp::uint32_field<"pass", 4>>;
+
+/* A block of periodic counter samples */
+using PeriodicSamples = pp::message<
+    /* The VkDevice handle */
+    pp::uint64_field<"device", 1>,
+    /* The time of each sample, in nanoseconds since sampling started */
+    pp::uint64_field<"timestamp", 2, pp::repeated>,
+    /* The frame number when each sample was taken */
+    pp::uint64_field<"frame", 3, pp::repeated>,
+    /* The number of queue submits made when each sample was taken */
+    pp::uint64_field<"submit", 4, pp::repeated>,
+    /* The values of all samples, in sample and then schema order */
+    pp::double_field<"value", 5, pp::repeated>>;
+
+/* The data payload message that wraps all other messages */
+using ProfileRecord = pp::message<
+    pp::message_field<"schema", 1, Schema>,
+    pp::message_field<"start_frame", 2, StartFrame>,
+    pp::message_field<"end_frame", 3, EndFrame>,
+    /* Field 4 was previously used for per-workload sample messages */
+    pp::message_field<"frame_sample", 5, FrameSample>,
+    pp::message_field<"periodic_samples", 6, PeriodicSamples>>;
+
+namespace
+{
+/**
+ * A helper to pack some message into a ProfileRecord and then encode it to the
+ * corresponding protobuf byte sequence.
+ *
+ * @param c The record field name
+ * @param f The record field value
+ * @return The encoded byte sequence
+ */
+template<pp::basic_fixed_string F, typename T>
+Comms::MessageData packBuffer(pp::constant<F> c, T&& f)
+{
+    using namespace pp;
+
+    ProfileRecord record {};
+    record[c] = std::move(f);
+
+    // allocate storage for the message
+    Comms::MessageData buffer {};
+    buffer.resize(skipper<message_coder<ProfileRecord>>::encode_skip(record));
+
+    const auto bufferBytes = bytes(reinterpret_cast<std::byte*>(buffer.data()), buffer.size());
+    const auto encodeResult = message_coder<ProfileRecord>::encode(record, bufferBytes);
+    assert(encodeResult.has_value());
+
+    const auto& bufferEnd = *encodeResult;
+    const auto usedLength = begin_diff(bufferEnd, bufferBytes);
+    buffer.resize(usedLength);
+
+    return buffer;
+}
+
+/**
+ * @brief Convert raw counter values into the values sent for a pass.
+ *
+ * @param device   The layer device.
+ * @param pass     The counter pass used to collect the values.
+ * @param values   The raw counter values, in sample and then pass order.
+ *
+ * @return The values to send, in sample and then schema order.
+ */
+std::vector<double> mapSampleValues(const Device& device, size_t pass, const std::vector<double>& values)
+{
+    const auto& config = device.instance->config;
+    return applyDerivedMetrics(device.lgcDerivedMetrics[pass],
+                               config.isStreamingRawCounters(),
+                               device.lgcCounterPasses[pass].size(),
+                               values);
+}
+
+/**
+ * @brief Map the layer workload type to the wire value.
+ *
+ * @param type   The type enum to convert
+ *
+ * @return The wire value enum to store in the protobuf message
+ */
+constexpr WorkloadType mapWorkloadType(ProfileWorkloadType type)
+{
+    switch (type)
+    {
+    case ProfileWorkloadType::RENDER_PASS:
+        return WorkloadType::render_pass;
+    case ProfileWorkloadType::COMPUTE:
+        return WorkloadType::compute;
+    case ProfileWorkloadType::DATA_GRAPH:
+        return WorkloadType::data_graph;
+    case ProfileWorkloadType::TRACE_RAYS:
+        return WorkloadType::trace_rays;
+    case ProfileWorkloadType::IMAGE_TRANSFER:
+        return WorkloadType::image_transfer;
+    case ProfileWorkloadType::BUFFER_TRANSFER:
+        return WorkloadType::buffer_transfer;
+    case ProfileWorkloadType::AS_BUILD:
+        return WorkloadType::as_build;
+    case ProfileWorkloadType::AS_TRANSFER:
+        return WorkloadType::as_transfer;
+    default:
+        assert(false && "Unexpected ProfileWorkloadType");
+        return WorkloadType::unknown_workload;
+    }
+}
+
+}
+
+/* See header for documentation. */
+void ProfileProtobufEncoder::emitSchema(Device& device, size_t pass)
+{
+    using namespace pp;
+
+    const auto& passCounters = device.lgcCounterPasses[pass];
+
+    std::vector<Counter> counters;
+    counters.reserve(passCounters.size());
+    for (const auto& pair : passCounters)
+    {
+        counters.emplace_back(static_cast<uint32_t>(pair.first), pair.second);
+    }
+
+    std::vector<std::string> metrics;
+    for (const auto& metric : device.lgcDerivedMetrics[pass])
+    {
+        metrics.push_back(metric.getName());
+    }
+
+    device.txMessage(packBuffer("schema"_f,
+                                Schema {
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    std::move(counters),
+                                    static_cast<uint32_t>(pass),
+                                    static_cast<uint32_t>(device.lgcCounterPasses.size()),
+                                    std::move(metrics),
+                                    !device.instance->config.isStreamingRawCounters(),
+                                }));
+}
+
+/* See header for documentation. */
+void ProfileProtobufEncoder::emitStartFrame(Device& device, uint64_t frameNumber)
+{
+    using namespace pp;
+
+    device.txMessage(packBuffer("start_frame"_f,
+                                StartFrame {
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    frameNumber,
+                                    static_cast<uint32_t>(device.frameCounterPass),
+                                }));
+}
+
+/* See header for documentation. */
+void ProfileProtobufEncoder::emitEndFrame(Device& device, uint64_t frameNumber, const ProfileSampleBuffer& samples)
+{
+    using namespace pp;
+
+    std::vector<WorkloadType> workloadTypes;
+    workloadTypes.reserve(samples.getSampleCount());
+    for (auto type : samples.getWorkloadTypes())
+    {
+        workloadTypes.push_back(mapWorkloadType(type));
+    }
+
+    const auto& histogram = samples.getTrapWaitHistogram();
+    std::vector<uint64_t> trapWaitHistogram(histogram.begin(), histogram.end());
+
+    device.txMessage(packBuffer("end_frame"_f,
+                                EndFrame {
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    frameNumber,
+                                    std::move(workloadTypes),
+                                    samples.getDebugLabelCounts(),
+                                    samples.getDebugLabels(),
+                                    mapSampleValues(device, device.frameCounterPass, samples.getValues()),
+                                    std::move(trapWaitHistogram),
+                                    samples.getWorkloadCounts(),
+                                }));
+}
+
+/* See header for documentation. */
+void ProfileProtobufEncoder::emitFrameSample(Device& device, uint64_t frameNumber, const std::vector<double>& values)
+{
+    using namespace pp;
+
+    device.txMessage(packBuffer("frame_sample"_f,
+                                FrameSample {
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    frameNumber,
+                                    mapSampleValues(device, device.lgcCounterPass, values),
+                                    static_cast<uint32_t>(device.lgcCounterPass),
+                                }));
+}
+
+/* See header for documentation. */
+void ProfileProtobufEncoder::emitPeriodicSamples(Device& device, const ProfilePeriodicSampleBlock& block)
+{
+    using namespace pp;
+
+    device.txMessage(packBuffer("periodic_samples"_f,
+                                PeriodicSamples {
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    block.timestamps,
+                                    block.frameIDs,
+                                    block.submitIDs,
+                                    mapSampleValues(device, device.lgcCounterPass, block.values),
+                                }));
+}
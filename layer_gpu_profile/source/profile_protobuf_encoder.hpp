@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares methods for encoding counter samples into metadata messages for
+ * transmission to the host.
+ *
+ * Role summary
+ * ============
+ *
+ * Counter samples are encoded as compact protobuf messages, and the counter
+ * names are sent once per device in a schema message. Each sample then only
+ * contains the counter values, in schema order. Workload samples are buffered
+ * for the whole frame, and sent as a single message at the end of the frame.
+ */
+
+#pragma once
+
+#include "device.hpp"
+#include "profile_periodic_sampler.hpp"
+#include "profile_sample_buffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Encodes profile protocol messages in protobuf format.
+ */
+class ProfileProtobufEncoder
+{
+public:
+    /**
+     * @brief Emit the counter schema for a device.
+     *
+     * This must be sent before any sample message for the device. One schema
+     * is sent for each counter pass.
+     *
+     * @param device   The device to emit the schema for.
+     * @param pass     The index of the counter pass to emit the schema for.
+     */
+    static void emitSchema(Device& device, size_t pass);
+
+    /**
+     * @brief Emit the start of a profiled frame.
+     *
+     * @param device        The device the frame belongs to.
+     * @param frameNumber   The number of the frame.
+     */
+    static void emitStartFrame(Device& device, uint64_t frameNumber);
+
+    /**
+     * @brief Emit the end of a profiled frame, and its workload samples.
+     *
+     * @param device        The device the frame belongs to.
+     * @param frameNumber   The number of the frame.
+     * @param samples       The workload samples taken during the frame.
+     */
+    static void emitEndFrame(Device& device, uint64_t frameNumber, const ProfileSampleBuffer& samples);
+
+    /**
+     * @brief Emit the counter sample for a whole frame.
+     *
+     * @param device        The device the frame belongs to.
+     * @param frameNumber   The number of the frame.
+     * @param values        The counter values, in schema order.
+     */
+    static void emitFrameSample(Device& device, uint64_t frameNumber, const std::vector<double>& values);
+
+    /**
+     * @brief Emit a block of periodic counter samples.
+     *
+     * @param device   The device the samples belong to.
+     * @param block    The samples to emit.
+     */
+    static void emitPeriodicSamples(Device& device, const ProfilePeriodicSampleBlock& block);
+};
@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines the per-frame buffer used to store workload counter samples.
+ */
+
+#include "profile_sample_buffer.hpp"
+
+#include <algorithm>
+#include <bit>
+
+/**
+ * @brief The number of samples to preallocate storage for.
+ *
+ * This is sized to cover most frames without reallocation on the first
+ * profiled frame. Storage for larger frames is retained across frames.
+ */
+static constexpr size_t INITIAL_SAMPLE_CAPACITY {256};
+
+/**
+ * @brief The number of counters to preallocate storage for, per sample.
+ */
+static constexpr size_t INITIAL_COUNTER_CAPACITY {32};
+
+/* See header for documentation. */
+ProfileSampleBuffer::ProfileSampleBuffer()
+{
+    workloadTypes.reserve(INITIAL_SAMPLE_CAPACITY);
+    workloadCounts.reserve(INITIAL_SAMPLE_CAPACITY);
+    debugLabelCounts.reserve(INITIAL_SAMPLE_CAPACITY);
+    debugLabels.reserve(INITIAL_SAMPLE_CAPACITY);
+    values.reserve(INITIAL_SAMPLE_CAPACITY * INITIAL_COUNTER_CAPACITY);
+}
+
+/* See header for documentation. */
+void ProfileSampleBuffer::reset(size_t _counterCount)
+{
+    counterCount = _counterCount;
+    workloadTypes.clear();
+    workloadCounts.clear();
+    untrappedWorkloadCount = 0;
+    debugLabelCounts.clear();
+    debugLabels.clear();
+    values.clear();
+    trapWaitHistogram.fill(0);
+}
+
+/* See header for documentation. */
+double* ProfileSampleBuffer::addSample(
+    ProfileWorkloadType type,
+    const std::vector<std::string>& debugStack
+) {
+    workloadTypes.push_back(type);
+    workloadCounts.push_back(untrappedWorkloadCount + 1);
+    untrappedWorkloadCount = 0;
+    debugLabelCounts.push_back(static_cast<uint32_t>(debugStack.size()));
+    debugLabels.insert(debugLabels.end(), debugStack.begin(), debugStack.end());
+
+    size_t offset = values.size();
+    values.resize(offset + counterCount);
+    return values.data() + offset;
+}
+
+/* See header for documentation. */
+void ProfileSampleBuffer::addTrapWait(uint64_t waitTime)
+{
+    uint64_t waitTimeUs = waitTime / 1000;
+
+    // Bucket index is log2 of the wait time, with 0 and 1 us in bucket 0
+    size_t bucket = waitTimeUs ? static_cast<size_t>(std::bit_width(waitTimeUs)) - 1 : 0;
+    bucket = std::min(bucket, TRAP_WAIT_HISTOGRAM_BUCKETS - 1);
+
+    trapWaitHistogram[bucket]++;
+}
@@ -0,0 +1,240 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the per-frame buffer used to store workload counter samples.
+ *
+ * Role summary
+ * ============
+ *
+ * Workload counter samples are taken on the application thread while the GPU
+ * is blocked, or is about to block, waiting for the layer. To keep each trap
+ * as short as possible samples are not encoded and sent when they are taken.
+ * Instead the counter values are appended to flat preallocated arrays owned by
+ * the device, and the whole frame is encoded and sent as a single message at
+ * the end of the frame.
+ *
+ * The buffer is cleared, but not deallocated, at the start of each frame so
+ * after the first profiled frame most traps will not need to allocate memory.
+ *
+ * When workload traps are filtered, workloads without a trap are attributed
+ * to the next sample, so each sample also records the number of workloads it
+ * covers.
+ *
+ * The buffer also records a histogram of the time the layer waited for each
+ * trap to trigger, which is sent alongside the samples for the frame.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The coarse type of a sampled workload.
+ */
+enum class ProfileWorkloadType
+{
+    RENDER_PASS,
+    COMPUTE,
+    DATA_GRAPH,
+    TRACE_RAYS,
+    IMAGE_TRANSFER,
+    BUFFER_TRANSFER,
+    AS_BUILD,
+    AS_TRANSFER
+};
+
+/**
+ * @brief The number of buckets in the trap wait histogram.
+ *
+ * Bucket N counts waits of [2^N, 2^(N+1)) microseconds, except that bucket 0
+ * also counts shorter waits and the last bucket also counts longer waits.
+ */
+static constexpr size_t TRAP_WAIT_HISTOGRAM_BUCKETS {16};
+
+/**
+ * @brief Stores the workload counter samples for a single frame.
+ *
+ * Sample data is stored in flat arrays. The counter values for sample N are
+ * stored at indices [N * counterCount, (N + 1) * counterCount) in the value
+ * array, in the order of the active counter list. The debug labels for sample
+ * N follow the labels for sample N - 1 in the label array, and the number of
+ * labels for each sample is stored in the label count array.
+ */
+class ProfileSampleBuffer
+{
+public:
+    /**
+     * @brief Construct a new empty sample buffer.
+     */
+    ProfileSampleBuffer();
+
+    /**
+     * @brief Clear the buffer for a new frame, retaining allocated storage.
+     *
+     * @param counterCount   The number of counter values per sample.
+     */
+    void reset(size_t counterCount);
+
+    /**
+     * @brief Add a new sample to the buffer.
+     *
+     * @param type         The coarse type of the workload.
+     * @param debugStack   The user debug label stack of the workload.
+     *
+     * @return Pointer to storage for counterCount values for this sample. This
+     *         pointer is invalidated by the next call to addSample() or reset().
+     */
+    double* addSample(
+        ProfileWorkloadType type,
+        const std::vector<std::string>& debugStack);
+
+    /**
+     * @brief Add workloads that have no trap, and are merged into the next sample.
+     *
+     * @param count   The number of untrapped workloads.
+     */
+    void addUntrappedWorkloads(uint32_t count)
+    {
+        untrappedWorkloadCount += count;
+    }
+
+    /**
+     * @brief Add a trap wait to the histogram.
+     *
+     * @param waitTime   The time waited for the trap, in nanoseconds.
+     */
+    void addTrapWait(uint64_t waitTime);
+
+    /**
+     * @brief Get the number of counter values per sample.
+     */
+    size_t getCounterCount() const
+    {
+        return counterCount;
+    }
+
+    /**
+     * @brief Get the number of samples stored in the buffer.
+     */
+    size_t getSampleCount() const
+    {
+        return workloadTypes.size();
+    }
+
+    /**
+     * @brief Get the workload type for each sample.
+     */
+    const std::vector<ProfileWorkloadType>& getWorkloadTypes() const
+    {
+        return workloadTypes;
+    }
+
+    /**
+     * @brief Get the number of workloads covered by each sample.
+     */
+    const std::vector<uint32_t>& getWorkloadCounts() const
+    {
+        return workloadCounts;
+    }
+
+    /**
+     * @brief Get the number of debug labels for each sample.
+     */
+    const std::vector<uint32_t>& getDebugLabelCounts() const
+    {
+        return debugLabelCounts;
+    }
+
+    /**
+     * @brief Get the debug labels for all samples.
+     */
+    const std::vector<std::string>& getDebugLabels() const
+    {
+        return debugLabels;
+    }
+
+    /**
+     * @brief Get the counter values for all samples.
+     */
+    const std::vector<double>& getValues() const
+    {
+        return values;
+    }
+
+    /**
+     * @brief Get the trap wait histogram.
+     */
+    const std::array<uint64_t, TRAP_WAIT_HISTOGRAM_BUCKETS>& getTrapWaitHistogram() const
+    {
+        return trapWaitHistogram;
+    }
+
+private:
+    /**
+     * @brief The number of counter values per sample.
+     */
+    size_t counterCount {0};
+
+    /**
+     * @brief The workload type for each sample.
+     */
+    std::vector<ProfileWorkloadType> workloadTypes;
+
+    /**
+     * @brief The number of workloads covered by each sample.
+     */
+    std::vector<uint32_t> workloadCounts;
+
+    /**
+     * @brief The number of untrapped workloads since the last sample.
+     */
+    uint32_t untrappedWorkloadCount {0};
+
+    /**
+     * @brief The number of debug labels for each sample.
+     */
+    std::vector<uint32_t> debugLabelCounts;
+
+    /**
+     * @brief The debug labels for all samples, in sample order.
+     */
+    std::vector<std::string> debugLabels;
+
+    /**
+     * @brief The counter values for all samples, in sample order.
+     */
+    std::vector<double> values;
+
+    /**
+     * @brief The trap wait histogram for all samples.
+     */
+    std::array<uint64_t, TRAP_WAIT_HISTOGRAM_BUCKETS> trapWaitHistogram {};
+};
@@ -0,0 +1,270 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Implements the scheduler thread used to service workload traps.
+ */
+
+#include "profile_trap_scheduler.hpp"
+
+#include "device.hpp"
+#include "device_utils.hpp"
+#include "framework/utils.hpp"
+
+#include <algorithm>
+#include <limits>
+
+/* See header for documentation. */
+ProfileTrapScheduler::ProfileTrapScheduler(
+    Device& _device
+) :
+    device(_device)
+{
+    // Create and start a worker thread
+    worker = std::thread(&ProfileTrapScheduler::runScheduler, this);
+}
+
+/* See header for documentation. */
+ProfileTrapScheduler::~ProfileTrapScheduler()
+{
+    // Stop the worker thread if it's not stopped already
+    if (!stopRequested)
+    {
+        stop();
+    }
+}
+
+/* See header for documentation. */
+void ProfileTrapScheduler::stop()
+{
+    // Mark the scheduler as stopping, and wake any waiting threads
+    {
+        std::lock_guard<std::mutex> guard {lock};
+        stopRequested = true;
+    }
+
+    trapsQueued.notify_one();
+    trapsDrained.notify_all();
+
+    // Join on the worker thread
+    worker.join();
+}
+
+/* See header for documentation. */
+void ProfileTrapScheduler::addTrap(
+    const ProfileTrapSlot& slot,
+    ProfileWorkloadType workloadType,
+    const std::vector<std::string>& debugStack,
+    uint32_t untrappedCount
+) {
+    {
+        std::lock_guard<std::mutex> guard {lock};
+
+        auto& traps = pendingTraps[slot.index];
+        traps.push_back({
+            slot,
+            workloadType,
+            debugStack,
+            untrappedCount,
+            std::chrono::steady_clock::now()
+        });
+
+        pendingTrapCount++;
+    }
+
+    trapsQueued.notify_one();
+}
+
+/* See header for documentation. */
+void ProfileTrapScheduler::addUntrappedWorkloads(
+    uint32_t untrappedCount
+) {
+    std::lock_guard<std::mutex> guard {lock};
+    device.workloadSamples.addUntrappedWorkloads(untrappedCount);
+}
+
+/* See header for documentation. */
+void ProfileTrapScheduler::drain()
+{
+    std::unique_lock<std::mutex> guard {lock};
+    trapsDrained.wait(guard, [this]{ return pendingTrapCount == 0 || stopRequested; });
+}
+
+/* See header for documentation. */
+void ProfileTrapScheduler::runScheduler()
+{
+    const auto& config = device.instance->config;
+    auto spinTime = std::chrono::microseconds(config.getTrapSpinTime());
+    auto yieldTime = spinTime + std::chrono::microseconds(config.getTrapYieldTime());
+    auto sleepTime = std::chrono::microseconds(config.getTrapSleepTime());
+
+    std::unique_lock<std::mutex> guard {lock};
+    auto idleStartTime = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        // Block until there is something to do
+        if (pendingTrapCount == 0 && !stopRequested)
+        {
+            trapsQueued.wait(guard, [this]{ return pendingTrapCount != 0 || stopRequested; });
+            idleStartTime = std::chrono::steady_clock::now();
+        }
+
+        if (stopRequested)
+        {
+            break;
+        }
+
+        if (pollTraps())
+        {
+            idleStartTime = std::chrono::steady_clock::now();
+            if (pendingTrapCount == 0)
+            {
+                trapsDrained.notify_all();
+            }
+
+            continue;
+        }
+
+        // Back off progressively before polling again, releasing the lock
+        // so that the application thread can queue more traps
+        auto idleTime = std::chrono::steady_clock::now() - idleStartTime;
+        guard.unlock();
+
+        if (idleTime >= yieldTime)
+        {
+            std::this_thread::sleep_for(sleepTime);
+        }
+        else if (idleTime >= spinTime)
+        {
+            std::this_thread::yield();
+        }
+
+        guard.lock();
+    }
+}
+
+/* See header for documentation. */
+bool ProfileTrapScheduler::pollTraps()
+{
+    bool serviced = false;
+
+    for (auto& [index, traps] : pendingTraps)
+    {
+        if (traps.empty())
+        {
+            continue;
+        }
+
+        const auto& trap = traps.front();
+        auto res = device.driver.vkGetEventStatus(device.device, trap.slot.gpuToCpuEvent);
+        if (res == VK_EVENT_RESET)
+        {
+            continue;
+        }
+
+        // An error will not clear on retry, so drop the slot rather than
+        // leaving drain() blocked forever on traps that can never complete
+        if (res != VK_EVENT_SET)
+        {
+            LAYER_ERR("Failed to wait for gpuToCpuEvent, dropping %zu traps", traps.size());
+            dropTraps(traps);
+            serviced = true;
+            continue;
+        }
+
+        serviceTrap(trap);
+        traps.pop_front();
+        pendingTrapCount--;
+        serviced = true;
+
+        // The next trap in the slot can only trigger after this one
+        if (!traps.empty())
+        {
+            traps.front().waitStartTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    return serviced;
+}
+
+/* See header for documentation. */
+void ProfileTrapScheduler::dropTraps(
+    std::deque<PendingTrap>& traps
+) {
+    for (const auto& trap : traps)
+    {
+        device.workloadSamples.addUntrappedWorkloads(trap.untrappedCount + 1);
+        device.driver.vkSetEvent(device.device, trap.slot.cpuToGpuEvent);
+    }
+
+    pendingTrapCount -= traps.size();
+    traps.clear();
+}
+
+/* See header for documentation. */
+void ProfileTrapScheduler::serviceTrap(
+    const PendingTrap& trap
+) {
+    auto waitTime = std::chrono::steady_clock::now() - trap.waitStartTime;
+    device.workloadSamples.addTrapWait(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(waitTime).count());
+
+    // Reset gpuToCpu so it's ready to use again
+    auto res = device.driver.vkResetEvent(device.device, trap.slot.gpuToCpuEvent);
+    if (res != VK_SUCCESS)
+    {
+        LAYER_LOG("Failed to reset gpuToCpuEvent");
+    }
+
+    // Sleep after event set to workaround counter sync errata on older drivers
+    workaroundDelay(device);
+
+    auto ec = device.lgcSampler->sample_now();
+
+    // Signal cpuToGpu to wake the GPU to keep processing the command stream
+    res = device.driver.vkSetEvent(device.device, trap.slot.cpuToGpuEvent);
+    if (res != VK_SUCCESS)
+    {
+        LAYER_LOG("Failed to notify cpuToGpuEvent");
+    }
+
+    // Store the sample to send at the end of the frame
+    auto& samples = device.workloadSamples;
+    samples.addUntrappedWorkloads(trap.untrappedCount);
+
+    double* values = samples.addSample(trap.workloadType, trap.debugStack);
+    if (ec)
+    {
+        LAYER_ERR("Failed to make libGPUCounters GPU counter sample");
+        std::fill_n(values, samples.getCounterCount(),
+                    std::numeric_limits<double>::quiet_NaN());
+    }
+    else
+    {
+        readCounterValues(device, values);
+    }
+}
@@ -0,0 +1,262 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the scheduler thread used to service workload traps.
+ *
+ * Role summary
+ * ============
+ *
+ * When sampling workloads, the layer inserts a trap after each workload. The
+ * GPU signals a gpuToCpu event when it reaches the trap, and then waits for
+ * the layer to signal a cpuToGpu event after taking a counter sample.
+ *
+ * Each command buffer that contains traps is assigned its own pair of events,
+ * called a trap slot, from a pool owned by the device. Command buffers that
+ * run on different queues therefore never share a rendezvous, and a trap on
+ * one queue cannot be mistaken for a trap on another.
+ *
+ * Traps are not serviced on the application thread. When a command buffer is
+ * submitted, the layer queues one pending trap per trapped workload on the
+ * slot for that command buffer, and returns to the application. A scheduler
+ * thread polls the oldest pending trap of every slot, and services traps in
+ * the order that the GPU reaches them. Queues can therefore progress
+ * independently, and each workload is still sampled while the GPU is blocked.
+ *
+ * Counters are sampled for the whole GPU, so workloads that run concurrently
+ * on different queues will each include some of the other's counter data.
+ */
+
+#pragma once
+
+#include "profile_sample_buffer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+class Device;
+
+/**
+ * @brief The pair of events used to rendezvous with the GPU for a trap slot.
+ */
+struct ProfileTrapSlot
+{
+    /**
+     * @brief The index of the slot in the device slot pool.
+     */
+    uint32_t index;
+
+    /**
+     * @brief The event needed to sync execution from GPU to CPU.
+     */
+    VkEvent gpuToCpuEvent;
+
+    /**
+     * @brief The event needed to sync execution from CPU back to GPU.
+     */
+    VkEvent cpuToGpuEvent;
+};
+
+/**
+ * @brief The scheduler thread used to service workload traps.
+ */
+class ProfileTrapScheduler
+{
+public:
+    /**
+     * @brief Construct a new trap scheduler and start the worker thread.
+     *
+     * @param device   The device to sample.
+     */
+    ProfileTrapScheduler(
+        Device& device);
+
+    /**
+     * @brief Destroy this trap scheduler.
+     *
+     * This will stop the worker thread if it hasn't stopped already.
+     */
+    ~ProfileTrapScheduler();
+
+    /**
+     * @brief Stop the worker thread.
+     *
+     * Any traps that are still pending will not be serviced.
+     */
+    void stop();
+
+    /**
+     * @brief Queue a trap to be serviced when the GPU reaches it.
+     *
+     * Traps for the same slot must be queued in command stream order.
+     *
+     * @param slot            The trap slot of the command buffer.
+     * @param workloadType    The coarse type of the workload.
+     * @param debugStack      The user debug label stack of the workload.
+     * @param untrappedCount  The number of untrapped workloads merged into
+     *                        this sample.
+     */
+    void addTrap(
+        const ProfileTrapSlot& slot,
+        ProfileWorkloadType workloadType,
+        const std::vector<std::string>& debugStack,
+        uint32_t untrappedCount);
+
+    /**
+     * @brief Add untrapped workloads that are merged into the next sample.
+     *
+     * @param untrappedCount   The number of untrapped workloads.
+     */
+    void addUntrappedWorkloads(
+        uint32_t untrappedCount);
+
+    /**
+     * @brief Wait for all pending traps to be serviced.
+     *
+     * The device sample buffer and counter sampler can be accessed by the
+     * caller after this returns, until the next trap is queued.
+     */
+    void drain();
+
+private:
+    /**
+     * @brief A trap that has been submitted but not yet serviced.
+     */
+    struct PendingTrap
+    {
+        /**
+         * @brief The trap slot of the command buffer.
+         */
+        ProfileTrapSlot slot;
+
+        /**
+         * @brief The coarse type of the workload.
+         */
+        ProfileWorkloadType workloadType;
+
+        /**
+         * @brief The user debug label stack of the workload.
+         */
+        std::vector<std::string> debugStack;
+
+        /**
+         * @brief The number of untrapped workloads merged into this sample.
+         */
+        uint32_t untrappedCount;
+
+        /**
+         * @brief The time the trap became the oldest pending trap for its slot.
+         */
+        std::chrono::steady_clock::time_point waitStartTime;
+    };
+
+    /**
+     * @brief Entrypoint for the worker thread.
+     */
+    void runScheduler();
+
+    /**
+     * @brief Poll the oldest pending trap of every slot.
+     *
+     * The caller must hold the scheduler lock.
+     *
+     * @return @c true if any trap was serviced or dropped, @c false otherwise.
+     */
+    bool pollTraps();
+
+    /**
+     * @brief Drop all pending traps of a slot after an event query error.
+     *
+     * The dropped workloads are counted as untrapped, and their cpuToGpu
+     * events are set so the GPU is not left blocked. The caller must hold the
+     * scheduler lock.
+     *
+     * @param traps   The pending traps of the slot.
+     */
+    void dropTraps(
+        std::deque<PendingTrap>& traps);
+
+    /**
+     * @brief Take the counter sample for a trap that the GPU has reached.
+     *
+     * The caller must hold the scheduler lock.
+     *
+     * @param trap   The trap to service.
+     */
+    void serviceTrap(
+        const PendingTrap& trap);
+
+private:
+    /**
+     * @brief The device being sampled.
+     */
+    Device& device;
+
+    /**
+     * @brief The pending traps for each slot, in command stream order.
+     */
+    std::unordered_map<uint32_t, std::deque<PendingTrap>> pendingTraps;
+
+    /**
+     * @brief The number of pending traps across all slots.
+     */
+    size_t pendingTrapCount {0};
+
+    /**
+     * @brief The worker thread running the scheduler.
+     */
+    std::thread worker;
+
+    /**
+     * @brief Has the worker been asked to stop?
+     */
+    std::atomic<bool> stopRequested {false};
+
+    /**
+     * @brief Lock protecting the pending traps.
+     */
+    std::mutex lock;
+
+    /**
+     * @brief Condition used to wake the worker when traps are queued.
+     */
+    std::condition_variable trapsQueued;
+
+    /**
+     * @brief Condition used to wake drain() when all traps are serviced.
+     */
+    std::condition_variable trapsDrained;
+};
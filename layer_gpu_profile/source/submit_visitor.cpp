@@ -26,68 +26,37 @@
 #include "submit_visitor.hpp"
 #include "framework/utils.hpp"
 
-#include <nlohmann/json.hpp>
-
+#include <algorithm>
+#include <limits>
 #include <string>
 
-using json = nlohmann::json;
-
 /* See header for documentation */
 void ProfileSubmitVisitor::handleCPUTrap(
-    const std::string& workloadType,
+    const Tracker::LCSWorkload& workload,
+    ProfileWorkloadType workloadType,
     const std::vector<std::string>& debugStack
 ) {
-    json message {
-        { "type", workloadType },
-        { "labels", debugStack },
-        { "counters", json::array() }
-    };
-
-    waitForGPU(device);
-
-    auto ec = device.lgcSampler->sample_now();
-
-    notifyGPU(device);
-
-    if (ec)
+    // Workloads without a trap are attributed to the next sample
+    uint32_t slotIndex = workload.getInstrumentationSlot();
+    if (slotIndex == Tracker::LCSWorkload::NO_INSTRUMENTATION_SLOT)
     {
-        LAYER_ERR("Failed to make libGPUCounters GPU counter sample");
+        untrappedCount++;
+        return;
     }
-    else
-    {
-        for (const auto& pair : device.lgcActiveCounters)
-        {
-            hwcpipe::counter_sample sample;
-            ec = device.lgcSampler->get_counter_value(pair.first, sample);
-            if (ec)
-            {
-                LAYER_ERR("Failed to get libGPUCounters GPU counter value");
-                continue;
-            }
 
-            if (sample.type == hwcpipe::counter_sample::type::uint64)
-            {
-                json counter {
-                    { pair.second, sample.value.uint64 },
-                };
-
-                message["counters"].push_back(counter);
-
-            }
-            else
-            {
-                json counter {
-                    { pair.second, sample.value.float64 },
-                };
-
-                message["counters"].push_back(counter);
+    auto slot = device.getTrapSlotByIndex(slotIndex);
+    device.trapScheduler->addTrap(slot, workloadType, debugStack, untrappedCount);
+    untrappedCount = 0;
+}
 
-            }
-        }
+/* See header for documentation */
+void ProfileSubmitVisitor::flushUntrappedWorkloads()
+{
+    if (untrappedCount)
+    {
+        device.trapScheduler->addUntrappedWorkloads(untrappedCount);
+        untrappedCount = 0;
     }
-
-    device.txMessage(message.dump());
-
 }
 
 /* See header for documentation */
@@ -95,9 +64,14 @@ void ProfileSubmitVisitor::operator()(
     const Tracker::LCSRenderPass& renderPass,
     const std::vector<std::string>& debugStack
 ) {
-    UNUSED(renderPass);
+    // Suspending render passes are always trapped, but the trap is recorded
+    // at the end of the last continuation so is handled there
+    if (renderPass.isSuspending())
+    {
+        return;
+    }
 
-    handleCPUTrap("render_pass", debugStack);
+    handleCPUTrap(renderPass, ProfileWorkloadType::RENDER_PASS, debugStack);
 }
 
 /* See header for documentation */
@@ -106,11 +80,15 @@ void ProfileSubmitVisitor::operator()(
     const std::vector<std::string>& debugStack,
     uint64_t renderPassTagID
 ) {
-    UNUSED(continuation);
-    UNUSED(debugStack);
     UNUSED(renderPassTagID);
 
-    // Ignore continuations because we only trigger one trap per render pass
+    // Only the last continuation has a trap, as we only trigger one trap per
+    // render pass. The trap is in the continuation command buffer so must use
+    // its trap slot, which is why it is handled here and not at the start
+    if (!continuation.isSuspending())
+    {
+        handleCPUTrap(continuation, ProfileWorkloadType::RENDER_PASS, debugStack);
+    }
 }
 
 /* See header for documentation */
@@ -118,9 +96,7 @@ void ProfileSubmitVisitor::operator()(
     const Tracker::LCSDispatch& dispatch,
     const std::vector<std::string>& debugStack
 ) {
-    UNUSED(dispatch);
-
-    handleCPUTrap("compute", debugStack);
+    handleCPUTrap(dispatch, ProfileWorkloadType::COMPUTE, debugStack);
 }
 
 /* See header for documentation */
@@ -128,9 +104,7 @@ void ProfileSubmitVisitor::operator()(
     const Tracker::LCSDispatchDataGraph& dispatch,
     const std::vector<std::string>& debugStack
 ) {
-    UNUSED(dispatch);
-
-    handleCPUTrap("data_graph", debugStack);
+    handleCPUTrap(dispatch, ProfileWorkloadType::DATA_GRAPH, debugStack);
 }
 
 /* See header for documentation */
@@ -138,9 +112,7 @@ void ProfileSubmitVisitor::operator()(
     const Tracker::LCSTraceRays& traceRays,
     const std::vector<std::string>& debugStack
 ) {
-    UNUSED(traceRays);
-
-    handleCPUTrap("trace_rays", debugStack);
+    handleCPUTrap(traceRays, ProfileWorkloadType::TRACE_RAYS, debugStack);
 }
 
 /* See header for documentation */
@@ -148,9 +120,7 @@ void ProfileSubmitVisitor::operator()(
     const Tracker::LCSImageTransfer& imageTransfer,
     const std::vector<std::string>& debugStack
 ) {
-    UNUSED(imageTransfer);
-
-    handleCPUTrap("image_transfer", debugStack);
+    handleCPUTrap(imageTransfer, ProfileWorkloadType::IMAGE_TRANSFER, debugStack);
 }
 
 /* See header for documentation */
@@ -158,9 +128,7 @@ void ProfileSubmitVisitor::operator()(
     const Tracker::LCSBufferTransfer& bufferTransfer,
     const std::vector<std::string>& debugStack
 ) {
-    UNUSED(bufferTransfer);
-
-    handleCPUTrap("buffer_transfer", debugStack);
+    handleCPUTrap(bufferTransfer, ProfileWorkloadType::BUFFER_TRANSFER, debugStack);
 }
 
 /* See header for documentation */
@@ -168,9 +136,7 @@ void ProfileSubmitVisitor::operator()(
     const Tracker::LCSAccelerationStructureBuild& asBuild,
     const std::vector<std::string>& debugStack
 ) {
-    UNUSED(asBuild);
-
-    handleCPUTrap("as_build", debugStack);
+    handleCPUTrap(asBuild, ProfileWorkloadType::AS_BUILD, debugStack);
 }
 
 /* See header for documentation */
@@ -178,7 +144,5 @@ void ProfileSubmitVisitor::operator()(
     const Tracker::LCSAccelerationStructureTransfer& asTransfer,
     const std::vector<std::string>& debugStack
 ) {
-    UNUSED(asTransfer);
-
-    handleCPUTrap("as_transfer", debugStack);
+    handleCPUTrap(asTransfer, ProfileWorkloadType::AS_TRANSFER, debugStack);
 }
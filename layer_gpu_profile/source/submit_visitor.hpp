@@ -26,6 +26,7 @@
 #pragma once
 
 #include "device.hpp"
+#include "profile_sample_buffer.hpp"
 #include "trackers/layer_command_stream.hpp"
 #include "trackers/queue.hpp"
 
@@ -41,13 +42,19 @@ public:
     /**
      * Construct a profile workload visitor for a layer command stream.
      *
-     * @param _device The device object for the command stream.
+     * @param _device   The device object for the command stream.
      */
     ProfileSubmitVisitor(Device& _device)
         : device(_device)
     {
     }
 
+    /**
+     * Merge any untrapped workloads at the end of the command stream into
+     * the next sample.
+     */
+    void flushUntrappedWorkloads();
+
     // Visitor should not be copied or moved from
     ProfileSubmitVisitor(const ProfileSubmitVisitor&) = delete;
     ProfileSubmitVisitor(ProfileSubmitVisitor&&) noexcept = delete;
@@ -94,16 +101,28 @@ public:
 
 private:
     /**
-     * @brief Handle the CPU-side of the counter sampling sequence.
+     * @brief Queue the CPU-side of the counter sampling sequence.
+     *
+     * The trap is serviced by the trap scheduler when the GPU reaches it. The
+     * trap uses the slot recorded in the workload, which belongs to the
+     * command buffer the trap was recorded in. This may be a secondary
+     * command buffer executed by the one being submitted.
      *
+     * @param workload       The workload to sample.
      * @param workloadType   The coarse type of the workload.
      * @param debugStack     The user debug label stack.
      */
     void handleCPUTrap(
-        const std::string& workloadType,
+        const Tracker::LCSWorkload& workload,
+        ProfileWorkloadType workloadType,
         const std::vector<std::string>& debugStack);
 
 private:
     Device& device;
+
+    /**
+     * @brief The number of untrapped workloads since the last trap.
+     */
+    uint32_t untrappedCount {0};
 };
 
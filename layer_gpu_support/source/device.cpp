@@ -27,25 +27,39 @@
 
 #include "device.hpp"
 #include "framework/manual_functions.hpp"
+#include "framework/timestamp_queries.hpp"
 #include "framework/utils.hpp"
 #include "instance.hpp"
 
+#include <mutex>
+
+extern std::mutex g_vulkanLock;
+
 /**
  * @brief The dispatch lookup for all of the created Vulkan instances.
  */
 static std::unordered_map<void*, std::unique_ptr<Device>> g_devices;
 
+/* See header for documentation. */
+std::unique_ptr<Comms::CommsModule> Device::commsModule;
+
 /* Predeclare custom DeviceCreatePatch functions */
 static void modifyDeviceRobustBufferAccess(Instance& instance,
                                            VkPhysicalDevice physicalDevice,
                                            vku::safe_VkDeviceCreateInfo& createInfo,
                                            std::vector<std::string>& supported);
 
+static void enableDeviceOverlapMeasurement(Instance& instance,
+                                           VkPhysicalDevice physicalDevice,
+                                           vku::safe_VkDeviceCreateInfo& createInfo,
+                                           std::vector<std::string>& supported);
+
 /* See header for documentation. */
 const std::vector<DeviceCreatePatchPtr> Device::createInfoPatches {
     enableDeviceVkKhrTimelineSemaphore,
     enableDeviceVkExtImageCompressionControl,
-    modifyDeviceRobustBufferAccess
+    modifyDeviceRobustBufferAccess,
+    enableDeviceOverlapMeasurement
 };
 
 /* See header for documentation. */
@@ -101,8 +115,6 @@ Device::Device(Instance* _instance,
       physicalDevice(_physicalDevice),
       device(_device)
 {
-    UNUSED(createInfo);
-
     initDriverDeviceDispatchTable(device, nlayerGetProcAddress, driver);
 
     VkSemaphoreTypeCreateInfo timelineCreateInfo {
@@ -124,6 +136,202 @@ Device::Device(Instance* _instance,
         LAYER_ERR("Failed vkCreateSemaphore() for queue serialization");
         queueSerializationTimelineSem = nullptr;
     }
+
+    size_t shaderCacheSize = instance->config.shader_transform_cache_size();
+    if (shaderCacheSize)
+    {
+        shaderCache = std::make_unique<ShaderCache>(shaderCacheSize);
+    }
+
+    if (instance->config.shader_force_cache())
+    {
+        pipelineCache = std::make_unique<PersistentPipelineCache>(*this, instance->config.shader_force_cache_path());
+    }
+
+    if (instance->config.serialize_cmdstream_window())
+    {
+        Comms::CommsInterface* comms {nullptr};
+
+        // Init the shared comms module for the first device that bisects
+        if (instance->config.serialize_cmdstream_window_bisect())
+        {
+            std::lock_guard<std::mutex> lock {g_vulkanLock};
+            if (!commsModule)
+            {
+                commsModule = std::make_unique<Comms::CommsModule>("lglcomms");
+            }
+
+            comms = commsModule.get();
+        }
+
+        serializationWindow = std::make_unique<SerializationWindow>(instance->config, comms);
+    }
+
+    if (instance->config.serialize_measure_overlap())
+    {
+        VkPhysicalDeviceProperties deviceProperties;
+        instance->driver.vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperties);
+
+        uint32_t validBits = getTimestampValidBits(instance->driver, physicalDevice, createInfo);
+        bool hasWrite = driver.vkCmdWriteTimestamp2 || driver.vkCmdWriteTimestamp2KHR;
+
+        if (!hasWrite || !isSynchronization2Enabled(createInfo))
+        {
+            LAYER_LOG("Device does not support VK_KHR_synchronization2, overlap measurement disabled");
+        }
+        else if (validBits == 0)
+        {
+            LAYER_LOG("Device queues do not support timestamps, overlap measurement disabled");
+        }
+        else
+        {
+            overlapMeasurement = std::make_unique<OverlapMeasurement>(driver,
+                                                                      device,
+                                                                      deviceProperties.limits.timestampPeriod,
+                                                                      validBits,
+                                                                      instance->config.serialize_measure_overlap_frames());
+        }
+    }
+}
+
+/* See header for documentation. */
+void Device::beginWorkloadTimestamp(VkCommandBuffer commandBuffer)
+{
+    if (!overlapMeasurement)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto query = overlapMeasurement->beginWorkload(commandBuffer);
+    lock.unlock();
+
+    if (query)
+    {
+        driver.vkCmdResetQueryPool(commandBuffer, query->pool, query->index, 2);
+        writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, query->pool, query->index);
+    }
+}
+
+/* See header for documentation. */
+void Device::endWorkloadTimestamp(VkCommandBuffer commandBuffer)
+{
+    if (!overlapMeasurement)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto query = overlapMeasurement->getTimestamps().endWorkload(commandBuffer);
+    lock.unlock();
+
+    if (query)
+    {
+        writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, query->pool, query->index + 1);
+    }
+}
+
+/* See header for documentation. */
+void Device::writeTimestamp(VkCommandBuffer commandBuffer,
+                            VkPipelineStageFlags2 stage,
+                            VkQueryPool pool,
+                            uint32_t query)
+{
+    // Prefer the core entry point, but fall back to the extension
+    if (driver.vkCmdWriteTimestamp2)
+    {
+        driver.vkCmdWriteTimestamp2(commandBuffer, stage, pool, query);
+    }
+    else
+    {
+        driver.vkCmdWriteTimestamp2KHR(commandBuffer, stage, pool, query);
+    }
+}
+
+/* See header for documentation. */
+void Device::createCommandPool(VkCommandPool commandPool, uint32_t queueFamilyIndex)
+{
+    if (!overlapMeasurement)
+    {
+        return;
+    }
+
+    VkQueueFlags queueFlags = getQueueFamilyFlags(instance->driver, physicalDevice, queueFamilyIndex);
+    overlapMeasurement->getTimestamps().createCommandPool(commandPool, queueFlags);
+}
+
+/* See header for documentation. */
+void Device::allocateCommandBuffers(VkCommandPool commandPool,
+                                    uint32_t commandBufferCount,
+                                    const VkCommandBuffer* pCommandBuffers)
+{
+    // Only needed if we have per-command buffer state to release
+    if (!serializationWindow && !overlapMeasurement)
+    {
+        return;
+    }
+
+    if (overlapMeasurement)
+    {
+        overlapMeasurement->getTimestamps().allocateCommandBuffers(commandPool, commandBufferCount, pCommandBuffers);
+    }
+
+    auto& buffers = commandPoolBuffers[commandPool];
+    for (uint32_t i = 0; i < commandBufferCount; i++)
+    {
+        buffers.insert(pCommandBuffers[i]);
+    }
+}
+
+/* See header for documentation. */
+void Device::freeCommandBuffer(VkCommandPool commandPool, VkCommandBuffer commandBuffer)
+{
+    if (serializationWindow)
+    {
+        serializationWindow->freeCommandBuffer(commandBuffer);
+    }
+
+    if (overlapMeasurement)
+    {
+        overlapMeasurement->getTimestamps().resetCommandBuffer(commandBuffer);
+    }
+
+    auto it = commandPoolBuffers.find(commandPool);
+    if (it != commandPoolBuffers.end())
+    {
+        it->second.erase(commandBuffer);
+    }
+}
+
+/* See header for documentation. */
+void Device::destroyCommandPool(VkCommandPool commandPool)
+{
+    if (overlapMeasurement)
+    {
+        overlapMeasurement->getTimestamps().destroyCommandPool(commandPool);
+    }
+
+    auto it = commandPoolBuffers.find(commandPool);
+    if (it == commandPoolBuffers.end())
+    {
+        return;
+    }
+
+    // Destroying a pool implicitly frees all of its command buffers
+    for (auto commandBuffer : it->second)
+    {
+        if (serializationWindow)
+        {
+            serializationWindow->freeCommandBuffer(commandBuffer);
+        }
+
+        if (overlapMeasurement)
+        {
+            overlapMeasurement->getTimestamps().resetCommandBuffer(commandBuffer);
+        }
+    }
+
+    commandPoolBuffers.erase(it);
 }
 
 /**
@@ -218,3 +426,24 @@ static void modifyDeviceRobustBufferAccess(Instance& instance,
         LAYER_LOG("Device feature already disabled: robustBufferAccess");
     }
 }
+
+/**
+ * Enable the device features needed for overlap measurement, if configured.
+ *
+ * @param instance         The layer instance we are running within.
+ * @param physicalDevice   The physical device we are creating a device for.
+ * @param createInfo       The createInfo we can search to find user config.
+ * @param supported        The list of supported extensions.
+ */
+static void enableDeviceOverlapMeasurement(Instance& instance,
+                                           VkPhysicalDevice physicalDevice,
+                                           vku::safe_VkDeviceCreateInfo& createInfo,
+                                           std::vector<std::string>& supported)
+{
+    if (!instance.config.serialize_measure_overlap())
+    {
+        return;
+    }
+
+    enableDeviceVkKhrSynchronization2(instance, physicalDevice, createInfo, supported);
+}
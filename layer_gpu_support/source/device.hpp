@@ -52,14 +52,22 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include <vulkan/vk_layer.h>
 
+#include "comms/comms_module.hpp"
 #include "framework/device_dispatch_table.hpp"
 #include "instance.hpp"
+#include "overlap_measurement.hpp"
+#include "pipeline_cache.hpp"
+#include "serialization_window.hpp"
+#include "shader_cache.hpp"
 
 /**
  * @brief Function pointer type for patching VkDeviceCreateInfo.
@@ -145,6 +153,118 @@ public:
      */
     ~Device() = default;
 
+    /**
+     * @brief Test if the next workload in a command buffer can be serialized.
+     *
+     * A workload can be serialized if it is inside the serialization window,
+     * and its class is serialized by the current overlap measurement phase.
+     *
+     * Must be called with the layer global lock held.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     * @param workloadClass   The class of the workload being recorded.
+     *
+     * @return @c true if the workload can be serialized.
+     */
+    bool isSerializedWorkload(VkCommandBuffer commandBuffer, WorkloadClass workloadClass)
+    {
+        // Always test the window first, as this allocates the workload index
+        bool inWindow = !serializationWindow || serializationWindow->testWorkload(commandBuffer);
+        return inWindow && (!overlapMeasurement || overlapMeasurement->isSerializing(workloadClass));
+    }
+
+    /**
+     * @brief Test if a render pass starting in a command buffer can be serialized.
+     *
+     * Must be called with the layer global lock held.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     *
+     * @return @c true if the render pass can be serialized.
+     */
+    bool isSerializedRenderPassBegin(VkCommandBuffer commandBuffer)
+    {
+        bool inWindow = !serializationWindow || serializationWindow->testRenderPassBegin(commandBuffer);
+        return inWindow && (!overlapMeasurement || overlapMeasurement->isSerializing(WorkloadClass::RENDER_PASS));
+    }
+
+    /**
+     * @brief Test if a render pass ending in a command buffer can be serialized.
+     *
+     * Must be called with the layer global lock held.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     *
+     * @return @c true if the render pass can be serialized.
+     */
+    bool isSerializedRenderPassEnd(VkCommandBuffer commandBuffer)
+    {
+        bool inWindow = !serializationWindow || serializationWindow->testRenderPassEnd(commandBuffer);
+        return inWindow && (!overlapMeasurement || overlapMeasurement->isSerializing(WorkloadClass::RENDER_PASS));
+    }
+
+    /**
+     * @brief Write the start timestamp of a workload, if measuring overlap.
+     *
+     * Must be called without the layer global lock held.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     */
+    void beginWorkloadTimestamp(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Write the end timestamp of a workload, if measuring overlap.
+     *
+     * Must be called without the layer global lock held.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     */
+    void endWorkloadTimestamp(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Track the queue family of a new command pool.
+     *
+     * This is a no-op unless measuring overlap. Must be called with the layer
+     * global lock held.
+     *
+     * @param commandPool        The command pool being created.
+     * @param queueFamilyIndex   The queue family of the command pool.
+     */
+    void createCommandPool(VkCommandPool commandPool, uint32_t queueFamilyIndex);
+
+    /**
+     * @brief Track command buffers allocated from a command pool.
+     *
+     * This is a no-op unless the layer keeps per-command buffer state. Must
+     * be called with the layer global lock held.
+     *
+     * @param commandPool          The command pool allocated from.
+     * @param commandBufferCount   The number of command buffers allocated.
+     * @param pCommandBuffers      The allocated command buffers.
+     */
+    void allocateCommandBuffers(VkCommandPool commandPool,
+                                uint32_t commandBufferCount,
+                                const VkCommandBuffer* pCommandBuffers);
+
+    /**
+     * @brief Release the layer state for a command buffer that is freed.
+     *
+     * Must be called with the layer global lock held.
+     *
+     * @param commandPool     The command pool the command buffer belongs to.
+     * @param commandBuffer   The command buffer being freed.
+     */
+    void freeCommandBuffer(VkCommandPool commandPool, VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Release the layer state for all command buffers in a pool.
+     *
+     * Must be called with the layer global lock held.
+     *
+     * @param commandPool   The command pool being destroyed.
+     */
+    void destroyCommandPool(VkCommandPool commandPool);
+
 public:
     /**
      * @brief The instance this device is created with.
@@ -180,4 +300,48 @@ public:
      * @brief The current timeline sem target value the next use waits for.
      */
     uint64_t queueSerializationTimelineSemCount {0};
+
+    /**
+     * @brief The cache of transformed shader modules, or null if disabled.
+     */
+    std::unique_ptr<ShaderCache> shaderCache;
+
+    /**
+     * @brief The persistent pipeline cache, or null if not forced.
+     */
+    std::unique_ptr<PersistentPipelineCache> pipelineCache;
+
+    /**
+     * @brief The command stream serialization window, or null if not restricted.
+     */
+    std::unique_ptr<SerializationWindow> serializationWindow;
+
+    /**
+     * @brief The overlap benefit measurement, or null if not measuring.
+     */
+    std::unique_ptr<OverlapMeasurement> overlapMeasurement;
+
+private:
+    /**
+     * @brief Write a GPU timestamp into a layer-owned query.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     * @param stage           The pipeline stage to write the timestamp at.
+     * @param pool            The query pool to write to.
+     * @param query           The index of the query to write.
+     */
+    void writeTimestamp(VkCommandBuffer commandBuffer,
+                        VkPipelineStageFlags2 stage,
+                        VkQueryPool pool,
+                        uint32_t query);
+
+    /**
+     * @brief The command buffers allocated from each tracked command pool.
+     */
+    std::unordered_map<VkCommandPool, std::unordered_set<VkCommandBuffer>> commandPoolBuffers;
+
+    /**
+     * @brief Shared network communications module, used for host bisection.
+     */
+    static std::unique_ptr<Comms::CommsModule> commsModule;
 };
@@ -89,4 +89,11 @@ Instance::Instance(VkInstance _instance, PFN_vkGetInstanceProcAddr _nlayerGetPro
       nlayerGetProcAddress(_nlayerGetProcAddress)
 {
     initDriverInstanceDispatchTable(instance, nlayerGetProcAddress, driver);
+
+    // Forced fixed-rate compression queries the supported rates per image
+    if (config.framebuffer_force_fixed_rate_compression())
+    {
+        imageFormatCache = std::make_unique<ImageFormatCache>(
+            driver.vkGetPhysicalDeviceImageFormatProperties2, true);
+    }
 }
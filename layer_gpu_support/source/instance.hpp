@@ -54,6 +54,7 @@
 
 #pragma once
 
+#include "framework/image_format_cache.hpp"
 #include "framework/instance_dispatch_table.hpp"
 #include "layer_config.hpp"
 
@@ -136,6 +137,11 @@ public:
      */
     const LayerConfig config;
 
+    /**
+     * @brief The cache of image format queries, or null if not needed.
+     */
+    std::unique_ptr<ImageFormatCache> imageFormatCache;
+
     /**
      * @brief The minimum API version needed by this layer.
      */
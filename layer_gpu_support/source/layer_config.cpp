@@ -33,6 +33,8 @@
 #include "framework/utils.hpp"
 #include "version.hpp"
 
+#include <algorithm>
+#include <cinttypes>
 #include <fstream>
 
 #include <vulkan/vulkan.h>
@@ -80,6 +82,10 @@ void LayerConfig::parse_serialization_options(const json& config)
     bool s_queue_to_queue = serialize.at("queue");
     bool s_queue_to_cpu = serialize.at("queue_wait_idle");
 
+    json s_overlap = serialize.at("measure_overlap");
+    bool s_overlap_enable = s_overlap.at("enable");
+    uint32_t s_overlap_frames = s_overlap.at("frames_per_phase");
+
     // Decode command stream options
     json s_stream = serialize.at("commandstream");
 
@@ -98,6 +104,20 @@ void LayerConfig::parse_serialization_options(const json& config)
     bool s_stream_tx_pre = s_stream.at("transfer").at("pre");
     bool s_stream_tx_post = s_stream.at("transfer").at("post");
 
+    json s_window = s_stream.at("window");
+
+    bool s_window_enable = s_window.at("enable");
+    std::string s_window_scope = s_window.at("scope");
+    uint64_t s_window_first = s_window.at("first");
+    uint64_t s_window_count = s_window.at("count");
+    bool s_window_bisect = s_window.at("bisect");
+
+    bool s_window_per_frame = s_window_scope == "frame";
+    if (!s_window_per_frame && s_window_scope != "command_buffer")
+    {
+        LAYER_ERR("Unknown serialization window scope '%s', using command_buffer", s_window_scope.c_str());
+    }
+
     // Write after all options read from JSON so we know it parsed correctly
     conf_serialize_queues = (!s_none) && (s_all || s_queue_to_queue);
 
@@ -120,6 +140,16 @@ void LayerConfig::parse_serialization_options(const json& config)
     conf_serialize_transfer_pre = (!s_none) && (s_all || s_stream_tx_pre);
     conf_serialize_transfer_post = (!s_none) && (s_all || s_stream_tx_post);
 
+    // Bisection requires a window to narrow, so implies the window
+    conf_serialize_window = (!s_none) && (s_window_enable || s_window_bisect);
+    conf_serialize_window_per_frame = s_window_per_frame;
+    conf_serialize_window_first = s_window_first;
+    conf_serialize_window_count = s_window_count;
+    conf_serialize_window_bisect = s_window_bisect;
+
+    conf_serialize_measure_overlap = (!s_none) && s_overlap_enable;
+    conf_serialize_measure_overlap_frames = std::max(s_overlap_frames, 1u);
+
     LAYER_LOG("Layer serialization configuration");
     LAYER_LOG("=================================");
     LAYER_LOG(" - Serialize queue submit: %d", conf_serialize_queues);
@@ -134,6 +164,19 @@ void LayerConfig::parse_serialization_options(const json& config)
     LAYER_LOG(" - Serialize trace rays post: %d", conf_serialize_trace_rays_post);
     LAYER_LOG(" - Serialize transfer pre: %d", conf_serialize_transfer_pre);
     LAYER_LOG(" - Serialize transfer post: %d", conf_serialize_transfer_post);
+    LAYER_LOG(" - Serialize workload window: %d", conf_serialize_window);
+    if (conf_serialize_window)
+    {
+        LAYER_LOG("   - Scope: %s", conf_serialize_window_per_frame ? "frame" : "command_buffer");
+        LAYER_LOG("   - First: %" PRIu64, conf_serialize_window_first);
+        LAYER_LOG("   - Count: %" PRIu64, conf_serialize_window_count);
+        LAYER_LOG("   - Host bisect: %d", conf_serialize_window_bisect);
+    }
+    LAYER_LOG(" - Measure overlap: %d", conf_serialize_measure_overlap);
+    if (conf_serialize_measure_overlap)
+    {
+        LAYER_LOG("   - Frames per phase: %u", conf_serialize_measure_overlap_frames);
+    }
 }
 
 /* See header for documentation. */
@@ -145,17 +188,29 @@ void LayerConfig::parse_shader_options(const json& config)
     bool disable_program_cache = shader.at("disable_cache");
     bool disable_relaxed_precision = shader.at("disable_relaxed_precision");
     bool enable_fuzz_spirv_hash = shader.at("enable_spirv_fuzz");
+    uint32_t transform_cache_mb = shader.at("transform_cache_mb");
+    bool force_cache = shader.at("force_cache");
+    std::string force_cache_path = shader.at("force_cache_path");
 
     // Write after all options read from JSON so we know it parsed correctly
     conf_shader_disable_program_cache = disable_program_cache;
     conf_shader_disable_relaxed_precision = disable_relaxed_precision;
     conf_shader_enable_fuzz_spirv_hash = enable_fuzz_spirv_hash;
+    conf_shader_transform_cache_mb = transform_cache_mb;
+    conf_shader_force_cache = force_cache;
+    conf_shader_force_cache_path = force_cache_path;
 
     LAYER_LOG("Layer shader configuration");
     LAYER_LOG("==========================");
     LAYER_LOG(" - Disable binary cache: %d", conf_shader_disable_program_cache);
     LAYER_LOG(" - Disable relaxed precision %d", conf_shader_disable_relaxed_precision);
     LAYER_LOG(" - Enable SPIR-V hash fuzzer: %d", conf_shader_enable_fuzz_spirv_hash);
+    LAYER_LOG(" - Transformed shader cache: %u MB", conf_shader_transform_cache_mb);
+    LAYER_LOG(" - Force persistent pipeline cache: %d", conf_shader_force_cache);
+    if (conf_shader_force_cache)
+    {
+        LAYER_LOG("   - Path: %s", force_cache_path.empty() ? "<default>" : force_cache_path.c_str());
+    }
 }
 
 /* See header for documentation. */
@@ -395,6 +450,48 @@ bool LayerConfig::serialize_cmdstream_transfer_post() const
     return conf_serialize_transfer_post;
 }
 
+/* See header for documentation. */
+bool LayerConfig::serialize_cmdstream_window() const
+{
+    return conf_serialize_window;
+}
+
+/* See header for documentation. */
+bool LayerConfig::serialize_cmdstream_window_per_frame() const
+{
+    return conf_serialize_window_per_frame;
+}
+
+/* See header for documentation. */
+uint64_t LayerConfig::serialize_cmdstream_window_first() const
+{
+    return conf_serialize_window_first;
+}
+
+/* See header for documentation. */
+uint64_t LayerConfig::serialize_cmdstream_window_count() const
+{
+    return conf_serialize_window_count;
+}
+
+/* See header for documentation. */
+bool LayerConfig::serialize_cmdstream_window_bisect() const
+{
+    return conf_serialize_window_bisect;
+}
+
+/* See header for documentation. */
+bool LayerConfig::serialize_measure_overlap() const
+{
+    return conf_serialize_measure_overlap;
+}
+
+/* See header for documentation. */
+uint32_t LayerConfig::serialize_measure_overlap_frames() const
+{
+    return conf_serialize_measure_overlap_frames;
+}
+
 /* See header for documentation. */
 bool LayerConfig::shader_disable_cache() const
 {
@@ -413,6 +510,25 @@ bool LayerConfig::shader_fuzz_spirv_hash() const
     return conf_shader_enable_fuzz_spirv_hash;
 }
 
+/* See header for documentation. */
+size_t LayerConfig::shader_transform_cache_size() const
+{
+    return static_cast<size_t>(conf_shader_transform_cache_mb) * 1024 * 1024;
+}
+
+/* See header for documentation. */
+bool LayerConfig::shader_force_cache() const
+{
+    // Disabling caching takes precedence over forcing it
+    return conf_shader_force_cache && !conf_shader_disable_program_cache;
+}
+
+/* See header for documentation. */
+const std::string& LayerConfig::shader_force_cache_path() const
+{
+    return conf_shader_force_cache_path;
+}
+
 /* See header for documentation. */
 bool LayerConfig::framebuffer_disable_all_compression() const
 {
@@ -30,6 +30,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
@@ -123,6 +127,41 @@ public:
      */
     bool serialize_cmdstream_as_build_post() const;
 
+    /**
+     * @brief True if command stream serialization is restricted to a window of workloads.
+     */
+    bool serialize_cmdstream_window() const;
+
+    /**
+     * @brief True if window workload indices count per frame, false if per command buffer.
+     */
+    bool serialize_cmdstream_window_per_frame() const;
+
+    /**
+     * @brief The index of the first workload in the serialization window.
+     */
+    uint64_t serialize_cmdstream_window_first() const;
+
+    /**
+     * @brief The number of workloads in the serialization window, or 0 if unbounded.
+     */
+    uint64_t serialize_cmdstream_window_count() const;
+
+    /**
+     * @brief True if the serialization window is driven by the host bisect service.
+     */
+    bool serialize_cmdstream_window_bisect() const;
+
+    /**
+     * @brief True if config wants to measure the cost of serializing each workload class.
+     */
+    bool serialize_measure_overlap() const;
+
+    /**
+     * @brief The number of frames to measure for each workload class.
+     */
+    uint32_t serialize_measure_overlap_frames() const;
+
     // Config queries for shaders
 
     /**
@@ -140,6 +179,25 @@ public:
      */
     bool shader_fuzz_spirv_hash() const;
 
+    /**
+     * @brief The memory cap of the transformed shader cache, in bytes.
+     *
+     * A value of zero disables the cache.
+     */
+    size_t shader_transform_cache_size() const;
+
+    /**
+     * @brief True if config wants to force use of a persistent pipeline cache.
+     */
+    bool shader_force_cache() const;
+
+    /**
+     * @brief The file path of the persistent pipeline cache.
+     *
+     * An empty path means the platform default location.
+     */
+    const std::string& shader_force_cache_path() const;
+
     // Config queries for framebuffers
 
     /**
@@ -273,6 +331,41 @@ private:
      */
     bool conf_serialize_transfer_post {false};
 
+    /**
+     * @brief True if we restrict command stream serialization to a workload window.
+     */
+    bool conf_serialize_window {false};
+
+    /**
+     * @brief True if window workload indices count per frame.
+     */
+    bool conf_serialize_window_per_frame {false};
+
+    /**
+     * @brief The index of the first workload in the serialization window.
+     */
+    uint64_t conf_serialize_window_first {0};
+
+    /**
+     * @brief The number of workloads in the serialization window, or 0 if unbounded.
+     */
+    uint64_t conf_serialize_window_count {0};
+
+    /**
+     * @brief True if the host bisect service drives the serialization window.
+     */
+    bool conf_serialize_window_bisect {false};
+
+    /**
+     * @brief True if we measure the cost of serializing each workload class.
+     */
+    bool conf_serialize_measure_overlap {false};
+
+    /**
+     * @brief The number of frames to measure for each workload class.
+     */
+    uint32_t conf_serialize_measure_overlap_frames {16};
+
     /**
      * @brief True if we force disable executable binary caching.
      */
@@ -288,6 +381,21 @@ private:
      */
     bool conf_shader_enable_fuzz_spirv_hash {false};
 
+    /**
+     * @brief The memory cap of the transformed shader cache, in MB.
+     */
+    uint32_t conf_shader_transform_cache_mb {32};
+
+    /**
+     * @brief True if we force use of a persistent pipeline cache.
+     */
+    bool conf_shader_force_cache {false};
+
+    /**
+     * @brief The file path of the persistent pipeline cache.
+     */
+    std::string conf_shader_force_cache_path;
+
     /**
      * @brief True if we disable all framebuffer compression.
      *
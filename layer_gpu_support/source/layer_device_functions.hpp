@@ -27,6 +27,46 @@
 
 #include <vulkan/vulkan.h>
 
+// Functions for command buffers
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateCommandPool<user_tag>(VkDevice device,
+                                                                   const VkCommandPoolCreateInfo* pCreateInfo,
+                                                                   const VkAllocationCallbacks* pAllocator,
+                                                                   VkCommandPool* pCommandPool);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL
+    layer_vkAllocateCommandBuffers<user_tag>(VkDevice device,
+                                             const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                             VkCommandBuffer* pCommandBuffers);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkBeginCommandBuffer<user_tag>(VkCommandBuffer commandBuffer,
+                                                                    const VkCommandBufferBeginInfo* pBeginInfo);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR void VKAPI_CALL layer_vkFreeCommandBuffers<user_tag>(VkDevice device,
+                                                                VkCommandPool commandPool,
+                                                                uint32_t commandBufferCount,
+                                                                const VkCommandBuffer* pCommandBuffers);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR void VKAPI_CALL layer_vkDestroyCommandPool<user_tag>(VkDevice device,
+                                                                VkCommandPool commandPool,
+                                                                const VkAllocationCallbacks* pAllocator);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR void VKAPI_CALL layer_vkCmdExecuteCommands<user_tag>(VkCommandBuffer commandBuffer,
+                                                                uint32_t commandBufferCount,
+                                                                const VkCommandBuffer* pCommandBuffers);
+
 // Functions for render passes
 
 /* See Vulkan API for documentation. */
@@ -308,6 +348,10 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueueSubmit2KHR<user_tag>(VkQueue queue,
                                                                  const VkSubmitInfo2* pSubmits,
                                                                  VkFence fence);
 
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueuePresentKHR<user_tag>(VkQueue queue, const VkPresentInfoKHR* pPresentInfo);
+
 // Functions for pipelines
 
 /* See Vulkan API for documentation. */
@@ -361,6 +405,12 @@ VKAPI_ATTR VkResult VKAPI_CALL
                                                    const VkAllocationCallbacks* pAllocator,
                                                    VkPipeline* pPipelines);
 
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR void VKAPI_CALL layer_vkDestroyPipelineCache<user_tag>(VkDevice device,
+                                                                  VkPipelineCache pipelineCache,
+                                                                  const VkAllocationCallbacks* pAllocator);
+
 // Functions for images
 
 /* See Vulkan API for documentation. */
@@ -0,0 +1,182 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+#include "device.hpp"
+#include "framework/device_dispatch_table.hpp"
+
+#include <mutex>
+
+extern std::mutex g_vulkanLock;
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateCommandPool<user_tag>(VkDevice device,
+                                                                   const VkCommandPoolCreateInfo* pCreateInfo,
+                                                                   const VkAllocationCallbacks* pAllocator,
+                                                                   VkCommandPool* pCommandPool)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    VkResult result = layer->driver.vkCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    layer->createCommandPool(*pCommandPool, pCreateInfo->queueFamilyIndex);
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL
+    layer_vkAllocateCommandBuffers<user_tag>(VkDevice device,
+                                             const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                             VkCommandBuffer* pCommandBuffers)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    VkResult result = layer->driver.vkAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    layer->allocateCommandBuffers(pAllocateInfo->commandPool, pAllocateInfo->commandBufferCount, pCommandBuffers);
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkBeginCommandBuffer<user_tag>(VkCommandBuffer commandBuffer,
+                                                                    const VkCommandBufferBeginInfo* pBeginInfo)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(commandBuffer);
+
+    // Recording implicitly resets the command buffer workload indices
+    if (layer->serializationWindow)
+    {
+        layer->serializationWindow->beginCommandBuffer(commandBuffer);
+    }
+
+    // Recording implicitly resets the command buffer, releasing its queries
+    if (layer->overlapMeasurement)
+    {
+        layer->overlapMeasurement->getTimestamps().resetCommandBuffer(commandBuffer);
+    }
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    return layer->driver.vkBeginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR void VKAPI_CALL layer_vkFreeCommandBuffers<user_tag>(VkDevice device,
+                                                                VkCommandPool commandPool,
+                                                                uint32_t commandBufferCount,
+                                                                const VkCommandBuffer* pCommandBuffers)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    for (uint32_t i = 0; i < commandBufferCount; i++)
+    {
+        layer->freeCommandBuffer(commandPool, pCommandBuffers[i]);
+    }
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    layer->driver.vkFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR void VKAPI_CALL layer_vkDestroyCommandPool<user_tag>(VkDevice device,
+                                                                VkCommandPool commandPool,
+                                                                const VkAllocationCallbacks* pAllocator)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    layer->destroyCommandPool(commandPool);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    layer->driver.vkDestroyCommandPool(device, commandPool, pAllocator);
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR void VKAPI_CALL layer_vkCmdExecuteCommands<user_tag>(VkCommandBuffer commandBuffer,
+                                                                uint32_t commandBufferCount,
+                                                                const VkCommandBuffer* pCommandBuffers)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(commandBuffer);
+
+    // Secondary command buffer queries are submitted with the primary
+    if (layer->overlapMeasurement)
+    {
+        auto& timestamps = layer->overlapMeasurement->getTimestamps();
+        for (uint32_t i = 0; i < commandBufferCount; i++)
+        {
+            timestamps.executeCommands(commandBuffer, pCommandBuffers[i]);
+        }
+    }
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    layer->driver.vkCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
@@ -35,25 +35,26 @@ extern std::mutex g_vulkanLock;
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void preDispatch(Device* layer, VkCommandBuffer commandBuffer)
+static void preDispatch(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_compute_dispatch_pre())
+    if (serialize && layer->instance->config.serialize_cmdstream_compute_dispatch_pre())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
 
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
+    layer->beginWorkloadTimestamp(commandBuffer);
 }
 
 /**
@@ -61,25 +62,26 @@ static void preDispatch(Device* layer, VkCommandBuffer commandBuffer)
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void postDispatch(Device* layer, VkCommandBuffer commandBuffer)
+static void postDispatch(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_compute_dispatch_post())
+    layer->endWorkloadTimestamp(commandBuffer);
+
+    if (serialize && layer->instance->config.serialize_cmdstream_compute_dispatch_post())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
-
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
 }
 
 /* See Vulkan API for documentation. */
@@ -94,13 +96,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdDispatch<user_tag>(VkCommandBuffer command
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::COMPUTE);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preDispatch(layer, commandBuffer);
+    preDispatch(layer, commandBuffer, serialize);
     layer->driver.vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
-    postDispatch(layer, commandBuffer);
+    postDispatch(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -118,14 +121,15 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdDispatchBase<user_tag>(VkCommandBuffer com
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::COMPUTE);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preDispatch(layer, commandBuffer);
+    preDispatch(layer, commandBuffer, serialize);
     layer->driver
         .vkCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    postDispatch(layer, commandBuffer);
+    postDispatch(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -143,14 +147,15 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdDispatchBaseKHR<user_tag>(VkCommandBuffer
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::COMPUTE);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preDispatch(layer, commandBuffer);
+    preDispatch(layer, commandBuffer, serialize);
     layer->driver
         .vkCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
-    postDispatch(layer, commandBuffer);
+    postDispatch(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -164,11 +169,12 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdDispatchIndirect<user_tag>(VkCommandBuffer
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::COMPUTE);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preDispatch(layer, commandBuffer);
+    preDispatch(layer, commandBuffer, serialize);
     layer->driver.vkCmdDispatchIndirect(commandBuffer, buffer, offset);
-    postDispatch(layer, commandBuffer);
+    postDispatch(layer, commandBuffer, serialize);
 }
@@ -27,6 +27,7 @@
 
 #include "device.hpp"
 #include "framework/device_dispatch_table.hpp"
+#include "framework/pnext_patch.hpp"
 
 #include <bit>
 #include <mutex>
@@ -36,6 +37,9 @@ extern std::mutex g_vulkanLock;
 /**
  * @brief Determine what compression bitrates are supported for this image.
  *
+ * Results are memoized per physical device, as streaming-heavy applications
+ * create many images with identical configurations.
+ *
  * @param layer         The device context for the layer.
  * @param pCreateInfo   The image configuration to query.
  *
@@ -44,43 +48,27 @@ extern std::mutex g_vulkanLock;
 static VkImageCompressionFixedRateFlagsEXT getSupportedCompressionLevels(Device* layer,
                                                                          const VkImageCreateInfo* pCreateInfo)
 {
-    VkImageCompressionControlEXT compressionInfo {
-        .sType = VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT,
-        .pNext = nullptr,
-        .flags = VK_IMAGE_COMPRESSION_FIXED_RATE_DEFAULT_EXT,
-        .compressionControlPlaneCount = 0,
-        .pFixedRateFlags = 0,
-    };
-
-    VkImageCompressionPropertiesEXT compressionProperties {
-        .sType = VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT,
-        .pNext = nullptr,
-        .imageCompressionFlags = 0,
-        .imageCompressionFixedRateFlags = 0,
-    };
-
-    VkPhysicalDeviceImageFormatInfo2 formatInfo {
-        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2,
-        .pNext = reinterpret_cast<const void*>(&compressionInfo),
-        .format = pCreateInfo->format,
-        .type = pCreateInfo->imageType,
-        .tiling = pCreateInfo->tiling,
-        .usage = pCreateInfo->usage,
-        .flags = pCreateInfo->flags,
-    };
-
-    VkImageFormatProperties2 formatProperties {
-        .sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2,
-        .pNext = reinterpret_cast<void*>(&compressionProperties),
-        .imageFormatProperties = {},
-    };
-
-    auto instance = layer->instance;
-    auto physicalDevice = layer->physicalDevice;
-
-    instance->driver.vkGetPhysicalDeviceImageFormatProperties2(physicalDevice, &formatInfo, &formatProperties);
-
-    return compressionProperties.imageCompressionFixedRateFlags;
+    auto* cache = layer->instance->imageFormatCache.get();
+    auto entry = cache->lookup(layer->physicalDevice, *pCreateInfo);
+    if (entry.result != VK_SUCCESS)
+    {
+        return 0;
+    }
+
+    return entry.compressionFixedRateFlags;
+}
+
+/**
+ * @brief Copy the compression settings from one compression control to another.
+ *
+ * @param dst   The structure to modify.
+ * @param src   The settings to copy.
+ */
+static void setCompressionControl(VkImageCompressionControlEXT& dst, const VkImageCompressionControlEXT& src)
+{
+    dst.flags = src.flags;
+    dst.compressionControlPlaneCount = src.compressionControlPlaneCount;
+    dst.pFixedRateFlags = src.pFixedRateFlags;
 }
 
 /* See Vulkan API for documentation. */
@@ -121,52 +109,54 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateImage<user_tag>(VkDevice device,
         }
     }
 
-    // Create modifiable structures we can patch
-    vku::safe_VkImageCreateInfo safeCreateInfo(pCreateInfo);
-    auto* newCreateInfo = reinterpret_cast<VkImageCreateInfo*>(&safeCreateInfo);
-    // We know we can const-cast here because this is a safe-struct clone
-    void* pNextBase = const_cast<void*>(safeCreateInfo.pNext);
-
-    // Create extra structures we can patch in
+    // Determine the compression settings to apply
     VkImageCompressionControlEXT newCompressionControl = vku::InitStructHelper();
-    VkImageCompressionControlEXT* compressionControl = &newCompressionControl;
-
-    auto* userCompressionControl = vku::FindStructInPNextChain<VkImageCompressionControlEXT>(pNextBase);
-    if (userCompressionControl)
-    {
-        compressionControl = userCompressionControl;
-    }
-
-    bool patchNeeded = compressionControl != userCompressionControl;
-
     if (forceDisable)
     {
-        compressionControl->flags = VK_IMAGE_COMPRESSION_DISABLED_EXT;
-        compressionControl->compressionControlPlaneCount = 0;
-        compressionControl->pFixedRateFlags = nullptr;
+        newCompressionControl.flags = VK_IMAGE_COMPRESSION_DISABLED_EXT;
     }
     else if (forceDefault)
     {
-        compressionControl->flags = VK_IMAGE_COMPRESSION_DEFAULT_EXT;
-        compressionControl->compressionControlPlaneCount = 0;
-        compressionControl->pFixedRateFlags = nullptr;
+        newCompressionControl.flags = VK_IMAGE_COMPRESSION_DEFAULT_EXT;
     }
     else if (selectedLevel)
     {
-        compressionControl->flags = VK_IMAGE_COMPRESSION_FIXED_RATE_EXPLICIT_EXT;
-        compressionControl->compressionControlPlaneCount = 1;
-        compressionControl->pFixedRateFlags = reinterpret_cast<VkImageCompressionFixedRateFlagsEXT*>(&selectedLevel);
+        newCompressionControl.flags = VK_IMAGE_COMPRESSION_FIXED_RATE_EXPLICIT_EXT;
+        newCompressionControl.compressionControlPlaneCount = 1;
+        newCompressionControl.pFixedRateFlags = reinterpret_cast<VkImageCompressionFixedRateFlagsEXT*>(&selectedLevel);
     }
     else
     {
-        patchNeeded = false;
+        return layer->driver.vkCreateImage(device, pCreateInfo, pAllocator, pImage);
     }
 
-    // Add a config if not already configured by the application
-    if (patchNeeded)
+    // Create a shallow copy we can patch, cloning only modified structures
+    StackArena arena;
+    VkImageCreateInfo newCreateInfo = *pCreateInfo;
+
+    // Overwrite the application config if it has one, else add our own
+    auto* compressionControl = clonePNextPath<VkImageCompressionControlEXT>(
+        arena, newCreateInfo.pNext, VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT);
+    if (compressionControl)
+    {
+        setCompressionControl(*compressionControl, newCompressionControl);
+    }
+    else if (!vku::FindStructInPNextChain<VkImageCompressionControlEXT>(pCreateInfo->pNext))
+    {
+        prependPNextStruct(arena, newCreateInfo.pNext, newCompressionControl);
+    }
+    else
     {
-        vku::AddToPnext(safeCreateInfo, *compressionControl);
+        // The application chain has structures we cannot shallow clone, so
+        // fall back to a deep copy of the whole create info
+        vku::safe_VkImageCreateInfo safeCreateInfo(pCreateInfo);
+        // We know we can const-cast here because this is a safe-struct clone
+        void* pNextBase = const_cast<void*>(safeCreateInfo.pNext);
+        auto* userCompressionControl = vku::FindStructInPNextChain<VkImageCompressionControlEXT>(pNextBase);
+        setCompressionControl(*userCompressionControl, newCompressionControl);
+
+        return layer->driver.vkCreateImage(device, safeCreateInfo.ptr(), pAllocator, pImage);
     }
 
-    return layer->driver.vkCreateImage(device, newCreateInfo, pAllocator, pImage);
+    return layer->driver.vkCreateImage(device, &newCreateInfo, pAllocator, pImage);
 }
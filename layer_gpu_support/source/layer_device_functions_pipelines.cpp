@@ -26,106 +26,125 @@
 #include "device.hpp"
 #include "framework/device_dispatch_table.hpp"
 
-#include <map>
+#include "spirv/spirv_passes.hpp"
+#include "spirv/spirv_pipeline.hpp"
+
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <span>
 
 extern std::mutex g_vulkanLock;
 
-// Opcode IDs for interesting SPIR-V opcodes
-static const uint32_t SPIRV_OPCODE_OPDECORATE {71};
-static const uint32_t SPIRV_OPCODE_OPMEMBERDECORATE {72};
-static const uint32_t SPIRV_OPCODE_OPDECORATEID {332};
-static const uint32_t SPIRV_OPCODE_OPDECORATESTRING {5632};
-static const uint32_t SPIRV_OPCODE_OPMEMBERDECORATESTRING {5633};
-
-// Map of decorate opcodes and the word offset of the decoration ID
-static const std::map<uint32_t, size_t> SPIRV_DECORATE_OPCODES {
-    {SPIRV_OPCODE_OPDECORATE, 2},
-    {SPIRV_OPCODE_OPMEMBERDECORATE, 3},
-    {SPIRV_OPCODE_OPDECORATEID, 2},
-    {SPIRV_OPCODE_OPDECORATESTRING, 2},
-    {SPIRV_OPCODE_OPMEMBERDECORATESTRING, 3},
-};
-
-// Decoration IDs for interesting SPIR-V decorations
-static const uint32_t SPIRV_DECORATE_RELAXED_PRECISION {0};
-
 /**
- * @brief Modify a SPIR-V module to remove all use of relaxed precision.
+ * @brief Create the SPIR-V rewrite pipeline for the layer config.
  *
- * @param originalCode   The original binary.
+ * @param layer   The layer device.
  *
- * @return   The modified binary.
+ * @return   The pipeline, which may have no passes.
  */
-static std::vector<uint32_t> remove_relaxed_precision(const std::vector<uint32_t>& originalCode)
+static Spirv::Pipeline createShaderPipeline(const Device& layer)
 {
-    // This module assumes the input SPIR-V is valid
-    std::vector<uint32_t> code;
+    Spirv::Pipeline pipeline;
 
-    // Process SPIR-V header
-    for (size_t i = 0; i < 5; i++)
+    if (layer.instance->config.shader_disable_relaxed_precision())
     {
-        code.push_back(originalCode[i]);
+        pipeline.addPass(std::make_unique<Spirv::RemoveRelaxedPrecisionPass>());
     }
 
-    // Process SPIR-V opcode payload
-    for (size_t i = 5; i < originalCode.size(); /* Increment in loop. */)
+    if (layer.instance->config.shader_fuzz_spirv_hash())
     {
-        uint32_t opWord0 = originalCode[i];
-
-        uint32_t opCode {opWord0 & 0xFFFF};
-        uint32_t opWordCount {opWord0 >> 16};
-
-        // This should never happen, but avoids infinite loop on bad input
-        if (opWordCount == 0)
-        {
-            LAYER_ERR("SPIR-V opcode has zero length");
-            break;
-        }
+        pipeline.addPass(std::make_unique<Spirv::AppendNopPass>());
+    }
 
-        bool keep {true};
-        if (isInMap(opCode, SPIRV_DECORATE_OPCODES))
-        {
-            size_t offset = SPIRV_DECORATE_OPCODES.at(opCode);
-            uint32_t decoration = originalCode[i + offset];
-            if (decoration == SPIRV_DECORATE_RELAXED_PRECISION)
-            {
-                keep = false;
-            }
-        }
+    return pipeline;
+}
 
-        if (keep)
-        {
-            for (size_t opI = 0; opI < opWordCount; opI++)
-            {
-                code.push_back(originalCode[i + opI]);
-            }
-        }
+/**
+ * @brief Select the pipeline cache to use for a pipeline creation call.
+ *
+ * @param layer           The layer device.
+ * @param pipelineCache   The pipeline cache passed by the application.
+ * @param cacheLock       The lock to hold while using the persistent cache.
+ *
+ * @return   The pipeline cache to pass to the driver.
+ */
+static VkPipelineCache selectPipelineCache(Device& layer,
+                                           VkPipelineCache pipelineCache,
+                                           std::shared_lock<std::shared_mutex>& cacheLock)
+{
+    if (layer.instance->config.shader_disable_cache())
+    {
+        return VK_NULL_HANDLE;
+    }
 
-        i += opWordCount;
+    // Inject the persistent cache if the application did not provide one
+    if (pipelineCache == VK_NULL_HANDLE && layer.pipelineCache)
+    {
+        cacheLock = std::shared_lock<std::shared_mutex>(layer.pipelineCache->lock);
+        return layer.pipelineCache->getHandle();
     }
 
-    // Return the modified program
-    return code;
+    return pipelineCache;
 }
 
 /**
- * @brief Modify a SPIR-V module so it functionally the same with a different hash.
+ * @brief Get the bitmask of active transform options, used in cache keys.
  *
- * @param originalCode   The original binary.
+ * @param layer   The layer device.
+ */
+static uint64_t getShaderTransformConfig(const Device& layer)
+{
+    uint64_t config = 0;
+    config |= layer.instance->config.shader_disable_relaxed_precision() ? (1 << 0) : 0;
+    config |= layer.instance->config.shader_fuzz_spirv_hash() ? (1 << 1) : 0;
+    return config;
+}
+
+/**
+ * @brief Transform a SPIR-V module, using the shader cache if enabled.
+ *
+ * @param layer      The layer device.
+ * @param pipeline   The SPIR-V rewrite pipeline.
+ * @param code       The input SPIR-V code.
  *
- * @return   The modified binary.
+ * @return   The transformed code, or null if the code is unmodified.
  */
-static std::vector<uint32_t> fuzz_spirv(const std::vector<uint32_t>& originalCode)
+static ShaderCache::Code transformShader(Device& layer,
+                                         Spirv::Pipeline& pipeline,
+                                         std::span<const uint32_t> code)
 {
-    // This module assumes the input SPIR-V is valid
-    std::vector<uint32_t> code = originalCode;
+    if (pipeline.empty())
+    {
+        return nullptr;
+    }
+
+    uint64_t key = 0;
+    if (layer.shaderCache)
+    {
+        key = ShaderCache::getKey(code, getShaderTransformConfig(layer));
+
+        ShaderCache::Code cachedCode;
+        if (layer.shaderCache->lookup(key, code, cachedCode))
+        {
+            return cachedCode;
+        }
+    }
+
+    auto newCode = pipeline.run(code);
+
+    ShaderCache::Code storedCode;
+    if (pipeline.isModified())
+    {
+        storedCode = std::make_shared<const std::vector<uint32_t>>(newCode.begin(), newCode.end());
+    }
 
-    // Opcode NOP = 1 word, Opcode ID 0
-    uint32_t opNOP = (1 << 16) | 0;
-    code.push_back(opNOP);
+    if (layer.shaderCache)
+    {
+        layer.shaderCache->insert(key, code, storedCode);
+    }
 
-    return code;
+    return storedCode;
 }
 
 /* See Vulkan API for documentation. */
@@ -144,24 +163,18 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateShaderModule<user_tag>(VkDevice dev
     // Release the lock to call into the driver
     lock.unlock();
 
-    // Create a copy of the code that we can modify
-    std::vector<uint32_t> code;
-    code.assign(pCreateInfo->pCode, pCreateInfo->pCode + (pCreateInfo->codeSize / sizeof(uint32_t)));
-
-    if (layer->instance->config.shader_disable_relaxed_precision())
-    {
-        code = remove_relaxed_precision(code);
-    }
+    // Transform the code, which returns null if not modified
+    auto pipeline = createShaderPipeline(*layer);
+    std::span<const uint32_t> code(pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t));
+    auto newCode = transformShader(*layer, pipeline, code);
 
-    if (layer->instance->config.shader_fuzz_spirv_hash())
+    VkShaderModuleCreateInfo newCreateInfo = *pCreateInfo;
+    if (newCode)
     {
-        code = fuzz_spirv(code);
+        newCreateInfo.pCode = newCode->data();
+        newCreateInfo.codeSize = newCode->size() * sizeof(uint32_t);
     }
 
-    VkShaderModuleCreateInfo newCreateInfo = *pCreateInfo;
-    newCreateInfo.pCode = code.data();
-    newCreateInfo.codeSize = code.size() * sizeof(uint32_t);
-
     return layer->driver.vkCreateShaderModule(device, &newCreateInfo, pAllocator, pShaderModule);
 }
 
@@ -183,7 +196,11 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateShadersEXT<user_tag>(VkDevice devic
     std::vector<VkShaderCreateInfoEXT> newCreateInfo;
     newCreateInfo.resize(createInfoCount);
 
-    std::vector<std::vector<uint32_t>> newCodes;
+    auto pipeline = createShaderPipeline(*layer);
+
+    // Keep the transformed code alive until the driver call returns
+    std::vector<ShaderCache::Code> newCodes;
+
     for (uint32_t i = 0; i < createInfoCount; i++)
     {
         newCreateInfo[i] = pCreateInfos[i];
@@ -196,30 +213,23 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateShadersEXT<user_tag>(VkDevice devic
 
         // Preprocess SPIR-V shaders
         const uint32_t* pCode = static_cast<const uint32_t*>(newCreateInfo[i].pCode);
-        uint32_t codeWords = newCreateInfo[i].codeSize / sizeof(uint32_t);
-
-        std::vector<uint32_t> newCode;
-        newCode.assign(pCode, pCode + codeWords);
-
-        if (layer->instance->config.shader_disable_relaxed_precision())
-        {
-            newCode = remove_relaxed_precision(newCode);
-        }
+        size_t codeWords = newCreateInfo[i].codeSize / sizeof(uint32_t);
 
-        if (layer->instance->config.shader_fuzz_spirv_hash())
+        auto newCode = transformShader(*layer, pipeline, std::span<const uint32_t>(pCode, codeWords));
+        if (!newCode)
         {
-            newCode = fuzz_spirv(newCode);
+            continue;
         }
 
         // Patch the descriptors
+        newCreateInfo[i].pCode = newCode->data();
+        newCreateInfo[i].codeSize = newCode->size() * sizeof(uint32_t);
         newCodes.push_back(std::move(newCode));
-        newCreateInfo[i].pCode = newCodes[newCodes.size() - 1].data();
-        newCreateInfo[i].codeSize = newCodes[newCodes.size() - 1].size() * sizeof(uint32_t);
     }
 
     // Release the lock to call into the driver
     lock.unlock();
-    auto result = layer->driver.vkCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders);
+    auto result = layer->driver.vkCreateShadersEXT(device, createInfoCount, newCreateInfo.data(), pAllocator, pShaders);
 
     // On error just return
     if ((result != VK_SUCCESS) && (result != VK_INCOMPATIBLE_SHADER_BINARY_EXT))
@@ -301,13 +311,11 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateComputePipelines<user_tag>(VkDevice
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(device);
 
-    if (layer->instance->config.shader_disable_cache())
-    {
-        pipelineCache = VK_NULL_HANDLE;
-    }
-
     // Release the lock to call into the driver
     lock.unlock();
+
+    std::shared_lock<std::shared_mutex> cacheLock;
+    pipelineCache = selectPipelineCache(*layer, pipelineCache, cacheLock);
     return layer->driver
         .vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 }
@@ -328,13 +336,11 @@ VKAPI_ATTR VkResult VKAPI_CALL
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(device);
 
-    if (layer->instance->config.shader_disable_cache())
-    {
-        pipelineCache = VK_NULL_HANDLE;
-    }
-
     // Release the lock to call into the driver
     lock.unlock();
+
+    std::shared_lock<std::shared_mutex> cacheLock;
+    pipelineCache = selectPipelineCache(*layer, pipelineCache, cacheLock);
     return layer->driver
         .vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 }
@@ -356,13 +362,11 @@ VKAPI_ATTR VkResult VKAPI_CALL
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(device);
 
-    if (layer->instance->config.shader_disable_cache())
-    {
-        pipelineCache = VK_NULL_HANDLE;
-    }
-
     // Release the lock to call into the driver
     lock.unlock();
+
+    std::shared_lock<std::shared_mutex> cacheLock;
+    pipelineCache = selectPipelineCache(*layer, pipelineCache, cacheLock);
     return layer->driver.vkCreateRayTracingPipelinesKHR(device,
                                                         deferredOperation,
                                                         pipelineCache,
@@ -371,3 +375,27 @@ VKAPI_ATTR VkResult VKAPI_CALL
                                                         pAllocator,
                                                         pPipelines);
 }
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR void VKAPI_CALL layer_vkDestroyPipelineCache<user_tag>(VkDevice device,
+                                                                  VkPipelineCache pipelineCache,
+                                                                  const VkAllocationCallbacks* pAllocator)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+
+    // Merge application caches into the persistent cache before they are lost
+    if (layer->pipelineCache)
+    {
+        layer->pipelineCache->merge(pipelineCache);
+    }
+
+    layer->driver.vkDestroyPipelineCache(device, pipelineCache, pAllocator);
+}
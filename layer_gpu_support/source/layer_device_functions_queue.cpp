@@ -25,80 +25,371 @@
 
 #include "device.hpp"
 #include "framework/device_dispatch_table.hpp"
+#include "framework/pnext_patch.hpp"
+#include "framework/timestamp_queries.hpp"
+#include "framework/utils.hpp"
 
 #include <mutex>
+#include <vector>
 
 extern std::mutex g_vulkanLock;
 
-/* See Vulkan API for documentation. */
-template<>
-VKAPI_ATTR VkResult VKAPI_CALL
-    layer_vkQueueSubmit<user_tag>(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
+/**
+ * @brief Splice a timeline semaphore wait and/or signal into a submit.
+ *
+ * The submit is patched in place, with all modified arrays and pNext chain
+ * structures copied into the arena.
+ *
+ * @param arena         The arena for patched structures.
+ * @param submit        The submit to patch.
+ * @param semaphore     The timeline semaphore.
+ * @param waitValue     The value to wait for, or @c nullptr for no wait.
+ * @param signalValue   The value to signal, or @c nullptr for no signal.
+ *
+ * @return @c true on success, @c false if the pNext chain contains a
+ *         structure that cannot be patched.
+ */
+static bool spliceTimelineSemaphore(StackArena& arena,
+                                    VkSubmitInfo& submit,
+                                    VkSemaphore semaphore,
+                                    const uint64_t* waitValue,
+                                    const uint64_t* signalValue)
 {
-    LAYER_TRACE(__func__);
+    // Clone the pNext chain so we can patch the count-dependent structures
+    VkTimelineSemaphoreSubmitInfo* timelineInfo {nullptr};
+    VkDeviceGroupSubmitInfo* deviceGroupInfo {nullptr};
 
-    // Hold the lock to access layer-wide global store
-    std::unique_lock<std::mutex> lock {g_vulkanLock};
-    auto* layer = Device::retrieve(queue);
+    VkBaseOutStructure* head {nullptr};
+    VkBaseOutStructure* tail {nullptr};
 
-    // Serialize in the order submits are called
-    // TODO: This assumes a forward progress guarantee which is no longer
-    // guaranteed if the user is using timeline semaphores for syncs
+    auto* next = reinterpret_cast<const VkBaseInStructure*>(submit.pNext);
+    while (next)
+    {
+        VkBaseOutStructure* copy = clonePNextStruct(arena, next);
+        if (!copy)
+        {
+            return false;
+        }
+
+        if (copy->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+        {
+            timelineInfo = reinterpret_cast<VkTimelineSemaphoreSubmitInfo*>(copy);
+        }
+        else if (copy->sType == VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO)
+        {
+            deviceGroupInfo = reinterpret_cast<VkDeviceGroupSubmitInfo*>(copy);
+        }
+
+        copy->pNext = nullptr;
+        (tail ? tail->pNext : head) = copy;
+        tail = copy;
+        next = next->pNext;
+    }
 
-    const uint64_t waitValue = layer->queueSerializationTimelineSemCount;
-    layer->queueSerializationTimelineSemCount++;
-    const uint64_t signalValue = layer->queueSerializationTimelineSemCount;
+    // Add a timeline info if the application did not provide one
+    if (!timelineInfo)
+    {
+        timelineInfo = arena.allocate<VkTimelineSemaphoreSubmitInfo>(1);
+        *timelineInfo = {
+            .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .waitSemaphoreValueCount = 0,
+            .pWaitSemaphoreValues = nullptr,
+            .signalSemaphoreValueCount = 0,
+            .pSignalSemaphoreValues = nullptr,
+        };
+
+        auto* copy = reinterpret_cast<VkBaseOutStructure*>(timelineInfo);
+        (tail ? tail->pNext : head) = copy;
+        tail = copy;
+    }
 
-    VkPipelineStageFlags waitMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-
-    VkTimelineSemaphoreSubmitInfo timelineInfo {
-        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
-        .pNext = nullptr,
-        .waitSemaphoreValueCount = 1,
-        .pWaitSemaphoreValues = &waitValue,
-        .signalSemaphoreValueCount = 1,
-        .pSignalSemaphoreValues = &signalValue,
-    };
-
-    VkSubmitInfo submitInfoPre {
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-        .pNext = &timelineInfo,
-        .waitSemaphoreCount = 1,
-        .pWaitSemaphores = &(layer->queueSerializationTimelineSem),
-        .pWaitDstStageMask = &waitMask,
-        .commandBufferCount = 0,
-        .pCommandBuffers = 0,
-        .signalSemaphoreCount = 0,
-        .pSignalSemaphores = nullptr,
-    };
-
-    VkSubmitInfo submitInfoPost {
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-        .pNext = &timelineInfo,
-        .waitSemaphoreCount = 0,
-        .pWaitSemaphores = 0,
-        .pWaitDstStageMask = 0,
-        .commandBufferCount = 0,
-        .pCommandBuffers = 0,
-        .signalSemaphoreCount = 1,
-        .pSignalSemaphores = &(layer->queueSerializationTimelineSem),
-    };
+    submit.pNext = head;
 
-    // Release the lock to call into the driver
-    lock.unlock();
+    if (waitValue)
+    {
+        uint32_t count = submit.waitSemaphoreCount;
+
+        auto* semaphores = arena.copy(submit.pWaitSemaphores, count, 1);
+        semaphores[count] = semaphore;
+        submit.pWaitSemaphores = semaphores;
+
+        auto* stages = arena.copy(submit.pWaitDstStageMask, count, 1);
+        stages[count] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        submit.pWaitDstStageMask = stages;
+
+        // Values are ignored for binary semaphores, so may be omitted by
+        // the application if it only uses binary semaphores
+        bool hasValues = timelineInfo->waitSemaphoreValueCount == count;
+        auto* values = arena.allocate<uint64_t>(count + 1);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            values[i] = hasValues ? timelineInfo->pWaitSemaphoreValues[i] : 0;
+        }
+
+        values[count] = *waitValue;
+        timelineInfo->waitSemaphoreValueCount = count + 1;
+        timelineInfo->pWaitSemaphoreValues = values;
+
+        if (deviceGroupInfo && deviceGroupInfo->waitSemaphoreCount == count)
+        {
+            auto* indices = arena.copy(deviceGroupInfo->pWaitSemaphoreDeviceIndices, count, 1);
+            indices[count] = 0;
+            deviceGroupInfo->waitSemaphoreCount = count + 1;
+            deviceGroupInfo->pWaitSemaphoreDeviceIndices = indices;
+        }
+
+        submit.waitSemaphoreCount = count + 1;
+    }
 
-    if (layer->instance->config.serialize_queue())
+    if (signalValue)
     {
-        layer->driver.vkQueueSubmit(queue, 1, &submitInfoPre, VK_NULL_HANDLE);
+        uint32_t count = submit.signalSemaphoreCount;
+
+        auto* semaphores = arena.copy(submit.pSignalSemaphores, count, 1);
+        semaphores[count] = semaphore;
+        submit.pSignalSemaphores = semaphores;
+
+        bool hasValues = timelineInfo->signalSemaphoreValueCount == count;
+        auto* values = arena.allocate<uint64_t>(count + 1);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            values[i] = hasValues ? timelineInfo->pSignalSemaphoreValues[i] : 0;
+        }
+
+        values[count] = *signalValue;
+        timelineInfo->signalSemaphoreValueCount = count + 1;
+        timelineInfo->pSignalSemaphoreValues = values;
+
+        if (deviceGroupInfo && deviceGroupInfo->signalSemaphoreCount == count)
+        {
+            auto* indices = arena.copy(deviceGroupInfo->pSignalSemaphoreDeviceIndices, count, 1);
+            indices[count] = 0;
+            deviceGroupInfo->signalSemaphoreCount = count + 1;
+            deviceGroupInfo->pSignalSemaphoreDeviceIndices = indices;
+        }
+
+        submit.signalSemaphoreCount = count + 1;
     }
 
-    auto result = layer->driver.vkQueueSubmit(queue, submitCount, pSubmits, fence);
+    return true;
+}
+
+/**
+ * @brief Splice a timeline semaphore wait and/or signal into a submit.
+ *
+ * The submit is patched in place, with all modified arrays copied into the
+ * arena.
+ *
+ * @param arena    The arena for patched structures.
+ * @param submit   The submit to patch.
+ * @param wait     The semaphore wait to add, or @c nullptr for no wait.
+ * @param signal   The semaphore signal to add, or @c nullptr for no signal.
+ */
+static void spliceTimelineSemaphore(StackArena& arena,
+                                    VkSubmitInfo2& submit,
+                                    const VkSemaphoreSubmitInfo* wait,
+                                    const VkSemaphoreSubmitInfo* signal)
+{
+    if (wait)
+    {
+        uint32_t count = submit.waitSemaphoreInfoCount;
+        auto* infos = arena.copy(submit.pWaitSemaphoreInfos, count, 1);
+        infos[count] = *wait;
+        submit.waitSemaphoreInfoCount = count + 1;
+        submit.pWaitSemaphoreInfos = infos;
+    }
+
+    if (signal)
+    {
+        uint32_t count = submit.signalSemaphoreInfoCount;
+        auto* infos = arena.copy(submit.pSignalSemaphoreInfos, count, 1);
+        infos[count] = *signal;
+        submit.signalSemaphoreInfoCount = count + 1;
+        submit.pSignalSemaphoreInfos = infos;
+    }
+}
+
+/**
+ * @brief Collect the timestamp queries written by the command buffers in a submit.
+ *
+ * This is a no-op if overlap measurement is disabled. Must be called with the
+ * layer-wide lock held.
+ *
+ * @param layer         The layer device.
+ * @param submitCount   The number of submits.
+ * @param pSubmits      The submits.
+ * @param queries       The list of timestamp queries to append to.
+ */
+static void collectTimestampQueries(Device& layer,
+                                    uint32_t submitCount,
+                                    const VkSubmitInfo* pSubmits,
+                                    std::vector<TimestampQuery>& queries)
+{
+    if (!layer.overlapMeasurement)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < submitCount; i++)
+    {
+        const auto& submit = pSubmits[i];
+        for (uint32_t j = 0; j < submit.commandBufferCount; j++)
+        {
+            layer.overlapMeasurement->collectQueries(submit.pCommandBuffers[j], queries);
+        }
+    }
+}
+
+/**
+ * @brief Collect the timestamp queries written by the command buffers in a submit.
+ *
+ * This is a no-op if overlap measurement is disabled. Must be called with the
+ * layer-wide lock held.
+ *
+ * @param layer         The layer device.
+ * @param submitCount   The number of submits.
+ * @param pSubmits      The submits.
+ * @param queries       The list of timestamp queries to append to.
+ */
+static void collectTimestampQueries(Device& layer,
+                                    uint32_t submitCount,
+                                    const VkSubmitInfo2* pSubmits,
+                                    std::vector<TimestampQuery>& queries)
+{
+    if (!layer.overlapMeasurement)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < submitCount; i++)
+    {
+        const auto& submit = pSubmits[i];
+        for (uint32_t j = 0; j < submit.commandBufferInfoCount; j++)
+        {
+            layer.overlapMeasurement->collectQueries(submit.pCommandBufferInfos[j].commandBuffer, queries);
+        }
+    }
+}
+
+/**
+ * @brief Submit a layer-owned fence to track completion of timed workloads.
+ *
+ * This must be called without the layer-wide lock held, after the application
+ * submit.
+ *
+ * @param layer     The layer device.
+ * @param queue     The queue being submitted to.
+ * @param queries   The timestamp queries written by the application submit.
+ */
+static void submitTimestampFence(Device& layer, VkQueue queue, std::vector<TimestampQuery>&& queries)
+{
+    auto* overlap = layer.overlapMeasurement.get();
+    if (!overlap)
+    {
+        return;
+    }
+
+    submitTimestampFence(overlap->getTimestamps(),
+                         layer.driver,
+                         layer.device,
+                         queue,
+                         std::move(queries),
+                         g_vulkanLock,
+                         [overlap]()
+                         {
+                             overlap->poll();
+                         });
+}
+
+/**
+ * @brief Submit to a queue using VkQueueSubmit2 or VkQueueSubmit2KHR.
+ *
+ * @param lock           The held layer-wide lock, which is released before
+ *                       calling into the driver.
+ * @param layer          The layer device.
+ * @param fpQueueSubmit  The driver function to call.
+ * @param queue          The queue to submit to.
+ * @param submitCount    The number of submits.
+ * @param pSubmits       The submits.
+ * @param fence          The fence to signal.
+ */
+static VkResult queueSubmit2(std::unique_lock<std::mutex>& lock,
+                             Device* layer,
+                             PFN_vkQueueSubmit2 fpQueueSubmit,
+                             VkQueue queue,
+                             uint32_t submitCount,
+                             const VkSubmitInfo2* pSubmits,
+                             VkFence fence)
+{
+    VkResult result;
+
+    std::vector<TimestampQuery> timestampQueries;
+    collectTimestampQueries(*layer, submitCount, pSubmits, timestampQueries);
 
     if (layer->instance->config.serialize_queue())
     {
-        layer->driver.vkQueueSubmit(queue, 1, &submitInfoPost, VK_NULL_HANDLE);
+        // Serialize in the order submits are called
+        // TODO: This assumes a forward progress guarantee which is no longer
+        // guaranteed if the user is using timeline semaphores for syncs
+        const uint64_t waitValue = layer->queueSerializationTimelineSemCount;
+        layer->queueSerializationTimelineSemCount++;
+        const uint64_t signalValue = layer->queueSerializationTimelineSemCount;
+
+        VkSemaphoreSubmitInfo timelineInfoPre {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .semaphore = layer->queueSerializationTimelineSem,
+            .value = waitValue,
+            .stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
+        };
+
+        VkSemaphoreSubmitInfo timelineInfoPost {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .semaphore = layer->queueSerializationTimelineSem,
+            .value = signalValue,
+            .stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
+        };
+
+        // Splice the wait into the first submit and the signal into the last
+        // submit, adding an empty submit if the application has none
+        StackArena arena;
+        uint32_t newSubmitCount = submitCount ? submitCount : 1;
+        auto* newSubmits = arena.copy(pSubmits, submitCount, newSubmitCount - submitCount);
+        if (!submitCount)
+        {
+            newSubmits[0] = {
+                .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+                .pNext = nullptr,
+                .flags = 0,
+                .waitSemaphoreInfoCount = 0,
+                .pWaitSemaphoreInfos = nullptr,
+                .commandBufferInfoCount = 0,
+                .pCommandBufferInfos = nullptr,
+                .signalSemaphoreInfoCount = 0,
+                .pSignalSemaphoreInfos = nullptr,
+            };
+        }
+
+        spliceTimelineSemaphore(arena, newSubmits[0], &timelineInfoPre, nullptr);
+        spliceTimelineSemaphore(arena, newSubmits[newSubmitCount - 1], nullptr, &timelineInfoPost);
+
+        // Release the lock to call into the driver
+        lock.unlock();
+        result = fpQueueSubmit(queue, newSubmitCount, newSubmits, fence);
+    }
+    else
+    {
+        // Release the lock to call into the driver
+        lock.unlock();
+        result = fpQueueSubmit(queue, submitCount, pSubmits, fence);
     }
 
+    submitTimestampFence(*layer, queue, std::move(timestampQueries));
+
     if (layer->instance->config.serialize_queue_wait_idle())
     {
         layer->driver.vkDeviceWaitIdle(layer->device);
@@ -110,7 +401,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 /* See Vulkan API for documentation. */
 template<>
 VKAPI_ATTR VkResult VKAPI_CALL
-    layer_vkQueueSubmit2<user_tag>(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence)
+    layer_vkQueueSubmit<user_tag>(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence)
 {
     LAYER_TRACE(__func__);
 
@@ -118,70 +409,112 @@ VKAPI_ATTR VkResult VKAPI_CALL
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(queue);
 
+    std::vector<TimestampQuery> timestampQueries;
+    collectTimestampQueries(*layer, submitCount, pSubmits, timestampQueries);
+
+    if (!layer->instance->config.serialize_queue())
+    {
+        // Release the lock to call into the driver
+        lock.unlock();
+        auto result = layer->driver.vkQueueSubmit(queue, submitCount, pSubmits, fence);
+        submitTimestampFence(*layer, queue, std::move(timestampQueries));
+
+        if (layer->instance->config.serialize_queue_wait_idle())
+        {
+            layer->driver.vkDeviceWaitIdle(layer->device);
+        }
+
+        return result;
+    }
+
     // Serialize in the order submits are called
     // TODO: This assumes a forward progress guarantee which is no longer
     // guaranteed if the user is using timeline semaphores for syncs
-
     const uint64_t waitValue = layer->queueSerializationTimelineSemCount;
     layer->queueSerializationTimelineSemCount++;
     const uint64_t signalValue = layer->queueSerializationTimelineSemCount;
 
-    VkSemaphoreSubmitInfo timelineInfoPre {
-        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-        .pNext = nullptr,
-        .semaphore = layer->queueSerializationTimelineSem,
-        .value = waitValue,
-        .stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-        .deviceIndex = 0,
-    };
-
-    VkSemaphoreSubmitInfo timelineInfoPost {
-        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-        .pNext = nullptr,
-        .semaphore = layer->queueSerializationTimelineSem,
-        .value = signalValue,
-        .stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-        .deviceIndex = 0,
-    };
-
-    VkSubmitInfo2 submitInfoPre {
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-        .pNext = nullptr,
-        .flags = 0,
-        .waitSemaphoreInfoCount = 1,
-        .pWaitSemaphoreInfos = &timelineInfoPre,
-        .commandBufferInfoCount = 0,
-        .pCommandBufferInfos = nullptr,
-        .signalSemaphoreInfoCount = 0,
-        .pSignalSemaphoreInfos = nullptr,
-    };
-
-    VkSubmitInfo2 submitInfoPost {
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-        .pNext = nullptr,
-        .flags = 0,
-        .waitSemaphoreInfoCount = 0,
-        .pWaitSemaphoreInfos = nullptr,
-        .commandBufferInfoCount = 0,
-        .pCommandBufferInfos = nullptr,
-        .signalSemaphoreInfoCount = 1,
-        .pSignalSemaphoreInfos = &timelineInfoPost,
-    };
+    VkSemaphore semaphore = layer->queueSerializationTimelineSem;
 
-    // Release the lock to call into the driver
-    lock.unlock();
+    // Splice the wait into the first submit and the signal into the last
+    // submit, adding an empty submit if the application has none
+    StackArena arena;
+    uint32_t newSubmitCount = submitCount ? submitCount : 1;
+    auto* newSubmits = arena.copy(pSubmits, submitCount, newSubmitCount - submitCount);
+    if (!submitCount)
+    {
+        newSubmits[0] = {
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .waitSemaphoreCount = 0,
+            .pWaitSemaphores = nullptr,
+            .pWaitDstStageMask = nullptr,
+            .commandBufferCount = 0,
+            .pCommandBuffers = nullptr,
+            .signalSemaphoreCount = 0,
+            .pSignalSemaphores = nullptr,
+        };
+    }
 
-    if (layer->instance->config.serialize_queue())
+    bool spliced = spliceTimelineSemaphore(arena, newSubmits[0], semaphore, &waitValue, nullptr);
+    if (spliced)
     {
-        layer->driver.vkQueueSubmit2(queue, 1, &submitInfoPre, VK_NULL_HANDLE);
+        spliced = spliceTimelineSemaphore(arena, newSubmits[newSubmitCount - 1], semaphore, nullptr, &signalValue);
     }
 
-    auto result = layer->driver.vkQueueSubmit2(queue, submitCount, pSubmits, fence);
+    // Release the lock to call into the driver
+    lock.unlock();
 
-    if (layer->instance->config.serialize_queue())
+    VkResult result;
+    if (spliced)
     {
-        layer->driver.vkQueueSubmit2(queue, 1, &submitInfoPost, VK_NULL_HANDLE);
+        result = layer->driver.vkQueueSubmit(queue, newSubmitCount, newSubmits, fence);
     }
+    else
+    {
+        // The submit has a pNext chain we cannot patch, so use separate
+        // submits to wait and signal the serialization semaphore
+        VkPipelineStageFlags waitMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        VkTimelineSemaphoreSubmitInfo timelineInfo {
+            .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .waitSemaphoreValueCount = 1,
+            .pWaitSemaphoreValues = &waitValue,
+            .signalSemaphoreValueCount = 1,
+            .pSignalSemaphoreValues = &signalValue,
+        };
+
+        VkSubmitInfo submitInfoPre {
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .pNext = &timelineInfo,
+            .waitSemaphoreCount = 1,
+            .pWaitSemaphores = &semaphore,
+            .pWaitDstStageMask = &waitMask,
+            .commandBufferCount = 0,
+            .pCommandBuffers = 0,
+            .signalSemaphoreCount = 0,
+            .pSignalSemaphores = nullptr,
+        };
+
+        VkSubmitInfo submitInfoPost {
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .pNext = &timelineInfo,
+            .waitSemaphoreCount = 0,
+            .pWaitSemaphores = 0,
+            .pWaitDstStageMask = 0,
+            .commandBufferCount = 0,
+            .pCommandBuffers = 0,
+            .signalSemaphoreCount = 1,
+            .pSignalSemaphores = &semaphore,
+        };
+
+        layer->driver.vkQueueSubmit(queue, 1, &submitInfoPre, VK_NULL_HANDLE);
+        result = layer->driver.vkQueueSubmit(queue, submitCount, pSubmits, fence);
+        layer->driver.vkQueueSubmit(queue, 1, &submitInfoPost, VK_NULL_HANDLE);
+    }
+
+    submitTimestampFence(*layer, queue, std::move(timestampQueries));
 
     if (layer->instance->config.serialize_queue_wait_idle())
     {
@@ -194,7 +527,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 /* See Vulkan API for documentation. */
 template<>
 VKAPI_ATTR VkResult VKAPI_CALL
-    layer_vkQueueSubmit2KHR<user_tag>(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence)
+    layer_vkQueueSubmit2<user_tag>(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence)
 {
     LAYER_TRACE(__func__);
 
@@ -202,74 +535,52 @@ VKAPI_ATTR VkResult VKAPI_CALL
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(queue);
 
-    // Serialize in the order submits are called
-    // TODO: This assumes a forward progress guarantee which is no longer
-    // guaranteed if the user is using timeline semaphores for syncs
+    return queueSubmit2(lock, layer, layer->driver.vkQueueSubmit2, queue, submitCount, pSubmits, fence);
+}
 
-    const uint64_t waitValue = layer->queueSerializationTimelineSemCount;
-    layer->queueSerializationTimelineSemCount++;
-    const uint64_t signalValue = layer->queueSerializationTimelineSemCount;
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL
+    layer_vkQueueSubmit2KHR<user_tag>(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence)
+{
+    LAYER_TRACE(__func__);
 
-    VkSemaphoreSubmitInfo timelineInfoPre {
-        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-        .pNext = nullptr,
-        .semaphore = layer->queueSerializationTimelineSem,
-        .value = waitValue,
-        .stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-        .deviceIndex = 0,
-    };
-
-    VkSemaphoreSubmitInfo timelineInfoPost {
-        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-        .pNext = nullptr,
-        .semaphore = layer->queueSerializationTimelineSem,
-        .value = signalValue,
-        .stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-        .deviceIndex = 0,
-    };
-
-    VkSubmitInfo2 submitInfoPre {
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-        .pNext = nullptr,
-        .flags = 0,
-        .waitSemaphoreInfoCount = 1,
-        .pWaitSemaphoreInfos = &timelineInfoPre,
-        .commandBufferInfoCount = 0,
-        .pCommandBufferInfos = nullptr,
-        .signalSemaphoreInfoCount = 0,
-        .pSignalSemaphoreInfos = nullptr,
-    };
-
-    VkSubmitInfo2 submitInfoPost {
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-        .pNext = nullptr,
-        .flags = 0,
-        .waitSemaphoreInfoCount = 0,
-        .pWaitSemaphoreInfos = nullptr,
-        .commandBufferInfoCount = 0,
-        .pCommandBufferInfos = nullptr,
-        .signalSemaphoreInfoCount = 1,
-        .pSignalSemaphoreInfos = &timelineInfoPost,
-    };
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(queue);
 
-    // Release the lock to call into the driver
-    lock.unlock();
+    return queueSubmit2(lock, layer, layer->driver.vkQueueSubmit2KHR, queue, submitCount, pSubmits, fence);
+}
 
-    if (layer->instance->config.serialize_queue())
-    {
-        layer->driver.vkQueueSubmit2KHR(queue, 1, &submitInfoPre, VK_NULL_HANDLE);
-    }
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueuePresentKHR<user_tag>(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+    LAYER_TRACE(__func__);
 
-    auto result = layer->driver.vkQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(queue);
 
-    if (layer->instance->config.serialize_queue())
-    {
-        layer->driver.vkQueueSubmit2KHR(queue, 1, &submitInfoPost, VK_NULL_HANDLE);
-    }
+    // Release the lock to call into the driver
+    lock.unlock();
+    VkResult result = layer->driver.vkQueuePresentKHR(queue, pPresentInfo);
 
-    if (layer->instance->config.serialize_queue_wait_idle())
+    // Present is the frame boundary for the overlap measurement and the
+    // serialization window
+    if (layer->overlapMeasurement || layer->serializationWindow)
     {
-        layer->driver.vkDeviceWaitIdle(layer->device);
+        lock.lock();
+        if (layer->overlapMeasurement)
+        {
+            layer->overlapMeasurement->endFrame();
+        }
+
+        // This may temporarily release the lock to talk to the host
+        if (layer->serializationWindow)
+        {
+            layer->serializationWindow->endFrame(lock);
+        }
     }
 
     return result;
@@ -41,25 +41,26 @@ static std::unordered_map<VkCommandBuffer, bool> dynamic_suspend_state;
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void preRenderPass(Device* layer, VkCommandBuffer commandBuffer)
+static void preRenderPass(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_render_pass_pre())
+    if (serialize && layer->instance->config.serialize_cmdstream_render_pass_pre())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
 
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
+    layer->beginWorkloadTimestamp(commandBuffer);
 }
 
 /**
@@ -67,25 +68,26 @@ static void preRenderPass(Device* layer, VkCommandBuffer commandBuffer)
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void postRenderPass(Device* layer, VkCommandBuffer commandBuffer)
+static void postRenderPass(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_render_pass_post())
+    layer->endWorkloadTimestamp(commandBuffer);
+
+    if (serialize && layer->instance->config.serialize_cmdstream_render_pass_post())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
-
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
 }
 
 /* See Vulkan API for documentation. */
@@ -99,11 +101,12 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdBeginRenderPass<user_tag>(VkCommandBuffer
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedRenderPassBegin(commandBuffer);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preRenderPass(layer, commandBuffer);
+    preRenderPass(layer, commandBuffer, serialize);
     layer->driver.vkCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
 }
 
@@ -118,11 +121,12 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdBeginRenderPass2<user_tag>(VkCommandBuffer
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedRenderPassBegin(commandBuffer);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preRenderPass(layer, commandBuffer);
+    preRenderPass(layer, commandBuffer, serialize);
     layer->driver.vkCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
 }
 
@@ -137,11 +141,12 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdBeginRenderPass2KHR<user_tag>(VkCommandBuf
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedRenderPassBegin(commandBuffer);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preRenderPass(layer, commandBuffer);
+    preRenderPass(layer, commandBuffer, serialize);
     layer->driver.vkCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
 }
 
@@ -160,13 +165,16 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdBeginRendering<user_tag>(VkCommandBuffer c
     bool suspending = pRenderingInfo->flags & VK_RENDERING_SUSPENDING_BIT;
     dynamic_suspend_state[commandBuffer] = suspending;
 
+    // Only allocate a window index for the first part of the render pass
+    bool serialize = !resuming && layer->isSerializedRenderPassBegin(commandBuffer);
+
     // Release the lock to call into the driver
     lock.unlock();
 
     // Only modify synchronization for the first part of the render pass
     if (!resuming)
     {
-        preRenderPass(layer, commandBuffer);
+        preRenderPass(layer, commandBuffer, serialize);
     }
     layer->driver.vkCmdBeginRendering(commandBuffer, pRenderingInfo);
 }
@@ -186,13 +194,16 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdBeginRenderingKHR<user_tag>(VkCommandBuffe
     bool suspending = pRenderingInfo->flags & VK_RENDERING_SUSPENDING_BIT_KHR;
     dynamic_suspend_state[commandBuffer] = suspending;
 
+    // Only allocate a window index for the first part of the render pass
+    bool serialize = !resuming && layer->isSerializedRenderPassBegin(commandBuffer);
+
     // Release the lock to call into the driver
     lock.unlock();
 
     // Only modify synchronization for the first part of the render pass
     if (!resuming)
     {
-        preRenderPass(layer, commandBuffer);
+        preRenderPass(layer, commandBuffer, serialize);
     }
     layer->driver.vkCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
 }
@@ -206,12 +217,13 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdEndRenderPass<user_tag>(VkCommandBuffer co
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedRenderPassEnd(commandBuffer);
 
     // Release the lock to call into the driver
     lock.unlock();
 
     layer->driver.vkCmdEndRenderPass(commandBuffer);
-    postRenderPass(layer, commandBuffer);
+    postRenderPass(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -227,6 +239,7 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdEndRendering<user_tag>(VkCommandBuffer com
     // Retrieve the begin rendering suspend state
     bool suspending = dynamic_suspend_state[commandBuffer];
     dynamic_suspend_state.erase(commandBuffer);
+    bool serialize = !suspending && layer->isSerializedRenderPassEnd(commandBuffer);
 
     // Release the lock to call into the driver
     lock.unlock();
@@ -236,7 +249,7 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdEndRendering<user_tag>(VkCommandBuffer com
     // Only modify synchronization for the last part of the render pass
     if (!suspending)
     {
-        postRenderPass(layer, commandBuffer);
+        postRenderPass(layer, commandBuffer, serialize);
     }
 }
 
@@ -253,6 +266,7 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdEndRenderingKHR<user_tag>(VkCommandBuffer
     // Retrieve the begin rendering suspend state
     bool suspending = dynamic_suspend_state[commandBuffer];
     dynamic_suspend_state.erase(commandBuffer);
+    bool serialize = !suspending && layer->isSerializedRenderPassEnd(commandBuffer);
 
     // Release the lock to call into the driver
     lock.unlock();
@@ -260,8 +274,8 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdEndRenderingKHR<user_tag>(VkCommandBuffer
     layer->driver.vkCmdEndRenderingKHR(commandBuffer);
 
     // Only modify synchronization for the last part of the render pass
-    if (suspending)
+    if (!suspending)
     {
-        postRenderPass(layer, commandBuffer);
+        postRenderPass(layer, commandBuffer, serialize);
     }
 }
@@ -35,25 +35,26 @@ extern std::mutex g_vulkanLock;
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void preTraceRays(Device* layer, VkCommandBuffer commandBuffer)
+static void preTraceRays(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_trace_rays_pre())
+    if (serialize && layer->instance->config.serialize_cmdstream_trace_rays_pre())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
 
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
+    layer->beginWorkloadTimestamp(commandBuffer);
 }
 
 /**
@@ -61,25 +62,26 @@ static void preTraceRays(Device* layer, VkCommandBuffer commandBuffer)
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void postTraceRays(Device* layer, VkCommandBuffer commandBuffer)
+static void postTraceRays(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_trace_rays_post())
+    layer->endWorkloadTimestamp(commandBuffer);
+
+    if (serialize && layer->instance->config.serialize_cmdstream_trace_rays_post())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
-
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
 }
 
 /**
@@ -87,25 +89,26 @@ static void postTraceRays(Device* layer, VkCommandBuffer commandBuffer)
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void preAccelerationStructureBuild(Device* layer, VkCommandBuffer commandBuffer)
+static void preAccelerationStructureBuild(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_as_build_pre())
+    if (serialize && layer->instance->config.serialize_cmdstream_as_build_pre())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
 
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
+    layer->beginWorkloadTimestamp(commandBuffer);
 }
 
 /**
@@ -113,25 +116,26 @@ static void preAccelerationStructureBuild(Device* layer, VkCommandBuffer command
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void postAccelerationStructureBuild(Device* layer, VkCommandBuffer commandBuffer)
+static void postAccelerationStructureBuild(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_as_build_post())
+    layer->endWorkloadTimestamp(commandBuffer);
+
+    if (serialize && layer->instance->config.serialize_cmdstream_as_build_post())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
-
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
 }
 
 /* See Vulkan API for documentation. */
@@ -144,13 +148,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdTraceRaysIndirect2KHR<user_tag>(VkCommandB
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRACE_RAYS);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTraceRays(layer, commandBuffer);
+    preTraceRays(layer, commandBuffer, serialize);
     layer->driver.vkCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
-    postTraceRays(layer, commandBuffer);
+    postTraceRays(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -168,18 +173,19 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRACE_RAYS);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTraceRays(layer, commandBuffer);
+    preTraceRays(layer, commandBuffer, serialize);
     layer->driver.vkCmdTraceRaysIndirectKHR(commandBuffer,
                                             pRaygenShaderBindingTable,
                                             pMissShaderBindingTable,
                                             pHitShaderBindingTable,
                                             pCallableShaderBindingTable,
                                             indirectDeviceAddress);
-    postTraceRays(layer, commandBuffer);
+    postTraceRays(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -199,11 +205,12 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRACE_RAYS);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTraceRays(layer, commandBuffer);
+    preTraceRays(layer, commandBuffer, serialize);
     layer->driver.vkCmdTraceRaysKHR(commandBuffer,
                                     pRaygenShaderBindingTable,
                                     pMissShaderBindingTable,
@@ -212,7 +219,7 @@ VKAPI_ATTR void VKAPI_CALL
                                     width,
                                     height,
                                     depth);
-    postTraceRays(layer, commandBuffer);
+    postTraceRays(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -230,17 +237,18 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdBuildAccelerationStructuresIndirectKHR<use
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::AS_BUILD);
 
     // Release the lock to call into the driver
     lock.unlock();
-    preAccelerationStructureBuild(layer, commandBuffer);
+    preAccelerationStructureBuild(layer, commandBuffer, serialize);
     layer->driver.vkCmdBuildAccelerationStructuresIndirectKHR(commandBuffer,
                                                               infoCount,
                                                               pInfos,
                                                               pIndirectDeviceAddresses,
                                                               pIndirectStrides,
                                                               ppMaxPrimitiveCounts);
-    postAccelerationStructureBuild(layer, commandBuffer);
+    postAccelerationStructureBuild(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -256,10 +264,11 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdBuildAccelerationStructuresKHR<user_tag>(
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::AS_BUILD);
 
     // Release the lock to call into the driver
     lock.unlock();
-    preAccelerationStructureBuild(layer, commandBuffer);
+    preAccelerationStructureBuild(layer, commandBuffer, serialize);
     layer->driver.vkCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
-    postAccelerationStructureBuild(layer, commandBuffer);
+    postAccelerationStructureBuild(layer, commandBuffer, serialize);
 }
@@ -35,25 +35,26 @@ extern std::mutex g_vulkanLock;
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void preTransfer(Device* layer, VkCommandBuffer commandBuffer)
+static void preTransfer(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_transfer_pre())
+    if (serialize && layer->instance->config.serialize_cmdstream_transfer_pre())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
 
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
+    layer->beginWorkloadTimestamp(commandBuffer);
 }
 
 /**
@@ -61,25 +62,26 @@ static void preTransfer(Device* layer, VkCommandBuffer commandBuffer)
  *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
+ * @param serialize       True if the workload can be serialized.
  */
-static void postTransfer(Device* layer, VkCommandBuffer commandBuffer)
+static void postTransfer(Device* layer, VkCommandBuffer commandBuffer, bool serialize)
 {
-    if (!layer->instance->config.serialize_cmdstream_transfer_post())
+    layer->endWorkloadTimestamp(commandBuffer);
+
+    if (serialize && layer->instance->config.serialize_cmdstream_transfer_post())
     {
-        return;
+        // Execution dependency
+        layer->driver.vkCmdPipelineBarrier(commandBuffer,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           0,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr,
+                                           0,
+                                           nullptr);
     }
-
-    // Execution dependency
-    layer->driver.vkCmdPipelineBarrier(commandBuffer,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       0,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr,
-                                       0,
-                                       nullptr);
 }
 
 // Commands for transfers
@@ -97,13 +99,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdFillBuffer<user_tag>(VkCommandBuffer comma
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -120,13 +123,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdClearColorImage<user_tag>(VkCommandBuffer
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -143,13 +147,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdClearDepthStencilImage<user_tag>(VkCommand
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -165,13 +170,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdCopyBuffer<user_tag>(VkCommandBuffer comma
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -184,13 +190,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdCopyBuffer2<user_tag>(VkCommandBuffer comm
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -203,13 +210,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdCopyBuffer2KHR<user_tag>(VkCommandBuffer c
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -226,13 +234,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdCopyBufferToImage<user_tag>(VkCommandBuffe
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -246,13 +255,14 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -266,13 +276,14 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -290,14 +301,15 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdCopyImage<user_tag>(VkCommandBuffer comman
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver
         .vkCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -310,13 +322,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdCopyImage2<user_tag>(VkCommandBuffer comma
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyImage2(commandBuffer, pCopyImageInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -329,13 +342,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdCopyImage2KHR<user_tag>(VkCommandBuffer co
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -352,13 +366,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdCopyImageToBuffer<user_tag>(VkCommandBuffe
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -372,13 +387,14 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -392,13 +408,14 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -412,13 +429,14 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
 
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -432,12 +450,13 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
 
 /* See Vulkan API for documentation. */
@@ -451,10 +470,11 @@ VKAPI_ATTR void VKAPI_CALL
     // Hold the lock to access layer-wide global store
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(commandBuffer);
+    bool serialize = layer->isSerializedWorkload(commandBuffer, WorkloadClass::TRANSFER);
 
     // Release the lock to call into the driver
     lock.unlock();
-    preTransfer(layer, commandBuffer);
+    preTransfer(layer, commandBuffer, serialize);
     layer->driver.vkCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
-    postTransfer(layer, commandBuffer);
+    postTransfer(layer, commandBuffer, serialize);
 }
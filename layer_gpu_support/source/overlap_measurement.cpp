@@ -0,0 +1,207 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines the measurement of how much each workload class benefits from
+ * overlapping with other GPU work.
+ */
+
+#include "overlap_measurement.hpp"
+
+#include "framework/utils.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+
+/**
+ * @brief The maximum number of timestamp queries to allocate.
+ */
+static const uint32_t MAX_QUERY_COUNT {16384};
+
+/**
+ * @brief The number of in-flight timed submits per queue.
+ */
+static const uint32_t RING_SIZE {16};
+
+/**
+ * @brief The display names of the workload classes.
+ */
+static const std::array<const char*, static_cast<size_t>(WorkloadClass::COUNT)> WORKLOAD_CLASS_NAMES {
+    "Compute",
+    "Render pass",
+    "Trace rays",
+    "Transfer",
+    "Acceleration structure build",
+};
+
+/* See header for documentation. */
+OverlapMeasurement::OverlapMeasurement(const DeviceDispatchTable& driver,
+                                       VkDevice device,
+                                       float timestampPeriod,
+                                       uint32_t validBits,
+                                       uint32_t _framesPerPhase)
+    : timestamps(driver, device, timestampPeriod, validBits, MAX_QUERY_COUNT, RING_SIZE),
+      framesPerPhase(_framesPerPhase)
+{
+}
+
+/* See header for documentation. */
+bool OverlapMeasurement::isSerializing(WorkloadClass workloadClass) const
+{
+    return getPhase(frameIndex) == static_cast<size_t>(workloadClass) + 1;
+}
+
+/* See header for documentation. */
+std::optional<TimestampQuery> OverlapMeasurement::beginWorkload(VkCommandBuffer commandBuffer)
+{
+    // Tag with the recording frame so we can detect cross-phase submits
+    return timestamps.beginWorkload(commandBuffer, frameIndex);
+}
+
+/* See header for documentation. */
+void OverlapMeasurement::collectQueries(VkCommandBuffer commandBuffer, std::vector<TimestampQuery>& queries)
+{
+    size_t first = queries.size();
+    timestamps.collectQueries(commandBuffer, queries);
+
+    size_t phase = getPhase(frameIndex);
+    for (size_t i = first; i < queries.size(); i++)
+    {
+        if (getPhase(queries[i].tagID) != phase)
+        {
+            frames[frameIndex].mixed = true;
+        }
+
+        queries[i].tagID = frameIndex;
+    }
+}
+
+/* See header for documentation. */
+void OverlapMeasurement::poll()
+{
+    for (const auto& result : timestamps.poll())
+    {
+        // Ignore late results for frames that have already been reported
+        if (result.tagID < retiredFrames)
+        {
+            continue;
+        }
+
+        auto& span = frames[result.tagID];
+        span.start = std::min(span.start, result.startTimestamp);
+        span.end = std::max(span.end, result.endTimestamp);
+    }
+}
+
+/* See header for documentation. */
+void OverlapMeasurement::endFrame()
+{
+    poll();
+    frameIndex++;
+    retireFrames();
+}
+
+/* See header for documentation. */
+size_t OverlapMeasurement::getPhase(uint64_t frame) const
+{
+    return static_cast<size_t>((frame / framesPerPhase) % PHASE_COUNT);
+}
+
+/* See header for documentation. */
+void OverlapMeasurement::retireFrames()
+{
+    if (frameIndex < FRAME_LATENCY)
+    {
+        return;
+    }
+
+    uint64_t cycleLength = framesPerPhase * PHASE_COUNT;
+    uint64_t limit = frameIndex - FRAME_LATENCY;
+
+    while (retiredFrames < limit)
+    {
+        uint64_t frame = retiredFrames++;
+
+        auto it = frames.find(frame);
+        if (it != frames.end())
+        {
+            const auto& span = it->second;
+            if (!span.mixed && span.end > span.start)
+            {
+                auto& stats = phases[getPhase(frame)];
+                stats.frameCount++;
+                stats.totalTime += span.end - span.start;
+            }
+
+            frames.erase(it);
+        }
+
+        if (((frame + 1) % cycleLength) == 0)
+        {
+            report();
+            phases = {};
+        }
+    }
+}
+
+/* See header for documentation. */
+void OverlapMeasurement::report()
+{
+    auto getMean = [](const PhaseStats& stats) {
+        return static_cast<double>(stats.totalTime) / static_cast<double>(stats.frameCount) / 1000000.0;
+    };
+
+    const auto& baseline = phases[0];
+    if (!baseline.frameCount)
+    {
+        LAYER_LOG("Overlap benefit: no baseline frames measured");
+        return;
+    }
+
+    double baselineTime = getMean(baseline);
+
+    LAYER_LOG("Overlap benefit per frame");
+    LAYER_LOG("=========================");
+    LAYER_LOG(" - Baseline: %.3f ms (%" PRIu64 " frames)", baselineTime, baseline.frameCount);
+
+    for (size_t i = 0; i < WORKLOAD_CLASS_NAMES.size(); i++)
+    {
+        const auto& stats = phases[i + 1];
+        if (!stats.frameCount)
+        {
+            LAYER_LOG(" - %s: no frames measured", WORKLOAD_CLASS_NAMES[i]);
+            continue;
+        }
+
+        double serializedTime = getMean(stats);
+        double benefit = serializedTime - baselineTime;
+        LAYER_LOG(" - %s: %.3f ms serialized, %+.3f ms benefit (%+.1f%%)",
+                  WORKLOAD_CLASS_NAMES[i],
+                  serializedTime,
+                  benefit,
+                  benefit * 100.0 / baselineTime);
+    }
+}
@@ -0,0 +1,251 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the measurement of how much each workload class benefits from
+ * overlapping with other GPU work.
+ *
+ * Role summary
+ * ============
+ *
+ * The command stream serialization options insert full barriers around
+ * workloads, removing any overlap with neighboring work. Measuring the GPU
+ * frame time with and without these barriers shows how much an application
+ * gains from overlap.
+ *
+ * The measurement cycles through a sequence of phases, each lasting a fixed
+ * number of frames. The first phase is a baseline with no command stream
+ * serialization, and each following phase enables the configured barriers
+ * for a single workload class. Every workload is wrapped with a pair of GPU
+ * timestamps, and the GPU frame time is the span from the earliest workload
+ * start to the latest workload end of the frame. At the end of each cycle the
+ * mean frame time of each phase is compared to the baseline, and the delta is
+ * logged as the overlap benefit of that workload class.
+ *
+ * Serialization is decided when a workload is recorded, and timing is
+ * attributed to the frame a workload is submitted in. Frames that submit work
+ * recorded in a different phase are excluded from the results.
+ *
+ * Threading
+ * =========
+ *
+ * This class is not thread-safe, and must be used with the layer-wide lock
+ * held. It never calls a blocking driver function itself.
+ */
+
+#pragma once
+
+#include "framework/device_dispatch_table.hpp"
+#include "framework/timestamp_queries.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief The classes of workload that can be serialized.
+ */
+enum class WorkloadClass
+{
+    COMPUTE,
+    RENDER_PASS,
+    TRACE_RAYS,
+    TRANSFER,
+    AS_BUILD,
+    COUNT
+};
+
+/**
+ * @brief Measures the GPU frame time cost of serializing each workload class.
+ */
+class OverlapMeasurement
+{
+public:
+    /**
+     * @brief Construct a new measurement for a device.
+     *
+     * @param driver            The driver dispatch table for the device.
+     * @param device            The device handle.
+     * @param timestampPeriod   The number of nanoseconds per timestamp tick.
+     * @param validBits         The minimum valid timestamp bits for all queues.
+     * @param framesPerPhase    The number of frames to measure in each phase.
+     */
+    OverlapMeasurement(const DeviceDispatchTable& driver,
+                       VkDevice device,
+                       float timestampPeriod,
+                       uint32_t validBits,
+                       uint32_t framesPerPhase);
+
+    /**
+     * @brief Test if a workload class is serialized in the current phase.
+     *
+     * @param workloadClass   The class of the workload being recorded.
+     *
+     * @return @c true if the configured barriers should be inserted.
+     */
+    bool isSerializing(WorkloadClass workloadClass) const;
+
+    /**
+     * @brief Get the timestamp manager used to time workloads.
+     */
+    TimestampQueryManager& getTimestamps() { return timestamps; }
+
+    /**
+     * @brief Allocate a query pair for a workload starting in a command buffer.
+     *
+     * @param commandBuffer   The command buffer being recorded.
+     *
+     * @return The allocated pair, or @c std::nullopt if no queries are free.
+     */
+    std::optional<TimestampQuery> beginWorkload(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Append the queries written by a command buffer to a submit list.
+     *
+     * Queries are re-tagged with the current frame, so that timing is
+     * attributed to the frame the work is submitted in.
+     *
+     * @param commandBuffer   The command buffer being submitted.
+     * @param queries         The list to append to.
+     */
+    void collectQueries(VkCommandBuffer commandBuffer, std::vector<TimestampQuery>& queries);
+
+    /**
+     * @brief Read back the results of all retired submits.
+     */
+    void poll();
+
+    /**
+     * @brief Notify the measurement of a frame boundary.
+     *
+     * This reads back any available results, and logs a report when a full
+     * cycle of phases has been measured.
+     */
+    void endFrame();
+
+private:
+    /**
+     * @brief The number of frames to wait before treating a frame as retired.
+     */
+    static const uint64_t FRAME_LATENCY {8};
+
+    /**
+     * @brief The number of phases in a measurement cycle.
+     */
+    static const size_t PHASE_COUNT {static_cast<size_t>(WorkloadClass::COUNT) + 1};
+
+    /**
+     * @brief The GPU execution span of a single frame.
+     */
+    struct FrameSpan
+    {
+        /**
+         * @brief The earliest workload start timestamp, in nanoseconds.
+         */
+        uint64_t start {UINT64_MAX};
+
+        /**
+         * @brief The latest workload end timestamp, in nanoseconds.
+         */
+        uint64_t end {0};
+
+        /**
+         * @brief True if the frame submitted work recorded in another phase.
+         */
+        bool mixed {false};
+    };
+
+    /**
+     * @brief The accumulated frame times of a single phase.
+     */
+    struct PhaseStats
+    {
+        /**
+         * @brief The number of frames measured.
+         */
+        uint64_t frameCount {0};
+
+        /**
+         * @brief The total GPU frame time, in nanoseconds.
+         */
+        uint64_t totalTime {0};
+    };
+
+    /**
+     * @brief Get the phase of a frame.
+     *
+     * @param frame   The frame index.
+     *
+     * @return The phase index, where 0 is the baseline and N serializes the
+     *         workload class with value N - 1.
+     */
+    size_t getPhase(uint64_t frame) const;
+
+    /**
+     * @brief Accumulate the results of all retired frames into the phase stats.
+     */
+    void retireFrames();
+
+    /**
+     * @brief Log the overlap report for the measured cycle.
+     */
+    void report();
+
+    /**
+     * @brief The timestamp manager used to time workloads.
+     */
+    TimestampQueryManager timestamps;
+
+    /**
+     * @brief The number of frames to measure in each phase.
+     */
+    const uint64_t framesPerPhase;
+
+    /**
+     * @brief The index of the current frame.
+     */
+    uint64_t frameIndex {0};
+
+    /**
+     * @brief The number of frames retired into the phase stats.
+     */
+    uint64_t retiredFrames {0};
+
+    /**
+     * @brief The GPU spans of frames not yet retired.
+     */
+    std::map<uint64_t, FrameSpan> frames;
+
+    /**
+     * @brief The accumulated stats for each phase of the current cycle.
+     */
+    std::array<PhaseStats, PHASE_COUNT> phases {};
+};
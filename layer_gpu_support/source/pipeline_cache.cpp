@@ -0,0 +1,213 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines a layer-owned persistent pipeline cache.
+ */
+
+#include "pipeline_cache.hpp"
+
+#include "device.hpp"
+#include "framework/utils.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+
+/**
+ * @brief The file name of the cache when using the default location.
+ */
+static const char* CACHE_FILE_NAME {"lgl_pipeline_cache.bin"};
+
+/* See header for documentation. */
+PersistentPipelineCache::PersistentPipelineCache(
+    Device& _device,
+    const std::string& _path
+) :
+    device(_device),
+    path(_path.empty() ? getDefaultPath() : _path)
+{
+    std::vector<char> data = load();
+
+    VkPipelineCacheCreateInfo createInfo {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .initialDataSize = data.size(),
+        .pInitialData = data.data(),
+    };
+
+    auto result = device.driver.vkCreatePipelineCache(device.device, &createInfo, nullptr, &cache);
+
+    // Retry with an empty cache if the driver rejected the data
+    if (result != VK_SUCCESS && !data.empty())
+    {
+        LAYER_ERR("Failed to load persistent pipeline cache data, using empty cache");
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        result = device.driver.vkCreatePipelineCache(device.device, &createInfo, nullptr, &cache);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        LAYER_ERR("Failed vkCreatePipelineCache() for persistent pipeline cache");
+        cache = VK_NULL_HANDLE;
+    }
+}
+
+/* See header for documentation. */
+PersistentPipelineCache::~PersistentPipelineCache()
+{
+    if (cache == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    save();
+    device.driver.vkDestroyPipelineCache(device.device, cache, nullptr);
+}
+
+/* See header for documentation. */
+void PersistentPipelineCache::merge(
+    VkPipelineCache source
+) {
+    if (cache == VK_NULL_HANDLE || source == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    // Merging needs exclusive access to the destination cache
+    std::unique_lock<std::shared_mutex> guard {lock};
+    auto result = device.driver.vkMergePipelineCaches(device.device, cache, 1, &source);
+    if (result != VK_SUCCESS)
+    {
+        LAYER_ERR("Failed vkMergePipelineCaches() for persistent pipeline cache");
+    }
+}
+
+/* See header for documentation. */
+std::string PersistentPipelineCache::getDefaultPath()
+{
+#ifdef __ANDROID__
+    // Applications can only write to their own data directory
+    std::string package;
+    std::ifstream cmdline("/proc/self/cmdline");
+    std::getline(cmdline, package, '\0');
+
+    std::string fileName("/data/data/");
+    fileName.append(package);
+    fileName.append("/cache/");
+    fileName.append(CACHE_FILE_NAME);
+    return fileName;
+#else
+    return CACHE_FILE_NAME;
+#endif
+}
+
+/* See header for documentation. */
+std::vector<char> PersistentPipelineCache::load()
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        LAYER_LOG("No persistent pipeline cache found: %s", path.c_str());
+        return {};
+    }
+
+    std::vector<char> data {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+
+    // Check the header matches this device, as drivers can be unforgiving
+    // about data written by a different device or driver version
+    VkPipelineCacheHeaderVersionOne header;
+    if (data.size() < sizeof(header))
+    {
+        LAYER_ERR("Persistent pipeline cache is truncated, ignoring it");
+        return {};
+    }
+
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    VkPhysicalDeviceProperties properties;
+    device.instance->driver.vkGetPhysicalDeviceProperties(device.physicalDevice, &properties);
+
+    if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+        header.vendorID != properties.vendorID ||
+        header.deviceID != properties.deviceID ||
+        std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+        LAYER_LOG("Persistent pipeline cache is for a different device or driver, ignoring it");
+        return {};
+    }
+
+    LAYER_LOG("Loaded persistent pipeline cache: %s (%zu bytes)", path.c_str(), data.size());
+    return data;
+}
+
+/* See header for documentation. */
+void PersistentPipelineCache::save()
+{
+    size_t size {0};
+    auto result = device.driver.vkGetPipelineCacheData(device.device, cache, &size, nullptr);
+    if (result != VK_SUCCESS || size == 0)
+    {
+        LAYER_ERR("Failed vkGetPipelineCacheData() for persistent pipeline cache");
+        return;
+    }
+
+    std::vector<char> data(size);
+    result = device.driver.vkGetPipelineCacheData(device.device, cache, &size, data.data());
+    if (result != VK_SUCCESS)
+    {
+        LAYER_ERR("Failed vkGetPipelineCacheData() for persistent pipeline cache");
+        return;
+    }
+
+    // Write to a temporary file and rename it, so that the update is atomic
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+        stream.write(data.data(), static_cast<std::streamsize>(size));
+        stream.close();
+
+        if (!stream)
+        {
+            LAYER_ERR("Failed to write persistent pipeline cache: %s", tempPath.c_str());
+            std::remove(tempPath.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        LAYER_ERR("Failed to replace persistent pipeline cache: %s", path.c_str());
+        std::remove(tempPath.c_str());
+        return;
+    }
+
+    LAYER_LOG("Saved persistent pipeline cache: %s (%zu bytes)", path.c_str(), size);
+}
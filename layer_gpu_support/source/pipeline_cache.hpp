@@ -0,0 +1,141 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares a layer-owned persistent pipeline cache.
+ *
+ * Role summary
+ * ============
+ *
+ * The persistent pipeline cache lets us measure how much pipeline creation
+ * time an application would save by using a pipeline cache, without needing
+ * to modify the application.
+ *
+ * The cache is loaded from disk when the device is created, and is used for
+ * all pipeline creation calls that do not pass a cache. Application caches
+ * are merged into it when they are destroyed, and the cache is written back
+ * to disk when the device is destroyed. The file is written to a temporary
+ * file and then renamed, so an interrupted write never corrupts the existing
+ * cache.
+ *
+ * Threading
+ * =========
+ *
+ * Pipeline creation can use the cache concurrently, but merging requires
+ * exclusive access to the cache. Callers must hold a shared lock on the cache
+ * while creating pipelines with it.
+ */
+
+#pragma once
+
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+class Device;
+
+/**
+ * @brief A layer-owned pipeline cache that persists between runs.
+ */
+class PersistentPipelineCache
+{
+public:
+    /**
+     * @brief Create a new cache, loading the initial data from disk.
+     *
+     * @param device   The layer device.
+     * @param path     The file path of the cache, or empty for the default.
+     */
+    PersistentPipelineCache(
+        Device& device,
+        const std::string& path);
+
+    /**
+     * @brief Destroy the cache, writing the data back to disk.
+     *
+     * Must be called before the driver device is destroyed.
+     */
+    ~PersistentPipelineCache();
+
+    /**
+     * @brief Get the cache handle.
+     *
+     * @return The cache handle, or @c VK_NULL_HANDLE if creation failed.
+     */
+    VkPipelineCache getHandle() const
+    {
+        return cache;
+    }
+
+    /**
+     * @brief Merge an application cache into this cache.
+     *
+     * @param source   The application cache to merge.
+     */
+    void merge(
+        VkPipelineCache source);
+
+    /**
+     * @brief Lock held while creating pipelines with this cache.
+     */
+    std::shared_mutex lock;
+
+private:
+    /**
+     * @brief Get the default file path for the cache.
+     */
+    static std::string getDefaultPath();
+
+    /**
+     * @brief Load the cache data from disk.
+     *
+     * @return The cache data, or empty if the file is missing or was
+     *         created for a different device or driver.
+     */
+    std::vector<char> load();
+
+    /**
+     * @brief Save the cache data to disk.
+     */
+    void save();
+
+    /**
+     * @brief The layer device.
+     */
+    Device& device;
+
+    /**
+     * @brief The file path of the cache.
+     */
+    std::string path;
+
+    /**
+     * @brief The driver cache handle.
+     */
+    VkPipelineCache cache {VK_NULL_HANDLE};
+};
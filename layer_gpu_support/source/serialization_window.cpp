@@ -0,0 +1,193 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Implements a workload window that restricts command stream serialization.
+ */
+
+#include "serialization_window.hpp"
+
+#include "framework/utils.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <memory>
+#include <string>
+
+/* See header for documentation. */
+SerializationWindow::SerializationWindow(
+    const LayerConfig& config,
+    Comms::CommsInterface* _comms
+) :
+    perFrame(config.serialize_cmdstream_window_per_frame()),
+    first(config.serialize_cmdstream_window_first()),
+    count(config.serialize_cmdstream_window_count()),
+    comms(_comms),
+    frameStart(std::chrono::steady_clock::now())
+{
+    if (comms && comms->isConnected())
+    {
+        endpoint = comms->getEndpointID("GPUSupportBisect");
+    }
+
+    if (comms && !endpoint)
+    {
+        LAYER_ERR("Host bisect service not found, using static serialization window");
+    }
+}
+
+/* See header for documentation. */
+bool SerializationWindow::testWorkload(
+    VkCommandBuffer commandBuffer
+) {
+    auto& state = commandBuffers[commandBuffer];
+    return isInWindow(allocateIndex(state));
+}
+
+/* See header for documentation. */
+bool SerializationWindow::testRenderPassBegin(
+    VkCommandBuffer commandBuffer
+) {
+    auto& state = commandBuffers[commandBuffer];
+    state.renderPassInWindow = isInWindow(allocateIndex(state));
+    return state.renderPassInWindow;
+}
+
+/* See header for documentation. */
+bool SerializationWindow::testRenderPassEnd(
+    VkCommandBuffer commandBuffer
+) {
+    auto& state = commandBuffers[commandBuffer];
+    return state.renderPassInWindow;
+}
+
+/* See header for documentation. */
+void SerializationWindow::beginCommandBuffer(
+    VkCommandBuffer commandBuffer
+) {
+    commandBuffers[commandBuffer] = CommandBufferState {};
+}
+
+/* See header for documentation. */
+void SerializationWindow::freeCommandBuffer(
+    VkCommandBuffer commandBuffer
+) {
+    commandBuffers.erase(commandBuffer);
+}
+
+/* See header for documentation. */
+void SerializationWindow::endFrame(
+    std::unique_lock<std::mutex>& lock
+) {
+    auto frameEnd = std::chrono::steady_clock::now();
+    auto frameTime = std::chrono::duration_cast<std::chrono::microseconds>(frameEnd - frameStart);
+
+    uint64_t workloadCount = frameWorkloadCount;
+
+    frameState = CommandBufferState {};
+    frameWorkloadCount = 0;
+    frameStart = frameEnd;
+
+    if (endpoint)
+    {
+        exchangeBisect(lock, workloadCount, static_cast<uint64_t>(frameTime.count()));
+    }
+
+    frameIndex++;
+}
+
+/* See header for documentation. */
+uint64_t SerializationWindow::allocateIndex(
+    CommandBufferState& state
+) {
+    // Render pass tracking is always per command buffer, but the indices are
+    // allocated from the frame when using per-frame scope
+    auto& indexState = perFrame ? frameState : state;
+
+    uint64_t index = indexState.nextIndex++;
+    frameWorkloadCount = std::max(frameWorkloadCount, indexState.nextIndex);
+    return index;
+}
+
+/* See header for documentation. */
+bool SerializationWindow::isInWindow(
+    uint64_t index
+) const {
+    if (index < first)
+    {
+        return false;
+    }
+
+    return (count == 0) || ((index - first) < count);
+}
+
+/* See header for documentation. */
+void SerializationWindow::exchangeBisect(
+    std::unique_lock<std::mutex>& lock,
+    uint64_t workloadCount,
+    uint64_t frameTimeUs
+) {
+    json report {
+        { "frame", frameIndex },
+        { "workloads", workloadCount },
+        { "frame_time_us", frameTimeUs },
+        { "first", first },
+        { "count", count },
+    };
+
+    std::string text = report.dump();
+    auto request = std::make_unique<Comms::MessageData>(text.begin(), text.end());
+
+    // Release the lock while waiting for the host
+    lock.unlock();
+    auto response = comms->txRx(endpoint, std::move(request));
+    lock.lock();
+
+    // An empty response keeps the current window
+    if (!response || response->empty())
+    {
+        return;
+    }
+
+    try
+    {
+        json window = json::parse(response->begin(), response->end());
+        uint64_t newFirst = window.at("first");
+        uint64_t newCount = window.at("count");
+
+        if ((newFirst != first) || (newCount != count))
+        {
+            LAYER_LOG("Serialization window: first %" PRIu64 ", count %" PRIu64, newFirst, newCount);
+        }
+
+        first = newFirst;
+        count = newCount;
+    }
+    catch (const json::exception& e)
+    {
+        LAYER_ERR("Failed to decode host bisect response: %s", e.what());
+    }
+}
@@ -0,0 +1,243 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares a workload window that restricts command stream serialization.
+ *
+ * Role summary
+ * ============
+ *
+ * The command stream serialization options insert full barriers around every
+ * workload of a type, which makes it hard to find which workload is causing a
+ * hazard or a slowdown. The serialization window assigns each workload an
+ * index, counted either per command buffer or per frame, and only allows
+ * barriers for workloads with an index inside the window.
+ *
+ * The window can be set statically in the layer config, or can be driven by
+ * the host bisect service. When bisecting, the layer sends a report to the
+ * host at the end of each frame and receives the window to use for the next
+ * frame, allowing the host to narrow the window across frames without
+ * restarting the application.
+ *
+ * Workload indices are assigned at record time. Per-frame indices count all
+ * workloads recorded since the last present, so applications that record
+ * command buffers once and submit them many times should use the per command
+ * buffer scope. Window changes only apply to command buffers recorded after
+ * the change.
+ *
+ * Threading
+ * =========
+ *
+ * The window is only accessed while holding the layer global lock.
+ */
+
+#pragma once
+
+#include "comms/comms_interface.hpp"
+#include "layer_config.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief A window of workloads that are allowed to be serialized.
+ */
+class SerializationWindow
+{
+public:
+    /**
+     * @brief Create a new window.
+     *
+     * @param config   The layer configuration.
+     * @param comms    The comms module for host bisection, or @c nullptr if not bisecting.
+     */
+    SerializationWindow(
+        const LayerConfig& config,
+        Comms::CommsInterface* comms);
+
+    /**
+     * @brief Assign an index to the next workload in a command buffer.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     *
+     * @return @c true if the workload is inside the window.
+     */
+    bool testWorkload(
+        VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Assign an index to a render pass starting in a command buffer.
+     *
+     * The result is stored so that the end of the render pass is serialized
+     * consistently with the start of it.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     *
+     * @return @c true if the render pass is inside the window.
+     */
+    bool testRenderPassBegin(
+        VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Test if a render pass ending in a command buffer was inside the window.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     *
+     * @return @c true if the render pass is inside the window.
+     */
+    bool testRenderPassEnd(
+        VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Reset the workload indices for a command buffer being re-recorded.
+     *
+     * @param commandBuffer   The command buffer being recorded.
+     */
+    void beginCommandBuffer(
+        VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Release the tracking state for a command buffer being freed.
+     *
+     * @param commandBuffer   The command buffer being freed.
+     */
+    void freeCommandBuffer(
+        VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Notify the window of a frame boundary.
+     *
+     * When bisecting this exchanges a frame report for a new window with the
+     * host. The lock is released while waiting for the host response.
+     *
+     * @param lock   The held layer global lock.
+     */
+    void endFrame(
+        std::unique_lock<std::mutex>& lock);
+
+private:
+    /**
+     * @brief Per command buffer tracking state.
+     */
+    struct CommandBufferState
+    {
+        /**
+         * @brief The index to assign to the next workload.
+         */
+        uint64_t nextIndex {0};
+
+        /**
+         * @brief True if the active render pass is inside the window.
+         */
+        bool renderPassInWindow {false};
+    };
+
+    /**
+     * @brief Allocate the next workload index for a command buffer.
+     *
+     * @param state   The command buffer state.
+     *
+     * @return The workload index.
+     */
+    uint64_t allocateIndex(
+        CommandBufferState& state);
+
+    /**
+     * @brief Test if a workload index is inside the window.
+     *
+     * @param index   The workload index.
+     *
+     * @return @c true if the index is inside the window.
+     */
+    bool isInWindow(
+        uint64_t index) const;
+
+    /**
+     * @brief Exchange a frame report with the host bisect service.
+     *
+     * @param lock            The held layer global lock.
+     * @param workloadCount   The largest workload count seen this frame.
+     * @param frameTimeUs     The CPU frame time, in microseconds.
+     */
+    void exchangeBisect(
+        std::unique_lock<std::mutex>& lock,
+        uint64_t workloadCount,
+        uint64_t frameTimeUs);
+
+    /**
+     * @brief True if workload indices count per frame.
+     */
+    bool perFrame;
+
+    /**
+     * @brief The index of the first workload in the window.
+     */
+    uint64_t first;
+
+    /**
+     * @brief The number of workloads in the window, or 0 if unbounded.
+     */
+    uint64_t count;
+
+    /**
+     * @brief The comms module for host bisection, or @c nullptr if not bisecting.
+     */
+    Comms::CommsInterface* comms;
+
+    /**
+     * @brief The endpoint ID of the host bisect service, or 0 if not found.
+     */
+    Comms::EndpointID endpoint {0};
+
+    /**
+     * @brief The workload index state for each recording command buffer.
+     */
+    std::unordered_map<VkCommandBuffer, CommandBufferState> commandBuffers;
+
+    /**
+     * @brief The workload index state for the frame, used for per-frame scope.
+     */
+    CommandBufferState frameState;
+
+    /**
+     * @brief The largest workload count seen in any index scope this frame.
+     */
+    uint64_t frameWorkloadCount {0};
+
+    /**
+     * @brief The number of frames completed.
+     */
+    uint64_t frameIndex {0};
+
+    /**
+     * @brief The time of the previous frame boundary.
+     */
+    std::chrono::steady_clock::time_point frameStart;
+};
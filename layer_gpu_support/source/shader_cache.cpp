@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines a cache of transformed SPIR-V shader modules.
+ */
+
+#include "shader_cache.hpp"
+
+#include "framework/utils.hpp"
+#include "utils/misc.hpp"
+
+#include <cstring>
+
+/**
+ * @brief Approximate memory cost of an entry, excluding the code.
+ */
+static constexpr size_t ENTRY_OVERHEAD {128};
+
+/**
+ * @brief Mix a 64-bit value into a hash lane.
+ */
+static inline uint64_t mixLane(uint64_t lane, uint64_t value)
+{
+    lane ^= value * 0x9E3779B97F4A7C15ULL;
+    lane = (lane << 31) | (lane >> 33);
+    return lane * 0xC2B2AE3D27D4EB4FULL;
+}
+
+/* See header for documentation. */
+ShaderCache::ShaderCache(
+    size_t _maxBytes
+) :
+    maxBytes(_maxBytes)
+{
+}
+
+/* See header for documentation. */
+ShaderCache::~ShaderCache()
+{
+    LAYER_LOG("Transformed shader cache: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " evictions, %" PRIu64
+              " collisions",
+              hitCount, missCount, evictCount, collisionCount);
+}
+
+/* See header for documentation. */
+uint64_t ShaderCache::getKey(
+    std::span<const uint32_t> code,
+    uint64_t config
+) {
+    // Four independent lanes avoid serializing on the multiply latency
+    uint64_t lanes[4] {
+        0x243F6A8885A308D3ULL ^ config,
+        0x13198A2E03707344ULL,
+        0xA4093822299F31D0ULL,
+        0x082EFA98EC4E6C89ULL ^ code.size()
+    };
+
+    const uint32_t* data = code.data();
+    size_t words = code.size();
+    size_t i = 0;
+
+    for (; i + 8 <= words; i += 8)
+    {
+        uint64_t values[4];
+        std::memcpy(values, data + i, sizeof(values));
+
+        lanes[0] = mixLane(lanes[0], values[0]);
+        lanes[1] = mixLane(lanes[1], values[1]);
+        lanes[2] = mixLane(lanes[2], values[2]);
+        lanes[3] = mixLane(lanes[3], values[3]);
+    }
+
+    for (; i < words; i++)
+    {
+        lanes[i & 3] = mixLane(lanes[i & 3], data[i]);
+    }
+
+    uint64_t hash = lanes[0];
+    for (size_t lane = 1; lane < 4; lane++)
+    {
+        hash = mixLane(hash, lanes[lane]);
+    }
+
+    // Final avalanche
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/* See header for documentation. */
+bool ShaderCache::lookup(
+    uint64_t key,
+    std::span<const uint32_t> input,
+    Code& code
+) {
+    std::lock_guard<std::mutex> guard {lock};
+
+    auto it = entries.find(key);
+    if (it == entries.end())
+    {
+        missCount++;
+        return false;
+    }
+
+    // Verify the input code so a key collision is treated as a miss
+    const auto& entryInput = it->second.input;
+    if (entryInput.size() != input.size()
+        || std::memcmp(entryInput.data(), input.data(), input.size_bytes()) != 0)
+    {
+        collisionCount++;
+        missCount++;
+        return false;
+    }
+
+    // Move the entry to the front of the LRU list
+    lru.splice(lru.begin(), lru, it->second.lruPosition);
+
+    hitCount++;
+    code = it->second.code;
+    return true;
+}
+
+/* See header for documentation. */
+void ShaderCache::insert(
+    uint64_t key,
+    std::span<const uint32_t> input,
+    Code code
+) {
+    size_t size = ENTRY_OVERHEAD + input.size_bytes();
+    if (code)
+    {
+        size += code->size() * sizeof(uint32_t);
+    }
+
+    // Entries larger than the whole cache are never stored
+    if (size > maxBytes)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard {lock};
+
+    // Another thread may have inserted the same module concurrently, and on a
+    // key collision the existing entry is kept
+    if (isInMap(key, entries))
+    {
+        return;
+    }
+
+    std::vector<uint32_t> inputCopy(input.begin(), input.end());
+
+    lru.push_front(key);
+    entries.insert({key, Entry {std::move(inputCopy), std::move(code), size, lru.begin()}});
+    usedBytes += size;
+
+    evict();
+}
+
+/* See header for documentation. */
+void ShaderCache::evict()
+{
+    while (usedBytes > maxBytes && !lru.empty())
+    {
+        uint64_t key = lru.back();
+        lru.pop_back();
+
+        auto it = entries.find(key);
+        usedBytes -= it->second.size;
+        entries.erase(it);
+        evictCount++;
+    }
+}
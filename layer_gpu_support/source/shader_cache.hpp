@@ -0,0 +1,205 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares a cache of transformed SPIR-V shader modules.
+ *
+ * Role summary
+ * ============
+ *
+ * Applications often create the same shader module many times, for example
+ * for per-material variants or streaming reloads. The layer SPIR-V transforms
+ * are deterministic, so the cache stores the transformed code keyed by a hash
+ * of the input code and the active transform options, and returns it without
+ * reprocessing the module.
+ *
+ * The cache has a memory cap, and evicts the least recently used entries when
+ * the cap is exceeded. Entries are reference counted, so code returned by the
+ * cache remains valid while in use even if it is evicted.
+ *
+ * Each entry also stores a copy of its input code, which is compared against
+ * the input on every hit. A hash collision is therefore treated as a miss,
+ * rather than returning the transformed code for a different module.
+ *
+ * Threading
+ * =========
+ *
+ * The cache is thread-safe, and is used without holding the layer lock.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief A cache of transformed SPIR-V shader modules.
+ */
+class ShaderCache
+{
+public:
+    /**
+     * @brief Shared storage for transformed code.
+     *
+     * A null pointer indicates that the transforms did not modify the code.
+     */
+    using Code = std::shared_ptr<const std::vector<uint32_t>>;
+
+    /**
+     * @brief Create a new cache.
+     *
+     * @param maxBytes   The memory cap for the cache.
+     */
+    ShaderCache(
+        size_t maxBytes);
+
+    /**
+     * @brief Destroy the cache.
+     */
+    ~ShaderCache();
+
+    /**
+     * @brief Compute the cache key for a module.
+     *
+     * @param code     The input SPIR-V code.
+     * @param config   The active transform options, as a bitmask.
+     *
+     * @return The cache key.
+     */
+    static uint64_t getKey(
+        std::span<const uint32_t> code,
+        uint64_t config);
+
+    /**
+     * @brief Look up a module in the cache.
+     *
+     * @param key     The cache key.
+     * @param input   The input SPIR-V code, verified against the entry.
+     * @param code    Storage for the transformed code on a hit.
+     *
+     * @return @c true on a hit, @c false on a miss.
+     */
+    bool lookup(
+        uint64_t key,
+        std::span<const uint32_t> input,
+        Code& code);
+
+    /**
+     * @brief Insert a module into the cache.
+     *
+     * @param key     The cache key.
+     * @param input   The input SPIR-V code.
+     * @param code    The transformed code, or null if the transforms did not
+     *                modify the input code.
+     */
+    void insert(
+        uint64_t key,
+        std::span<const uint32_t> input,
+        Code code);
+
+private:
+    /**
+     * @brief A single cache entry.
+     */
+    struct Entry
+    {
+        /**
+         * @brief The input code, used to detect key collisions.
+         */
+        std::vector<uint32_t> input;
+
+        /**
+         * @brief The transformed code.
+         */
+        Code code;
+
+        /**
+         * @brief The memory cost of the entry, in bytes.
+         */
+        size_t size;
+
+        /**
+         * @brief The position of the entry in the LRU list.
+         */
+        std::list<uint64_t>::iterator lruPosition;
+    };
+
+    /**
+     * @brief Evict entries until the cache is under the memory cap.
+     */
+    void evict();
+
+    /**
+     * @brief Lock protecting the cache state.
+     */
+    std::mutex lock;
+
+    /**
+     * @brief The cache entries.
+     */
+    std::unordered_map<uint64_t, Entry> entries;
+
+    /**
+     * @brief The cache keys, with the most recently used first.
+     */
+    std::list<uint64_t> lru;
+
+    /**
+     * @brief The memory cap for the cache, in bytes.
+     */
+    size_t maxBytes;
+
+    /**
+     * @brief The memory used by the cache, in bytes.
+     */
+    size_t usedBytes {0};
+
+    /**
+     * @brief The number of lookups that hit.
+     */
+    uint64_t hitCount {0};
+
+    /**
+     * @brief The number of lookups that missed.
+     */
+    uint64_t missCount {0};
+
+    /**
+     * @brief The number of entries evicted.
+     */
+    uint64_t evictCount {0};
+
+    /**
+     * @brief The number of lookups that matched a key but not the input code.
+     */
+    uint64_t collisionCount {0};
+};
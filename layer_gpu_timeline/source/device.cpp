@@ -22,12 +22,16 @@
  * IN THE SOFTWARE.
  * ----------------------------------------------------------------------------
  */
+#include <array>
+#include <fstream>
+#include <string>
 #include <vector>
 #include <sys/stat.h>
 #include <unistd.h>
 
 #include "comms/comms_module.hpp"
 #include "device.hpp"
+#include "framework/manual_functions.hpp"
 #include "framework/utils.hpp"
 #include "instance.hpp"
 #include "timeline_protobuf_encoder.hpp"
@@ -37,8 +41,28 @@
  */
 static std::unordered_map<void*, std::unique_ptr<Device>> g_devices;
 
+/* Predeclare custom DeviceCreatePatch functions */
+static void enableDeviceTimestampSupport(Instance& instance,
+                                         VkPhysicalDevice physicalDevice,
+                                         vku::safe_VkDeviceCreateInfo& createInfo,
+                                         std::vector<std::string>& supported);
+
+static void enableDeviceCalibratedTimestamps(Instance& instance,
+                                             VkPhysicalDevice physicalDevice,
+                                             vku::safe_VkDeviceCreateInfo& createInfo,
+                                             std::vector<std::string>& supported);
+
+static void enableDevicePipelineCreationFeedback(Instance& instance,
+                                                 VkPhysicalDevice physicalDevice,
+                                                 vku::safe_VkDeviceCreateInfo& createInfo,
+                                                 std::vector<std::string>& supported);
+
 /* See header for documentation. */
-const std::vector<DeviceCreatePatchPtr> Device::createInfoPatches {};
+const std::vector<DeviceCreatePatchPtr> Device::createInfoPatches {
+    enableDeviceTimestampSupport,
+    enableDeviceCalibratedTimestamps,
+    enableDevicePipelineCreationFeedback
+};
 
 /* See header for documentation. */
 std::unique_ptr<Comms::CommsModule> Device::commsModule;
@@ -46,6 +70,9 @@ std::unique_ptr<Comms::CommsModule> Device::commsModule;
 /* See header for documentation. */
 std::unique_ptr<TimelineComms> Device::commsWrapper;
 
+/* See header for documentation. */
+std::unique_ptr<TimelinePerfettoWriter> Device::perfettoWriter;
+
 extern std::mutex g_vulkanLock;
 
 /* See header for documentation. */
@@ -91,6 +118,177 @@ std::unique_ptr<Device> Device::destroy(
     return device;
 }
 
+/**
+ * Enable the device features needed for GPU timestamp mode, if configured.
+ *
+ * @param instance         The layer instance we are running within.
+ * @param physicalDevice   The physical device we are creating a device for.
+ * @param createInfo       The createInfo we can search to find user config.
+ * @param supported        The list of supported extensions.
+ */
+static void enableDeviceTimestampSupport(Instance& instance,
+                                         VkPhysicalDevice physicalDevice,
+                                         vku::safe_VkDeviceCreateInfo& createInfo,
+                                         std::vector<std::string>& supported)
+{
+    if (!instance.config.isGPUTimestampEnabled())
+    {
+        return;
+    }
+
+    enableDeviceVkKhrSynchronization2(instance, physicalDevice, createInfo, supported);
+}
+
+/**
+ * Enable calibrated timestamps if configured to write GPU timings to Perfetto.
+ *
+ * @param instance         The layer instance we are running within.
+ * @param physicalDevice   The physical device we are creating a device for.
+ * @param createInfo       The createInfo we can search to find user config.
+ * @param supported        The list of supported extensions.
+ */
+static void enableDeviceCalibratedTimestamps(Instance& instance,
+                                             VkPhysicalDevice physicalDevice,
+                                             vku::safe_VkDeviceCreateInfo& createInfo,
+                                             std::vector<std::string>& supported)
+{
+    UNUSED(physicalDevice);
+
+    const auto& config = instance.config;
+    if (!config.isPerfettoEnabled() || !config.isGPUTimestampEnabled())
+    {
+        return;
+    }
+
+    // Prefer the KHR extension, but fall back to the EXT extension
+    static const std::array<std::string, 2> targets {
+        VK_KHR_CALIBRATED_TIMESTAMPS_EXTENSION_NAME,
+        VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME,
+    };
+
+    for (const auto& target : targets)
+    {
+        if (isIn(target, supported))
+        {
+            if (vku::AddExtension(createInfo, target.c_str()))
+            {
+                LAYER_LOG("Device extension added: %s", target.c_str());
+            }
+
+            return;
+        }
+    }
+
+    LAYER_LOG("Device extension not available: %s", targets[0].c_str());
+}
+
+/**
+ * Enable pipeline creation feedback, used to report pipeline cache hits.
+ *
+ * @param instance         The layer instance we are running within.
+ * @param physicalDevice   The physical device we are creating a device for.
+ * @param createInfo       The createInfo we can search to find user config.
+ * @param supported        The list of supported extensions.
+ */
+static void enableDevicePipelineCreationFeedback(Instance& instance,
+                                                 VkPhysicalDevice physicalDevice,
+                                                 vku::safe_VkDeviceCreateInfo& createInfo,
+                                                 std::vector<std::string>& supported)
+{
+    UNUSED(instance);
+    UNUSED(physicalDevice);
+
+    static const std::string target {VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME};
+
+    if (!isIn(target, supported))
+    {
+        LAYER_LOG("Device extension not available: %s", target.c_str());
+        return;
+    }
+
+    if (vku::AddExtension(createInfo, target.c_str()))
+    {
+        LAYER_LOG("Device extension added: %s", target.c_str());
+    }
+}
+
+/**
+ * Test if a device was created with pipeline creation feedback enabled.
+ *
+ * @param createInfo   The create info used to create the device.
+ *
+ * @return @c true if creation feedback can be requested, @c false otherwise.
+ */
+static bool isPipelineCreationFeedbackSupported(const VkDeviceCreateInfo& createInfo)
+{
+    for (uint32_t i = 0; i < createInfo.enabledExtensionCount; i++)
+    {
+        std::string name {createInfo.ppEnabledExtensionNames[i]};
+        if (name == VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Test if a device can sample the GPU clock and CLOCK_MONOTONIC_RAW together.
+ *
+ * @param instance         The layer instance we are running within.
+ * @param physicalDevice   The physical device the device was created for.
+ * @param createInfo       The create info used to create the device.
+ *
+ * @return @c true if calibrated timestamps can be used, @c false otherwise.
+ */
+static bool isCalibratedTimestampsSupported(const Instance& instance,
+                                            VkPhysicalDevice physicalDevice,
+                                            const VkDeviceCreateInfo& createInfo)
+{
+    bool enabled {false};
+    for (uint32_t i = 0; i < createInfo.enabledExtensionCount; i++)
+    {
+        std::string name {createInfo.ppEnabledExtensionNames[i]};
+        if (name == VK_KHR_CALIBRATED_TIMESTAMPS_EXTENSION_NAME || name == VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME)
+        {
+            enabled = true;
+        }
+    }
+
+    auto fpGetDomains = instance.driver.vkGetPhysicalDeviceCalibrateableTimeDomainsKHR;
+    if (!fpGetDomains)
+    {
+        fpGetDomains = instance.driver.vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+    }
+
+    if (!enabled || !fpGetDomains)
+    {
+        return false;
+    }
+
+    uint32_t domainCount {0};
+    fpGetDomains(physicalDevice, &domainCount, nullptr);
+
+    std::vector<VkTimeDomainKHR> domains(domainCount);
+    fpGetDomains(physicalDevice, &domainCount, domains.data());
+
+    return isIn(VK_TIME_DOMAIN_DEVICE_KHR, domains) && isIn(VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_KHR, domains);
+}
+
+/**
+ * Get the name of the current process.
+ *
+ * @return The process name, or an empty string on error.
+ */
+static std::string getProcessName()
+{
+    std::ifstream stream("/proc/self/comm");
+    std::string name;
+    std::getline(stream, name);
+    return name;
+}
+
 /* See header for documentation. */
 Device::Device(Instance* _instance,
                VkPhysicalDevice _physicalDevice,
@@ -101,8 +299,6 @@ Device::Device(Instance* _instance,
       physicalDevice(_physicalDevice),
       device(_device)
 {
-    UNUSED(createInfo);
-
     initDriverDeviceDispatchTable(device, nlayerGetProcAddress, driver);
 
     // Emit a log if debug utils entry points did not load. In this scenario
@@ -137,7 +333,146 @@ Device::Device(Instance* _instance,
     uint32_t minor = VK_VERSION_MINOR(driverVersion);
     uint32_t patch = VK_VERSION_PATCH(driverVersion);
 
+    // Create the GPU timestamp query manager if configured and supported
+    const auto& config = instance->config;
+    if (config.isGPUTimestampEnabled())
+    {
+        uint32_t validBits = getTimestampValidBits(instance->driver, physicalDevice, createInfo);
+        bool hasWrite = driver.vkCmdWriteTimestamp2 || driver.vkCmdWriteTimestamp2KHR;
+
+        if (!hasWrite || !isSynchronization2Enabled(createInfo))
+        {
+            LAYER_LOG("  - ERROR: Device does not support VK_KHR_synchronization2");
+            LAYER_LOG("           GPU timestamps are disabled");
+        }
+        else if (validBits == 0)
+        {
+            LAYER_LOG("  - ERROR: Device queues do not support timestamps");
+            LAYER_LOG("           GPU timestamps are disabled");
+        }
+        else
+        {
+            timestampManager = std::make_unique<TimestampQueryManager>(driver,
+                                                                       device,
+                                                                       deviceProperties.limits.timestampPeriod,
+                                                                       validBits,
+                                                                       config.getGPUTimestampQueryCount(),
+                                                                       config.getGPUTimestampRingSize());
+        }
+    }
+
+    hasPipelineCreationFeedback = isPipelineCreationFeedbackSupported(createInfo);
+    if (!hasPipelineCreationFeedback)
+    {
+        LAYER_LOG("  - ERROR: Device does not support VK_EXT_pipeline_creation_feedback");
+        LAYER_LOG("           Pipeline cache hits will not be reported");
+    }
+
     pid_t processPID = getpid();
 
+    // Add the device to the shared Perfetto trace if configured
+    if (config.isPerfettoEnabled())
+    {
+        std::lock_guard<std::mutex> lock { g_vulkanLock };
+        if (!perfettoWriter)
+        {
+            perfettoWriter = std::make_unique<TimelinePerfettoWriter>(config.getPerfettoTracePath(),
+                                                                      static_cast<uint32_t>(processPID),
+                                                                      getProcessName());
+            if (!perfettoWriter->isOpen())
+            {
+                perfettoWriter.reset();
+            }
+        }
+
+        if (perfettoWriter)
+        {
+            if (timestampManager)
+            {
+                hasCalibratedTimestamps = isCalibratedTimestampsSupported(*instance, physicalDevice, createInfo);
+                if (!hasCalibratedTimestamps)
+                {
+                    LAYER_LOG("  - ERROR: Device does not support calibrated timestamps");
+                    LAYER_LOG("           Perfetto trace will use CPU submit times");
+                }
+            }
+
+            perfettoWriter->addDevice(device, name, hasCalibratedTimestamps);
+            emitPerfettoClockSnapshot();
+        }
+    }
+
     TimelineProtobufEncoder::emitMetadata(*this, processPID, major, minor, patch, std::move(name));
 }
+
+/* See header for documentation. */
+Device::~Device()
+{
+    // Called from vkDestroyDevice without the lock held
+    std::lock_guard<std::mutex> lock { g_vulkanLock };
+    if (perfettoWriter)
+    {
+        perfettoWriter->removeDevice(device);
+    }
+}
+
+/* See header for documentation. */
+void Device::emitPerfettoClockSnapshot()
+{
+    if (!perfettoWriter || !hasCalibratedTimestamps)
+    {
+        return;
+    }
+
+    auto fpGetCalibratedTimestamps = driver.vkGetCalibratedTimestampsKHR;
+    if (!fpGetCalibratedTimestamps)
+    {
+        fpGetCalibratedTimestamps = driver.vkGetCalibratedTimestampsEXT;
+    }
+
+    std::array<VkCalibratedTimestampInfoKHR, 2> infos {{
+        {VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_KHR, nullptr, VK_TIME_DOMAIN_DEVICE_KHR},
+        {VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_KHR, nullptr, VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_KHR},
+    }};
+
+    std::array<uint64_t, 2> timestamps {};
+    uint64_t maxDeviation {0};
+
+    VkResult result = fpGetCalibratedTimestamps(device, 2, infos.data(), timestamps.data(), &maxDeviation);
+    if (result != VK_SUCCESS)
+    {
+        return;
+    }
+
+    uint64_t gpuTimestamp = timestampManager->toNanoseconds(timestamps[0]);
+    perfettoWriter->emitClockSnapshot(device, gpuTimestamp, timestamps[1]);
+}
+
+/* See header for documentation. */
+void Device::createTimestampCommandPool(VkCommandPool commandPool, uint32_t queueFamilyIndex)
+{
+    if (!timestampManager)
+    {
+        return;
+    }
+
+    VkQueueFlags queueFlags = getQueueFamilyFlags(instance->driver, physicalDevice, queueFamilyIndex);
+    timestampManager->createCommandPool(commandPool, queueFlags);
+}
+
+/* See header for documentation. */
+void Device::writeTimestamp(VkCommandBuffer commandBuffer,
+                            VkPipelineStageFlags2 stage,
+                            VkQueryPool pool,
+                            uint32_t query)
+{
+    // Prefer the core entry point, but fall back to the extension
+    if (driver.vkCmdWriteTimestamp2)
+    {
+        driver.vkCmdWriteTimestamp2(commandBuffer, stage, pool, query);
+    }
+    else
+    {
+        driver.vkCmdWriteTimestamp2KHR(commandBuffer, stage, pool, query);
+    }
+}
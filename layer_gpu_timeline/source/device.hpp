@@ -52,6 +52,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <vulkan/utility/vk_safe_struct.hpp>
@@ -59,8 +60,11 @@
 
 #include "comms/comms_module.hpp"
 #include "framework/device_dispatch_table.hpp"
+#include "framework/timestamp_queries.hpp"
 #include "instance.hpp"
 #include "timeline_comms.hpp"
+#include "timeline_frame_summary.hpp"
+#include "timeline_perfetto.hpp"
 #include "trackers/device.hpp"
 
 /**
@@ -145,7 +149,7 @@ public:
     /**
      * @brief Destroy this layer device object.
      */
-    ~Device() = default;
+    ~Device();
 
     /**
      * @brief Callback for sending some message for the device.
@@ -159,6 +163,61 @@ public:
      */
     Tracker::Device& getStateTracker() { return stateTracker; }
 
+    /**
+     * @brief Get the frame summary accumulator for this device.
+     */
+    TimelineFrameSummary& getFrameSummary() { return frameSummary; }
+
+    /**
+     * @brief Get the GPU timestamp query manager for this device.
+     *
+     * @return The query manager, or @c nullptr if GPU timestamps are disabled.
+     */
+    TimestampQueryManager* getTimestampManager() { return timestampManager.get(); }
+
+    /**
+     * @brief Can the layer request pipeline creation feedback for this device?
+     */
+    bool isPipelineCreationFeedbackEnabled() const { return hasPipelineCreationFeedback; }
+
+    /**
+     * @brief Get the shared Perfetto trace writer.
+     *
+     * @return The trace writer, or @c nullptr if not writing a Perfetto trace.
+     */
+    TimelinePerfettoWriter* getPerfettoWriter() { return perfettoWriter.get(); }
+
+    /**
+     * @brief Emit a Perfetto clock snapshot mapping the GPU clock to the CPU clock.
+     *
+     * This is a no-op unless GPU timestamps and calibrated timestamps are both
+     * available for this device.
+     */
+    void emitPerfettoClockSnapshot();
+
+    /**
+     * @brief Start tracking GPU timestamp support for a new command pool.
+     *
+     * This is a no-op unless GPU timestamps are enabled for this device.
+     *
+     * @param commandPool        The command pool being created.
+     * @param queueFamilyIndex   The queue family of the command pool.
+     */
+    void createTimestampCommandPool(VkCommandPool commandPool, uint32_t queueFamilyIndex);
+
+    /**
+     * @brief Write a GPU timestamp into a layer-owned query.
+     *
+     * @param commandBuffer   The command buffer we are recording.
+     * @param stage           The pipeline stage to write the timestamp at.
+     * @param pool            The query pool to write to.
+     * @param query           The index of the query to write.
+     */
+    void writeTimestamp(VkCommandBuffer commandBuffer,
+                        VkPipelineStageFlags2 stage,
+                        VkQueryPool pool,
+                        uint32_t query);
+
 public:
     /**
      * @brief The instance this device is created with.
@@ -191,6 +250,26 @@ private:
      */
     Tracker::Device stateTracker;
 
+    /**
+     * @brief Frame summary accumulator for this device.
+     */
+    TimelineFrameSummary frameSummary;
+
+    /**
+     * @brief GPU timestamp query manager for this device, if enabled.
+     */
+    std::unique_ptr<TimestampQueryManager> timestampManager;
+
+    /**
+     * @brief Can GPU timestamps be mapped to the CPU clock for this device?
+     */
+    bool hasCalibratedTimestamps {false};
+
+    /**
+     * @brief Can the layer request pipeline creation feedback for this device?
+     */
+    bool hasPipelineCreationFeedback {false};
+
     /**
      * @brief Shared network communications module.
      */
@@ -200,4 +279,9 @@ private:
      * @brief Shared network communications message encoder.
      */
     static std::unique_ptr<TimelineComms> commsWrapper;
+
+    /**
+     * @brief Shared Perfetto trace writer.
+     */
+    static std::unique_ptr<TimelinePerfettoWriter> perfettoWriter;
 };
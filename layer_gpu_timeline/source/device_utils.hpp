@@ -28,11 +28,56 @@
 #include "device.hpp"
 #include "framework/utils.hpp"
 
+#include <mutex>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
 #include <vulkan/vulkan.h>
 
+extern std::mutex g_vulkanLock;
+
+/**
+ * @brief Get the CLOCK_MONOTONIC_RAW timestamp in nanoseconds.
+ *
+ * CLOCK_MONOTONIC_RAW is clock source 5 in Perfetto.
+ *
+ * @returns Current time in nanoseconds.
+ */
+[[maybe_unused]] static uint64_t getClockMonotonicRaw()
+{
+    struct timespec ts;
+
+    auto error = clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    if (error)
+    {
+        return 0;
+    }
+
+    // Accumulate the nanosecond value
+    uint64_t sec = static_cast<uint64_t>(ts.tv_sec);
+    uint64_t nsec = static_cast<uint64_t>(ts.tv_nsec);
+    nsec += sec * 1000000000ull;
+
+    return nsec;
+}
+
+/**
+ * @brief Get the kernel thread ID of the calling thread.
+ *
+ * @returns The thread ID.
+ */
+[[maybe_unused]] static uint32_t getThreadID()
+{
+    return static_cast<uint32_t>(syscall(SYS_gettid));
+}
+
 /**
  * @brief Emit a start tag via a driver debug utils label.
  *
+ * If GPU timestamps are enabled this also writes the start timestamp for the
+ * workload. This must be called without the layer-wide lock held.
+ *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
  * @param tagID           The tagID to emit into the label.
@@ -53,16 +98,48 @@
     {
         layer->driver.vkCmdBeginDebugUtilsLabelEXT(commandBuffer, &tagInfo);
     }
+
+    // Write the start timestamp into a layer-owned query
+    auto* timestamps = layer->getTimestampManager();
+    if (timestamps)
+    {
+        std::unique_lock<std::mutex> lock {g_vulkanLock};
+        auto query = timestamps->beginWorkload(commandBuffer, tagID);
+        lock.unlock();
+
+        if (query)
+        {
+            layer->driver.vkCmdResetQueryPool(commandBuffer, query->pool, query->index, 2);
+            layer->writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, query->pool, query->index);
+        }
+    }
 }
 
 /**
  * @brief End a tag via a driver debug utils label.
  *
+ * If GPU timestamps are enabled this also writes the end timestamp for the
+ * workload. This must be called without the layer-wide lock held.
+ *
  * @param layer           The layer context for the device.
  * @param commandBuffer   The command buffer we are recording.
  */
  [[maybe_unused]] static void emitEndTag(Device* layer, VkCommandBuffer commandBuffer)
  {
+    // Write the end timestamp into a layer-owned query
+    auto* timestamps = layer->getTimestampManager();
+    if (timestamps)
+    {
+        std::unique_lock<std::mutex> lock {g_vulkanLock};
+        auto query = timestamps->endWorkload(commandBuffer);
+        lock.unlock();
+
+        if (query)
+        {
+            layer->writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, query->pool, query->index + 1);
+        }
+    }
+
     // Function pointer may be null if driver does not expose the extension
     if (layer->driver.vkCmdEndDebugUtilsLabelEXT)
     {
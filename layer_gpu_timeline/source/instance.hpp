@@ -55,6 +55,7 @@
 #pragma once
 
 #include "framework/instance_dispatch_table.hpp"
+#include "layer_config.hpp"
 
 #include <memory>
 #include <unordered_map>
@@ -131,6 +132,11 @@ public:
      */
     InstanceDispatchTable driver {};
 
+    /**
+     * @brief The layer configuration.
+     */
+    const LayerConfig config;
+
     /**
      * @brief The minimum API version needed by this layer.
      */
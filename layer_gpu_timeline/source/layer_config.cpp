@@ -0,0 +1,201 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines the a config file to parameterize the layer.
+ */
+
+#include "layer_config.hpp"
+
+#include "framework/utils.hpp"
+#include "version.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+#include <vulkan/vulkan.h>
+
+/* See header for documentation. */
+void LayerConfig::parseOutputOptions(const json& config)
+{
+    // Decode output mode
+    std::string rawOutputMode = config.at("output_mode");
+
+    if (rawOutputMode == "workloads")
+    {
+        outputMode = OUTPUT_MODE_WORKLOADS;
+    }
+    else if (rawOutputMode == "frame_summary")
+    {
+        outputMode = OUTPUT_MODE_FRAME_SUMMARY;
+        frameSummaryLabelCount = config.at("frame_summary_label_count");
+    }
+    else if (rawOutputMode == "perfetto")
+    {
+        outputMode = OUTPUT_MODE_PERFETTO;
+        perfettoTracePath = config.at("perfetto_trace_path");
+    }
+    else
+    {
+        LAYER_ERR("Unknown output_mode: %s", rawOutputMode.c_str());
+        outputMode = OUTPUT_MODE_WORKLOADS;
+        rawOutputMode = "workloads";
+    }
+
+    LAYER_LOG("Layer output configuration");
+    LAYER_LOG("==========================");
+    LAYER_LOG(" - Output mode: %s", rawOutputMode.c_str());
+
+    if (outputMode == OUTPUT_MODE_FRAME_SUMMARY)
+    {
+        LAYER_LOG(" - Frame summary label scopes: %u", frameSummaryLabelCount);
+    }
+    else if (outputMode == OUTPUT_MODE_PERFETTO)
+    {
+        LAYER_LOG(" - Perfetto trace path: %s", perfettoTracePath.c_str());
+    }
+}
+
+/* See header for documentation. */
+void LayerConfig::parseTimestampOptions(const json& config)
+{
+    gpuTimestamps = config.at("gpu_timestamps");
+    if (gpuTimestamps)
+    {
+        gpuTimestampQueryCount = config.at("gpu_timestamp_query_count");
+        gpuTimestampRingSize = config.at("gpu_timestamp_ring_size");
+    }
+
+    // Each workload needs a pair of queries, and each queue a ring slot
+    gpuTimestampQueryCount = std::max(gpuTimestampQueryCount & ~1u, 2u);
+    gpuTimestampRingSize = std::max(gpuTimestampRingSize, 1u);
+
+    LAYER_LOG("Layer timestamp configuration");
+    LAYER_LOG("=============================");
+    LAYER_LOG(" - GPU timestamps: %u", gpuTimestamps);
+
+    if (gpuTimestamps)
+    {
+        LAYER_LOG(" - Query count: %u", gpuTimestampQueryCount);
+        LAYER_LOG(" - Ring size: %u", gpuTimestampRingSize);
+    }
+}
+
+/* See header for documentation. */
+LayerConfig::LayerConfig()
+{
+#ifdef __ANDROID__
+    std::string fileName("/data/local/tmp/");
+    fileName.append(LGL_LAYER_CONFIG);
+#else
+    std::string fileName(LGL_LAYER_CONFIG);
+#endif
+
+    LAYER_LOG("Trying to read config: %s", fileName.c_str());
+
+    std::ifstream stream(fileName);
+    if (!stream)
+    {
+        LAYER_LOG("Failed to open layer config, using defaults");
+        return;
+    }
+
+    json data;
+
+    try
+    {
+        data = json::parse(stream);
+    }
+    catch (const json::parse_error& e)
+    {
+        LAYER_ERR("Failed to load layer config, using defaults");
+        LAYER_ERR("Error: %s", e.what());
+        return;
+    }
+
+    try
+    {
+        parseOutputOptions(data);
+    }
+    catch (const json::out_of_range& e)
+    {
+        LAYER_ERR("Failed to read output config, using defaults");
+        LAYER_ERR("Error: %s", e.what());
+    }
+
+    try
+    {
+        parseTimestampOptions(data);
+    }
+    catch (const json::out_of_range& e)
+    {
+        LAYER_ERR("Failed to read timestamp config, using defaults");
+        LAYER_ERR("Error: %s", e.what());
+    }
+}
+
+/* See header for documentation. */
+bool LayerConfig::isFrameSummaryEnabled() const
+{
+    return outputMode == OUTPUT_MODE_FRAME_SUMMARY;
+}
+
+/* See header for documentation. */
+uint32_t LayerConfig::getFrameSummaryLabelCount() const
+{
+    return frameSummaryLabelCount;
+}
+
+/* See header for documentation. */
+bool LayerConfig::isPerfettoEnabled() const
+{
+    return outputMode == OUTPUT_MODE_PERFETTO;
+}
+
+/* See header for documentation. */
+const std::string& LayerConfig::getPerfettoTracePath() const
+{
+    return perfettoTracePath;
+}
+
+/* See header for documentation. */
+bool LayerConfig::isGPUTimestampEnabled() const
+{
+    return gpuTimestamps;
+}
+
+/* See header for documentation. */
+uint32_t LayerConfig::getGPUTimestampQueryCount() const
+{
+    return gpuTimestampQueryCount;
+}
+
+/* See header for documentation. */
+uint32_t LayerConfig::getGPUTimestampRingSize() const
+{
+    return gpuTimestampRingSize;
+}
@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the a config file to parameterize the layer.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+/**
+ * @brief This class implements a config interface for this layer.
+ *
+ * The layer contains a default config, but users can provide a JSON config
+ * file on the file system which is loaded at init time.
+ *  - On Android the file is loaded from /data/local/tmp.
+ *  - On Linux the file is loaded from the current working directory.
+ */
+class LayerConfig
+{
+public:
+    /**
+     * @brief Create a new layer config.
+     */
+    LayerConfig();
+
+    /**
+     * @brief Test if we are emitting per-frame summaries instead of workloads.
+     *
+     * @return @c true if emitting frame summaries, @c false otherwise.
+     */
+    bool isFrameSummaryEnabled() const;
+
+    /**
+     * @brief Test if we are writing a native Perfetto trace.
+     *
+     * @return @c true if writing a Perfetto trace, @c false otherwise.
+     */
+    bool isPerfettoEnabled() const;
+
+    /**
+     * @brief Get the path of the Perfetto trace file to write.
+     *
+     * @return The path of the trace file.
+     */
+    const std::string& getPerfettoTracePath() const;
+
+    /**
+     * @brief Get the number of debug label scopes reported in a frame summary.
+     *
+     * @return The maximum number of label scopes to report.
+     */
+    uint32_t getFrameSummaryLabelCount() const;
+
+    /**
+     * @brief Test if we are timing workloads using GPU timestamp queries.
+     *
+     * @return @c true if timing workloads, @c false otherwise.
+     */
+    bool isGPUTimestampEnabled() const;
+
+    /**
+     * @brief Get the maximum number of timestamp queries the layer can allocate.
+     *
+     * @return The maximum number of queries, two of which are used per workload.
+     */
+    uint32_t getGPUTimestampQueryCount() const;
+
+    /**
+     * @brief Get the number of in-flight submits tracked per queue for readback.
+     *
+     * @return The size of the per-queue readback ring.
+     */
+    uint32_t getGPUTimestampRingSize() const;
+
+private:
+    /**
+     * @brief Supported data output modes.
+     */
+    enum OutputMode
+    {
+        OUTPUT_MODE_WORKLOADS,
+        OUTPUT_MODE_FRAME_SUMMARY,
+        OUTPUT_MODE_PERFETTO
+    };
+
+    /**
+     * @brief Parse the configuration options for the output module.
+     *
+     * @param config   The JSON configuration.
+     *
+     * @throws json::out_of_bounds if required fields are missing.
+     */
+    void parseOutputOptions(const json& config);
+
+    /**
+     * @brief Parse the configuration options for the timestamp module.
+     *
+     * @param config   The JSON configuration.
+     *
+     * @throws json::out_of_bounds if required fields are missing.
+     */
+    void parseTimestampOptions(const json& config);
+
+    /**
+     * @brief The data output mode.
+     */
+    OutputMode outputMode {OUTPUT_MODE_WORKLOADS};
+
+    /**
+     * @brief The number of label scopes reported in a frame summary.
+     */
+    uint32_t frameSummaryLabelCount {8};
+
+    /**
+     * @brief The path of the Perfetto trace file to write.
+     */
+    std::string perfettoTracePath {"timeline.perfetto-trace"};
+
+    /**
+     * @brief Are workloads timed using GPU timestamp queries?
+     */
+    bool gpuTimestamps {false};
+
+    /**
+     * @brief The maximum number of timestamp queries the layer can allocate.
+     */
+    uint32_t gpuTimestampQueryCount {16384};
+
+    /**
+     * @brief The number of in-flight submits tracked per queue for readback.
+     */
+    uint32_t gpuTimestampRingSize {16};
+};
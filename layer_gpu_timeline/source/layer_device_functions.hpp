@@ -549,3 +549,80 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueueBindSparse<user_tag>(
     uint32_t bindInfoCount,
     const VkBindSparseInfo* pBindInfo,
     VkFence fence);
+
+// Functions for pipelines
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateComputePipelines<user_tag>(VkDevice device,
+                                                                        VkPipelineCache pipelineCache,
+                                                                        uint32_t createInfoCount,
+                                                                        const VkComputePipelineCreateInfo* pCreateInfos,
+                                                                        const VkAllocationCallbacks* pAllocator,
+                                                                        VkPipeline* pPipelines);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL
+    layer_vkCreateGraphicsPipelines<user_tag>(VkDevice device,
+                                              VkPipelineCache pipelineCache,
+                                              uint32_t createInfoCount,
+                                              const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                              const VkAllocationCallbacks* pAllocator,
+                                              VkPipeline* pPipelines);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL
+    layer_vkCreateRayTracingPipelinesKHR<user_tag>(VkDevice device,
+                                                   VkDeferredOperationKHR deferredOperation,
+                                                   VkPipelineCache pipelineCache,
+                                                   uint32_t createInfoCount,
+                                                   const VkRayTracingPipelineCreateInfoKHR* pCreateInfos,
+                                                   const VkAllocationCallbacks* pAllocator,
+                                                   VkPipeline* pPipelines);
+
+// Functions for waits
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkWaitForFences<user_tag>(VkDevice device,
+                                                               uint32_t fenceCount,
+                                                               const VkFence* pFences,
+                                                               VkBool32 waitAll,
+                                                               uint64_t timeout);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkWaitSemaphores<user_tag>(VkDevice device,
+                                                                const VkSemaphoreWaitInfo* pWaitInfo,
+                                                                uint64_t timeout);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkWaitSemaphoresKHR<user_tag>(VkDevice device,
+                                                                   const VkSemaphoreWaitInfo* pWaitInfo,
+                                                                   uint64_t timeout);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkAcquireNextImageKHR<user_tag>(VkDevice device,
+                                                                     VkSwapchainKHR swapchain,
+                                                                     uint64_t timeout,
+                                                                     VkSemaphore semaphore,
+                                                                     VkFence fence,
+                                                                     uint32_t* pImageIndex);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkAcquireNextImage2KHR<user_tag>(VkDevice device,
+                                                                      const VkAcquireNextImageInfoKHR* pAcquireInfo,
+                                                                      uint32_t* pImageIndex);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueueWaitIdle<user_tag>(VkQueue queue);
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkDeviceWaitIdle<user_tag>(VkDevice device);
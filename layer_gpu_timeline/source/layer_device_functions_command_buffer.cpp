@@ -59,6 +59,14 @@ VKAPI_ATTR VkResult VKAPI_CALL
         tracker.allocateCommandBuffer(pAllocateInfo->commandPool, pCommandBuffers[i]);
     }
 
+    auto* timestamps = layer->getTimestampManager();
+    if (timestamps)
+    {
+        timestamps->allocateCommandBuffers(pAllocateInfo->commandPool,
+                                           pAllocateInfo->commandBufferCount,
+                                           pCommandBuffers);
+    }
+
     return result;
 }
 
@@ -76,6 +84,13 @@ VKAPI_ATTR VkResult layer_vkBeginCommandBuffer<user_tag>(VkCommandBuffer command
     cmdBuffer.reset();
     cmdBuffer.begin(pBeginInfo->flags & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
 
+    // Recording implicitly resets the command buffer, releasing its queries
+    auto* timestamps = layer->getTimestampManager();
+    if (timestamps)
+    {
+        timestamps->resetCommandBuffer(commandBuffer);
+    }
+
     // Release the lock to call into the driver
     lock.unlock();
     return layer->driver.vkBeginCommandBuffer(commandBuffer, pBeginInfo);
@@ -96,6 +111,12 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkResetCommandBuffer<user_tag>(VkCommandBuf
     auto& cmdBuffer = tracker.getCommandBuffer(commandBuffer);
     cmdBuffer.reset();
 
+    auto* timestamps = layer->getTimestampManager();
+    if (timestamps)
+    {
+        timestamps->resetCommandBuffer(commandBuffer);
+    }
+
     // Release the lock to call into the driver
     lock.unlock();
     return layer->driver.vkResetCommandBuffer(commandBuffer, flags);
@@ -115,9 +136,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkFreeCommandBuffers<user_tag>(VkDevice device,
     auto* layer = Device::retrieve(device);
 
     auto& tracker = layer->getStateTracker();
+    auto* timestamps = layer->getTimestampManager();
     for (uint32_t i = 0; i < commandBufferCount; i++)
     {
         tracker.freeCommandBuffer(commandPool, pCommandBuffers[i]);
+        if (timestamps)
+        {
+            timestamps->resetCommandBuffer(pCommandBuffers[i]);
+        }
     }
 
     // Release the lock to call into the driver
@@ -140,10 +166,15 @@ VKAPI_ATTR void VKAPI_CALL layer_vkCmdExecuteCommands<user_tag>(VkCommandBuffer
     auto& tracker = layer->getStateTracker();
     auto& primary = tracker.getCommandBuffer(commandBuffer);
 
+    auto* timestamps = layer->getTimestampManager();
     for (uint32_t i = 0; i < commandBufferCount; i++)
     {
         auto& secondary = tracker.getCommandBuffer(pCommandBuffers[i]);
         primary.executeCommands(secondary);
+        if (timestamps)
+        {
+            timestamps->executeCommands(commandBuffer, pCommandBuffers[i]);
+        }
     }
 
     // Release the lock to call into the main driver
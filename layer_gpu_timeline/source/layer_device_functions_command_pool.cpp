@@ -30,6 +30,27 @@
 
 extern std::mutex g_vulkanLock;
 
+/**
+ * @brief Release the timestamp queries owned by all command buffers in a pool.
+ *
+ * @param layer         The layer context for the device.
+ * @param commandPool   The command pool being reset or destroyed.
+ */
+static void resetCommandPoolTimestamps(Device& layer, VkCommandPool commandPool)
+{
+    auto* timestamps = layer.getTimestampManager();
+    if (!timestamps)
+    {
+        return;
+    }
+
+    auto& tracker = layer.getStateTracker();
+    for (const auto& it : tracker.getCommandPool(commandPool).getCommandBuffers())
+    {
+        timestamps->resetCommandBuffer(it.first);
+    }
+}
+
 /* See Vulkan API for documentation. */
 template<>
 VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateCommandPool<user_tag>(VkDevice device,
@@ -55,6 +76,7 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateCommandPool<user_tag>(VkDevice devi
     lock.lock();
     auto& tracker = layer->getStateTracker();
     tracker.createCommandPool(*pCommandPool);
+    layer->createTimestampCommandPool(*pCommandPool, pCreateInfo->queueFamilyIndex);
     return result;
 }
 
@@ -70,6 +92,8 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkResetCommandPool<user_tag>(VkDevice devic
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(device);
 
+    resetCommandPoolTimestamps(*layer, commandPool);
+
     auto& tracker = layer->getStateTracker();
     tracker.getCommandPool(commandPool).reset();
 
@@ -90,6 +114,14 @@ VKAPI_ATTR void VKAPI_CALL layer_vkDestroyCommandPool<user_tag>(VkDevice device,
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(device);
 
+    resetCommandPoolTimestamps(*layer, commandPool);
+
+    auto* timestamps = layer->getTimestampManager();
+    if (timestamps)
+    {
+        timestamps->destroyCommandPool(commandPool);
+    }
+
     auto& tracker = layer->getStateTracker();
     tracker.destroyCommandPool(commandPool);
 
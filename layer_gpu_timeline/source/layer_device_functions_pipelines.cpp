@@ -0,0 +1,349 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+#include "device.hpp"
+#include "device_utils.hpp"
+#include "framework/device_dispatch_table.hpp"
+#include "timeline_pipelines.hpp"
+#include "timeline_protobuf_encoder.hpp"
+
+#include <mutex>
+#include <vector>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+extern std::mutex g_vulkanLock;
+
+/**
+ * @brief Helper to add pipeline creation feedback to a pipeline creation call.
+ *
+ * The application create infos are shallow copied, and a layer-owned
+ * VkPipelineCreationFeedbackCreateInfo is prepended to the pNext chain of any
+ * create info that does not already request feedback. If the application
+ * already requests feedback, the application's results are read instead.
+ *
+ * @tparam T   The pipeline create info type.
+ */
+template<typename T>
+class PipelineFeedbackPatch
+{
+public:
+    /**
+     * @brief Construct a patch for a pipeline creation call.
+     *
+     * @param enabled        Can the layer add creation feedback structures?
+     * @param count          The number of create infos.
+     * @param pCreateInfos   The application create infos.
+     */
+    PipelineFeedbackPatch(bool enabled, uint32_t count, const T* pCreateInfos)
+        : originalCreateInfos(pCreateInfos),
+          results(count, nullptr)
+    {
+        if (enabled)
+        {
+            createInfos.assign(pCreateInfos, pCreateInfos + count);
+            feedback.resize(count);
+            feedbackInfos.resize(count);
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            auto* appInfo = vku::FindStructInPNextChain<VkPipelineCreationFeedbackCreateInfo>(pCreateInfos[i].pNext);
+            if (appInfo)
+            {
+                results[i] = appInfo->pPipelineCreationFeedback;
+            }
+            else if (enabled)
+            {
+                auto& info = feedbackInfos[i];
+                info = vku::InitStructHelper();
+                info.pNext = createInfos[i].pNext;
+                info.pPipelineCreationFeedback = &feedback[i];
+                info.pipelineStageCreationFeedbackCount = 0;
+                info.pPipelineStageCreationFeedbacks = nullptr;
+
+                createInfos[i].pNext = &info;
+                results[i] = &feedback[i];
+            }
+        }
+    }
+
+    /**
+     * @brief Get the create infos to pass to the driver.
+     */
+    const T* getCreateInfos() const { return createInfos.empty() ? originalCreateInfos : createInfos.data(); }
+
+    /**
+     * @brief Populate the feedback fields of a record after the driver call.
+     *
+     * @param record   The record to populate.
+     */
+    void fillRecord(PipelineCreationRecord& record) const
+    {
+        record.pipelineDurations.reserve(results.size());
+        for (const auto* result : results)
+        {
+            if (!result || !(result->flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT))
+            {
+                record.pipelineDurations.push_back(0);
+                continue;
+            }
+
+            record.feedbackCount++;
+            if (result->flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT)
+            {
+                record.cacheHitCount++;
+            }
+
+            record.pipelineDurations.push_back(result->duration);
+        }
+    }
+
+private:
+    /**
+     * @brief The application create infos.
+     */
+    const T* originalCreateInfos;
+
+    /**
+     * @brief The patched create infos, or empty if not patched.
+     */
+    std::vector<T> createInfos;
+
+    /**
+     * @brief The layer-owned feedback results.
+     */
+    std::vector<VkPipelineCreationFeedback> feedback;
+
+    /**
+     * @brief The layer-owned feedback requests.
+     */
+    std::vector<VkPipelineCreationFeedbackCreateInfo> feedbackInfos;
+
+    /**
+     * @brief The feedback result for each pipeline, or nullptr if none.
+     */
+    std::vector<const VkPipelineCreationFeedback*> results;
+};
+
+/**
+ * @brief Create a pipeline creation record for a set of create infos.
+ *
+ * @param type             The type of pipeline created.
+ * @param count            The number of create infos.
+ * @param pCreateInfos     The application create infos.
+ * @param startTimestamp   The CLOCK_MONOTONIC_RAW timestamp at the start of the call.
+ * @param endTimestamp     The CLOCK_MONOTONIC_RAW timestamp at the end of the call.
+ * @param result           The result returned by the API call.
+ *
+ * @return The record, with no feedback fields populated.
+ */
+template<typename T>
+static PipelineCreationRecord createRecord(PipelineType type,
+                                           uint32_t count,
+                                           const T* pCreateInfos,
+                                           uint64_t startTimestamp,
+                                           uint64_t endTimestamp,
+                                           VkResult result)
+{
+    PipelineCreationRecord record {};
+    record.type = type;
+    record.threadID = getThreadID();
+    record.startTimestamp = startTimestamp;
+    record.endTimestamp = endTimestamp;
+    record.pipelineCount = count;
+    record.result = result;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (pCreateInfos[i].flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR)
+        {
+            record.libraryCount++;
+        }
+
+        auto* libraries = vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(pCreateInfos[i].pNext);
+        if (libraries && libraries->libraryCount)
+        {
+            record.linkCount++;
+        }
+    }
+
+    return record;
+}
+
+/**
+ * @brief Emit the metadata for a completed pipeline creation call.
+ *
+ * In frame summary mode the call is only accumulated, and no message is sent.
+ * In Perfetto mode the call is written to the trace file.
+ *
+ * @param layer    The layer context.
+ * @param record   The pipeline creation record.
+ */
+static void emitPipelineCreationMetadata(Device& layer, const PipelineCreationRecord& record)
+{
+    auto* perfetto = layer.getPerfettoWriter();
+    if (perfetto)
+    {
+        perfetto->emitPipelineCreation(record);
+        return;
+    }
+
+    if (layer.instance->config.isFrameSummaryEnabled())
+    {
+        layer.getFrameSummary().pipelineCreation(record.pipelineCount, record.endTimestamp - record.startTimestamp);
+        return;
+    }
+
+    TimelineProtobufEncoder::emitPipelineCreation(layer, record);
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkCreateComputePipelines<user_tag>(VkDevice device,
+                                                                        VkPipelineCache pipelineCache,
+                                                                        uint32_t createInfoCount,
+                                                                        const VkComputePipelineCreateInfo* pCreateInfos,
+                                                                        const VkAllocationCallbacks* pAllocator,
+                                                                        VkPipeline* pPipelines)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+    bool addFeedback = layer->isPipelineCreationFeedbackEnabled();
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    PipelineFeedbackPatch<VkComputePipelineCreateInfo> patch(addFeedback, createInfoCount, pCreateInfos);
+
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkCreateComputePipelines(device,
+                                                             pipelineCache,
+                                                             createInfoCount,
+                                                             patch.getCreateInfos(),
+                                                             pAllocator,
+                                                             pPipelines);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    auto record =
+        createRecord(PipelineType::COMPUTE, createInfoCount, pCreateInfos, startTimestamp, endTimestamp, result);
+    patch.fillRecord(record);
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitPipelineCreationMetadata(*layer, record);
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL
+    layer_vkCreateGraphicsPipelines<user_tag>(VkDevice device,
+                                              VkPipelineCache pipelineCache,
+                                              uint32_t createInfoCount,
+                                              const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                              const VkAllocationCallbacks* pAllocator,
+                                              VkPipeline* pPipelines)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+    bool addFeedback = layer->isPipelineCreationFeedbackEnabled();
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    PipelineFeedbackPatch<VkGraphicsPipelineCreateInfo> patch(addFeedback, createInfoCount, pCreateInfos);
+
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkCreateGraphicsPipelines(device,
+                                                              pipelineCache,
+                                                              createInfoCount,
+                                                              patch.getCreateInfos(),
+                                                              pAllocator,
+                                                              pPipelines);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    auto record =
+        createRecord(PipelineType::GRAPHICS, createInfoCount, pCreateInfos, startTimestamp, endTimestamp, result);
+    patch.fillRecord(record);
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitPipelineCreationMetadata(*layer, record);
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL
+    layer_vkCreateRayTracingPipelinesKHR<user_tag>(VkDevice device,
+                                                   VkDeferredOperationKHR deferredOperation,
+                                                   VkPipelineCache pipelineCache,
+                                                   uint32_t createInfoCount,
+                                                   const VkRayTracingPipelineCreateInfoKHR* pCreateInfos,
+                                                   const VkAllocationCallbacks* pAllocator,
+                                                   VkPipeline* pPipelines)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Deferred creation writes feedback after this call returns, so the layer
+    // can only add feedback structures for non-deferred creation
+    bool addFeedback = layer->isPipelineCreationFeedbackEnabled() && (deferredOperation == VK_NULL_HANDLE);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    PipelineFeedbackPatch<VkRayTracingPipelineCreateInfoKHR> patch(addFeedback, createInfoCount, pCreateInfos);
+
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkCreateRayTracingPipelinesKHR(device,
+                                                                   deferredOperation,
+                                                                   pipelineCache,
+                                                                   createInfoCount,
+                                                                   patch.getCreateInfos(),
+                                                                   pAllocator,
+                                                                   pPipelines);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    auto record =
+        createRecord(PipelineType::RAY_TRACING, createInfoCount, pCreateInfos, startTimestamp, endTimestamp, result);
+
+    // Application feedback is not written yet if creation was deferred
+    if (result != VK_OPERATION_DEFERRED_KHR)
+    {
+        patch.fillRecord(record);
+    }
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitPipelineCreationMetadata(*layer, record);
+    return result;
+}
@@ -24,73 +24,194 @@
  */
 
 #include "device.hpp"
+#include "device_utils.hpp"
 #include "framework/device_dispatch_table.hpp"
+#include "framework/utils.hpp"
 #include "timeline_protobuf_encoder.hpp"
 #include "trackers/queue.hpp"
 
 #include <mutex>
-#include <time.h>
+#include <vector>
 #include <vulkan/utility/vk_struct_helper.hpp>
 
 extern std::mutex g_vulkanLock;
 
 /**
- * @brief Get the CLOCK_MONOTONIC_RAW timestamp in nanoseconds.
+ * @brief Emit the queue submit time metadata.
  *
- * CLOCK_MONOTONIC_RAW is clock source 5 in Perfetto.
+ * In frame summary mode the submit is only counted, and no message is sent.
+ * In Perfetto mode the submit is written to the trace file.
  *
- * @returns Current time in nanoseconds.
+ * @param layer             The layer context.
+ * @param queue             The queue being submitted to.
+ * @param workloadVisitor   The data emit callback.
  */
-static uint64_t getClockMonotonicRaw()
+static void emitQueueMetadata(Device& layer, VkQueue queue, TimelineProtobufEncoder& workloadVisitor)
 {
-    struct timespec ts;
+    auto* perfetto = layer.getPerfettoWriter();
+    if (perfetto)
+    {
+        perfetto->emitSubmit(layer.device, queue, getClockMonotonicRaw());
+        return;
+    }
 
-    auto error = clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
-    if (error)
+    if (layer.instance->config.isFrameSummaryEnabled())
     {
-        return 0;
+        layer.getFrameSummary().submit();
+        return;
     }
 
-    // Accumulate the nanosecond value
-    uint64_t sec = static_cast<uint64_t>(ts.tv_sec);
-    uint64_t nsec = static_cast<uint64_t>(ts.tv_nsec);
-    nsec += sec * 1000000000ull;
+    workloadVisitor.emitSubmit(queue, getClockMonotonicRaw());
+}
+
+/**
+ * @brief Emit the frame boundary metadata.
+ *
+ * In frame summary mode this emits the summary of the frame that just ended,
+ * otherwise it emits a frame delimiter for the frame that is starting. In
+ * Perfetto mode the delimiter and a new clock snapshot are written to the
+ * trace file.
+ *
+ * @param layer   The layer context.
+ */
+static void emitFrameMetadata(Device& layer)
+{
+    auto& tracker = layer.getStateTracker();
+    const auto& config = layer.instance->config;
+    uint64_t timestamp = getClockMonotonicRaw();
+
+    auto* perfetto = layer.getPerfettoWriter();
+    if (perfetto)
+    {
+        tracker.queuePresent();
+        perfetto->emitFrame(layer.device, tracker.totalStats.getFrameCount(), timestamp);
+        layer.emitPerfettoClockSnapshot();
+        return;
+    }
 
-    return nsec;
+    if (config.isFrameSummaryEnabled())
+    {
+        // Frame stats are reset by queuePresent so must be emitted first
+        auto& summary = layer.getFrameSummary();
+        TimelineProtobufEncoder::emitFrameSummary(layer,
+                                                  tracker.totalStats.getFrameCount(),
+                                                  timestamp,
+                                                  tracker.frameStats,
+                                                  summary,
+                                                  config.getFrameSummaryLabelCount());
+        summary.reset(timestamp);
+        tracker.queuePresent();
+        return;
+    }
+
+    tracker.queuePresent();
+    TimelineProtobufEncoder::emitFrame(layer, tracker.totalStats.getFrameCount(), timestamp);
 }
 
 /**
- * @brief Emit the queue submit time metadata.
+ * @brief Emit the GPU timestamp results for all retired submits.
  *
- * @param queue             The queue being submitted to.
- * @param workloadVisitor   The data emit callback.
+ * This is a no-op if GPU timestamps are disabled.
+ *
+ * @param layer   The layer context.
  */
-static void emitQueueMetadata(VkQueue queue, TimelineProtobufEncoder& workloadVisitor)
+static void emitWorkloadTimings(Device& layer)
 {
-    workloadVisitor.emitSubmit(queue, getClockMonotonicRaw());
+    auto* timestamps = layer.getTimestampManager();
+    if (!timestamps)
+    {
+        return;
+    }
+
+    auto* perfetto = layer.getPerfettoWriter();
+    for (const auto& result : timestamps->poll())
+    {
+        if (perfetto)
+        {
+            perfetto->emitWorkloadTiming(layer.device, result);
+        }
+        else
+        {
+            TimelineProtobufEncoder::emitWorkloadTiming(layer, result);
+        }
+    }
+}
+
+/**
+ * @brief Submit a layer-owned fence to track completion of timed workloads.
+ *
+ * This must be called without the layer-wide lock held, after the application
+ * submit.
+ *
+ * @param layer     The layer context.
+ * @param queue     The queue being submitted to.
+ * @param queries   The timestamp queries written by the application submit.
+ */
+static void submitTimestampFence(Device& layer, VkQueue queue, std::vector<TimestampQuery>&& queries)
+{
+    auto* timestamps = layer.getTimestampManager();
+    if (!timestamps)
+    {
+        return;
+    }
+
+    submitTimestampFence(*timestamps,
+                         layer.driver,
+                         layer.device,
+                         queue,
+                         std::move(queries),
+                         g_vulkanLock,
+                         [&layer]()
+                         {
+                             emitWorkloadTimings(layer);
+                         });
 }
 
 /**
  * @brief Emit the command buffer submit time metadata.
  *
- * @param layer             The layer context.
- * @param queue             The queue being submitted to.
- * @param commandBuffer     The command buffer being submitted.
- * @param workloadVisitor   The data emit callback.
+ * @param layer              The layer context.
+ * @param queue              The queue being submitted to.
+ * @param commandBuffer      The command buffer being submitted.
+ * @param workloadVisitor    The data emit callback.
+ * @param timestampQueries   The list of timestamp queries to append to.
  */
 static void emitCommandBufferMetadata(Device& layer,
                                       VkQueue queue,
                                       VkCommandBuffer commandBuffer,
-                                      Tracker::SubmitCommandWorkloadVisitor& workloadVisitor)
+                                      Tracker::SubmitCommandWorkloadVisitor& workloadVisitor,
+                                      std::vector<TimestampQuery>& timestampQueries)
 {
     // Fetch layer proxies for this workload
     auto& tracker = layer.getStateTracker();
     auto& trackQueue = tracker.getQueue(queue);
     auto& trackCB = tracker.getCommandBuffer(commandBuffer);
 
+    // Accumulate the command buffer stats into the frame stats
+    tracker.queueSubmit(commandBuffer);
+
     // Play the layer command stream into the queue
     const auto& LCS = trackCB.getSubmitCommandStream();
-    trackQueue.runSubmitCommandStream(LCS, workloadVisitor);
+    auto* perfetto = layer.getPerfettoWriter();
+    if (perfetto)
+    {
+        trackQueue.runSubmitCommandStream(LCS, *perfetto);
+    }
+    else if (layer.instance->config.isFrameSummaryEnabled())
+    {
+        trackQueue.runSubmitCommandStream(LCS, layer.getFrameSummary());
+    }
+    else
+    {
+        trackQueue.runSubmitCommandStream(LCS, workloadVisitor);
+    }
+
+    // Collect the timestamp queries written by this command buffer
+    auto* timestamps = layer.getTimestampManager();
+    if (timestamps)
+    {
+        timestamps->collectQueries(commandBuffer, timestampQueries);
+    }
 }
 
 /**
@@ -118,15 +239,12 @@ static void checkManualFrameBoundary(
     if (ext && (ext->flags & VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT))
     {
         // Emulate a queue present to indicate end of frame
-        auto& tracker = layer.getStateTracker();
-        tracker.queuePresent();
-
-        TimelineProtobufEncoder::emitFrame(layer, tracker.totalStats.getFrameCount(), getClockMonotonicRaw());
+        emitFrameMetadata(layer);
 
         // Emulate a new queue submit if work remains to submit
         if (!isLastSubmit)
         {
-            emitQueueMetadata(queue, workloadVisitor);
+            emitQueueMetadata(layer, queue, workloadVisitor);
         }
     }
 }
@@ -141,9 +259,6 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueuePresentKHR<user_tag>(VkQueue queue,
     std::unique_lock<std::mutex> lock {g_vulkanLock};
     auto* layer = Device::retrieve(queue);
 
-    auto& tracker = layer->getStateTracker();
-    tracker.queuePresent();
-
     // Create a modifiable structure we can patch
     vku::safe_VkPresentInfoKHR safePresentInfo(pPresentInfo);
     auto* newPresentInfo = reinterpret_cast<VkPresentInfoKHR*>(&safePresentInfo);
@@ -151,7 +266,10 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueuePresentKHR<user_tag>(VkQueue queue,
     // Note that we assume QueuePresent is _always_ the end of a frame.
     // This is run with the lock held to ensure that all queue submit messages
     // are sent sequentially to the host tool
-    TimelineProtobufEncoder::emitFrame(*layer, tracker.totalStats.getFrameCount(), getClockMonotonicRaw());
+    emitFrameMetadata(*layer);
+
+    // Add timing results for any retired submits
+    emitWorkloadTimings(*layer);
 
     // Release the lock to call into the driver
     lock.unlock();
@@ -174,16 +292,17 @@ VKAPI_ATTR VkResult VKAPI_CALL
     TimelineProtobufEncoder workloadVisitor {*layer};
 
     // Add queue-level metadata
-    emitQueueMetadata(queue, workloadVisitor);
+    emitQueueMetadata(*layer, queue, workloadVisitor);
 
     // Add per-command buffer metadata
+    std::vector<TimestampQuery> timestampQueries;
     for (uint32_t i = 0; i < submitCount; i++)
     {
         const auto& submit = pSubmits[i];
         for (uint32_t j = 0; j < submit.commandBufferCount; j++)
         {
             VkCommandBuffer commandBuffer = submit.pCommandBuffers[j];
-            emitCommandBufferMetadata(*layer, queue, commandBuffer, workloadVisitor);
+            emitCommandBufferMetadata(*layer, queue, commandBuffer, workloadVisitor, timestampQueries);
         }
 
         // Check for end of frame boundary
@@ -191,9 +310,18 @@ VKAPI_ATTR VkResult VKAPI_CALL
         checkManualFrameBoundary(*layer, queue, submit.pNext, isLast, workloadVisitor);
     }
 
+    // Add timing results for any retired submits
+    emitWorkloadTimings(*layer);
+
     // Release the lock to call into the driver
     lock.unlock();
-    return layer->driver.vkQueueSubmit(queue, submitCount, pSubmits, fence);
+    VkResult result = layer->driver.vkQueueSubmit(queue, submitCount, pSubmits, fence);
+    if (result == VK_SUCCESS)
+    {
+        submitTimestampFence(*layer, queue, std::move(timestampQueries));
+    }
+
+    return result;
 }
 
 /* See Vulkan API for documentation. */
@@ -212,16 +340,17 @@ VKAPI_ATTR VkResult VKAPI_CALL
     TimelineProtobufEncoder workloadVisitor {*layer};
 
     // Add queue-level metadata
-    emitQueueMetadata(queue, workloadVisitor);
+    emitQueueMetadata(*layer, queue, workloadVisitor);
 
     // Add per-command buffer metadata
+    std::vector<TimestampQuery> timestampQueries;
     for (uint32_t i = 0; i < submitCount; i++)
     {
         const auto& submit = pSubmits[i];
         for (uint32_t j = 0; j < submit.commandBufferInfoCount; j++)
         {
             VkCommandBuffer commandBuffer = submit.pCommandBufferInfos[j].commandBuffer;
-            emitCommandBufferMetadata(*layer, queue, commandBuffer, workloadVisitor);
+            emitCommandBufferMetadata(*layer, queue, commandBuffer, workloadVisitor, timestampQueries);
         }
 
         // Check for end of frame boundary
@@ -229,9 +358,18 @@ VKAPI_ATTR VkResult VKAPI_CALL
         checkManualFrameBoundary(*layer, queue, submit.pNext, isLast, workloadVisitor);
     }
 
+    // Add timing results for any retired submits
+    emitWorkloadTimings(*layer);
+
     // Release the lock to call into the driver
     lock.unlock();
-    return layer->driver.vkQueueSubmit2(queue, submitCount, pSubmits, fence);
+    VkResult result = layer->driver.vkQueueSubmit2(queue, submitCount, pSubmits, fence);
+    if (result == VK_SUCCESS)
+    {
+        submitTimestampFence(*layer, queue, std::move(timestampQueries));
+    }
+
+    return result;
 }
 
 /* See Vulkan API for documentation. */
@@ -250,16 +388,17 @@ VKAPI_ATTR VkResult VKAPI_CALL
     TimelineProtobufEncoder workloadVisitor {*layer};
 
     // Add queue-level metadata
-    emitQueueMetadata(queue, workloadVisitor);
+    emitQueueMetadata(*layer, queue, workloadVisitor);
 
     // Add per-command buffer metadata
+    std::vector<TimestampQuery> timestampQueries;
     for (uint32_t i = 0; i < submitCount; i++)
     {
         const auto& submit = pSubmits[i];
         for (uint32_t j = 0; j < submit.commandBufferInfoCount; j++)
         {
             VkCommandBuffer commandBuffer = submit.pCommandBufferInfos[j].commandBuffer;
-            emitCommandBufferMetadata(*layer, queue, commandBuffer, workloadVisitor);
+            emitCommandBufferMetadata(*layer, queue, commandBuffer, workloadVisitor, timestampQueries);
         }
 
         // Check for end of frame boundary
@@ -267,9 +406,18 @@ VKAPI_ATTR VkResult VKAPI_CALL
         checkManualFrameBoundary(*layer, queue, submit.pNext, isLast, workloadVisitor);
     }
 
+    // Add timing results for any retired submits
+    emitWorkloadTimings(*layer);
+
     // Release the lock to call into the driver
     lock.unlock();
-    return layer->driver.vkQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    VkResult result = layer->driver.vkQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    if (result == VK_SUCCESS)
+    {
+        submitTimestampFence(*layer, queue, std::move(timestampQueries));
+    }
+
+    return result;
 }
 
 /**
@@ -301,9 +449,7 @@ VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueueBindSparse<user_tag>(
         if (ext && (ext->flags & VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT))
         {
             // Emulate a queue present to indicate end of frame
-            auto& tracker = layer->getStateTracker();
-            tracker.queuePresent();
-            TimelineProtobufEncoder::emitFrame(*layer, tracker.totalStats.getFrameCount(), getClockMonotonicRaw());
+            emitFrameMetadata(*layer);
         }
     }
 
@@ -0,0 +1,267 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+#include "device.hpp"
+#include "device_utils.hpp"
+#include "framework/device_dispatch_table.hpp"
+#include "timeline_protobuf_encoder.hpp"
+#include "timeline_waits.hpp"
+
+#include <mutex>
+
+extern std::mutex g_vulkanLock;
+
+/**
+ * @brief Emit the metadata for a completed wait.
+ *
+ * In frame summary mode the wait is only accumulated, and no message is sent.
+ * In Perfetto mode the wait is written to the trace file.
+ *
+ * @param layer   The layer context.
+ * @param wait    The wait record.
+ */
+static void emitWaitMetadata(Device& layer, const WaitRecord& wait)
+{
+    auto* perfetto = layer.getPerfettoWriter();
+    if (perfetto)
+    {
+        perfetto->emitWait(wait);
+        return;
+    }
+
+    if (layer.instance->config.isFrameSummaryEnabled())
+    {
+        layer.getFrameSummary().wait(wait.endTimestamp - wait.startTimestamp);
+        return;
+    }
+
+    TimelineProtobufEncoder::emitWait(layer, wait);
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkWaitForFences<user_tag>(VkDevice device,
+                                                               uint32_t fenceCount,
+                                                               const VkFence* pFences,
+                                                               VkBool32 waitAll,
+                                                               uint64_t timeout)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkWaitForFences(device, fenceCount, pFences, waitAll, timeout);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    // Polling calls with a zero timeout never block, so are not recorded
+    if (timeout == 0)
+    {
+        return result;
+    }
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitWaitMetadata(*layer,
+                     {WaitType::WAIT_FOR_FENCES, VK_NULL_HANDLE, getThreadID(), startTimestamp, endTimestamp, result});
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkWaitSemaphores<user_tag>(VkDevice device,
+                                                                const VkSemaphoreWaitInfo* pWaitInfo,
+                                                                uint64_t timeout)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkWaitSemaphores(device, pWaitInfo, timeout);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    // Polling calls with a zero timeout never block, so are not recorded
+    if (timeout == 0)
+    {
+        return result;
+    }
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitWaitMetadata(*layer,
+                     {WaitType::WAIT_SEMAPHORES, VK_NULL_HANDLE, getThreadID(), startTimestamp, endTimestamp, result});
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkWaitSemaphoresKHR<user_tag>(VkDevice device,
+                                                                   const VkSemaphoreWaitInfo* pWaitInfo,
+                                                                   uint64_t timeout)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkWaitSemaphoresKHR(device, pWaitInfo, timeout);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    // Polling calls with a zero timeout never block, so are not recorded
+    if (timeout == 0)
+    {
+        return result;
+    }
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitWaitMetadata(*layer,
+                     {WaitType::WAIT_SEMAPHORES, VK_NULL_HANDLE, getThreadID(), startTimestamp, endTimestamp, result});
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkAcquireNextImageKHR<user_tag>(VkDevice device,
+                                                                     VkSwapchainKHR swapchain,
+                                                                     uint64_t timeout,
+                                                                     VkSemaphore semaphore,
+                                                                     VkFence fence,
+                                                                     uint32_t* pImageIndex)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    // Polling calls with a zero timeout never block, so are not recorded
+    if (timeout == 0)
+    {
+        return result;
+    }
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitWaitMetadata(*layer,
+                     {WaitType::ACQUIRE_NEXT_IMAGE, VK_NULL_HANDLE, getThreadID(), startTimestamp, endTimestamp, result});
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkAcquireNextImage2KHR<user_tag>(VkDevice device,
+                                                                      const VkAcquireNextImageInfoKHR* pAcquireInfo,
+                                                                      uint32_t* pImageIndex)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    // Polling calls with a zero timeout never block, so are not recorded
+    if (pAcquireInfo->timeout == 0)
+    {
+        return result;
+    }
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitWaitMetadata(*layer,
+                     {WaitType::ACQUIRE_NEXT_IMAGE, VK_NULL_HANDLE, getThreadID(), startTimestamp, endTimestamp, result});
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkQueueWaitIdle<user_tag>(VkQueue queue)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(queue);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkQueueWaitIdle(queue);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitWaitMetadata(*layer,
+                     {WaitType::QUEUE_WAIT_IDLE, queue, getThreadID(), startTimestamp, endTimestamp, result});
+    return result;
+}
+
+/* See Vulkan API for documentation. */
+template<>
+VKAPI_ATTR VkResult VKAPI_CALL layer_vkDeviceWaitIdle<user_tag>(VkDevice device)
+{
+    LAYER_TRACE(__func__);
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> lock {g_vulkanLock};
+    auto* layer = Device::retrieve(device);
+
+    // Release the lock to call into the driver
+    lock.unlock();
+    uint64_t startTimestamp = getClockMonotonicRaw();
+    VkResult result = layer->driver.vkDeviceWaitIdle(device);
+    uint64_t endTimestamp = getClockMonotonicRaw();
+
+    // Retake the lock to access layer-wide global store
+    lock.lock();
+    emitWaitMetadata(*layer,
+                     {WaitType::DEVICE_WAIT_IDLE, VK_NULL_HANDLE, getThreadID(), startTimestamp, endTimestamp, result});
+    return result;
+}
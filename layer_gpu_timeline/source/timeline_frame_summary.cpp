@@ -0,0 +1,215 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines the on-device reduction of the layer command stream into per-frame
+ * aggregate statistics.
+ */
+
+#include "timeline_frame_summary.hpp"
+
+#include "trackers/render_pass.hpp"
+#include "utils/misc.hpp"
+
+#include <algorithm>
+
+/* See header for documentation. */
+void TimelineFrameSummary::reset(uint64_t timestamp)
+{
+    startTimestamp = timestamp;
+    submitCount = 0;
+    waitCount = 0;
+    waitTime = 0;
+    pipelineCount = 0;
+    pipelineCreationTime = 0;
+    renderPassDrawCallCounts.clear();
+    lastRenderPassTagID = 0;
+    attachmentLoadPixels = 0;
+    attachmentStorePixels = 0;
+    imageTransferPixels = 0;
+    bufferTransferBytes = 0;
+    asTransferBytes = 0;
+    labelScopes.clear();
+}
+
+/* See header for documentation. */
+std::vector<std::pair<std::string, FrameSummaryLabelScope>> TimelineFrameSummary::getTopLabelScopes(size_t count) const
+{
+    std::vector<std::pair<std::string, FrameSummaryLabelScope>> scopes(labelScopes.begin(), labelScopes.end());
+
+    auto isBusier = [](const auto& a, const auto& b)
+    {
+        if (a.second.workloadCount != b.second.workloadCount)
+        {
+            return a.second.workloadCount > b.second.workloadCount;
+        }
+
+        return a.second.drawCallCount > b.second.drawCallCount;
+    };
+
+    count = std::min(count, scopes.size());
+    std::partial_sort(scopes.begin(), scopes.begin() + count, scopes.end(), isBusier);
+    scopes.resize(count);
+
+    return scopes;
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::addLabelScope(const std::vector<std::string>& debugStack, uint64_t drawCallCount)
+{
+    // Workloads outside of any label scope are not tracked
+    if (debugStack.empty())
+    {
+        return;
+    }
+
+    auto& scope = labelScopes[debugStack.back()];
+    scope.workloadCount += 1;
+    scope.drawCallCount += drawCallCount;
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSRenderPass& renderPass,
+                                      const std::vector<std::string>& debugStack)
+{
+    uint64_t drawCount = renderPass.getDrawCallCount();
+    renderPassDrawCallCounts.push_back(drawCount);
+    lastRenderPassTagID = renderPass.getTagID();
+
+    // Attachment traffic is approximated in pixels as formats are not tracked
+    uint64_t pixels = static_cast<uint64_t>(renderPass.getWidth()) * renderPass.getHeight();
+    for (const auto& attachment : renderPass.getAttachments())
+    {
+        if (attachment.isLoaded())
+        {
+            attachmentLoadPixels += pixels;
+        }
+
+        if (attachment.isStored() || attachment.isResolved())
+        {
+            attachmentStorePixels += pixels;
+        }
+    }
+
+    addLabelScope(debugStack, drawCount);
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSRenderPassContinuation& continuation,
+                                      const std::vector<std::string>& debugStack,
+                                      uint64_t renderPassTagID)
+{
+    uint64_t drawCount = continuation.getDrawCallCount();
+
+    // Merge into the parent render pass if it was submitted in this frame
+    if (!renderPassDrawCallCounts.empty() && (lastRenderPassTagID == renderPassTagID))
+    {
+        renderPassDrawCallCounts.back() += drawCount;
+    }
+
+    // Continuations are not new workloads, so only accumulate the draw calls
+    if (!debugStack.empty())
+    {
+        labelScopes[debugStack.back()].drawCallCount += drawCount;
+    }
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSDispatch& dispatch, const std::vector<std::string>& debugStack)
+{
+    UNUSED(dispatch);
+
+    addLabelScope(debugStack, 0);
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSDispatchDataGraph& dispatch,
+                                      const std::vector<std::string>& debugStack)
+{
+    UNUSED(dispatch);
+
+    addLabelScope(debugStack, 0);
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSTraceRays& traceRays,
+                                      const std::vector<std::string>& debugStack)
+{
+    UNUSED(traceRays);
+
+    addLabelScope(debugStack, 0);
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSImageTransfer& imageTransfer,
+                                      const std::vector<std::string>& debugStack)
+{
+    // Transfers of unknown size use negative values
+    int64_t pixelCount = imageTransfer.getPixelCount();
+    if (pixelCount > 0)
+    {
+        imageTransferPixels += static_cast<uint64_t>(pixelCount);
+    }
+
+    addLabelScope(debugStack, 0);
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSBufferTransfer& bufferTransfer,
+                                      const std::vector<std::string>& debugStack)
+{
+    // Transfers of unknown size use negative values
+    int64_t byteCount = bufferTransfer.getByteCount();
+    if (byteCount > 0)
+    {
+        bufferTransferBytes += static_cast<uint64_t>(byteCount);
+    }
+
+    addLabelScope(debugStack, 0);
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSAccelerationStructureBuild& asBuild,
+                                      const std::vector<std::string>& debugStack)
+{
+    UNUSED(asBuild);
+
+    addLabelScope(debugStack, 0);
+}
+
+/* See header for documentation. */
+void TimelineFrameSummary::operator()(const Tracker::LCSAccelerationStructureTransfer& asTransfer,
+                                      const std::vector<std::string>& debugStack)
+{
+    // Transfers of unknown size use negative values
+    int64_t byteCount = asTransfer.getByteCount();
+    if (byteCount > 0)
+    {
+        asTransferBytes += static_cast<uint64_t>(byteCount);
+    }
+
+    addLabelScope(debugStack, 0);
+}
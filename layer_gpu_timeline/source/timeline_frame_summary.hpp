@@ -0,0 +1,289 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the on-device reduction of the layer command stream into per-frame
+ * aggregate statistics.
+ *
+ * Role summary
+ * ============
+ *
+ * In frame summary output mode the layer does not emit one message per
+ * workload. Instead each submitted command stream is replayed into this
+ * visitor, which accumulates compact statistics for the current frame. At the
+ * frame boundary the accumulated data is emitted as a single message and the
+ * accumulator is reset for the next frame.
+ *
+ * Workload counts by type are taken from the state tracker's frame statistics,
+ * so this class only tracks data that is not available from Tracker::Stats.
+ */
+
+#pragma once
+
+#include "trackers/layer_command_stream.hpp"
+#include "trackers/queue.hpp"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Aggregate statistics for a single debug label scope.
+ */
+struct FrameSummaryLabelScope
+{
+    /**
+     * @brief The number of workloads submitted in this scope.
+     */
+    uint64_t workloadCount {0};
+
+    /**
+     * @brief The number of draw calls submitted in this scope.
+     */
+    uint64_t drawCallCount {0};
+};
+
+/**
+ * @brief Accumulates the workloads submitted in a frame into aggregate stats.
+ */
+class TimelineFrameSummary : public Tracker::SubmitCommandWorkloadVisitor
+{
+public:
+    /**
+     * @brief Construct a new empty frame summary.
+     */
+    TimelineFrameSummary() = default;
+
+    // Visitor should not be copied or moved from
+    TimelineFrameSummary(const TimelineFrameSummary&) = delete;
+    TimelineFrameSummary(TimelineFrameSummary&&) noexcept = delete;
+    TimelineFrameSummary& operator=(const TimelineFrameSummary&) = delete;
+    TimelineFrameSummary& operator=(TimelineFrameSummary&&) noexcept = delete;
+
+    // Methods from the visitor interface
+    void operator()(const Tracker::LCSRenderPass& renderPass, const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSRenderPassContinuation& continuation,
+                    const std::vector<std::string>& debugStack,
+                    uint64_t renderPassTagID) override;
+    void operator()(const Tracker::LCSDispatch& dispatch, const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSDispatchDataGraph& dispatch, const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSTraceRays& traceRays, const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSImageTransfer& imageTransfer,
+                    const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSBufferTransfer& bufferTransfer,
+                    const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSAccelerationStructureBuild& asBuild,
+                    const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSAccelerationStructureTransfer& asTransfer,
+                    const std::vector<std::string>& debugStack) override;
+
+    /**
+     * @brief Record that a queue submit was made in this frame.
+     */
+    void submit() { submitCount += 1; }
+
+    /**
+     * @brief Record that a CPU thread blocked waiting in this frame.
+     *
+     * @param duration   The duration of the wait, in nanoseconds.
+     */
+    void wait(uint64_t duration)
+    {
+        waitCount += 1;
+        waitTime += duration;
+    }
+
+    /**
+     * @brief Record that pipelines were created in this frame.
+     *
+     * @param count      The number of pipelines created.
+     * @param duration   The duration of the creation call, in nanoseconds.
+     */
+    void pipelineCreation(uint64_t count, uint64_t duration)
+    {
+        pipelineCount += count;
+        pipelineCreationTime += duration;
+    }
+
+    /**
+     * @brief Reset the accumulator ready for the next frame.
+     *
+     * @param timestamp   The timestamp of the start of the next frame.
+     */
+    void reset(uint64_t timestamp);
+
+    /**
+     * @brief Get the timestamp of the start of this frame.
+     */
+    uint64_t getStartTimestamp() const { return startTimestamp; }
+
+    /**
+     * @brief Get the number of queue submits in this frame.
+     */
+    uint64_t getSubmitCount() const { return submitCount; }
+
+    /**
+     * @brief Get the number of CPU-side blocking waits in this frame.
+     */
+    uint64_t getWaitCount() const { return waitCount; }
+
+    /**
+     * @brief Get the total duration of CPU-side blocking waits in this frame.
+     */
+    uint64_t getWaitTime() const { return waitTime; }
+
+    /**
+     * @brief Get the number of pipelines created in this frame.
+     */
+    uint64_t getPipelineCount() const { return pipelineCount; }
+
+    /**
+     * @brief Get the total duration of pipeline creation calls in this frame.
+     */
+    uint64_t getPipelineCreationTime() const { return pipelineCreationTime; }
+
+    /**
+     * @brief Get the number of draw calls in each render pass, in submit order.
+     */
+    const std::vector<uint64_t>& getRenderPassDrawCallCounts() const { return renderPassDrawCallCounts; }
+
+    /**
+     * @brief Get the number of attachment pixels loaded from memory.
+     */
+    uint64_t getAttachmentLoadPixels() const { return attachmentLoadPixels; }
+
+    /**
+     * @brief Get the number of attachment pixels stored to memory.
+     */
+    uint64_t getAttachmentStorePixels() const { return attachmentStorePixels; }
+
+    /**
+     * @brief Get the number of pixels written by image transfers.
+     */
+    uint64_t getImageTransferPixels() const { return imageTransferPixels; }
+
+    /**
+     * @brief Get the number of bytes written by buffer transfers.
+     */
+    uint64_t getBufferTransferBytes() const { return bufferTransferBytes; }
+
+    /**
+     * @brief Get the number of bytes written by acceleration structure transfers.
+     */
+    uint64_t getAccelerationStructureTransferBytes() const { return asTransferBytes; }
+
+    /**
+     * @brief Get the busiest label scopes in this frame.
+     *
+     * Scopes are ranked by workload count, and then by draw call count.
+     *
+     * @param count   The maximum number of scopes to return.
+     *
+     * @return The label and statistics for each of the selected scopes.
+     */
+    std::vector<std::pair<std::string, FrameSummaryLabelScope>> getTopLabelScopes(size_t count) const;
+
+private:
+    /**
+     * @brief Accumulate a workload into its label scope.
+     *
+     * @param debugStack      The debug label stack of the workload.
+     * @param drawCallCount   The number of draw calls in the workload.
+     */
+    void addLabelScope(const std::vector<std::string>& debugStack, uint64_t drawCallCount);
+
+    /**
+     * @brief The timestamp of the start of this frame.
+     */
+    uint64_t startTimestamp {0};
+
+    /**
+     * @brief The number of queue submits in this frame.
+     */
+    uint64_t submitCount {0};
+
+    /**
+     * @brief The number of CPU-side blocking waits in this frame.
+     */
+    uint64_t waitCount {0};
+
+    /**
+     * @brief The total duration of CPU-side blocking waits in this frame.
+     */
+    uint64_t waitTime {0};
+
+    /**
+     * @brief The number of pipelines created in this frame.
+     */
+    uint64_t pipelineCount {0};
+
+    /**
+     * @brief The total duration of pipeline creation calls in this frame.
+     */
+    uint64_t pipelineCreationTime {0};
+
+    /**
+     * @brief The number of draw calls in each render pass, in submit order.
+     */
+    std::vector<uint64_t> renderPassDrawCallCounts;
+
+    /**
+     * @brief The tagID of the last render pass, used to merge continuations.
+     */
+    uint64_t lastRenderPassTagID {0};
+
+    /**
+     * @brief The number of attachment pixels loaded from memory.
+     */
+    uint64_t attachmentLoadPixels {0};
+
+    /**
+     * @brief The number of attachment pixels stored or resolved to memory.
+     */
+    uint64_t attachmentStorePixels {0};
+
+    /**
+     * @brief The number of pixels written by image transfers of known size.
+     */
+    uint64_t imageTransferPixels {0};
+
+    /**
+     * @brief The number of bytes written by buffer transfers of known size.
+     */
+    uint64_t bufferTransferBytes {0};
+
+    /**
+     * @brief The number of bytes written by acceleration structure transfers of known size.
+     */
+    uint64_t asTransferBytes {0};
+
+    /**
+     * @brief The per-scope statistics, keyed by innermost debug label.
+     */
+    std::unordered_map<std::string, FrameSummaryLabelScope> labelScopes;
+};
@@ -0,0 +1,813 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines a writer that emits the timeline directly as a Perfetto trace.
+ *
+ * The message definitions here are the minimal subset of the Perfetto trace
+ * format, from perfetto/protos/perfetto/trace/, that is needed by the layer.
+ * Field numbers must match the upstream definitions.
+ */
+
+#include "timeline_perfetto.hpp"
+
+#include "framework/utils.hpp"
+#include "trackers/render_pass.hpp"
+#include "utils/misc.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <ctime>
+#include <utility>
+
+#include <protopuf/field.h>
+#include <protopuf/message.h>
+#include <protopuf/skip.h>
+
+/* TrackEvent event types */
+enum class TrackEventType
+{
+    /* A slice start */
+    slice_begin = 1,
+    /* A slice end */
+    slice_end = 2,
+    /* An instant event */
+    instant = 3,
+};
+
+/* TracePacket sequence flags */
+enum SequenceFlags : uint32_t
+{
+    /* The incremental state of the sequence was cleared by this packet */
+    SEQ_INCREMENTAL_STATE_CLEARED = 1,
+    /* This packet uses incremental state from earlier packets */
+    SEQ_NEEDS_INCREMENTAL_STATE = 2,
+};
+
+/* An interned event name */
+using EventName = pp::message<
+    pp::uint64_field<"iid", 1>,
+    pp::string_field<"name", 2>>;
+
+/* An interned debug annotation name */
+using DebugAnnotationName = pp::message<
+    pp::uint64_field<"iid", 1>,
+    pp::string_field<"name", 2>>;
+
+/* The interned data added to the sequence by a packet */
+using InternedData = pp::message<
+    pp::message_field<"event_names", 2, EventName, pp::repeated>,
+    pp::message_field<"debug_annotation_names", 3, DebugAnnotationName, pp::repeated>>;
+
+/* A single name-value annotation on an event */
+using DebugAnnotation = pp::message<
+    pp::uint64_field<"name_iid", 1>,
+    pp::uint64_field<"uint_value", 3>,
+    pp::int64_field<"int_value", 4>,
+    pp::string_field<"string_value", 6>>;
+
+/* A single event on a track */
+using TrackEvent = pp::message<
+    pp::message_field<"debug_annotations", 4, DebugAnnotation, pp::repeated>,
+    pp::enum_field<"type", 9, TrackEventType>,
+    pp::uint64_field<"name_iid", 10>,
+    pp::uint64_field<"track_uuid", 11>>;
+
+/* The description of a process */
+using ProcessDescriptor = pp::message<
+    pp::int32_field<"pid", 1>,
+    pp::string_field<"process_name", 6>>;
+
+/* The description of a thread */
+using ThreadDescriptor = pp::message<
+    pp::int32_field<"pid", 1>,
+    pp::int32_field<"tid", 2>,
+    pp::string_field<"thread_name", 5>>;
+
+/* The description of a track */
+using TrackDescriptor = pp::message<
+    pp::uint64_field<"uuid", 1>,
+    pp::string_field<"name", 2>,
+    pp::message_field<"process", 3, ProcessDescriptor>,
+    pp::message_field<"thread", 4, ThreadDescriptor>,
+    pp::uint64_field<"parent_uuid", 5>>;
+
+/* A single clock value in a snapshot */
+using Clock = pp::message<
+    pp::uint32_field<"clock_id", 1>,
+    pp::uint64_field<"timestamp", 2>>;
+
+/* A set of clock values sampled at the same time */
+using ClockSnapshot = pp::message<
+    pp::message_field<"clocks", 1, Clock, pp::repeated>,
+    pp::uint32_field<"primary_trace_clock", 2>>;
+
+/* A single trace packet */
+using TracePacket = pp::message<
+    pp::message_field<"clock_snapshot", 6, ClockSnapshot>,
+    pp::uint64_field<"timestamp", 8>,
+    pp::uint32_field<"trusted_packet_sequence_id", 10>,
+    pp::message_field<"track_event", 11, TrackEvent>,
+    pp::message_field<"interned_data", 12, InternedData>,
+    pp::uint32_field<"sequence_flags", 13>,
+    pp::uint32_field<"timestamp_clock_id", 58>,
+    pp::message_field<"track_descriptor", 60, TrackDescriptor>>;
+
+/* The trace file, which is a sequence of packets */
+using Trace = pp::message<
+    pp::message_field<"packet", 1, TracePacket, pp::repeated>>;
+
+namespace
+{
+/**
+ * @brief The packet sequence ID used for all packets written by the layer.
+ */
+constexpr uint32_t SEQUENCE_ID {0x4C474C};
+
+/**
+ * @brief The clock ID used for CLOCK_BOOTTIME timestamps.
+ */
+constexpr uint32_t CLOCK_BOOTTIME_ID {6};
+
+/**
+ * @brief Encode a single packet as a Trace message.
+ *
+ * Trace messages can be concatenated, so each packet can be appended to the
+ * file as soon as it is encoded.
+ *
+ * @param packet   The packet to encode.
+ *
+ * @return The encoded byte sequence.
+ */
+std::vector<uint8_t> encodePacket(TracePacket&& packet)
+{
+    using namespace pp;
+
+    Trace trace {};
+    trace["packet"_f].push_back(std::move(packet));
+
+    std::vector<uint8_t> buffer {};
+    buffer.resize(skipper<message_coder<Trace>>::encode_skip(trace));
+
+    const auto bufferBytes = bytes(reinterpret_cast<std::byte*>(buffer.data()), buffer.size());
+    const auto encodeResult = message_coder<Trace>::encode(trace, bufferBytes);
+    assert(encodeResult.has_value());
+
+    const auto& bufferEnd = *encodeResult;
+    const auto usedLength = begin_diff(bufferEnd, bufferBytes);
+    buffer.resize(usedLength);
+
+    return buffer;
+}
+
+/**
+ * @brief Get the value of a clock in nanoseconds.
+ *
+ * @param clock   The clock to sample.
+ *
+ * @return The clock value, or zero on error.
+ */
+uint64_t getClockValue(clockid_t clock)
+{
+    struct timespec ts;
+    if (clock_gettime(clock, &ts))
+    {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+/**
+ * @brief Format a debug label stack as a single string.
+ *
+ * @param debugStack   The debug label stack.
+ *
+ * @return The labels, outermost first, separated by "|".
+ */
+std::string joinDebugStack(const std::vector<std::string>& debugStack)
+{
+    std::string result;
+    for (const auto& label : debugStack)
+    {
+        if (!result.empty())
+        {
+            result += "|";
+        }
+
+        result += label;
+    }
+
+    return result;
+}
+
+}
+
+/* See header for documentation. */
+TimelinePerfettoWriter::TimelinePerfettoWriter(const std::string& path,
+                                               uint32_t _processID,
+                                               const std::string& processName)
+    : file(path, std::ios::binary | std::ios::trunc),
+      processID(_processID),
+      nextUUID((static_cast<uint64_t>(processID) << 32) | 1)
+{
+    using namespace pp;
+
+    if (!file)
+    {
+        LAYER_ERR("Failed to open Perfetto trace: %s", path.c_str());
+        return;
+    }
+
+    LAYER_LOG("Writing Perfetto trace: %s", path.c_str());
+
+    // Map the layer timestamps to the default trace clock
+    ClockSnapshot snapshot {};
+    snapshot["clocks"_f].emplace_back(CLOCK_MONOTONIC_RAW_ID, getClockValue(CLOCK_MONOTONIC_RAW));
+    snapshot["clocks"_f].emplace_back(CLOCK_BOOTTIME_ID, getClockValue(CLOCK_BOOTTIME));
+
+    TracePacket packet {};
+    packet["trusted_packet_sequence_id"_f] = SEQUENCE_ID;
+    packet["clock_snapshot"_f] = std::move(snapshot);
+    writePacket(encodePacket(std::move(packet)));
+
+    // Add the process track that all other tracks are children of
+    processUUID = allocateUUID();
+
+    TrackDescriptor track {};
+    track["uuid"_f] = processUUID;
+    track["process"_f] = ProcessDescriptor {static_cast<int32_t>(processID), processName};
+
+    TracePacket trackPacket {};
+    trackPacket["trusted_packet_sequence_id"_f] = SEQUENCE_ID;
+    trackPacket["track_descriptor"_f] = std::move(track);
+    writePacket(encodePacket(std::move(trackPacket)));
+}
+
+/* See header for documentation. */
+TimelinePerfettoWriter::~TimelinePerfettoWriter()
+{
+    for (auto& [device, state] : devices)
+    {
+        UNUSED(device);
+        for (const auto& [tagID, workload] : state.pending)
+        {
+            UNUSED(tagID);
+            emitInstantWorkload(state, workload);
+        }
+    }
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::addDevice(VkDevice device, const std::string& name, bool gpuTimestamps)
+{
+    DeviceState state {};
+    state.uuid = allocateUUID();
+    state.clockID = nextClockID++;
+    state.gpuTimestamps = gpuTimestamps;
+    state.frameNumber = 0;
+
+    emitTrackDescriptor(state.uuid, processUUID, name);
+    devices[device] = std::move(state);
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::removeDevice(VkDevice device)
+{
+    auto it = devices.find(device);
+    if (it == devices.end())
+    {
+        return;
+    }
+
+    auto& state = it->second;
+    for (const auto& [tagID, workload] : state.pending)
+    {
+        UNUSED(tagID);
+        emitInstantWorkload(state, workload);
+    }
+
+    devices.erase(it);
+    file.flush();
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitClockSnapshot(VkDevice device, uint64_t gpuTimestamp, uint64_t cpuTimestamp)
+{
+    using namespace pp;
+
+    auto& state = devices.at(device);
+
+    ClockSnapshot snapshot {};
+    snapshot["clocks"_f].emplace_back(state.clockID, gpuTimestamp);
+    snapshot["clocks"_f].emplace_back(CLOCK_MONOTONIC_RAW_ID, cpuTimestamp);
+
+    TracePacket packet {};
+    packet["trusted_packet_sequence_id"_f] = SEQUENCE_ID;
+    packet["clock_snapshot"_f] = std::move(snapshot);
+    writePacket(encodePacket(std::move(packet)));
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitFrame(VkDevice device, uint64_t frameNumber, uint64_t timestamp)
+{
+    auto& state = devices.at(device);
+    state.frameNumber = frameNumber;
+
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::instant),
+                   CLOCK_MONOTONIC_RAW_ID,
+                   timestamp,
+                   state.uuid,
+                   "Frame",
+                   {{"frame", frameNumber}});
+
+    // Workloads that never receive a timing are emitted at submit time
+    for (auto it = state.pending.begin(); it != state.pending.end();)
+    {
+        if (it->second.frameNumber + PENDING_FRAME_LIMIT < frameNumber)
+        {
+            emitInstantWorkload(state, it->second);
+            it = state.pending.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    file.flush();
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitSubmit(VkDevice device, VkQueue queue, uint64_t timestamp)
+{
+    submitDevice = device;
+    submitQueue = queue;
+    submitTimestamp = timestamp;
+
+    auto& state = devices.at(device);
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::instant),
+                   CLOCK_MONOTONIC_RAW_ID,
+                   timestamp,
+                   getQueueTrack(state, queue),
+                   "Submit",
+                   {});
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitWorkloadTiming(VkDevice device, const TimestampResult& result)
+{
+    auto& state = devices.at(device);
+
+    auto it = state.pending.find(result.tagID);
+    if (it == state.pending.end())
+    {
+        return;
+    }
+
+    const auto& workload = it->second;
+    uint64_t track = getLaneTrack(state, result.queue, result.startTimestamp, result.endTimestamp);
+
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::slice_begin),
+                   state.clockID,
+                   result.startTimestamp,
+                   track,
+                   workload.name,
+                   workload.annotations);
+
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::slice_end),
+                   state.clockID,
+                   result.endTimestamp,
+                   track,
+                   "",
+                   {});
+
+    state.pending.erase(it);
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitWait(const WaitRecord& wait)
+{
+    uint64_t track = getThreadTrack(wait.threadID);
+
+    std::vector<Annotation> annotations {
+        {"result", static_cast<int64_t>(wait.result)},
+    };
+
+    if (wait.queue != VK_NULL_HANDLE)
+    {
+        annotations.push_back({"queue", formatString("%p", static_cast<void*>(wait.queue))});
+    }
+
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::slice_begin),
+                   CLOCK_MONOTONIC_RAW_ID,
+                   wait.startTimestamp,
+                   track,
+                   getWaitTypeName(wait.type),
+                   annotations);
+
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::slice_end),
+                   CLOCK_MONOTONIC_RAW_ID,
+                   wait.endTimestamp,
+                   track,
+                   "",
+                   {});
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitPipelineCreation(const PipelineCreationRecord& record)
+{
+    uint64_t track = getThreadTrack(record.threadID);
+
+    std::vector<Annotation> annotations {
+        {"pipeline_count", static_cast<uint64_t>(record.pipelineCount)},
+        {"library_count", static_cast<uint64_t>(record.libraryCount)},
+        {"link_count", static_cast<uint64_t>(record.linkCount)},
+        {"feedback_count", static_cast<uint64_t>(record.feedbackCount)},
+        {"cache_hit_count", static_cast<uint64_t>(record.cacheHitCount)},
+        {"result", static_cast<int64_t>(record.result)},
+    };
+
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::slice_begin),
+                   CLOCK_MONOTONIC_RAW_ID,
+                   record.startTimestamp,
+                   track,
+                   getPipelineCreationName(record.type),
+                   annotations);
+
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::slice_end),
+                   CLOCK_MONOTONIC_RAW_ID,
+                   record.endTimestamp,
+                   track,
+                   "",
+                   {});
+}
+
+/* See header for documentation. */
+uint64_t TimelinePerfettoWriter::getThreadTrack(uint32_t threadID)
+{
+    using namespace pp;
+
+    auto it = threadTracks.find(threadID);
+    if (it != threadTracks.end())
+    {
+        return it->second;
+    }
+
+    // Thread tracks are children of the process, so have no parent UUID
+    uint64_t uuid = allocateUUID();
+
+    TrackDescriptor track {};
+    track["uuid"_f] = uuid;
+    track["thread"_f] = ThreadDescriptor {static_cast<int32_t>(processID),
+                                          static_cast<int32_t>(threadID),
+                                          formatString("Thread %u", threadID)};
+
+    TracePacket packet {};
+    packet["trusted_packet_sequence_id"_f] = SEQUENCE_ID;
+    packet["track_descriptor"_f] = std::move(track);
+    writePacket(encodePacket(std::move(packet)));
+
+    threadTracks[threadID] = uuid;
+    return uuid;
+}
+
+/* See header for documentation. */
+uint64_t TimelinePerfettoWriter::getQueueTrack(DeviceState& state, VkQueue queue)
+{
+    auto it = state.queueTracks.find(queue);
+    if (it != state.queueTracks.end())
+    {
+        return it->second;
+    }
+
+    uint64_t uuid = allocateUUID();
+    std::string name = formatString("Queue %p", static_cast<void*>(queue));
+    emitTrackDescriptor(uuid, state.uuid, name);
+    state.queueTracks[queue] = uuid;
+    return uuid;
+}
+
+/* See header for documentation. */
+uint64_t TimelinePerfettoWriter::getLaneTrack(DeviceState& state,
+                                              VkQueue queue,
+                                              uint64_t startTimestamp,
+                                              uint64_t endTimestamp)
+{
+    // Slices on a track must nest, but GPU workloads on a queue can overlap,
+    // so use the first lane that is idle when this workload starts
+    auto& lanes = state.queueLanes[queue];
+    for (auto& lane : lanes)
+    {
+        if (lane.lastEndTimestamp <= startTimestamp)
+        {
+            lane.lastEndTimestamp = endTimestamp;
+            return lane.uuid;
+        }
+    }
+
+    uint64_t queueUUID = getQueueTrack(state, queue);
+    uint64_t uuid = allocateUUID();
+    std::string name = formatString("Queue %p (%zu)", static_cast<void*>(queue), lanes.size());
+    emitTrackDescriptor(uuid, queueUUID, name);
+
+    lanes.push_back({uuid, endTimestamp});
+    return uuid;
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::addWorkload(uint64_t tagID,
+                                         std::string name,
+                                         const std::vector<std::string>& debugStack,
+                                         std::vector<Annotation>&& annotations)
+{
+    auto& state = devices.at(submitDevice);
+
+    annotations.insert(annotations.begin(), Annotation {"tag_id", tagID});
+    if (!debugStack.empty())
+    {
+        annotations.push_back({"label", joinDebugStack(debugStack)});
+    }
+
+    PendingWorkload workload {
+        submitQueue,
+        submitTimestamp,
+        state.frameNumber,
+        std::move(name),
+        std::move(annotations),
+    };
+
+    // Workloads that will never be timed are emitted immediately
+    if (!state.gpuTimestamps)
+    {
+        emitInstantWorkload(state, workload);
+        return;
+    }
+
+    state.pending[tagID] = std::move(workload);
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitInstantWorkload(DeviceState& state, const PendingWorkload& workload)
+{
+    emitTrackEvent(static_cast<uint32_t>(TrackEventType::instant),
+                   CLOCK_MONOTONIC_RAW_ID,
+                   workload.submitTimestamp,
+                   getQueueTrack(state, workload.queue),
+                   workload.name,
+                   workload.annotations);
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitTrackDescriptor(uint64_t uuid, uint64_t parentUUID, const std::string& name)
+{
+    using namespace pp;
+
+    TrackDescriptor track {};
+    track["uuid"_f] = uuid;
+    track["name"_f] = name;
+    track["parent_uuid"_f] = parentUUID;
+
+    TracePacket packet {};
+    packet["trusted_packet_sequence_id"_f] = SEQUENCE_ID;
+    packet["track_descriptor"_f] = std::move(track);
+    writePacket(encodePacket(std::move(packet)));
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::emitTrackEvent(uint32_t type,
+                                            uint32_t clockID,
+                                            uint64_t timestamp,
+                                            uint64_t trackUUID,
+                                            const std::string& name,
+                                            const std::vector<Annotation>& annotations)
+{
+    using namespace pp;
+
+    InternedData interned {};
+    bool hasInterned {false};
+
+    // Intern a string, adding it to this packet if it is new to the sequence
+    auto intern = [&](auto& table, auto& field, const std::string& value) {
+        auto it = table.find(value);
+        if (it != table.end())
+        {
+            return it->second;
+        }
+
+        uint64_t iid = table.size() + 1;
+        table[value] = iid;
+        field.emplace_back(iid, value);
+        hasInterned = true;
+        return iid;
+    };
+
+    TrackEvent event {};
+    event["type"_f] = static_cast<TrackEventType>(type);
+    event["track_uuid"_f] = trackUUID;
+
+    if (!name.empty())
+    {
+        event["name_iid"_f] = intern(eventNames, interned["event_names"_f], name);
+    }
+
+    for (const auto& annotation : annotations)
+    {
+        DebugAnnotation value {};
+        value["name_iid"_f] = intern(annotationNames, interned["debug_annotation_names"_f], annotation.name);
+
+        if (const auto* uintValue = std::get_if<uint64_t>(&annotation.value))
+        {
+            value["uint_value"_f] = *uintValue;
+        }
+        else if (const auto* intValue = std::get_if<int64_t>(&annotation.value))
+        {
+            value["int_value"_f] = *intValue;
+        }
+        else
+        {
+            value["string_value"_f] = std::get<std::string>(annotation.value);
+        }
+
+        event["debug_annotations"_f].push_back(std::move(value));
+    }
+
+    TracePacket packet {};
+    packet["timestamp"_f] = timestamp;
+    packet["timestamp_clock_id"_f] = clockID;
+    packet["trusted_packet_sequence_id"_f] = SEQUENCE_ID;
+    packet["track_event"_f] = std::move(event);
+
+    // The first event packet on the sequence starts the incremental state
+    uint32_t flags = SEQ_NEEDS_INCREMENTAL_STATE;
+    if (firstPacket)
+    {
+        flags |= SEQ_INCREMENTAL_STATE_CLEARED;
+        firstPacket = false;
+    }
+
+    packet["sequence_flags"_f] = flags;
+
+    if (hasInterned)
+    {
+        packet["interned_data"_f] = std::move(interned);
+    }
+
+    writePacket(encodePacket(std::move(packet)));
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::writePacket(const std::vector<uint8_t>& data)
+{
+    if (!file)
+    {
+        return;
+    }
+
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSRenderPass& renderPass,
+                                        const std::vector<std::string>& debugStack)
+{
+    addWorkload(renderPass.getTagID(),
+                "Render pass",
+                debugStack,
+                {
+                    {"width", static_cast<uint64_t>(renderPass.getWidth())},
+                    {"height", static_cast<uint64_t>(renderPass.getHeight())},
+                    {"draw_calls", renderPass.getDrawCallCount()},
+                    {"subpasses", static_cast<uint64_t>(renderPass.getSubpassCount())},
+                });
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSRenderPassContinuation& continuation,
+                                        const std::vector<std::string>& debugStack,
+                                        uint64_t renderPassTagID)
+{
+    UNUSED(debugStack);
+
+    // Merge the draw calls into the parent render pass if not yet emitted
+    auto& state = devices.at(submitDevice);
+    auto it = state.pending.find(renderPassTagID);
+    if (it == state.pending.end())
+    {
+        return;
+    }
+
+    for (auto& annotation : it->second.annotations)
+    {
+        if (annotation.name == "draw_calls")
+        {
+            annotation.value = std::get<uint64_t>(annotation.value) + continuation.getDrawCallCount();
+        }
+    }
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSDispatch& dispatch,
+                                        const std::vector<std::string>& debugStack)
+{
+    addWorkload(dispatch.getTagID(),
+                "Dispatch",
+                debugStack,
+                {
+                    {"x_groups", dispatch.getXGroups()},
+                    {"y_groups", dispatch.getYGroups()},
+                    {"z_groups", dispatch.getZGroups()},
+                });
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSDispatchDataGraph& dispatch,
+                                        const std::vector<std::string>& debugStack)
+{
+    addWorkload(dispatch.getTagID(), "Dispatch data graph", debugStack, {});
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSTraceRays& traceRays,
+                                        const std::vector<std::string>& debugStack)
+{
+    addWorkload(traceRays.getTagID(),
+                "Trace rays",
+                debugStack,
+                {
+                    {"x_items", traceRays.getXItems()},
+                    {"y_items", traceRays.getYItems()},
+                    {"z_items", traceRays.getZItems()},
+                });
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSImageTransfer& imageTransfer,
+                                        const std::vector<std::string>& debugStack)
+{
+    addWorkload(imageTransfer.getTagID(),
+                imageTransfer.getTransferTypeStr(),
+                debugStack,
+                {
+                    {"pixel_count", imageTransfer.getPixelCount()},
+                });
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSBufferTransfer& bufferTransfer,
+                                        const std::vector<std::string>& debugStack)
+{
+    addWorkload(bufferTransfer.getTagID(),
+                bufferTransfer.getTransferTypeStr(),
+                debugStack,
+                {
+                    {"byte_count", bufferTransfer.getByteCount()},
+                });
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSAccelerationStructureBuild& asBuild,
+                                        const std::vector<std::string>& debugStack)
+{
+    addWorkload(asBuild.getTagID(),
+                asBuild.getBuildTypeStr(),
+                debugStack,
+                {
+                    {"primitive_count", asBuild.getPrimitiveCount()},
+                });
+}
+
+/* See header for documentation. */
+void TimelinePerfettoWriter::operator()(const Tracker::LCSAccelerationStructureTransfer& asTransfer,
+                                        const std::vector<std::string>& debugStack)
+{
+    addWorkload(asTransfer.getTagID(),
+                asTransfer.getTransferTypeStr(),
+                debugStack,
+                {
+                    {"byte_count", asTransfer.getByteCount()},
+                });
+}
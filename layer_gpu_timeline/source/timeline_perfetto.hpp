@@ -0,0 +1,461 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares a writer that emits the timeline directly as a Perfetto trace.
+ *
+ * Role summary
+ * ============
+ *
+ * In Perfetto output mode the layer writes a Perfetto trace file itself,
+ * rather than sending metadata to the host to be merged with a separate
+ * Perfetto capture. Each submitted command stream is replayed into this
+ * visitor, which converts the workloads into TrackEvent packets.
+ *
+ * Workloads are placed on one track per queue. If GPU timestamps are enabled
+ * and the device supports calibrated timestamps, workloads are emitted as
+ * slices using their measured GPU start and end times, with the GPU clock
+ * mapped to CLOCK_MONOTONIC_RAW using periodic clock snapshots. Otherwise,
+ * workloads are emitted as instant events at their CPU submit time.
+ *
+ * CPU-side blocking waits and pipeline creation calls are emitted as slices on
+ * one track per thread, using the CLOCK_MONOTONIC_RAW time base.
+ *
+ * Workload metadata, including the tag ID, is attached to each event as debug
+ * annotations, so no host-side post-processing is needed to join the data.
+ *
+ * Key properties
+ * ==============
+ *
+ * All events are written on a single packet sequence. Event names and debug
+ * annotation names are interned using sequence-scoped incremental state, so
+ * each name string is written to the file only once.
+ *
+ * This class is not thread-safe, and must be used with the layer-wide lock
+ * held. A single writer is shared by all devices in the process.
+ */
+
+#pragma once
+
+#include "framework/timestamp_queries.hpp"
+#include "timeline_pipelines.hpp"
+#include "timeline_waits.hpp"
+#include "trackers/layer_command_stream.hpp"
+#include "trackers/queue.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief Writes the layer timeline as a native Perfetto trace file.
+ */
+class TimelinePerfettoWriter : public Tracker::SubmitCommandWorkloadVisitor
+{
+public:
+    /**
+     * @brief Construct a new writer, and open the trace file.
+     *
+     * @param path          The path of the trace file to write.
+     * @param processID     The process ID of this process.
+     * @param processName   The name of this process.
+     */
+    TimelinePerfettoWriter(const std::string& path, uint32_t processID, const std::string& processName);
+
+    /**
+     * @brief Destroy the writer, flushing any pending workloads to the file.
+     */
+    ~TimelinePerfettoWriter() override;
+
+    // Visitor should not be copied or moved from
+    TimelinePerfettoWriter(const TimelinePerfettoWriter&) = delete;
+    TimelinePerfettoWriter(TimelinePerfettoWriter&&) noexcept = delete;
+    TimelinePerfettoWriter& operator=(const TimelinePerfettoWriter&) = delete;
+    TimelinePerfettoWriter& operator=(TimelinePerfettoWriter&&) noexcept = delete;
+
+    /**
+     * @brief Test if the trace file was opened successfully.
+     */
+    bool isOpen() const { return file.is_open(); }
+
+    /**
+     * @brief Add a new device track to the trace.
+     *
+     * @param device          The device handle.
+     * @param name            The device name.
+     * @param gpuTimestamps   Will GPU timings be provided for this device?
+     */
+    void addDevice(VkDevice device, const std::string& name, bool gpuTimestamps);
+
+    /**
+     * @brief Remove a device, flushing any pending workloads to the file.
+     *
+     * @param device   The device handle.
+     */
+    void removeDevice(VkDevice device);
+
+    /**
+     * @brief Emit a snapshot mapping a device GPU clock to the CPU clock.
+     *
+     * @param device         The device handle.
+     * @param gpuTimestamp   The GPU timestamp, in nanoseconds.
+     * @param cpuTimestamp   The matching CLOCK_MONOTONIC_RAW timestamp.
+     */
+    void emitClockSnapshot(VkDevice device, uint64_t gpuTimestamp, uint64_t cpuTimestamp);
+
+    /**
+     * @brief Emit a frame boundary for a device.
+     *
+     * @param device        The device handle.
+     * @param frameNumber   The number of the frame that is starting.
+     * @param timestamp     The CLOCK_MONOTONIC_RAW timestamp of the boundary.
+     */
+    void emitFrame(VkDevice device, uint64_t frameNumber, uint64_t timestamp);
+
+    /**
+     * @brief Emit a queue submit, and set the context for replayed workloads.
+     *
+     * @param device      The device handle.
+     * @param queue       The queue being submitted to.
+     * @param timestamp   The CLOCK_MONOTONIC_RAW timestamp of the submit.
+     */
+    void emitSubmit(VkDevice device, VkQueue queue, uint64_t timestamp);
+
+    /**
+     * @brief Emit the GPU timing for a previously submitted workload.
+     *
+     * @param device   The device handle.
+     * @param result   The timing result.
+     */
+    void emitWorkloadTiming(VkDevice device, const TimestampResult& result);
+
+    /**
+     * @brief Emit a CPU-side blocking wait.
+     *
+     * @param wait   The wait record.
+     */
+    void emitWait(const WaitRecord& wait);
+
+    /**
+     * @brief Emit a pipeline creation call.
+     *
+     * @param record   The pipeline creation record.
+     */
+    void emitPipelineCreation(const PipelineCreationRecord& record);
+
+    // Methods from the visitor interface
+    void operator()(const Tracker::LCSRenderPass& renderPass, const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSRenderPassContinuation& continuation,
+                    const std::vector<std::string>& debugStack,
+                    uint64_t renderPassTagID) override;
+    void operator()(const Tracker::LCSDispatch& dispatch, const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSDispatchDataGraph& dispatch, const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSTraceRays& traceRays, const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSImageTransfer& imageTransfer,
+                    const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSBufferTransfer& bufferTransfer,
+                    const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSAccelerationStructureBuild& asBuild,
+                    const std::vector<std::string>& debugStack) override;
+    void operator()(const Tracker::LCSAccelerationStructureTransfer& asTransfer,
+                    const std::vector<std::string>& debugStack) override;
+
+    /**
+     * @brief A single debug annotation attached to an event.
+     */
+    struct Annotation
+    {
+        /**
+         * @brief The annotation name.
+         */
+        std::string name;
+
+        /**
+         * @brief The annotation value.
+         */
+        std::variant<uint64_t, int64_t, std::string> value;
+    };
+
+    /**
+     * @brief The clock ID used for CLOCK_MONOTONIC_RAW timestamps.
+     */
+    static const uint32_t CLOCK_MONOTONIC_RAW_ID {5};
+
+private:
+    /**
+     * @brief The number of frames a workload can wait for its GPU timing.
+     */
+    static const uint64_t PENDING_FRAME_LIMIT {8};
+
+    /**
+     * @brief A workload waiting for its GPU timing.
+     */
+    struct PendingWorkload
+    {
+        /**
+         * @brief The queue the workload was submitted to.
+         */
+        VkQueue queue;
+
+        /**
+         * @brief The CLOCK_MONOTONIC_RAW timestamp of the submit.
+         */
+        uint64_t submitTimestamp;
+
+        /**
+         * @brief The frame the workload was submitted in.
+         */
+        uint64_t frameNumber;
+
+        /**
+         * @brief The event name.
+         */
+        std::string name;
+
+        /**
+         * @brief The event annotations.
+         */
+        std::vector<Annotation> annotations;
+    };
+
+    /**
+     * @brief A track for non-overlapping slices on a queue.
+     */
+    struct Lane
+    {
+        /**
+         * @brief The track UUID.
+         */
+        uint64_t uuid;
+
+        /**
+         * @brief The end timestamp of the last slice on the track.
+         */
+        uint64_t lastEndTimestamp;
+    };
+
+    /**
+     * @brief The trace state for a single device.
+     */
+    struct DeviceState
+    {
+        /**
+         * @brief The device track UUID.
+         */
+        uint64_t uuid;
+
+        /**
+         * @brief The sequence-scoped clock ID of the GPU clock.
+         */
+        uint32_t clockID;
+
+        /**
+         * @brief Will GPU timings be provided for this device?
+         */
+        bool gpuTimestamps;
+
+        /**
+         * @brief The number of the current frame.
+         */
+        uint64_t frameNumber;
+
+        /**
+         * @brief The queue track UUID for each queue.
+         */
+        std::unordered_map<VkQueue, uint64_t> queueTracks;
+
+        /**
+         * @brief The slice lanes for each queue.
+         */
+        std::unordered_map<VkQueue, std::vector<Lane>> queueLanes;
+
+        /**
+         * @brief The workloads waiting for GPU timings, indexed by tag ID.
+         */
+        std::unordered_map<uint64_t, PendingWorkload> pending;
+    };
+
+    /**
+     * @brief Get the track UUID for a queue, creating it if needed.
+     *
+     * @param state   The device state.
+     * @param queue   The queue handle.
+     *
+     * @return The track UUID.
+     */
+    uint64_t getQueueTrack(DeviceState& state, VkQueue queue);
+
+    /**
+     * @brief Get the track UUID for a thread, creating it if needed.
+     *
+     * @param threadID   The thread ID.
+     *
+     * @return The track UUID.
+     */
+    uint64_t getThreadTrack(uint32_t threadID);
+
+    /**
+     * @brief Get a lane track for a slice, creating it if needed.
+     *
+     * @param state            The device state.
+     * @param queue            The queue handle.
+     * @param startTimestamp   The slice start timestamp.
+     * @param endTimestamp     The slice end timestamp.
+     *
+     * @return The track UUID.
+     */
+    uint64_t getLaneTrack(DeviceState& state, VkQueue queue, uint64_t startTimestamp, uint64_t endTimestamp);
+
+    /**
+     * @brief Add a workload from the current submit.
+     *
+     * @param tagID         The unique tag ID of the workload.
+     * @param name          The event name.
+     * @param debugStack    The debug label stack of the workload.
+     * @param annotations   The event annotations.
+     */
+    void addWorkload(uint64_t tagID,
+                     std::string name,
+                     const std::vector<std::string>& debugStack,
+                     std::vector<Annotation>&& annotations);
+
+    /**
+     * @brief Emit a pending workload as an instant event at its submit time.
+     *
+     * @param state      The device state.
+     * @param workload   The workload.
+     */
+    void emitInstantWorkload(DeviceState& state, const PendingWorkload& workload);
+
+    /**
+     * @brief Emit a track descriptor packet.
+     *
+     * @param uuid         The track UUID.
+     * @param parentUUID   The parent track UUID, or zero for a process track.
+     * @param name         The track name.
+     */
+    void emitTrackDescriptor(uint64_t uuid, uint64_t parentUUID, const std::string& name);
+
+    /**
+     * @brief Emit a track event packet.
+     *
+     * @param type          The track event type.
+     * @param clockID       The clock ID of the timestamp.
+     * @param timestamp     The event timestamp.
+     * @param trackUUID     The track UUID.
+     * @param name          The event name, or empty for slice end events.
+     * @param annotations   The event annotations.
+     */
+    void emitTrackEvent(uint32_t type,
+                        uint32_t clockID,
+                        uint64_t timestamp,
+                        uint64_t trackUUID,
+                        const std::string& name,
+                        const std::vector<Annotation>& annotations);
+
+    /**
+     * @brief Write an encoded packet to the file.
+     *
+     * @param data   The encoded Trace message containing the packet.
+     */
+    void writePacket(const std::vector<uint8_t>& data);
+
+    /**
+     * @brief Allocate a new unique track UUID.
+     */
+    uint64_t allocateUUID() { return nextUUID++; }
+
+private:
+    /**
+     * @brief The trace file.
+     */
+    std::ofstream file;
+
+    /**
+     * @brief The process ID of this process.
+     */
+    uint32_t processID;
+
+    /**
+     * @brief The process track UUID.
+     */
+    uint64_t processUUID {0};
+
+    /**
+     * @brief The next track UUID to allocate.
+     */
+    uint64_t nextUUID;
+
+    /**
+     * @brief The next GPU clock ID to allocate.
+     */
+    uint32_t nextClockID {64};
+
+    /**
+     * @brief Is the next packet the first packet on the sequence?
+     */
+    bool firstPacket {true};
+
+    /**
+     * @brief The interned event name IDs.
+     */
+    std::unordered_map<std::string, uint64_t> eventNames;
+
+    /**
+     * @brief The interned debug annotation name IDs.
+     */
+    std::unordered_map<std::string, uint64_t> annotationNames;
+
+    /**
+     * @brief The trace state for each device.
+     */
+    std::unordered_map<VkDevice, DeviceState> devices;
+
+    /**
+     * @brief The track UUID for each thread that has waited.
+     */
+    std::unordered_map<uint32_t, uint64_t> threadTracks;
+
+    /**
+     * @brief The device of the current submit.
+     */
+    VkDevice submitDevice {VK_NULL_HANDLE};
+
+    /**
+     * @brief The queue of the current submit.
+     */
+    VkQueue submitQueue {VK_NULL_HANDLE};
+
+    /**
+     * @brief The CLOCK_MONOTONIC_RAW timestamp of the current submit.
+     */
+    uint64_t submitTimestamp {0};
+};
@@ -0,0 +1,144 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the record used to describe a pipeline creation call.
+ *
+ * Role summary
+ * ============
+ *
+ * Runtime pipeline creation is a common cause of frame hitches, because
+ * shader compilation happens on the calling thread. The layer intercepts the
+ * pipeline creation calls and times them using the same CLOCK_MONOTONIC_RAW
+ * time base as queue submits. Each call generates a single record, which the
+ * host can use to attribute hitching frames to specific pipeline compiles.
+ *
+ * If VK_EXT_pipeline_creation_feedback is available the layer also requests
+ * per-pipeline creation feedback, which reports whether each pipeline was a
+ * pipeline cache hit and how long the driver spent creating it.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief The type of pipeline created by a pipeline creation call.
+ */
+enum class PipelineType
+{
+    GRAPHICS,
+    COMPUTE,
+    RAY_TRACING
+};
+
+/**
+ * @brief A single timed pipeline creation call.
+ */
+struct PipelineCreationRecord
+{
+    /**
+     * @brief The type of pipeline created.
+     */
+    PipelineType type;
+
+    /**
+     * @brief The ID of the thread that created the pipelines.
+     */
+    uint32_t threadID;
+
+    /**
+     * @brief The CLOCK_MONOTONIC_RAW timestamp at the start of the call.
+     */
+    uint64_t startTimestamp;
+
+    /**
+     * @brief The CLOCK_MONOTONIC_RAW timestamp at the end of the call.
+     */
+    uint64_t endTimestamp;
+
+    /**
+     * @brief The number of pipelines created by the call.
+     */
+    uint32_t pipelineCount;
+
+    /**
+     * @brief The number of pipelines created as pipeline libraries.
+     */
+    uint32_t libraryCount;
+
+    /**
+     * @brief The number of pipelines linked from pipeline libraries.
+     */
+    uint32_t linkCount;
+
+    /**
+     * @brief The number of pipelines with valid creation feedback.
+     */
+    uint32_t feedbackCount;
+
+    /**
+     * @brief The number of pipelines that were pipeline cache hits.
+     */
+    uint32_t cacheHitCount;
+
+    /**
+     * @brief The driver-reported creation time of each pipeline, in nanoseconds.
+     *
+     * Pipelines without valid creation feedback report zero.
+     */
+    std::vector<uint64_t> pipelineDurations;
+
+    /**
+     * @brief The result returned by the API call.
+     */
+    VkResult result;
+};
+
+/**
+ * @brief Get the API function name for a pipeline type.
+ *
+ * @param type   The pipeline type.
+ *
+ * @return The function name.
+ */
+inline const char* getPipelineCreationName(PipelineType type)
+{
+    switch (type)
+    {
+    case PipelineType::GRAPHICS:
+        return "vkCreateGraphicsPipelines";
+    case PipelineType::COMPUTE:
+        return "vkCreateComputePipelines";
+    case PipelineType::RAY_TRACING:
+        return "vkCreateRayTracingPipelinesKHR";
+    }
+
+    return "Unknown pipeline creation";
+}
@@ -251,6 +251,137 @@ using AccelerationStructureTransfer = pp::message<
     /* Any user defined debug labels associated with the transfer */
     pp::string_field<"debug_label", 4, pp::repeated>>;
 
+/* The aggregate statistics for a single debug label scope in a frame */
+using LabelScopeSummary = pp::message<
+    /* The innermost debug label of the scope */
+    pp::string_field<"label", 1>,
+    /* The number of workloads submitted in the scope */
+    pp::uint64_field<"workload_count", 2>,
+    /* The number of draw calls submitted in the scope */
+    pp::uint64_field<"draw_call_count", 3>>;
+
+/* A frame summary message, sent instead of the per-workload messages */
+using FrameSummary = pp::message<
+    /* The unique counter / identifier for the frame being summarized */
+    pp::uint64_field<"id", 1>,
+    /* The VkDevice that the frame belongs to */
+    pp::uint64_field<"device", 2>,
+    /* The timestamp (in NS, CLOCK_MONOTONIC_RAW) of the start of the frame */
+    pp::uint64_field<"start_timestamp", 3>,
+    /* The timestamp (in NS, CLOCK_MONOTONIC_RAW) of the end of the frame */
+    pp::uint64_field<"end_timestamp", 4>,
+    /* The number of queue submits in the frame */
+    pp::uint64_field<"submit_count", 5>,
+    /* The number of workloads of each type in the frame */
+    pp::uint64_field<"renderpass_count", 6>,
+    pp::uint64_field<"draw_call_count", 7>,
+    pp::uint64_field<"dispatch_count", 8>,
+    pp::uint64_field<"dispatch_data_graph_count", 9>,
+    pp::uint64_field<"trace_rays_count", 10>,
+    pp::uint64_field<"image_transfer_count", 11>,
+    pp::uint64_field<"buffer_transfer_count", 12>,
+    pp::uint64_field<"acceleration_structure_build_count", 13>,
+    pp::uint64_field<"acceleration_structure_transfer_count", 14>,
+    /* The number of draw calls in each render pass, in submit order */
+    pp::uint64_field<"renderpass_draw_call_counts", 15, pp::repeated>,
+    /* The number of attachment pixels loaded from memory */
+    pp::uint64_field<"attachment_load_pixels", 16>,
+    /* The number of attachment pixels stored or resolved to memory */
+    pp::uint64_field<"attachment_store_pixels", 17>,
+    /* The number of pixels written by image transfers of known size */
+    pp::uint64_field<"image_transfer_pixels", 18>,
+    /* The number of bytes written by buffer transfers of known size */
+    pp::uint64_field<"buffer_transfer_bytes", 19>,
+    /* The number of bytes written by acceleration structure transfers of known size */
+    pp::uint64_field<"acceleration_structure_transfer_bytes", 20>,
+    /* The busiest debug label scopes in the frame */
+    pp::message_field<"label_scopes", 21, LabelScopeSummary, pp::repeated>,
+    /* The number of CPU-side blocking waits in the frame */
+    pp::uint64_field<"wait_count", 22>,
+    /* The total duration (in NS) of CPU-side blocking waits in the frame */
+    pp::uint64_field<"wait_time", 23>,
+    /* The number of pipelines created in the frame */
+    pp::uint64_field<"pipeline_count", 24>,
+    /* The total duration (in NS) of pipeline creation calls in the frame */
+    pp::uint64_field<"pipeline_creation_time", 25>>;
+
+/* The GPU execution time of a single workload, measured using timestamp queries */
+using WorkloadTiming = pp::message<
+    /* The unique tag ID of the workload */
+    pp::uint64_field<"tag_id", 1>,
+    /* The device the workload was submitted to */
+    pp::uint64_field<"device", 2>,
+    /* The queue the workload was submitted to */
+    pp::uint64_field<"queue", 3>,
+    /* The start timestamp, in GPU domain nanoseconds */
+    pp::uint64_field<"start_timestamp", 4>,
+    /* The end timestamp, in GPU domain nanoseconds */
+    pp::uint64_field<"end_timestamp", 5>>;
+
+/* Enumerates possible blocking wait functions */
+enum class WaitFunction
+{
+    unknown_wait = 0,
+    wait_for_fences = 1,
+    wait_semaphores = 2,
+    acquire_next_image = 3,
+    queue_wait_idle = 4,
+    device_wait_idle = 5,
+};
+
+/* A CPU-side blocking wait */
+using Wait = pp::message<
+    /* The device the wait was made on */
+    pp::uint64_field<"device", 1>,
+    /* The queue the wait was made on, or zero for non-queue waits */
+    pp::uint64_field<"queue", 2>,
+    /* The API function that waited */
+    pp::enum_field<"function", 3, WaitFunction>,
+    /* The ID of the thread that waited */
+    pp::uint32_field<"thread_id", 4>,
+    /* The timestamp (in NS, CLOCK_MONOTONIC_RAW) of the start of the wait */
+    pp::uint64_field<"start_timestamp", 5>,
+    /* The timestamp (in NS, CLOCK_MONOTONIC_RAW) of the end of the wait */
+    pp::uint64_field<"end_timestamp", 6>,
+    /* The VkResult returned by the function */
+    pp::int32_field<"result", 7>>;
+
+/* Enumerates possible pipeline creation types */
+enum class PipelineCreationType
+{
+    unknown_pipeline = 0,
+    graphics_pipeline = 1,
+    compute_pipeline = 2,
+    ray_tracing_pipeline = 3,
+};
+
+/* A pipeline creation call */
+using PipelineCreation = pp::message<
+    /* The device the pipelines were created on */
+    pp::uint64_field<"device", 1>,
+    /* The type of pipeline created */
+    pp::enum_field<"pipeline_type", 2, PipelineCreationType>,
+    /* The ID of the thread that created the pipelines */
+    pp::uint32_field<"thread_id", 3>,
+    /* The timestamp (in NS, CLOCK_MONOTONIC_RAW) of the start of the call */
+    pp::uint64_field<"start_timestamp", 4>,
+    /* The timestamp (in NS, CLOCK_MONOTONIC_RAW) of the end of the call */
+    pp::uint64_field<"end_timestamp", 5>,
+    /* The number of pipelines created by the call */
+    pp::uint32_field<"pipeline_count", 6>,
+    /* The number of pipelines created as pipeline libraries */
+    pp::uint32_field<"library_count", 7>,
+    /* The number of pipelines linked from pipeline libraries */
+    pp::uint32_field<"link_count", 8>,
+    /* The number of pipelines with valid creation feedback */
+    pp::uint32_field<"feedback_count", 9>,
+    /* The number of pipelines that were pipeline cache hits */
+    pp::uint32_field<"cache_hit_count", 10>,
+    /* The driver-reported creation time (in NS) of each pipeline, or zero if unknown */
+    pp::uint64_field<"pipeline_duration", 11, pp::repeated>,
+    /* The VkResult returned by the function */
+    pp::int32_field<"result", 12>>;
+
 /* The data payload message that wraps all other messages */
 using TimelineRecord =
     pp::message<pp::message_field<"header", 1, Header>,
@@ -265,7 +396,11 @@ using TimelineRecord =
                 pp::message_field<"buffer_transfer", 10, BufferTransfer>,
                 pp::message_field<"acceleration_structure_build", 11, AccelerationStructureBuild>,
                 pp::message_field<"acceleration_structure_transfer", 12, AccelerationStructureTransfer>,
-                pp::message_field<"dispatch_data_graph", 13, DispatchDataGraph>>;
+                pp::message_field<"dispatch_data_graph", 13, DispatchDataGraph>,
+                pp::message_field<"frame_summary", 14, FrameSummary>,
+                pp::message_field<"workload_timing", 15, WorkloadTiming>,
+                pp::message_field<"wait", 16, Wait>,
+                pp::message_field<"pipeline_creation", 17, PipelineCreation>>;
 
 namespace
 {
@@ -466,6 +601,56 @@ constexpr AccelerationStructureTransferType mapASTransferType(Tracker::LCSAccele
     }
 }
 
+/**
+ * @brief Map the layer wait type to the wire value.
+ *
+ * @param type   The type enum to convert
+ *
+ * @return The wire value enum to store in the protobuf message
+ */
+constexpr WaitFunction mapWaitType(WaitType type)
+{
+    switch (type)
+    {
+    case WaitType::WAIT_FOR_FENCES:
+        return WaitFunction::wait_for_fences;
+    case WaitType::WAIT_SEMAPHORES:
+        return WaitFunction::wait_semaphores;
+    case WaitType::ACQUIRE_NEXT_IMAGE:
+        return WaitFunction::acquire_next_image;
+    case WaitType::QUEUE_WAIT_IDLE:
+        return WaitFunction::queue_wait_idle;
+    case WaitType::DEVICE_WAIT_IDLE:
+        return WaitFunction::device_wait_idle;
+    default:
+        assert(false && "Unexpected WaitType");
+        return WaitFunction::unknown_wait;
+    }
+}
+
+/**
+ * @brief Map the layer pipeline type to the wire value.
+ *
+ * @param type   The type enum to convert
+ *
+ * @return The wire value enum to store in the protobuf message
+ */
+constexpr PipelineCreationType mapPipelineType(PipelineType type)
+{
+    switch (type)
+    {
+    case PipelineType::GRAPHICS:
+        return PipelineCreationType::graphics_pipeline;
+    case PipelineType::COMPUTE:
+        return PipelineCreationType::compute_pipeline;
+    case PipelineType::RAY_TRACING:
+        return PipelineCreationType::ray_tracing_pipeline;
+    default:
+        assert(false && "Unexpected PipelineType");
+        return PipelineCreationType::unknown_pipeline;
+    }
+}
+
 /**
  * @brief Serialize the metadata for this render pass workload.
  *
@@ -712,6 +897,106 @@ void TimelineProtobufEncoder::emitFrame(Device& device, uint64_t frameNumber, ui
                                 }));
 }
 
+void TimelineProtobufEncoder::emitFrameSummary(Device& device,
+                                               uint64_t frameNumber,
+                                               uint64_t timestamp,
+                                               const Tracker::Stats& stats,
+                                               const TimelineFrameSummary& summary,
+                                               uint32_t labelCount)
+{
+    using namespace pp;
+
+    // Make the label scope array
+    const auto scopes = summary.getTopLabelScopes(labelCount);
+    std::vector<LabelScopeSummary> scopesMsg {};
+    scopesMsg.reserve(scopes.size());
+
+    for (const auto& [label, scope] : scopes)
+    {
+        scopesMsg.emplace_back(label, scope.workloadCount, scope.drawCallCount);
+    }
+
+    device.txMessage(packBuffer("frame_summary"_f,
+                                FrameSummary {
+                                    frameNumber,
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    summary.getStartTimestamp(),
+                                    timestamp,
+                                    summary.getSubmitCount(),
+                                    stats.getRenderPassCount(),
+                                    stats.getDrawCallCount(),
+                                    stats.getDispatchCount(),
+                                    stats.getDispatchDataGraphCount(),
+                                    stats.getTraceRaysCount(),
+                                    stats.getImageTransferCount(),
+                                    stats.getBufferTransferCount(),
+                                    stats.getAccelerationStructureBuildCount(),
+                                    stats.getAccelerationStructureTransferCount(),
+                                    summary.getRenderPassDrawCallCounts(),
+                                    summary.getAttachmentLoadPixels(),
+                                    summary.getAttachmentStorePixels(),
+                                    summary.getImageTransferPixels(),
+                                    summary.getBufferTransferBytes(),
+                                    summary.getAccelerationStructureTransferBytes(),
+                                    std::move(scopesMsg),
+                                    summary.getWaitCount(),
+                                    summary.getWaitTime(),
+                                    summary.getPipelineCount(),
+                                    summary.getPipelineCreationTime(),
+                                }));
+}
+
+void TimelineProtobufEncoder::emitWorkloadTiming(Device& device, const TimestampResult& result)
+{
+    using namespace pp;
+
+    device.txMessage(packBuffer("workload_timing"_f,
+                                WorkloadTiming {
+                                    result.tagID,
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    reinterpret_cast<uintptr_t>(result.queue),
+                                    result.startTimestamp,
+                                    result.endTimestamp,
+                                }));
+}
+
+void TimelineProtobufEncoder::emitWait(Device& device, const WaitRecord& wait)
+{
+    using namespace pp;
+
+    device.txMessage(packBuffer("wait"_f,
+                                Wait {
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    reinterpret_cast<uintptr_t>(wait.queue),
+                                    mapWaitType(wait.type),
+                                    wait.threadID,
+                                    wait.startTimestamp,
+                                    wait.endTimestamp,
+                                    static_cast<int32_t>(wait.result),
+                                }));
+}
+
+void TimelineProtobufEncoder::emitPipelineCreation(Device& device, const PipelineCreationRecord& record)
+{
+    using namespace pp;
+
+    device.txMessage(packBuffer("pipeline_creation"_f,
+                                PipelineCreation {
+                                    reinterpret_cast<uintptr_t>(device.device),
+                                    mapPipelineType(record.type),
+                                    record.threadID,
+                                    record.startTimestamp,
+                                    record.endTimestamp,
+                                    record.pipelineCount,
+                                    record.libraryCount,
+                                    record.linkCount,
+                                    record.feedbackCount,
+                                    record.cacheHitCount,
+                                    record.pipelineDurations,
+                                    static_cast<int32_t>(record.result),
+                                }));
+}
+
 void TimelineProtobufEncoder::emitSubmit(VkQueue queue, uint64_t timestamp)
 {
     using namespace pp;
@@ -38,9 +38,14 @@
 #pragma once
 
 #include "device.hpp"
+#include "framework/timestamp_queries.hpp"
 #include "timeline_comms.hpp"
+#include "timeline_frame_summary.hpp"
+#include "timeline_pipelines.hpp"
+#include "timeline_waits.hpp"
 #include "trackers/layer_command_stream.hpp"
 #include "trackers/queue.hpp"
+#include "trackers/stats.hpp"
 
 #include <cstdint>
 
@@ -89,6 +94,47 @@ public:
      */
     static void emitFrame(Device& device, uint64_t frameNumber, uint64_t timestamp);
 
+    /**
+     * @brief Called at the end of a frame in frame summary mode, replacing all per-workload messages for that frame
+     *
+     * @param device The device object that the payloads are produced for, and to which they are passed for transmission
+     * @param frameNumber The frame number that uniquely identifies the frame being summarized
+     * @param timestamp The timestamp of the end of the frame
+     * @param stats The state tracker workload counts for the frame
+     * @param summary The accumulated frame summary
+     * @param labelCount The maximum number of label scopes to emit
+     */
+    static void emitFrameSummary(Device& device,
+                                 uint64_t frameNumber,
+                                 uint64_t timestamp,
+                                 const Tracker::Stats& stats,
+                                 const TimelineFrameSummary& summary,
+                                 uint32_t labelCount);
+
+    /**
+     * @brief Called when the GPU timestamps for a workload have been read back
+     *
+     * @param device The device object that the payloads are produced for, and to which they are passed for transmission
+     * @param result The timestamp result for the workload
+     */
+    static void emitWorkloadTiming(Device& device, const TimestampResult& result);
+
+    /**
+     * @brief Called when a CPU thread has finished a blocking wait
+     *
+     * @param device The device object that the payloads are produced for, and to which they are passed for transmission
+     * @param wait The wait record
+     */
+    static void emitWait(Device& device, const WaitRecord& wait);
+
+    /**
+     * @brief Called when a CPU thread has finished a pipeline creation call
+     *
+     * @param device The device object that the payloads are produced for, and to which they are passed for transmission
+     * @param record The pipeline creation record
+     */
+    static void emitPipelineCreation(Device& device, const PipelineCreationRecord& record);
+
     /**
      * Construct a new workload metadata emitter that will output payloads for the provided device
      *
@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the record used to describe a CPU-side blocking wait.
+ *
+ * Role summary
+ * ============
+ *
+ * The layer intercepts the API calls that can block an application thread
+ * waiting for the GPU or the presentation engine, and times them using the
+ * same CLOCK_MONOTONIC_RAW time base as queue submits. Each call generates a
+ * single wait record, which the host can lay out against GPU queue activity
+ * to identify CPU stalls.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief The type of API call that generated a wait.
+ */
+enum class WaitType
+{
+    WAIT_FOR_FENCES,
+    WAIT_SEMAPHORES,
+    ACQUIRE_NEXT_IMAGE,
+    QUEUE_WAIT_IDLE,
+    DEVICE_WAIT_IDLE
+};
+
+/**
+ * @brief A single timed CPU-side blocking wait.
+ */
+struct WaitRecord
+{
+    /**
+     * @brief The type of API call that generated the wait.
+     */
+    WaitType type;
+
+    /**
+     * @brief The queue waited on, or VK_NULL_HANDLE for non-queue waits.
+     */
+    VkQueue queue;
+
+    /**
+     * @brief The ID of the thread that waited.
+     */
+    uint32_t threadID;
+
+    /**
+     * @brief The CLOCK_MONOTONIC_RAW timestamp at the start of the wait.
+     */
+    uint64_t startTimestamp;
+
+    /**
+     * @brief The CLOCK_MONOTONIC_RAW timestamp at the end of the wait.
+     */
+    uint64_t endTimestamp;
+
+    /**
+     * @brief The result returned by the API call.
+     */
+    VkResult result;
+};
+
+/**
+ * @brief Get the API function name for a wait type.
+ *
+ * @param type   The wait type.
+ *
+ * @return The function name.
+ */
+inline const char* getWaitTypeName(WaitType type)
+{
+    switch (type)
+    {
+    case WaitType::WAIT_FOR_FENCES:
+        return "vkWaitForFences";
+    case WaitType::WAIT_SEMAPHORES:
+        return "vkWaitSemaphores";
+    case WaitType::ACQUIRE_NEXT_IMAGE:
+        return "vkAcquireNextImageKHR";
+    case WaitType::QUEUE_WAIT_IDLE:
+        return "vkQueueWaitIdle";
+    case WaitType::DEVICE_WAIT_IDLE:
+        return "vkDeviceWaitIdle";
+    }
+
+    return "Unknown wait";
+}
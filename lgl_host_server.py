@@ -39,6 +39,7 @@ from typing import Any
 
 from lglpy.android.adb import ADBConnect
 from lglpy.comms import server
+from lglpy.comms import service_gpu_support
 from lglpy.comms import service_gpu_timeline
 from lglpy.comms import service_test
 from lglpy.comms import service_log
@@ -65,6 +66,10 @@ def parse_cli() -> argparse.Namespace:
         '--timeline', '-T', type=str, default=None,
         help='file path to save timeline metadata to after a run')
 
+    parser.add_argument(
+        '--bisect', '-B', action='store_true', default=False,
+        help='enable the support layer serialization window bisect service')
+
     return parser.parse_args()
 
 
@@ -100,6 +105,11 @@ def main() -> int:
         endpoint_id = svr.register_endpoint(service)
         print(f'  - [{endpoint_id}] = {service.get_service_name()}')
 
+    if args.bisect:
+        service = service_gpu_support.GPUSupportBisectService(verbose=True)
+        endpoint_id = svr.register_endpoint(service)
+        print(f'  - [{endpoint_id}] = {service.get_service_name()}')
+
     print()
 
     # Start it running
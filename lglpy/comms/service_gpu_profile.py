@@ -28,44 +28,53 @@ handles record preprocessing and serializing the resulting GPU Profile layer.
 
 import csv
 import enum
-import json
+import math
 import os
-from typing import Optional, TypedDict, Union
+from typing import Optional
 
 from lglpy.comms.server import Message
+from lglpy.profile.protos.layer_driver import profile_pb2
 
 
-class StartFrameMessage(TypedDict):
-    '''
-    Type information for a start_frame JSON message.
-    '''
-    type: str
-    frame: int
+WORKLOAD_TYPE_NAMES = {
+    profile_pb2.WorkloadType.render_pass: 'render_pass',
+    profile_pb2.WorkloadType.compute: 'compute',
+    profile_pb2.WorkloadType.data_graph: 'data_graph',
+    profile_pb2.WorkloadType.trace_rays: 'trace_rays',
+    profile_pb2.WorkloadType.image_transfer: 'image_transfer',
+    profile_pb2.WorkloadType.buffer_transfer: 'buffer_transfer',
+    profile_pb2.WorkloadType.as_build: 'as_build',
+    profile_pb2.WorkloadType.as_transfer: 'as_transfer',
+}
 
 
-class EndFrameMessage(TypedDict):
-    '''
-    Type information for an end_frame JSON message.
+def map_workload_type(workload_type: int) -> str:
     '''
-    type: str
+    Map the PB encoded workload type to the string used in the CSV output.
 
+    Args:
+        workload_type: The PB encoded workload type.
 
-class WorkloadMessage(TypedDict):
+    Returns:
+        The workload type name.
     '''
-    Type information for any per-workload sample JSON message.
-    '''
-    type: str
-    counters: list[dict[str, Union[int, float]]]
-    labels: list[str]
+    return WORKLOAD_TYPE_NAMES.get(workload_type, 'unknown')
 
 
-class FrameMessage(TypedDict):
+def format_value(value: float) -> str:
     '''
-    Type information for a per-frame sample JSON message.
+    Format a counter value for the CSV output.
+
+    Args:
+        value: The counter value, or NaN if the value could not be read.
+
+    Returns:
+        The formatted value.
     '''
-    type: str
-    counters: list[dict[str, Union[int, float]]]
-    frame: int
+    if math.isnan(value):
+        return ''
+
+    return f'{value:0.2f}'
 
 
 class SampleMode(enum.Enum):
@@ -74,6 +83,43 @@ class SampleMode(enum.Enum):
     '''
     PER_WORKLOAD = 0
     PER_FRAME = 1
+    PERIODIC = 2
+
+
+class WorkloadSample:
+    '''
+    A single workload sample from one counter pass.
+    '''
+
+    def __init__(self, workload_type: str, workload_count: int,
+                 values: list[float], labels: list[str]):
+        '''
+        Initialize the workload sample.
+
+        Args:
+            workload_type: The workload type name.
+            workload_count: The number of workloads covered by the sample.
+            values: The counter values, in schema order.
+            labels: The debug label stack.
+        '''
+        self.workload_type = workload_type
+        self.workload_count = workload_count
+        self.values = values
+        self.labels = labels
+
+    def matches(self, other: 'WorkloadSample') -> bool:
+        '''
+        Test if this sample is for the same workload as another sample.
+
+        Args:
+            other: The sample from another counter pass.
+
+        Returns:
+            True if the samples are for the same workload.
+        '''
+        return self.workload_type == other.workload_type \
+            and self.workload_count == other.workload_count \
+            and self.labels == other.labels
 
 
 class GPUProfileService:
@@ -96,10 +142,24 @@ class GPUProfileService:
         self.sample_mode = SampleMode.PER_WORKLOAD
 
         self.frame_id: Optional[int] = None
+        self.frame_pass = 0
+
+        # Counter names are sent once per pass in the schema and samples only
+        # send the values in the same order, followed by any derived metrics
+        self.counter_names: list[str] = []
+        self.pass_counter_names: dict[int, list[str]] = {}
+        self.pass_count = 1
+
+        # Workload samples for each pass in the current pass cycle
+        self.pass_frame_ids: dict[int, int] = {}
+        self.pass_samples: dict[int, list[WorkloadSample]] = {}
 
         self.table_header: Optional[list[str]] = None
         self.table_data: list[list[str]] = []
 
+        # Periodic samples are appended to the file as each block arrives
+        self.periodic_path: Optional[str] = None
+
         os.makedirs(dir_path, exist_ok=True)
 
     def get_service_name(self) -> str:
@@ -111,28 +171,59 @@ class GPUProfileService:
         '''
         return 'GPUProfile'
 
-    def handle_start_frame(self, message: StartFrameMessage):
+    def handle_schema(self, message: profile_pb2.Schema):
+        '''
+        Handle a schema message.
+
+        Args:
+            message: The decoded protobuf message.
+        '''
+        # Note that "pass" is a Python keyword so cannot be used as an attribute
+        frame_pass = getattr(message, 'pass')
+
+        # Samples contain the raw counter values, unless omitted, followed by
+        # the derived metric values computed by the layer
+        names = []
+        if not message.omit_raw_values:
+            names.extend(counter.name for counter in message.counters)
+        names.extend(message.derived_metrics)
+
+        self.pass_counter_names[frame_pass] = names
+        self.pass_count = max(message.pass_count, 1)
+
+        if frame_pass == 0:
+            self.counter_names = names
+
+    def handle_start_frame(self, message: profile_pb2.StartFrame):
         '''
         Handle a start_frame message.
 
         Args:
-            message: The decoded JSON.
+            message: The decoded protobuf message.
         '''
-        self.frame_id = message["frame"]
+        self.frame_id = message.frame
+        self.frame_pass = getattr(message, 'pass')
+        self.counter_names = self.pass_counter_names[self.frame_pass]
         self.table_header = None
         self.table_data.clear()
 
-    def handle_end_frame(self, message: EndFrameMessage):
+        # A new pass cycle discards any incomplete previous cycle
+        if self.frame_pass == 0:
+            self.pass_frame_ids.clear()
+            self.pass_samples.clear()
+
+    def handle_end_frame(self, message: profile_pb2.EndFrame):
         '''
-        Handle an end_frame message.
+        Handle an end_frame message, which contains all workload samples for
+        the frame.
 
         Args:
-            message: The decoded JSON.
+            message: The decoded protobuf message.
         '''
-        # Message contains nothing we need
-        del message
-
         assert self.frame_id is not None
+
+        self.create_workload_header()
+        self.create_workload_data(message)
         assert self.table_header is not None
 
         # Emit the CSV file
@@ -143,84 +234,181 @@ class GPUProfileService:
             writer.writerow(self.table_header)
             writer.writerows(self.table_data)
 
+        self.write_trap_wait_histogram(message)
+
+        if self.pass_count > 1:
+            self.pass_frame_ids[self.frame_pass] = self.frame_id
+            self.pass_samples[self.frame_pass] = self.get_samples(message)
+
+            if len(self.pass_samples) == self.pass_count:
+                self.write_merged_passes()
+                self.pass_frame_ids.clear()
+                self.pass_samples.clear()
+
         # Reset the state
         self.frame_id = None
         self.table_header = None
         self.table_data.clear()
 
-    def create_workload_header(self, message: WorkloadMessage):
+    def write_trap_wait_histogram(self, message: profile_pb2.EndFrame):
         '''
-        Create a table header row from a workload sample.
+        Write the trap wait histogram for a frame to a CSV file.
 
         Args:
-            message: The decoded JSON.
+            message: The decoded protobuf message.
         '''
-        columns = []
+        assert self.frame_id is not None
 
-        columns.append('Index')
-        columns.append('Workload type')
-        for counter in message['counters']:
-            key = list(counter.keys())[0]
-            columns.append(key)
-        columns.append('Label')
+        rows = []
+        bucket_count = len(message.trap_wait_histogram)
+        for i, count in enumerate(message.trap_wait_histogram):
+            min_time = 0 if i == 0 else 2 ** i
+            max_time = '' if i == bucket_count - 1 else str(2 ** (i + 1))
+            rows.append([str(min_time), max_time, str(count)])
 
-        self.table_header = columns
+        name = f'frame_{self.frame_id:05d}_trap_waits.csv'
+        path = os.path.join(self.base_dir, name)
+        with open(path, 'w', newline='', encoding='utf-8') as handle:
+            writer = csv.writer(handle)
+            writer.writerow(['Min wait (us)', 'Max wait (us)', 'Trap count'])
+            writer.writerows(rows)
 
-    def create_workload_data(self, message: WorkloadMessage):
+    def get_samples(self, message: profile_pb2.EndFrame) \
+            -> list[WorkloadSample]:
         '''
-        Create a table data row from a workload sample.
+        Get the workload samples in a frame.
 
         Args:
-            message: The decoded JSON.
+            message: The decoded protobuf message.
+
+        Returns:
+            The workload samples, in frame order.
         '''
-        assert self.frame_id is not None
-        assert self.table_header is not None
+        counter_count = len(self.counter_names)
+        label_start = 0
+        samples = []
 
-        columns: list[str] = []
+        for i, workload_type in enumerate(message.workload_type):
+            value_start = i * counter_count
+            values = message.value[value_start:value_start + counter_count]
 
-        columns.append(str(len(self.table_data)))
-        columns.append(message['type'])
+            label_end = label_start + message.debug_label_count[i]
+            labels = message.debug_label[label_start:label_end]
+            label_start = label_end
 
-        for counter in message['counters']:
-            value = list(counter.values())[0]
-            columns.append(f'{value:0.2f}')
-        columns.append('|'.join(message['labels']))
+            samples.append(WorkloadSample(
+                map_workload_type(workload_type), message.workload_count[i],
+                list(values), list(labels)))
 
-        self.table_data.append(columns)
+        return samples
 
-    def handle_workload_sample(self, message: WorkloadMessage):
+    def write_merged_passes(self):
         '''
-        Handle a workload sample message.
+        Write a CSV file merging the workload samples from all counter passes.
 
-        Args:
-            message: The decoded JSON.
+        Workloads are matched by their frame-relative index, and must have the
+        same workload type, workload count, and debug label stack in every
+        pass. Counter values for workloads that do not match are left empty.
         '''
-        if not self.table_header:
-            self.create_workload_header(message)
+        base_frame_id = self.pass_frame_ids[0]
+        base_samples = self.pass_samples[0]
+
+        header = ['Index', 'Workload type', 'Workload count']
+        for i in range(self.pass_count):
+            header.extend(self.pass_counter_names[i])
+        header.append('Label')
+
+        mismatches = 0
+        rows = []
+        for i, sample in enumerate(base_samples):
+            row = [str(i), sample.workload_type, str(sample.workload_count)]
+
+            for j in range(self.pass_count):
+                samples = self.pass_samples[j]
+                counter_count = len(self.pass_counter_names[j])
+
+                if i < len(samples) and sample.matches(samples[i]):
+                    row.extend(format_value(x) for x in samples[i].values)
+                else:
+                    row.extend([''] * counter_count)
+                    mismatches += 1
+
+            row.append('|'.join(sample.labels))
+            rows.append(row)
+
+        if mismatches:
+            print(f'Warning: {mismatches} workload samples did not match '
+                  f'between passes for frame {base_frame_id}')
+
+        print(f'Generating merged CSV for frame {base_frame_id}')
+        name = f'frame_{base_frame_id:05d}_merged.csv'
+        path = os.path.join(self.base_dir, name)
+        with open(path, 'w', newline='', encoding='utf-8') as handle:
+            writer = csv.writer(handle)
+            writer.writerow(header)
+            writer.writerows(rows)
 
-        self.create_workload_data(message)
+    def create_workload_header(self):
+        '''
+        Create a table header row for workload samples from the schema.
+        '''
+        columns = []
 
-    def create_frame_header(self, message: FrameMessage):
+        columns.append('Index')
+        columns.append('Workload type')
+        columns.append('Workload count')
+        columns.extend(self.counter_names)
+        columns.append('Label')
+
+        self.table_header = columns
+
+    def create_workload_data(self, message: profile_pb2.EndFrame):
         '''
-        Create a table header row from a frame sample.
+        Create table data rows from the workload samples in a frame.
+
         Args:
-            message: The decoded JSON.
+            message: The decoded protobuf message.
+        '''
+        counter_count = len(self.counter_names)
+        label_start = 0
+
+        for i, workload_type in enumerate(message.workload_type):
+            columns: list[str] = []
+
+            columns.append(str(i))
+            columns.append(map_workload_type(workload_type))
+            columns.append(str(message.workload_count[i]))
+
+            value_start = i * counter_count
+            values = message.value[value_start:value_start + counter_count]
+            for value in values:
+                columns.append(format_value(value))
+
+            label_end = label_start + message.debug_label_count[i]
+            labels = message.debug_label[label_start:label_end]
+            columns.append('|'.join(labels))
+            label_start = label_end
+
+            self.table_data.append(columns)
+
+    def create_frame_header(self):
+        '''
+        Create a table header row for frame samples from the schema.
         '''
         columns = []
 
         columns.append('Frame ID')
-        for counter in message['counters']:
-            key = list(counter.keys())[0]
-            columns.append(key)
+        for i in range(self.pass_count):
+            columns.extend(self.pass_counter_names[i])
 
         self.table_header = columns
 
-    def create_frame_data(self, message: FrameMessage):
+    def create_frame_data(self, message: profile_pb2.FrameSample):
         '''
         Create a table data row from a frame sample.
 
         Args:
-            message: The decoded JSON.
+            message: The decoded protobuf message.
         '''
         assert self.table_header is not None
 
@@ -228,23 +416,28 @@ class GPUProfileService:
 
         columns.append(f'{self.frame_id}')
 
-        for counter in message['counters']:
-            value = list(counter.values())[0]
-            columns.append(f'{value:0.2f}')
+        # Only the counters in the pass used for this frame have values
+        frame_pass = getattr(message, 'pass')
+        for i in range(self.pass_count):
+            if i == frame_pass:
+                for value in message.value:
+                    columns.append(format_value(value))
+            else:
+                columns.extend([''] * len(self.pass_counter_names[i]))
 
         self.table_data.append(columns)
 
-    def handle_frame_sample(self, message: FrameMessage):
+    def handle_frame_sample(self, message: profile_pb2.FrameSample):
         '''
         Handle a frame message.
 
         Args:
-            message: The decoded JSON.
+            message: The decoded protobuf message.
         '''
-        self.frame_id = message['frame']
+        self.frame_id = message.frame
 
         if not self.table_header:
-            self.create_frame_header(message)
+            self.create_frame_header()
 
         assert self.table_header is not None
         self.create_frame_data(message)
@@ -256,6 +449,46 @@ class GPUProfileService:
             writer.writerow(self.table_header)
             writer.writerows(self.table_data)
 
+    def handle_periodic_samples(self, message: profile_pb2.PeriodicSamples):
+        '''
+        Handle a block of periodic samples.
+
+        Args:
+            message: The decoded protobuf message.
+        '''
+        self.sample_mode = SampleMode.PERIODIC
+
+        # Periodic sampling always uses the first counter pass
+        counter_names = self.pass_counter_names[0]
+        counter_count = len(counter_names)
+
+        rows = []
+        for i, timestamp in enumerate(message.timestamp):
+            columns = [f'{timestamp / 1000:0.1f}',
+                       str(message.frame[i]),
+                       str(message.submit[i])]
+
+            value_start = i * counter_count
+            values = message.value[value_start:value_start + counter_count]
+            columns.extend(format_value(value) for value in values)
+            rows.append(columns)
+
+        # Create the file with a header on the first block
+        mode = 'a'
+        if self.periodic_path is None:
+            self.periodic_path = os.path.join(self.base_dir, 'periodic.csv')
+            mode = 'w'
+
+        print(f'Updating CSV with {len(rows)} periodic samples')
+        with open(self.periodic_path, mode, newline='',
+                  encoding='utf-8') as handle:
+            writer = csv.writer(handle)
+            if mode == 'w':
+                header = ['Time (us)', 'Frame ID', 'Submit count']
+                header.extend(counter_names)
+                writer.writerow(header)
+            writer.writerows(rows)
+
     def handle_message(self, message: Message) -> None:
         '''
         Handle a service request from a layer.
@@ -263,14 +496,16 @@ class GPUProfileService:
         Note that this service only expects pushed TX or TX_ASYNC messages, so
         never provides a response.
         '''
-        encoded_payload = message.payload.decode('utf-8')
-        payload = json.loads(encoded_payload)
-
-        if payload['type'] == 'start_frame':
-            self.handle_start_frame(payload)
-        elif payload['type'] == 'end_frame':
-            self.handle_end_frame(payload)
-        elif payload['type'] == 'frame':
-            self.handle_frame_sample(payload)
-        else:
-            self.handle_workload_sample(payload)
+        record = profile_pb2.ProfileRecord()
+        record.ParseFromString(message.payload)
+
+        if record.HasField('schema'):
+            self.handle_schema(record.schema)
+        elif record.HasField('start_frame'):
+            self.handle_start_frame(record.start_frame)
+        elif record.HasField('end_frame'):
+            self.handle_end_frame(record.end_frame)
+        elif record.HasField('frame_sample'):
+            self.handle_frame_sample(record.frame_sample)
+        elif record.HasField('periodic_samples'):
+            self.handle_periodic_samples(record.periodic_samples)
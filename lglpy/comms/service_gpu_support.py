@@ -0,0 +1,202 @@
+# SPDX-License-Identifier: MIT
+# -----------------------------------------------------------------------------
+# Copyright (c) 2026 Arm Limited
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the 'Software'), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+# -----------------------------------------------------------------------------
+
+'''
+This module implements the server-side communications module service that
+drives a bisecting search over the GPU Support layer serialization window.
+
+The layer sends a report at the end of each frame, and receives the window of
+workloads that it may serialize for the next frame. The service splits the
+current window into two halves, measures the mean CPU frame time with each
+half serialized, and keeps the half with the higher cost. This repeats until
+the window contains a single workload, which is the workload whose
+serialization has the largest performance impact.
+'''
+
+import enum
+import json
+from typing import Optional
+
+from lglpy.comms.server import Message, MessageType
+
+
+class BisectState(enum.Enum):
+    '''
+    The state of the bisect search.
+    '''
+    DISCOVER = 0
+    MEASURE = 1
+    DONE = 2
+
+
+class GPUSupportBisectService:
+    '''
+    A service for bisecting the layer_gpu_support serialization window.
+    '''
+
+    def __init__(self, settle_frames: int = 5, sample_frames: int = 20,
+                 verbose: bool = False):
+        '''
+        Initialize the bisect service.
+
+        Args:
+            settle_frames: Frames to skip after each window change, allowing
+                in-flight frames recorded with the old window to retire.
+            sample_frames: Frames to average for each window measurement.
+            verbose: Should this use verbose logging?
+        '''
+        self.settle_frames = settle_frames
+        self.sample_frames = sample_frames
+        self.verbose = verbose
+
+        self.state = BisectState.DISCOVER
+
+        # The current search range of workload indices, as [low, high)
+        self.low = 0
+        self.high = 0
+
+        # The windows being measured in this step, and their mean frame times
+        self.candidates: list[tuple[int, int]] = []
+        self.candidate_times: list[float] = []
+
+        # The measurement state for the active window
+        self.frame_count = 0
+        self.frame_times: list[int] = []
+
+    def get_service_name(self) -> str:
+        '''
+        Get the service endpoint name.
+
+        Returns:
+            The endpoint name.
+        '''
+        return 'GPUSupportBisect'
+
+    def get_window(self) -> tuple[int, int]:
+        '''
+        Get the serialization window the layer should use next.
+
+        Returns:
+            The window as a (first, count) tuple, where a count of 0 is
+            unbounded.
+        '''
+        if self.state == BisectState.DISCOVER:
+            return (0, 0)
+
+        if self.state == BisectState.DONE:
+            return (self.low, 1)
+
+        return self.candidates[len(self.candidate_times)]
+
+    def start_step(self) -> None:
+        '''
+        Start the next bisect step, or finish the search.
+        '''
+        if self.high - self.low <= 1:
+            self.state = BisectState.DONE
+            print(f'Bisect complete: serialization of workload {self.low} '
+                  'has the highest cost')
+            return
+
+        mid = (self.low + self.high) // 2
+        self.candidates = [
+            (self.low, mid - self.low),
+            (mid, self.high - mid)
+        ]
+
+        self.candidate_times = []
+        self.state = BisectState.MEASURE
+
+    def end_step(self) -> None:
+        '''
+        Narrow the search range to the most expensive candidate window.
+        '''
+        lower, upper = self.candidate_times
+        first, count = self.candidates[0 if lower >= upper else 1]
+
+        if self.verbose:
+            for window, time in zip(self.candidates, self.candidate_times):
+                print(f'  Window {window[0]}+{window[1]}: {time:0.1f} us')
+
+        self.low = first
+        self.high = first + count
+        print(f'Bisect window now [{self.low}, {self.high})')
+
+        self.start_step()
+
+    def add_frame(self, frame_time_us: int) -> None:
+        '''
+        Add a frame measurement for the active window.
+
+        Args:
+            frame_time_us: The CPU frame time, in microseconds.
+        '''
+        self.frame_count += 1
+        if self.frame_count <= self.settle_frames:
+            return
+
+        self.frame_times.append(frame_time_us)
+        if len(self.frame_times) < self.sample_frames:
+            return
+
+        if self.state == BisectState.MEASURE:
+            mean = sum(self.frame_times) / len(self.frame_times)
+            self.candidate_times.append(mean)
+            if len(self.candidate_times) == len(self.candidates):
+                self.end_step()
+
+        self.frame_count = 0
+        self.frame_times = []
+
+    def handle_message(self, message: Message) -> Optional[bytes]:
+        '''
+        Handle a service request from a layer.
+
+        Args:
+            message: The received message.
+
+        Returns:
+            The response if message is a TX_RX message, None otherwise.
+        '''
+        report = json.loads(message.payload.decode('utf-8'))
+
+        if self.state == BisectState.DISCOVER:
+            # Size the search range from the unrestricted frames
+            self.high = max(self.high, report['workloads'])
+            self.add_frame(report['frame_time_us'])
+            if self.frame_count == 0 and self.high > 0:
+                print(f'Bisect window now [{self.low}, {self.high})')
+                self.start_step()
+
+        elif self.state == BisectState.MEASURE:
+            # Ignore frames recorded before the layer applied the window
+            window = (report['first'], report['count'])
+            if window == self.get_window():
+                self.add_frame(report['frame_time_us'])
+
+        if message.message_type != MessageType.TX_RX:
+            return None
+
+        first, count = self.get_window()
+        response = {'first': first, 'count': count}
+        return json.dumps(response).encode('utf-8')
@@ -143,6 +143,45 @@ class SubmitMetadataType(TypedDict):
                     | ASTransferMetadataType]
 
 
+class WorkloadTimingType(TypedDict):
+    '''
+    Structured dict type for type hinting.
+    '''
+    tid: int
+    queue: int
+    startTimestamp: int
+    endTimestamp: int
+
+
+class WaitType(TypedDict):
+    '''
+    Structured dict type for type hinting.
+    '''
+    function: str
+    queue: int
+    threadId: int
+    startTimestamp: int
+    endTimestamp: int
+    result: int
+
+
+class PipelineCreationType(TypedDict):
+    '''
+    Structured dict type for type hinting.
+    '''
+    pipelineType: str
+    threadId: int
+    startTimestamp: int
+    endTimestamp: int
+    pipelineCount: int
+    libraryCount: int
+    linkCount: int
+    feedbackCount: int
+    cacheHitCount: int
+    pipelineDurations: list[int]
+    result: int
+
+
 class FrameMetadataType(TypedDict):
     '''
     Structured dict type for type hinting.
@@ -151,6 +190,50 @@ class FrameMetadataType(TypedDict):
     frame: int
     presentTimestamp: int
     submits: list[SubmitMetadataType]
+    timings: list[WorkloadTimingType]
+    waits: list[WaitType]
+    pipelines: list[PipelineCreationType]
+
+
+class LabelScopeSummaryType(TypedDict):
+    '''
+    Structured dict type for type hinting.
+    '''
+    label: str
+    workloadCount: int
+    drawCallCount: int
+
+
+class FrameSummaryType(TypedDict):
+    '''
+    Structured dict type for type hinting.
+    '''
+    type: str
+    device: int
+    frame: int
+    startTimestamp: int
+    endTimestamp: int
+    submitCount: int
+    renderpassCount: int
+    drawCallCount: int
+    dispatchCount: int
+    dispatchDataGraphCount: int
+    traceRaysCount: int
+    imageTransferCount: int
+    bufferTransferCount: int
+    asBuildCount: int
+    asTransferCount: int
+    renderpassDrawCallCounts: list[int]
+    attachmentLoadPixels: int
+    attachmentStorePixels: int
+    imageTransferPixels: int
+    bufferTransferBytes: int
+    asTransferBytes: int
+    labelScopes: list[LabelScopeSummaryType]
+    waitCount: int
+    waitTime: int
+    pipelineCount: int
+    pipelineCreationTime: int
 
 
 def expect_int(v: int | None) -> int:
@@ -276,6 +359,54 @@ def map_as_transfer_type(type) -> str:
     assert False
 
 
+def map_wait_function(type) -> str:
+    '''
+    Map the PB encoded wait function to a description.
+    '''
+    base_type = timeline_pb2.WaitFunction
+
+    if type == base_type.unknown_wait:
+        return "Unknown"
+
+    if type == base_type.wait_for_fences:
+        return "vkWaitForFences"
+
+    if type == base_type.wait_semaphores:
+        return "vkWaitSemaphores"
+
+    if type == base_type.acquire_next_image:
+        return "vkAcquireNextImageKHR"
+
+    if type == base_type.queue_wait_idle:
+        return "vkQueueWaitIdle"
+
+    if type == base_type.device_wait_idle:
+        return "vkDeviceWaitIdle"
+
+    assert False
+
+
+def map_pipeline_type(type) -> str:
+    '''
+    Map the PB encoded pipeline creation type to a description.
+    '''
+    base_type = timeline_pb2.PipelineCreationType
+
+    if type == base_type.unknown_pipeline:
+        return "Unknown"
+
+    if type == base_type.graphics_pipeline:
+        return "Graphics"
+
+    if type == base_type.compute_pipeline:
+        return "Compute"
+
+    if type == base_type.ray_tracing_pipeline:
+        return "Ray tracing"
+
+    assert False
+
+
 def map_debug_label(labels: list[str] | None) -> list[str]:
     '''
     Normalize the 'debug_label' field from the PB data
@@ -309,7 +440,10 @@ class GPUDeviceState:
             'device': device_id,
             'frame': 0,
             'presentTimestamp': 0,
-            'submits': []
+            'submits': [],
+            'timings': [],
+            'waits': [],
+            'pipelines': []
         }
 
 
@@ -428,7 +562,10 @@ class GPUTimelineService:
             'device': device_id,
             'frame': next_frame,
             'presentTimestamp': 0,
-            'submits': []
+            'submits': [],
+            'timings': [],
+            'waits': [],
+            'pipelines': []
         }
 
         if self.verbose and (next_frame % 100 == 0):
@@ -674,6 +811,147 @@ class GPUTimelineService:
 
         submit['workloads'].append(as_transfer)
 
+    def handle_frame_summary(self, msg: Any) -> None:
+        '''
+        Handle a frame summary record.
+
+        Frame summaries are self-contained, so they are written directly to
+        the output file without modifying the per-device frame state.
+
+        Args:
+            msg: The Python decode of a Timeline PB payload.
+        '''
+        summary: FrameSummaryType = {
+            'type': 'summary',
+            'device': expect_int(msg.device),
+            'frame': expect_int(msg.id),
+            'startTimestamp': expect_int(msg.start_timestamp),
+            'endTimestamp': expect_int(msg.end_timestamp),
+            'submitCount': expect_int(msg.submit_count),
+            'renderpassCount': expect_int(msg.renderpass_count),
+            'drawCallCount': expect_int(msg.draw_call_count),
+            'dispatchCount': expect_int(msg.dispatch_count),
+            'dispatchDataGraphCount':
+                expect_int(msg.dispatch_data_graph_count),
+            'traceRaysCount': expect_int(msg.trace_rays_count),
+            'imageTransferCount': expect_int(msg.image_transfer_count),
+            'bufferTransferCount': expect_int(msg.buffer_transfer_count),
+            'asBuildCount':
+                expect_int(msg.acceleration_structure_build_count),
+            'asTransferCount':
+                expect_int(msg.acceleration_structure_transfer_count),
+            'renderpassDrawCallCounts':
+                [int(x) for x in msg.renderpass_draw_call_counts],
+            'attachmentLoadPixels': expect_int(msg.attachment_load_pixels),
+            'attachmentStorePixels': expect_int(msg.attachment_store_pixels),
+            'imageTransferPixels': expect_int(msg.image_transfer_pixels),
+            'bufferTransferBytes': expect_int(msg.buffer_transfer_bytes),
+            'asTransferBytes':
+                expect_int(msg.acceleration_structure_transfer_bytes),
+            'labelScopes': [],
+            'waitCount': expect_int(msg.wait_count),
+            'waitTime': expect_int(msg.wait_time),
+            'pipelineCount': expect_int(msg.pipeline_count),
+            'pipelineCreationTime': expect_int(msg.pipeline_creation_time),
+        }
+
+        for pb_scope in msg.label_scopes:
+            scope: LabelScopeSummaryType = {
+                'label': str(pb_scope.label),
+                'workloadCount': expect_int(pb_scope.workload_count),
+                'drawCallCount': expect_int(pb_scope.draw_call_count),
+            }
+            summary['labelScopes'].append(scope)
+
+        # Write summary packet to the file
+        data = json.dumps(summary).encode('utf-8')
+        length = struct.pack('<I', len(data))
+
+        self.file_handle.write(length)
+        self.file_handle.write(data)
+
+        frame = summary['frame']
+        if self.verbose and (frame % 100 == 0):
+            device_id = summary['device']
+            print(f'Summarized frame {frame} for 0x{device_id:02X} ...')
+
+    def handle_workload_timing(self, msg: Any) -> None:
+        '''
+        Handle a workload timing record.
+
+        Timings are read back asynchronously by the layer, so may arrive in a
+        later frame than the workload they refer to. They are attached to the
+        frame that is current when they arrive, and matched by tag ID.
+
+        Args:
+            msg: The Python decode of a Timeline PB payload.
+        '''
+        # Get the device object
+        device = self.get_device(expect_int(msg.device))
+
+        timing: WorkloadTimingType = {
+            'tid': expect_int(msg.tag_id),
+            'queue': expect_int(msg.queue),
+            'startTimestamp': expect_int(msg.start_timestamp),
+            'endTimestamp': expect_int(msg.end_timestamp),
+        }
+
+        device.frame['timings'].append(timing)
+
+    def handle_wait(self, msg: Any) -> None:
+        '''
+        Handle a CPU-side blocking wait record.
+
+        Waits are attached to the frame that is current when they complete.
+        Timestamps use the same CLOCK_MONOTONIC_RAW time base as submits, so
+        can be laid out directly against queue activity.
+
+        Args:
+            msg: The Python decode of a Timeline PB payload.
+        '''
+        # Get the device object
+        device = self.get_device(expect_int(msg.device))
+
+        wait: WaitType = {
+            'function': map_wait_function(msg.function),
+            'queue': expect_int(msg.queue),
+            'threadId': expect_int(msg.thread_id),
+            'startTimestamp': expect_int(msg.start_timestamp),
+            'endTimestamp': expect_int(msg.end_timestamp),
+            'result': expect_int(msg.result),
+        }
+
+        device.frame['waits'].append(wait)
+
+    def handle_pipeline_creation(self, msg: Any) -> None:
+        '''
+        Handle a pipeline creation record.
+
+        Pipeline creation calls are attached to the frame that is current when
+        they complete, so hitching frames can be attributed to them.
+
+        Args:
+            msg: The Python decode of a Timeline PB payload.
+        '''
+        # Get the device object
+        device = self.get_device(expect_int(msg.device))
+
+        pipeline: PipelineCreationType = {
+            'pipelineType': map_pipeline_type(msg.pipeline_type),
+            'threadId': expect_int(msg.thread_id),
+            'startTimestamp': expect_int(msg.start_timestamp),
+            'endTimestamp': expect_int(msg.end_timestamp),
+            'pipelineCount': expect_int(msg.pipeline_count),
+            'libraryCount': expect_int(msg.library_count),
+            'linkCount': expect_int(msg.link_count),
+            'feedbackCount': expect_int(msg.feedback_count),
+            'cacheHitCount': expect_int(msg.cache_hit_count),
+            'pipelineDurations': [int(x) for x in msg.pipeline_duration],
+            'result': expect_int(msg.result),
+        }
+
+        device.frame['pipelines'].append(pipeline)
+
     def handle_message(self, message: Message) -> None:
         '''
         Handle a service request from a layer.
@@ -696,7 +974,11 @@ class GPUTimelineService:
                  + int(pb_record.HasField('image_transfer'))
                  + int(pb_record.HasField('buffer_transfer'))
                  + int(pb_record.HasField('acceleration_structure_build'))
-                 + int(pb_record.HasField('acceleration_structure_transfer')))
+                 + int(pb_record.HasField('acceleration_structure_transfer'))
+                 + int(pb_record.HasField('frame_summary'))
+                 + int(pb_record.HasField('workload_timing'))
+                 + int(pb_record.HasField('wait'))
+                 + int(pb_record.HasField('pipeline_creation')))
                  <= 1)
 
         # Process the message
@@ -724,5 +1006,13 @@ class GPUTimelineService:
             self.handle_as_build(pb_record.acceleration_structure_build)
         elif pb_record.HasField('acceleration_structure_transfer'):
             self.handle_as_transfer(pb_record.acceleration_structure_transfer)
+        elif pb_record.HasField('frame_summary'):
+            self.handle_frame_summary(pb_record.frame_summary)
+        elif pb_record.HasField('workload_timing'):
+            self.handle_workload_timing(pb_record.workload_timing)
+        elif pb_record.HasField('wait'):
+            self.handle_wait(pb_record.wait)
+        elif pb_record.HasField('pipeline_creation'):
+            self.handle_pipeline_creation(pb_record.pipeline_creation)
         else:
             assert False, f'Unknown payload {pb_record}'
@@ -0,0 +1,40 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: profile.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rprofile.proto\x12\x11gpulayers.profile\"#\n\x07\x43ounter\x12\n\n\x02id\x18\x01 \x01(\r\x12\x0c\n\x04name\x18\x02 \x01(\t\"\x9a\x01\n\x06Schema\x12\x0e\n\x06\x64\x65vice\x18\x01 \x01(\x04\x12,\n\x08\x63ounters\x18\x02 \x03(\x0b\x32\x1a.gpulayers.profile.Counter\x12\x0c\n\x04pass\x18\x03 \x01(\r\x12\x12\n\npass_count\x18\x04 \x01(\r\x12\x17\n\x0f\x64\x65rived_metrics\x18\x05 \x03(\t\x12\x17\n\x0fomit_raw_values\x18\x06 \x01(\x08\"9\n\nStartFrame\x12\x0e\n\x06\x64\x65vice\x18\x01 \x01(\x04\x12\r\n\x05\x66rame\x18\x02 \x01(\x04\x12\x0c\n\x04pass\x18\x03 \x01(\r\"\xd5\x01\n\x08\x45ndFrame\x12\x0e\n\x06\x64\x65vice\x18\x01 \x01(\x04\x12\r\n\x05\x66rame\x18\x02 \x01(\x04\x12\x36\n\rworkload_type\x18\x03 \x03(\x0e\x32\x1f.gpulayers.profile.WorkloadType\x12\x19\n\x11\x64\x65\x62ug_label_count\x18\x04 \x03(\r\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x05 \x03(\t\x12\r\n\x05value\x18\x06 \x03(\x01\x12\x1b\n\x13trap_wait_histogram\x18\x07 \x03(\x04\x12\x16\n\x0eworkload_count\x18\x08 \x03(\r\"I\n\x0b\x46rameSample\x12\x0e\n\x06\x64\x65vice\x18\x01 \x01(\x04\x12\r\n\x05\x66rame\x18\x02 \x01(\x04\x12\r\n\x05value\x18\x03 \x03(\x01\x12\x0c\n\x04pass\x18\x04 \x01(\r\"b\n\x0fPeriodicSamples\x12\x0e\n\x06\x64\x65vice\x18\x01 \x01(\x04\x12\x11\n\ttimestamp\x18\x02 \x03(\x04\x12\r\n\x05\x66rame\x18\x03 \x03(\x04\x12\x0e\n\x06submit\x18\x04 \x03(\x04\x12\r\n\x05value\x18\x05 \x03(\x01\"\xa9\x02\n\rProfileRecord\x12)\n\x06schema\x18\x01 \x01(\x0b\x32\x19.gpulayers.profile.Schema\x12\x32\n\x0bstart_frame\x18\x02 \x01(\x0b\x32\x1d.gpulayers.profile.StartFrame\x12.\n\tend_frame\x18\x03 \x01(\x0b\x32\x1b.gpulayers.profile.EndFrame\x12\x34\n\x0c\x66rame_sample\x18\x05 \x01(\x0b\x32\x1e.gpulayers.profile.FrameSample\x12<\n\x10periodic_samples\x18\x06 \x01(\x0b\x32\".gpulayers.profile.PeriodicSamplesJ\x04\x08\x04\x10\x05R\x0fworkload_sample*\xaa\x01\n\x0cWorkloadType\x12\x14\n\x10unknown_workload\x10\x00\x12\x0f\n\x0brender_pass\x10\x01\x12\x0b\n\x07\x63ompute\x10\x02\x12\x0e\n\ndata_graph\x10\x03\x12\x0e\n\ntrace_rays\x10\x04\x12\x12\n\x0eimage_transfer\x10\x05\x12\x13\n\x0f\x62uffer_transfer\x10\x06\x12\x0c\n\x08\x61s_build\x10\x07\x12\x0f\n\x0b\x61s_transfer\x10\x08\x42\x02H\x03\x62\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'profile_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  DESCRIPTOR._serialized_options = b'H\003'
+  _WORKLOADTYPE._serialized_start=981
+  _WORKLOADTYPE._serialized_end=1151
+  _COUNTER._serialized_start=36
+  _COUNTER._serialized_end=71
+  _SCHEMA._serialized_start=74
+  _SCHEMA._serialized_end=228
+  _STARTFRAME._serialized_start=230
+  _STARTFRAME._serialized_end=287
+  _ENDFRAME._serialized_start=290
+  _ENDFRAME._serialized_end=503
+  _FRAMESAMPLE._serialized_start=505
+  _FRAMESAMPLE._serialized_end=578
+  _PERIODICSAMPLES._serialized_start=580
+  _PERIODICSAMPLES._serialized_end=678
+  _PROFILERECORD._serialized_start=681
+  _PROFILERECORD._serialized_end=978
+# @@protoc_insertion_point(module_scope)
@@ -13,7 +13,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0etimeline.proto\x12\x12gpulayers.timeline\"A\n\x06Header\x12\x37\n\nversion_no\x18\x01 \x01(\x0e\x32#.gpulayers.timeline.HeaderVersionNo\"\x83\x01\n\x0e\x44\x65viceMetadata\x12\n\n\x02id\x18\x01 \x01(\x04\x12\x12\n\nprocess_id\x18\x02 \x01(\r\x12\x15\n\rmajor_version\x18\x03 \x01(\r\x12\x15\n\rminor_version\x18\x04 \x01(\r\x12\x15\n\rpatch_version\x18\x05 \x01(\r\x12\x0c\n\x04name\x18\x06 \x01(\t\"6\n\x05\x46rame\x12\n\n\x02id\x18\x01 \x01(\x04\x12\x0e\n\x06\x64\x65vice\x18\x02 \x01(\x04\x12\x11\n\ttimestamp\x18\x03 \x01(\x04\":\n\x06Submit\x12\x11\n\ttimestamp\x18\x01 \x01(\x04\x12\x0e\n\x06\x64\x65vice\x18\x02 \x01(\x04\x12\r\n\x05queue\x18\x03 \x01(\x04\"\x9b\x01\n\x14RenderpassAttachment\x12:\n\x04type\x18\x01 \x01(\x0e\x32,.gpulayers.timeline.RenderpassAttachmentType\x12\r\n\x05index\x18\x02 \x01(\r\x12\x12\n\nnot_loaded\x18\x03 \x01(\x08\x12\x12\n\nnot_stored\x18\x04 \x01(\x08\x12\x10\n\x08resolved\x18\x05 \x01(\x08\"\xc4\x01\n\x0f\x42\x65ginRenderpass\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x17\n\x0f\x64raw_call_count\x18\x04 \x01(\r\x12\x15\n\rsubpass_count\x18\x05 \x01(\r\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x06 \x03(\t\x12=\n\x0b\x61ttachments\x18\x07 \x03(\x0b\x32(.gpulayers.timeline.RenderpassAttachment\"R\n\x12\x43ontinueRenderpass\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x17\n\x0f\x64raw_call_count\x18\x02 \x01(\r\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x03 \x03(\t\"e\n\x08\x44ispatch\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x10\n\x08x_groups\x18\x02 \x01(\x03\x12\x10\n\x08y_groups\x18\x03 \x01(\x03\x12\x10\n\x08z_groups\x18\x04 \x01(\x03\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x05 \x03(\t\"8\n\x11\x44ispatchDataGraph\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x02 \x03(\t\"c\n\tTraceRays\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x0f\n\x07x_items\x18\x02 \x01(\x03\x12\x0f\n\x07y_items\x18\x03 \x01(\x03\x12\x0f\n\x07z_items\x18\x04 \x01(\x03\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x05 \x03(\t\"\x87\x01\n\rImageTransfer\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x13\n\x0bpixel_count\x18\x02 \x01(\x03\x12<\n\rtransfer_type\x18\x03 \x01(\x0e\x32%.gpulayers.timeline.ImageTransferType\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x04 \x03(\t\"\x88\x01\n\x0e\x42ufferTransfer\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x12\n\nbyte_count\x18\x02 \x01(\x03\x12=\n\rtransfer_type\x18\x03 \x01(\x0e\x32&.gpulayers.timeline.BufferTransferType\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x04 \x03(\t\"\xa2\x01\n\x1a\x41\x63\x63\x65lerationStructureBuild\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x17\n\x0fprimitive_count\x18\x02 \x01(\x03\x12\x46\n\nbuild_type\x18\x03 \x01(\x0e\x32\x32.gpulayers.timeline.AccelerationStructureBuildType\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x04 \x03(\t\"\xa6\x01\n\x1d\x41\x63\x63\x65lerationStructureTransfer\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x12\n\nbyte_count\x18\x02 \x01(\x03\x12L\n\rtransfer_type\x18\x03 \x01(\x0e\x32\x35.gpulayers.timeline.AccelerationStructureTransferType\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x04 \x03(\t\"\x97\x06\n\x0eTimelineRecord\x12*\n\x06header\x18\x01 \x01(\x0b\x32\x1a.gpulayers.timeline.Header\x12\x34\n\x08metadata\x18\x02 \x01(\x0b\x32\".gpulayers.timeline.DeviceMetadata\x12(\n\x05\x66rame\x18\x03 \x01(\x0b\x32\x19.gpulayers.timeline.Frame\x12*\n\x06submit\x18\x04 \x01(\x0b\x32\x1a.gpulayers.timeline.Submit\x12\x37\n\nrenderpass\x18\x05 \x01(\x0b\x32#.gpulayers.timeline.BeginRenderpass\x12\x43\n\x13\x63ontinue_renderpass\x18\x06 \x01(\x0b\x32&.gpulayers.timeline.ContinueRenderpass\x12.\n\x08\x64ispatch\x18\x07 \x01(\x0b\x32\x1c.gpulayers.timeline.Dispatch\x12\x31\n\ntrace_rays\x18\x08 \x01(\x0b\x32\x1d.gpulayers.timeline.TraceRays\x12\x39\n\x0eimage_transfer\x18\t \x01(\x0b\x32!.gpulayers.timeline.ImageTransfer\x12;\n\x0f\x62uffer_transfer\x18\n \x01(\x0b\x32\".gpulayers.timeline.BufferTransfer\x12T\n\x1c\x61\x63\x63\x65leration_structure_build\x18\x0b \x01(\x0b\x32..gpulayers.timeline.AccelerationStructureBuild\x12Z\n\x1f\x61\x63\x63\x65leration_structure_transfer\x18\x0c \x01(\x0b\x32\x31.gpulayers.timeline.AccelerationStructureTransfer\x12\x42\n\x13\x64ispatch_data_graph\x18\r \x01(\x0b\x32%.gpulayers.timeline.DispatchDataGraph* \n\x0fHeaderVersionNo\x12\r\n\tversion_1\x10\x00*L\n\x18RenderpassAttachmentType\x12\r\n\tundefined\x10\x00\x12\t\n\x05\x63olor\x10\x01\x12\t\n\x05\x64\x65pth\x10\x02\x12\x0b\n\x07stencil\x10\x03*\x9e\x01\n\x11ImageTransferType\x12\x1a\n\x16unknown_image_transfer\x10\x00\x12\x0f\n\x0b\x63lear_image\x10\x01\x12\x0e\n\ncopy_image\x10\x02\x12\x18\n\x14\x63opy_buffer_to_image\x10\x03\x12\x18\n\x14\x63opy_image_to_buffer\x10\x04\x12\x18\n\x14\x63opy_memory_to_image\x10\x05*u\n\x12\x42ufferTransferType\x12\x1b\n\x17unknown_buffer_transfer\x10\x00\x12\x0f\n\x0b\x66ill_buffer\x10\x01\x12\x0f\n\x0b\x63opy_buffer\x10\x02\x12\x0f\n\x0b\x63opy_memory\x10\x03\x12\x0f\n\x0b\x63opy_tensor\x10\x04*V\n\x1e\x41\x63\x63\x65lerationStructureBuildType\x12\x14\n\x10unknown_as_build\x10\x00\x12\x0e\n\nfast_build\x10\x01\x12\x0e\n\nfast_trace\x10\x02*\xbc\x01\n!AccelerationStructureTransferType\x12\x17\n\x13unknown_as_transfer\x10\x00\x12\x14\n\x10struct_to_struct\x10\x01\x12\x11\n\rstruct_to_mem\x10\x02\x12\x11\n\rmem_to_struct\x10\x03\x12\x18\n\x14micromap_to_micromap\x10\x04\x12\x13\n\x0fmicromap_to_mem\x10\x05\x12\x13\n\x0fmem_to_micromap\x10\x06\x42\x02H\x03\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0etimeline.proto\x12\x12gpulayers.timeline\"A\n\x06Header\x12\x37\n\nversion_no\x18\x01 \x01(\x0e\x32#.gpulayers.timeline.HeaderVersionNo\"\x83\x01\n\x0e\x44\x65viceMetadata\x12\n\n\x02id\x18\x01 \x01(\x04\x12\x12\n\nprocess_id\x18\x02 \x01(\r\x12\x15\n\rmajor_version\x18\x03 \x01(\r\x12\x15\n\rminor_version\x18\x04 \x01(\r\x12\x15\n\rpatch_version\x18\x05 \x01(\r\x12\x0c\n\x04name\x18\x06 \x01(\t\"6\n\x05\x46rame\x12\n\n\x02id\x18\x01 \x01(\x04\x12\x0e\n\x06\x64\x65vice\x18\x02 \x01(\x04\x12\x11\n\ttimestamp\x18\x03 \x01(\x04\":\n\x06Submit\x12\x11\n\ttimestamp\x18\x01 \x01(\x04\x12\x0e\n\x06\x64\x65vice\x18\x02 \x01(\x04\x12\r\n\x05queue\x18\x03 \x01(\x04\"\x9b\x01\n\x14RenderpassAttachment\x12:\n\x04type\x18\x01 \x01(\x0e\x32,.gpulayers.timeline.RenderpassAttachmentType\x12\r\n\x05index\x18\x02 \x01(\r\x12\x12\n\nnot_loaded\x18\x03 \x01(\x08\x12\x12\n\nnot_stored\x18\x04 \x01(\x08\x12\x10\n\x08resolved\x18\x05 \x01(\x08\"\xc4\x01\n\x0f\x42\x65ginRenderpass\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x17\n\x0f\x64raw_call_count\x18\x04 \x01(\r\x12\x15\n\rsubpass_count\x18\x05 \x01(\r\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x06 \x03(\t\x12=\n\x0b\x61ttachments\x18\x07 \x03(\x0b\x32(.gpulayers.timeline.RenderpassAttachment\"R\n\x12\x43ontinueRenderpass\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x17\n\x0f\x64raw_call_count\x18\x02 \x01(\r\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x03 \x03(\t\"e\n\x08\x44ispatch\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x10\n\x08x_groups\x18\x02 \x01(\x03\x12\x10\n\x08y_groups\x18\x03 \x01(\x03\x12\x10\n\x08z_groups\x18\x04 \x01(\x03\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x05 \x03(\t\"8\n\x11\x44ispatchDataGraph\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x02 \x03(\t\"c\n\tTraceRays\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x0f\n\x07x_items\x18\x02 \x01(\x03\x12\x0f\n\x07y_items\x18\x03 \x01(\x03\x12\x0f\n\x07z_items\x18\x04 \x01(\x03\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x05 \x03(\t\"\x87\x01\n\rImageTransfer\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x13\n\x0bpixel_count\x18\x02 \x01(\x03\x12<\n\rtransfer_type\x18\x03 \x01(\x0e\x32%.gpulayers.timeline.ImageTransferType\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x04 \x03(\t\"\x88\x01\n\x0e\x42ufferTransfer\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x12\n\nbyte_count\x18\x02 \x01(\x03\x12=\n\rtransfer_type\x18\x03 \x01(\x0e\x32&.gpulayers.timeline.BufferTransferType\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x04 \x03(\t\"\xa2\x01\n\x1a\x41\x63\x63\x65lerationStructureBuild\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x17\n\x0fprimitive_count\x18\x02 \x01(\x03\x12\x46\n\nbuild_type\x18\x03 \x01(\x0e\x32\x32.gpulayers.timeline.AccelerationStructureBuildType\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x04 \x03(\t\"\xa6\x01\n\x1d\x41\x63\x63\x65lerationStructureTransfer\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x12\n\nbyte_count\x18\x02 \x01(\x03\x12L\n\rtransfer_type\x18\x03 \x01(\x0e\x32\x35.gpulayers.timeline.AccelerationStructureTransferType\x12\x13\n\x0b\x64\x65\x62ug_label\x18\x04 \x03(\t\"S\n\x11LabelScopeSummary\x12\r\n\x05label\x18\x01 \x01(\t\x12\x16\n\x0eworkload_count\x18\x02 \x01(\x04\x12\x17\n\x0f\x64raw_call_count\x18\x03 \x01(\x04\"\xff\x05\n\x0c\x46rameSummary\x12\n\n\x02id\x18\x01 \x01(\x04\x12\x0e\n\x06\x64\x65vice\x18\x02 \x01(\x04\x12\x17\n\x0fstart_timestamp\x18\x03 \x01(\x04\x12\x15\n\rend_timestamp\x18\x04 \x01(\x04\x12\x14\n\x0csubmit_count\x18\x05 \x01(\x04\x12\x18\n\x10renderpass_count\x18\x06 \x01(\x04\x12\x17\n\x0f\x64raw_call_count\x18\x07 \x01(\x04\x12\x16\n\x0e\x64ispatch_count\x18\x08 \x01(\x04\x12!\n\x19\x64ispatch_data_graph_count\x18\t \x01(\x04\x12\x18\n\x10trace_rays_count\x18\n \x01(\x04\x12\x1c\n\x14image_transfer_count\x18\x0b \x01(\x04\x12\x1d\n\x15\x62uffer_transfer_count\x18\x0c \x01(\x04\x12*\n\"acceleration_structure_build_count\x18\r \x01(\x04\x12-\n%acceleration_structure_transfer_count\x18\x0e \x01(\x04\x12#\n\x1brenderpass_draw_call_counts\x18\x0f \x03(\x04\x12\x1e\n\x16\x61ttachment_load_pixels\x18\x10 \x01(\x04\x12\x1f\n\x17\x61ttachment_store_pixels\x18\x11 \x01(\x04\x12\x1d\n\x15image_transfer_pixels\x18\x12 \x01(\x04\x12\x1d\n\x15\x62uffer_transfer_bytes\x18\x13 \x01(\x04\x12-\n%acceleration_structure_transfer_bytes\x18\x14 \x01(\x04\x12;\n\x0clabel_scopes\x18\x15 \x03(\x0b\x32%.gpulayers.timeline.LabelScopeSummary\x12\x12\n\nwait_count\x18\x16 \x01(\x04\x12\x11\n\twait_time\x18\x17 \x01(\x04\x12\x16\n\x0epipeline_count\x18\x18 \x01(\x04\x12\x1e\n\x16pipeline_creation_time\x18\x19 \x01(\x04\"o\n\x0eWorkloadTiming\x12\x0e\n\x06tag_id\x18\x01 \x01(\x04\x12\x0e\n\x06\x64\x65vice\x18\x02 \x01(\x04\x12\r\n\x05queue\x18\x03 \x01(\x04\x12\x17\n\x0fstart_timestamp\x18\x04 \x01(\x04\x12\x15\n\rend_timestamp\x18\x05 \x01(\x04\"\xac\x01\n\x04Wait\x12\x0e\n\x06\x64\x65vice\x18\x01 \x01(\x04\x12\r\n\x05queue\x18\x02 \x01(\x04\x12\x32\n\x08\x66unction\x18\x03 \x01(\x0e\x32 .gpulayers.timeline.WaitFunction\x12\x11\n\tthread_id\x18\x04 \x01(\r\x12\x17\n\x0fstart_timestamp\x18\x05 \x01(\x04\x12\x15\n\rend_timestamp\x18\x06 \x01(\x04\x12\x0e\n\x06result\x18\x07 \x01(\x05\"\xc5\x02\n\x10PipelineCreation\x12\x0e\n\x06\x64\x65vice\x18\x01 \x01(\x04\x12?\n\rpipeline_type\x18\x02 \x01(\x0e\x32(.gpulayers.timeline.PipelineCreationType\x12\x11\n\tthread_id\x18\x03 \x01(\r\x12\x17\n\x0fstart_timestamp\x18\x04 \x01(\x04\x12\x15\n\rend_timestamp\x18\x05 \x01(\x04\x12\x16\n\x0epipeline_count\x18\x06 \x01(\r\x12\x15\n\rlibrary_count\x18\x07 \x01(\r\x12\x12\n\nlink_count\x18\x08 \x01(\r\x12\x16\n\x0e\x66\x65\x65\x64\x62\x61\x63k_count\x18\t \x01(\r\x12\x17\n\x0f\x63\x61\x63he_hit_count\x18\n \x01(\r\x12\x19\n\x11pipeline_duration\x18\x0b \x03(\x04\x12\x0e\n\x06result\x18\x0c \x01(\x05\"\xf6\x07\n\x0eTimelineRecord\x12*\n\x06header\x18\x01 \x01(\x0b\x32\x1a.gpulayers.timeline.Header\x12\x34\n\x08metadata\x18\x02 \x01(\x0b\x32\".gpulayers.timeline.DeviceMetadata\x12(\n\x05\x66rame\x18\x03 \x01(\x0b\x32\x19.gpulayers.timeline.Frame\x12*\n\x06submit\x18\x04 \x01(\x0b\x32\x1a.gpulayers.timeline.Submit\x12\x37\n\nrenderpass\x18\x05 \x01(\x0b\x32#.gpulayers.timeline.BeginRenderpass\x12\x43\n\x13\x63ontinue_renderpass\x18\x06 \x01(\x0b\x32&.gpulayers.timeline.ContinueRenderpass\x12.\n\x08\x64ispatch\x18\x07 \x01(\x0b\x32\x1c.gpulayers.timeline.Dispatch\x12\x31\n\ntrace_rays\x18\x08 \x01(\x0b\x32\x1d.gpulayers.timeline.TraceRays\x12\x39\n\x0eimage_transfer\x18\t \x01(\x0b\x32!.gpulayers.timeline.ImageTransfer\x12;\n\x0f\x62uffer_transfer\x18\n \x01(\x0b\x32\".gpulayers.timeline.BufferTransfer\x12T\n\x1c\x61\x63\x63\x65leration_structure_build\x18\x0b \x01(\x0b\x32..gpulayers.timeline.AccelerationStructureBuild\x12Z\n\x1f\x61\x63\x63\x65leration_structure_transfer\x18\x0c \x01(\x0b\x32\x31.gpulayers.timeline.AccelerationStructureTransfer\x12\x42\n\x13\x64ispatch_data_graph\x18\r \x01(\x0b\x32%.gpulayers.timeline.DispatchDataGraph\x12\x37\n\rframe_summary\x18\x0e \x01(\x0b\x32 .gpulayers.timeline.FrameSummary\x12;\n\x0fworkload_timing\x18\x0f \x01(\x0b\x32\".gpulayers.timeline.WorkloadTiming\x12&\n\x04wait\x18\x10 \x01(\x0b\x32\x18.gpulayers.timeline.Wait\x12?\n\x11pipeline_creation\x18\x11 \x01(\x0b\x32$.gpulayers.timeline.PipelineCreation* \n\x0fHeaderVersionNo\x12\r\n\tversion_1\x10\x00*L\n\x18RenderpassAttachmentType\x12\r\n\tundefined\x10\x00\x12\t\n\x05\x63olor\x10\x01\x12\t\n\x05\x64\x65pth\x10\x02\x12\x0b\n\x07stencil\x10\x03*\x9e\x01\n\x11ImageTransferType\x12\x1a\n\x16unknown_image_transfer\x10\x00\x12\x0f\n\x0b\x63lear_image\x10\x01\x12\x0e\n\ncopy_image\x10\x02\x12\x18\n\x14\x63opy_buffer_to_image\x10\x03\x12\x18\n\x14\x63opy_image_to_buffer\x10\x04\x12\x18\n\x14\x63opy_memory_to_image\x10\x05*u\n\x12\x42ufferTransferType\x12\x1b\n\x17unknown_buffer_transfer\x10\x00\x12\x0f\n\x0b\x66ill_buffer\x10\x01\x12\x0f\n\x0b\x63opy_buffer\x10\x02\x12\x0f\n\x0b\x63opy_memory\x10\x03\x12\x0f\n\x0b\x63opy_tensor\x10\x04*V\n\x1e\x41\x63\x63\x65lerationStructureBuildType\x12\x14\n\x10unknown_as_build\x10\x00\x12\x0e\n\nfast_build\x10\x01\x12\x0e\n\nfast_trace\x10\x02*\xbc\x01\n!AccelerationStructureTransferType\x12\x17\n\x13unknown_as_transfer\x10\x00\x12\x14\n\x10struct_to_struct\x10\x01\x12\x11\n\rstruct_to_mem\x10\x02\x12\x11\n\rmem_to_struct\x10\x03\x12\x18\n\x14micromap_to_micromap\x10\x04\x12\x13\n\x0fmicromap_to_mem\x10\x05\x12\x13\n\x0fmem_to_micromap\x10\x06*\x8d\x01\n\x0cWaitFunction\x12\x10\n\x0cunknown_wait\x10\x00\x12\x13\n\x0fwait_for_fences\x10\x01\x12\x13\n\x0fwait_semaphores\x10\x02\x12\x16\n\x12\x61\x63quire_next_image\x10\x03\x12\x13\n\x0fqueue_wait_idle\x10\x04\x12\x14\n\x10\x64\x65vice_wait_idle\x10\x05*s\n\x14PipelineCreationType\x12\x14\n\x10unknown_pipeline\x10\x00\x12\x15\n\x11graphics_pipeline\x10\x01\x12\x14\n\x10\x63ompute_pipeline\x10\x02\x12\x18\n\x14ray_tracing_pipeline\x10\x03\x42\x02H\x03\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'timeline_pb2', globals())
@@ -21,18 +21,22 @@ if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
   DESCRIPTOR._serialized_options = b'H\003'
-  _HEADERVERSIONNO._serialized_start=2463
-  _HEADERVERSIONNO._serialized_end=2495
-  _RENDERPASSATTACHMENTTYPE._serialized_start=2497
-  _RENDERPASSATTACHMENTTYPE._serialized_end=2573
-  _IMAGETRANSFERTYPE._serialized_start=2576
-  _IMAGETRANSFERTYPE._serialized_end=2734
-  _BUFFERTRANSFERTYPE._serialized_start=2736
-  _BUFFERTRANSFERTYPE._serialized_end=2853
-  _ACCELERATIONSTRUCTUREBUILDTYPE._serialized_start=2855
-  _ACCELERATIONSTRUCTUREBUILDTYPE._serialized_end=2941
-  _ACCELERATIONSTRUCTURETRANSFERTYPE._serialized_start=2944
-  _ACCELERATIONSTRUCTURETRANSFERTYPE._serialized_end=3132
+  _HEADERVERSIONNO._serialized_start=4157
+  _HEADERVERSIONNO._serialized_end=4189
+  _RENDERPASSATTACHMENTTYPE._serialized_start=4191
+  _RENDERPASSATTACHMENTTYPE._serialized_end=4267
+  _IMAGETRANSFERTYPE._serialized_start=4270
+  _IMAGETRANSFERTYPE._serialized_end=4428
+  _BUFFERTRANSFERTYPE._serialized_start=4430
+  _BUFFERTRANSFERTYPE._serialized_end=4547
+  _ACCELERATIONSTRUCTUREBUILDTYPE._serialized_start=4549
+  _ACCELERATIONSTRUCTUREBUILDTYPE._serialized_end=4635
+  _ACCELERATIONSTRUCTURETRANSFERTYPE._serialized_start=4638
+  _ACCELERATIONSTRUCTURETRANSFERTYPE._serialized_end=4826
+  _WAITFUNCTION._serialized_start=4829
+  _WAITFUNCTION._serialized_end=4970
+  _PIPELINECREATIONTYPE._serialized_start=4972
+  _PIPELINECREATIONTYPE._serialized_end=5087
   _HEADER._serialized_start=38
   _HEADER._serialized_end=103
   _DEVICEMETADATA._serialized_start=106
@@ -61,6 +65,16 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _ACCELERATIONSTRUCTUREBUILD._serialized_end=1498
   _ACCELERATIONSTRUCTURETRANSFER._serialized_start=1501
   _ACCELERATIONSTRUCTURETRANSFER._serialized_end=1667
-  _TIMELINERECORD._serialized_start=1670
-  _TIMELINERECORD._serialized_end=2461
+  _LABELSCOPESUMMARY._serialized_start=1669
+  _LABELSCOPESUMMARY._serialized_end=1752
+  _FRAMESUMMARY._serialized_start=1755
+  _FRAMESUMMARY._serialized_end=2522
+  _WORKLOADTIMING._serialized_start=2524
+  _WORKLOADTIMING._serialized_end=2635
+  _WAIT._serialized_start=2638
+  _WAIT._serialized_end=2810
+  _PIPELINECREATION._serialized_start=2813
+  _PIPELINECREATION._serialized_end=3138
+  _TIMELINERECORD._serialized_start=3141
+  _TIMELINERECORD._serialized_end=4155
 # @@protoc_insertion_point(module_scope)
@@ -0,0 +1,159 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Implements a memoization cache for physical device image format queries.
+ */
+
+#include "framework/image_format_cache.hpp"
+
+#include "framework/utils.hpp"
+
+#include <cinttypes>
+#include <functional>
+
+/* See header for documentation. */
+ImageFormatCache::ImageFormatCache(
+    PFN_vkGetPhysicalDeviceImageFormatProperties2 query,
+    bool _queryCompression
+) :
+    driverQuery(query),
+    queryCompression(_queryCompression)
+{
+}
+
+/* See header for documentation. */
+ImageFormatCache::~ImageFormatCache()
+{
+    LAYER_LOG("Image format cache: %" PRIu64 " hits, %" PRIu64 " misses",
+              hitCount, missCount);
+}
+
+/* See header for documentation. */
+size_t ImageFormatCache::KeyHash::operator()(
+    const Key& key
+) const {
+    uint64_t hash = std::hash<void*>{}(reinterpret_cast<void*>(key.physicalDevice));
+    for (uint64_t value : { static_cast<uint64_t>(key.format),
+                            static_cast<uint64_t>(key.type),
+                            static_cast<uint64_t>(key.tiling),
+                            static_cast<uint64_t>(key.usage),
+                            static_cast<uint64_t>(key.flags) })
+    {
+        hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+    }
+
+    return static_cast<size_t>(hash);
+}
+
+/* See header for documentation. */
+ImageFormatCache::Entry ImageFormatCache::lookup(
+    VkPhysicalDevice physicalDevice,
+    VkFormat format,
+    VkImageType type,
+    VkImageTiling tiling,
+    VkImageUsageFlags usage,
+    VkImageCreateFlags flags
+) {
+    Key key { physicalDevice, format, type, tiling, usage, flags };
+
+    std::unique_lock<std::mutex> cacheLock {lock};
+    auto it = entries.find(key);
+    if (it != entries.end())
+    {
+        hitCount++;
+        return it->second;
+    }
+
+    missCount++;
+
+    // Release the lock to call into the driver
+    cacheLock.unlock();
+    Entry entry = query(key);
+
+    cacheLock.lock();
+    entries.try_emplace(key, entry);
+    return entry;
+}
+
+/* See header for documentation. */
+uint64_t ImageFormatCache::getHitCount() const
+{
+    std::lock_guard<std::mutex> cacheLock {lock};
+    return hitCount;
+}
+
+/* See header for documentation. */
+uint64_t ImageFormatCache::getMissCount() const
+{
+    std::lock_guard<std::mutex> cacheLock {lock};
+    return missCount;
+}
+
+/* See header for documentation. */
+ImageFormatCache::Entry ImageFormatCache::query(
+    const Key& key
+) const {
+    VkImageCompressionControlEXT compressionInfo {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT,
+        .pNext = nullptr,
+        .flags = VK_IMAGE_COMPRESSION_FIXED_RATE_DEFAULT_EXT,
+        .compressionControlPlaneCount = 0,
+        .pFixedRateFlags = nullptr,
+    };
+
+    VkImageCompressionPropertiesEXT compressionProperties {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT,
+        .pNext = nullptr,
+        .imageCompressionFlags = 0,
+        .imageCompressionFixedRateFlags = 0,
+    };
+
+    VkPhysicalDeviceImageFormatInfo2 formatInfo {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2,
+        .pNext = queryCompression ? reinterpret_cast<const void*>(&compressionInfo) : nullptr,
+        .format = key.format,
+        .type = key.type,
+        .tiling = key.tiling,
+        .usage = key.usage,
+        .flags = key.flags,
+    };
+
+    VkImageFormatProperties2 formatProperties {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2,
+        .pNext = queryCompression ? reinterpret_cast<void*>(&compressionProperties) : nullptr,
+        .imageFormatProperties = {},
+    };
+
+    VkResult result = driverQuery(key.physicalDevice, &formatInfo, &formatProperties);
+
+    return {
+        .result = result,
+        .properties = formatProperties.imageFormatProperties,
+        .compressionFlags = compressionProperties.imageCompressionFlags,
+        .compressionFixedRateFlags = compressionProperties.imageCompressionFixedRateFlags,
+    };
+}
@@ -0,0 +1,204 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares a memoization cache for physical device image format queries.
+ *
+ * Results of vkGetPhysicalDeviceImageFormatProperties2() depend only on the
+ * physical device and the image format info, so layers that query them on
+ * every resource creation can use this cache to skip the driver round-trip.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief Cache of image format properties, keyed by physical device.
+ *
+ * This cache is thread-safe, and can be accessed without holding the layer
+ * global lock. Concurrent misses on the same key may query the driver more
+ * than once, but will always store the same result.
+ */
+class ImageFormatCache
+{
+public:
+    /**
+     * @brief The cached result of a single format query.
+     */
+    struct Entry
+    {
+        /**
+         * @brief The return code of the query.
+         */
+        VkResult result;
+
+        /**
+         * @brief The core image format properties.
+         */
+        VkImageFormatProperties properties;
+
+        /**
+         * @brief The supported compression flags, if compression was queried.
+         */
+        VkImageCompressionFlagsEXT compressionFlags;
+
+        /**
+         * @brief The supported fixed-rate compression ratios, if compression was queried.
+         */
+        VkImageCompressionFixedRateFlagsEXT compressionFixedRateFlags;
+    };
+
+    /**
+     * @brief Create a new cache.
+     *
+     * @param query                The driver vkGetPhysicalDeviceImageFormatProperties2() function.
+     * @param queryCompression     @c true if queries should include the
+     *                             VK_EXT_image_compression_control properties.
+     */
+    ImageFormatCache(
+        PFN_vkGetPhysicalDeviceImageFormatProperties2 query,
+        bool queryCompression);
+
+    /**
+     * @brief Destroy the cache, logging the cache statistics.
+     */
+    ~ImageFormatCache();
+
+    /**
+     * @brief Get the format properties for an image configuration.
+     *
+     * @param physicalDevice   The physical device to query.
+     * @param format           The image format.
+     * @param type             The image type.
+     * @param tiling           The image tiling.
+     * @param usage            The image usage flags.
+     * @param flags            The image create flags.
+     *
+     * @return The cached query result.
+     */
+    Entry lookup(
+        VkPhysicalDevice physicalDevice,
+        VkFormat format,
+        VkImageType type,
+        VkImageTiling tiling,
+        VkImageUsageFlags usage,
+        VkImageCreateFlags flags);
+
+    /**
+     * @brief Get the format properties for an image create info.
+     *
+     * @param physicalDevice   The physical device to query.
+     * @param createInfo       The image configuration to query.
+     *
+     * @return The cached query result.
+     */
+    Entry lookup(
+        VkPhysicalDevice physicalDevice,
+        const VkImageCreateInfo& createInfo)
+    {
+        return lookup(physicalDevice, createInfo.format, createInfo.imageType,
+                      createInfo.tiling, createInfo.usage, createInfo.flags);
+    }
+
+    /**
+     * @brief Get the number of lookups served from the cache.
+     */
+    uint64_t getHitCount() const;
+
+    /**
+     * @brief Get the number of lookups that queried the driver.
+     */
+    uint64_t getMissCount() const;
+
+private:
+    /**
+     * @brief The lookup key for a single query.
+     */
+    struct Key
+    {
+        VkPhysicalDevice physicalDevice;
+        VkFormat format;
+        VkImageType type;
+        VkImageTiling tiling;
+        VkImageUsageFlags usage;
+        VkImageCreateFlags flags;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    /**
+     * @brief Hash function for the lookup key.
+     */
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    /**
+     * @brief Query the driver for an uncached key.
+     *
+     * @param key   The configuration to query.
+     *
+     * @return The query result.
+     */
+    Entry query(
+        const Key& key) const;
+
+    /**
+     * @brief The driver query function.
+     */
+    PFN_vkGetPhysicalDeviceImageFormatProperties2 driverQuery;
+
+    /**
+     * @brief @c true if the compression properties are queried.
+     */
+    bool queryCompression;
+
+    /**
+     * @brief Lock protecting the cache contents and statistics.
+     */
+    mutable std::mutex lock;
+
+    /**
+     * @brief The cached entries.
+     */
+    std::unordered_map<Key, Entry, KeyHash> entries;
+
+    /**
+     * @brief The number of lookups served from the cache.
+     */
+    uint64_t hitCount {0};
+
+    /**
+     * @brief The number of lookups that queried the driver.
+     */
+    uint64_t missCount {0};
+};
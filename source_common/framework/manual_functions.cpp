@@ -530,6 +530,74 @@ void enableDeviceVkExtImageCompressionControl(Instance& instance,
     }
 }
 
+/* See header for documentation. */
+void enableDeviceVkKhrSynchronization2(Instance& instance,
+                                       VkPhysicalDevice physicalDevice,
+                                       vku::safe_VkDeviceCreateInfo& createInfo,
+                                       std::vector<std::string>& supported)
+{
+    UNUSED(instance);
+    UNUSED(physicalDevice);
+
+    static const std::string target {VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME};
+
+    // We know we can const-cast here because createInfo is a safe-struct clone
+    void* pNextBase = const_cast<void*>(createInfo.pNext);
+
+    VkPhysicalDeviceSynchronization2Features newFeatures = vku::InitStructHelper();
+
+    // Test if the desired extension is supported
+    if (!isIn(target, supported))
+    {
+        LAYER_LOG("Device extension not available: %s", target.c_str());
+        return;
+    }
+
+    // Enable the extension - this will skip adding if already enabled
+    if (vku::AddExtension(createInfo, target.c_str()))
+    {
+        LAYER_LOG("Device extension added: %s", target.c_str());
+    }
+
+    // Check if user provided a VkPhysicalDeviceSynchronization2Features
+    auto* config1 = vku::FindStructInPNextChain<VkPhysicalDeviceSynchronization2Features>(pNextBase);
+    if (config1)
+    {
+        if (!config1->synchronization2)
+        {
+            LAYER_LOG("Device extension force enabled: %s", target.c_str());
+            config1->synchronization2 = true;
+        }
+        else
+        {
+            LAYER_LOG("Device extension already enabled: %s", target.c_str());
+        }
+    }
+
+    // Check if user provided a VkPhysicalDeviceVulkan13Features
+    auto* config2 = vku::FindStructInPNextChain<VkPhysicalDeviceVulkan13Features>(pNextBase);
+    if (config2)
+    {
+        if (!config2->synchronization2)
+        {
+            LAYER_LOG("Device extension force enabled: %s", target.c_str());
+            config2->synchronization2 = true;
+        }
+        else
+        {
+            LAYER_LOG("Device extension already enabled: %s", target.c_str());
+        }
+    }
+
+    // Add a config if not configured by the application
+    if (!config1 && !config2)
+    {
+        newFeatures.synchronization2 = true;
+        vku::AddToPnext(createInfo, newFeatures);
+        LAYER_LOG("Device extension config added: %s", target.c_str());
+    }
+}
+
 /* See header for documentation. */
 void emulateDeviceVkExtFrameBoundary(Instance& instance,
                                      VkPhysicalDevice physicalDevice,
@@ -1138,7 +1206,12 @@ VKAPI_ATTR void VKAPI_CALL layer_vkDestroyDevice<default_tag>(VkDevice device, c
 
     // Release the lock to call into the driver
     lock.unlock();
-    layer->driver.vkDestroyDevice(device, pAllocator);
+
+    // Destroy the layer device before the driver device, so that any
+    // layer-owned driver objects can be released in the destructor
+    auto fpDestroyDevice = layer->driver.vkDestroyDevice;
+    layer.reset();
+    fpDestroyDevice(device, pAllocator);
 }
 
 /* See Vulkan API for documentation. */
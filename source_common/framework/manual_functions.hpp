@@ -232,6 +232,26 @@ void enableDeviceVkExtImageCompressionControl(Instance& instance,
                                               vku::safe_VkDeviceCreateInfo& createInfo,
                                               std::vector<std::string>& supported);
 
+/**
+ * Enable VK_KHR_synchronization2 if not enabled.
+ *
+ * Enabling this requires passing the extension string to vkCreateDevice(),
+ * and passing either VkPhysicalDeviceSynchronization2Features or
+ * VkPhysicalDeviceVulkan13Features with the feature enabled.
+ *
+ * If the user has the extension enabled but the feature disabled we patch
+ * their existing structures to enable it.
+ *
+ * @param instance         The layer instance we are running within.
+ * @param physicalDevice   The physical device we are creating a device for.
+ * @param createInfo       The createInfo we can search to find user config.
+ * @param supported        The list of supported extensions.
+ */
+void enableDeviceVkKhrSynchronization2(Instance& instance,
+                                       VkPhysicalDevice physicalDevice,
+                                       vku::safe_VkDeviceCreateInfo& createInfo,
+                                       std::vector<std::string>& supported);
+
 /**
  * Hide VK_EXT_frame_boundary if emulated on top of the driver.
  *
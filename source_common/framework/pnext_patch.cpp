@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Implements utilities for patching Vulkan pNext chains without heap allocation.
+ */
+
+#include "framework/pnext_patch.hpp"
+
+/* See header for documentation. */
+size_t getPNextStructSize(VkStructureType sType)
+{
+    switch (sType)
+    {
+    // Image creation
+    case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+        return sizeof(VkExternalMemoryImageCreateInfo);
+    case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT:
+        return sizeof(VkImageCompressionControlEXT);
+    case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT:
+        return sizeof(VkImageDrmFormatModifierExplicitCreateInfoEXT);
+    case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT:
+        return sizeof(VkImageDrmFormatModifierListCreateInfoEXT);
+    case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
+        return sizeof(VkImageFormatListCreateInfo);
+    case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+        return sizeof(VkImageStencilUsageCreateInfo);
+    case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+        return sizeof(VkImageSwapchainCreateInfoKHR);
+    case VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT:
+        return sizeof(VkOpaqueCaptureDescriptorDataCreateInfoEXT);
+    case VK_STRUCTURE_TYPE_VIDEO_PROFILE_LIST_INFO_KHR:
+        return sizeof(VkVideoProfileListInfoKHR);
+    // Queue submission
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
+        return sizeof(VkDeviceGroupSubmitInfo);
+    case VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT:
+        return sizeof(VkFrameBoundaryEXT);
+    case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR:
+        return sizeof(VkPerformanceQuerySubmitInfoKHR);
+    case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
+        return sizeof(VkProtectedSubmitInfo);
+    case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO:
+        return sizeof(VkTimelineSemaphoreSubmitInfo);
+    default:
+        return 0;
+    }
+}
+
+/* See header for documentation. */
+VkBaseOutStructure* clonePNextStruct(StackArena& arena, const VkBaseInStructure* base)
+{
+    size_t size = getPNextStructSize(base->sType);
+    if (!size)
+    {
+        return nullptr;
+    }
+
+    void* copy = arena.allocateBytes(size, alignof(std::max_align_t));
+    std::memcpy(copy, base, size);
+    return static_cast<VkBaseOutStructure*>(copy);
+}
+
+/* See header for documentation. */
+VkBaseOutStructure* clonePNextPath(StackArena& arena, const void*& pNext, VkStructureType sType)
+{
+    // Check the whole path can be cloned before modifying anything
+    auto* node = static_cast<const VkBaseInStructure*>(pNext);
+    while (node && node->sType != sType)
+    {
+        if (!getPNextStructSize(node->sType))
+        {
+            return nullptr;
+        }
+
+        node = node->pNext;
+    }
+
+    if (!node || !getPNextStructSize(node->sType))
+    {
+        return nullptr;
+    }
+
+    // Clone the path, linking each copy to the next original structure
+    VkBaseOutStructure* prev {nullptr};
+    node = static_cast<const VkBaseInStructure*>(pNext);
+    while (true)
+    {
+        auto* copy = clonePNextStruct(arena, node);
+        if (prev)
+        {
+            prev->pNext = copy;
+        }
+        else
+        {
+            pNext = copy;
+        }
+
+        if (copy->sType == sType)
+        {
+            return copy;
+        }
+
+        prev = copy;
+        node = node->pNext;
+    }
+}
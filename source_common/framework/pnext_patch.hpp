@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares utilities for patching Vulkan pNext chains without heap allocation.
+ *
+ * Layers that add or modify an extension structure in an application pNext
+ * chain cannot write to the application's structures. Rather than deep copy
+ * the whole create info, these utilities shallow copy only the structures
+ * that need to change into a per-call stack arena. Structures that are not
+ * modified are shared with the application chain.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief A per-call bump allocator for patched Vulkan structures.
+ *
+ * Typical patches are stored in stack storage, falling back to the heap for
+ * unusually large patches. All allocations are freed when the arena is
+ * destroyed, so an arena must outlive the driver call that uses it.
+ */
+class StackArena
+{
+public:
+    /**
+     * @brief Allocate uninitialized storage.
+     *
+     * @param bytes       The number of bytes to allocate.
+     * @param alignment   The required alignment, which must be a power of two.
+     */
+    void* allocateBytes(size_t bytes, size_t alignment)
+    {
+        size_t offset = (used + alignment - 1) & ~(alignment - 1);
+        if (offset + bytes <= storage.size())
+        {
+            used = offset + bytes;
+            return storage.data() + offset;
+        }
+
+        auto& block = overflow.emplace_back(std::make_unique<std::byte[]>(bytes));
+        return block.get();
+    }
+
+    /**
+     * @brief Allocate an uninitialized array.
+     *
+     * @param count   The number of elements.
+     */
+    template<typename T>
+    T* allocate(size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+
+        return static_cast<T*>(allocateBytes(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * @brief Copy an array, reserving space for extra elements at the end.
+     *
+     * @param data    The array to copy, may be null if @c count is zero.
+     * @param count   The number of elements to copy.
+     * @param extra   The number of extra elements to reserve.
+     */
+    template<typename T>
+    T* copy(const T* data, size_t count, size_t extra)
+    {
+        T* result = allocate<T>(count + extra);
+        if (count)
+        {
+            std::memcpy(result, data, sizeof(T) * count);
+        }
+
+        return result;
+    }
+
+private:
+    /**
+     * @brief The stack storage.
+     */
+    alignas(std::max_align_t) std::array<std::byte, 2048> storage;
+
+    /**
+     * @brief The number of bytes of stack storage used.
+     */
+    size_t used {0};
+
+    /**
+     * @brief Heap storage used when the stack storage is full.
+     */
+    std::vector<std::unique_ptr<std::byte[]>> overflow;
+};
+
+/**
+ * @brief Get the size of a structure that can be cloned from a pNext chain.
+ *
+ * @param sType   The structure type.
+ *
+ * @return The size in bytes, or zero if the structure type is not supported.
+ */
+size_t getPNextStructSize(VkStructureType sType);
+
+/**
+ * @brief Shallow copy a single structure from a pNext chain into an arena.
+ *
+ * The copy keeps the original pNext pointer, and any arrays it references
+ * are shared with the original structure.
+ *
+ * @param arena   The arena to copy into.
+ * @param base    The structure to copy.
+ *
+ * @return The copy, or @c nullptr if the structure type is not supported.
+ */
+VkBaseOutStructure* clonePNextStruct(StackArena& arena, const VkBaseInStructure* base);
+
+/**
+ * @brief Prepend a structure to a pNext chain.
+ *
+ * @param arena   The arena to copy the new structure into.
+ * @param pNext   The pNext field of a structure owned by the caller.
+ * @param ext     The structure to add, which must not already be in the chain.
+ *
+ * @return The copy of the structure that was added to the chain.
+ */
+template<typename T>
+T* prependPNextStruct(StackArena& arena, const void*& pNext, const T& ext)
+{
+    T* copy = arena.copy(&ext, 1, 0);
+    copy->pNext = const_cast<void*>(pNext);
+    pNext = copy;
+    return copy;
+}
+
+/**
+ * @brief Make a structure in a pNext chain writable.
+ *
+ * The structure, and all of the structures before it in the chain, are
+ * cloned into the arena. Structures after it are shared with the original
+ * chain. If the chain cannot be patched it is left unmodified.
+ *
+ * @param arena   The arena to copy the modified structures into.
+ * @param pNext   The pNext field of a structure owned by the caller.
+ * @param sType   The structure type to find.
+ *
+ * @return The writable copy, or @c nullptr if the structure was not found or
+ *         a structure before it is not supported by @c clonePNextStruct().
+ */
+VkBaseOutStructure* clonePNextPath(StackArena& arena, const void*& pNext, VkStructureType sType);
+
+/**
+ * @brief Make a structure in a pNext chain writable.
+ *
+ * @param arena   The arena to copy the modified structures into.
+ * @param pNext   The pNext field of a structure owned by the caller.
+ * @param sType   The structure type of @c T.
+ *
+ * @return The writable copy, or @c nullptr if the structure was not found or
+ *         the chain cannot be patched.
+ */
+template<typename T>
+T* clonePNextPath(StackArena& arena, const void*& pNext, VkStructureType sType)
+{
+    return reinterpret_cast<T*>(clonePNextPath(arena, pNext, sType));
+}
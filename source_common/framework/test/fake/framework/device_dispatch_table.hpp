@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * A fake device dispatch table for framework unit tests.
+ *
+ * The real dispatch table header builds the layer intercept table, which
+ * needs a layer-specific Device implementation. Framework components that
+ * only call into the driver are tested against this subset of the table.
+ */
+
+#pragma once
+
+#include "framework/utils.hpp"
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief The subset of the device dispatch table used by tested components.
+ */
+struct DeviceDispatchTable
+{
+    PFN_vkCreateFence vkCreateFence;
+    PFN_vkCreateQueryPool vkCreateQueryPool;
+    PFN_vkDestroyFence vkDestroyFence;
+    PFN_vkDestroyQueryPool vkDestroyQueryPool;
+    PFN_vkGetFenceStatus vkGetFenceStatus;
+    PFN_vkGetQueryPoolResults vkGetQueryPoolResults;
+    PFN_vkQueueSubmit vkQueueSubmit;
+    PFN_vkResetFences vkResetFences;
+    PFN_vkWaitForFences vkWaitForFences;
+};
@@ -0,0 +1,287 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The implementation of the pNext chain patching unit tests.
+ */
+#include "framework/pnext_patch.hpp"
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+/**
+ * @brief Test if a pointer is inside the stack storage of an arena.
+ */
+static bool isInArena(const StackArena& arena, const void* ptr)
+{
+    auto* start = reinterpret_cast<const std::byte*>(&arena);
+    auto* end = start + sizeof(arena);
+    auto* data = static_cast<const std::byte*>(ptr);
+    return data >= start && data < end;
+}
+
+/** @brief Test that supported structures report their size. */
+TEST(PNextPatch, test_struct_size)
+{
+    EXPECT_EQ(getPNextStructSize(VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO),
+              sizeof(VkTimelineSemaphoreSubmitInfo));
+    EXPECT_EQ(getPNextStructSize(VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT), sizeof(VkFrameBoundaryEXT));
+    EXPECT_EQ(getPNextStructSize(VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO), sizeof(VkImageFormatListCreateInfo));
+
+    // Unsupported structures cannot be cloned
+    EXPECT_EQ(getPNextStructSize(VK_STRUCTURE_TYPE_APPLICATION_INFO), 0u);
+}
+
+/** @brief Test cloning the structure at the head of a chain. */
+TEST(PNextPatch, test_clone_path_head)
+{
+    VkProtectedSubmitInfo protectedInfo {};
+    protectedInfo.sType = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo {};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.pNext = &protectedInfo;
+    timelineInfo.waitSemaphoreValueCount = 1;
+
+    StackArena arena;
+    const void* pNext = &timelineInfo;
+    auto* copy = clonePNextPath<VkTimelineSemaphoreSubmitInfo>(arena,
+                                                               pNext,
+                                                               VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_NE(copy, &timelineInfo);
+    EXPECT_EQ(pNext, copy);
+    EXPECT_EQ(copy->waitSemaphoreValueCount, 1u);
+
+    // Structures after the target are shared with the original chain
+    EXPECT_EQ(copy->pNext, &protectedInfo);
+
+    // The original structure is not modified
+    copy->waitSemaphoreValueCount = 2;
+    EXPECT_EQ(timelineInfo.waitSemaphoreValueCount, 1u);
+    EXPECT_EQ(timelineInfo.pNext, &protectedInfo);
+}
+
+/** @brief Test cloning a structure in the middle of a chain. */
+TEST(PNextPatch, test_clone_path_middle)
+{
+    VkProtectedSubmitInfo protectedInfo {};
+    protectedInfo.sType = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo {};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.pNext = &protectedInfo;
+
+    VkFrameBoundaryEXT frameInfo {};
+    frameInfo.sType = VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT;
+    frameInfo.pNext = &timelineInfo;
+    frameInfo.frameID = 42;
+
+    StackArena arena;
+    const void* pNext = &frameInfo;
+    auto* copy = clonePNextPath<VkTimelineSemaphoreSubmitInfo>(arena,
+                                                               pNext,
+                                                               VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_NE(copy, &timelineInfo);
+    EXPECT_EQ(copy->pNext, &protectedInfo);
+
+    // Structures before the target are cloned to link to the copy
+    auto* frameCopy = static_cast<const VkFrameBoundaryEXT*>(pNext);
+    ASSERT_NE(frameCopy, nullptr);
+    EXPECT_NE(frameCopy, &frameInfo);
+    EXPECT_EQ(frameCopy->sType, VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT);
+    EXPECT_EQ(frameCopy->frameID, 42u);
+    EXPECT_EQ(frameCopy->pNext, copy);
+
+    // The original chain is not modified
+    EXPECT_EQ(frameInfo.pNext, &timelineInfo);
+    EXPECT_EQ(timelineInfo.pNext, &protectedInfo);
+}
+
+/** @brief Test that a missing structure is not cloned. */
+TEST(PNextPatch, test_clone_path_missing)
+{
+    VkProtectedSubmitInfo protectedInfo {};
+    protectedInfo.sType = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
+
+    StackArena arena;
+    const void* pNext = &protectedInfo;
+    EXPECT_EQ(clonePNextPath(arena, pNext, VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO), nullptr);
+    EXPECT_EQ(pNext, &protectedInfo);
+
+    pNext = nullptr;
+    EXPECT_EQ(clonePNextPath(arena, pNext, VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO), nullptr);
+    EXPECT_EQ(pNext, nullptr);
+}
+
+/** @brief Test that a chain with an unsupported structure is not modified. */
+TEST(PNextPatch, test_clone_path_unknown)
+{
+    VkTimelineSemaphoreSubmitInfo timelineInfo {};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+
+    // Use a structure type that clonePNextStruct() does not know the size of
+    VkBaseInStructure unknownInfo {};
+    unknownInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    unknownInfo.pNext = reinterpret_cast<const VkBaseInStructure*>(&timelineInfo);
+
+    StackArena arena;
+    const void* pNext = &unknownInfo;
+    EXPECT_EQ(clonePNextPath(arena, pNext, VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO), nullptr);
+    EXPECT_EQ(pNext, &unknownInfo);
+    EXPECT_EQ(unknownInfo.pNext, reinterpret_cast<const VkBaseInStructure*>(&timelineInfo));
+
+    // An unsupported target structure cannot be cloned either
+    EXPECT_EQ(clonePNextPath(arena, pNext, VK_STRUCTURE_TYPE_APPLICATION_INFO), nullptr);
+    EXPECT_EQ(pNext, &unknownInfo);
+}
+
+/** @brief Test prepending a structure to a chain. */
+TEST(PNextPatch, test_prepend)
+{
+    VkProtectedSubmitInfo protectedInfo {};
+    protectedInfo.sType = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo {};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.signalSemaphoreValueCount = 3;
+
+    StackArena arena;
+    const void* pNext = &protectedInfo;
+    auto* copy = prependPNextStruct(arena, pNext, timelineInfo);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_NE(copy, &timelineInfo);
+    EXPECT_EQ(pNext, copy);
+    EXPECT_EQ(copy->pNext, &protectedInfo);
+    EXPECT_EQ(copy->signalSemaphoreValueCount, 3u);
+
+    // The template structure is not modified
+    EXPECT_EQ(timelineInfo.pNext, nullptr);
+}
+
+/** @brief Test that arena allocations are aligned and use stack storage. */
+TEST(PNextPatch, test_arena_alignment)
+{
+    StackArena arena;
+
+    auto* bytes = arena.allocate<uint8_t>(3);
+    auto* words = arena.allocate<uint64_t>(4);
+    EXPECT_TRUE(isInArena(arena, bytes));
+    EXPECT_TRUE(isInArena(arena, words));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(words) % alignof(uint64_t), 0u);
+    EXPECT_GE(reinterpret_cast<uintptr_t>(words), reinterpret_cast<uintptr_t>(bytes + 3));
+}
+
+/** @brief Test copying an array with extra space reserved. */
+TEST(PNextPatch, test_arena_copy)
+{
+    StackArena arena;
+
+    const uint32_t source[3] {1, 2, 3};
+    auto* copy = arena.copy(source, 3, 2);
+    copy[3] = 4;
+    copy[4] = 5;
+
+    EXPECT_NE(copy, source);
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(copy[i], i + 1);
+    }
+
+    // Empty arrays may be null
+    EXPECT_NE(arena.copy<uint32_t>(nullptr, 0, 1), nullptr);
+}
+
+/** @brief Test that large allocations overflow to the heap. */
+TEST(PNextPatch, test_arena_overflow)
+{
+    StackArena arena;
+
+    // Fill most of the stack storage
+    auto* first = arena.allocate<uint64_t>(200);
+    EXPECT_TRUE(isInArena(arena, first));
+
+    // Allocations that do not fit use the heap
+    auto* second = arena.allocate<uint64_t>(200);
+    auto* third = arena.allocate<uint64_t>(1024);
+    EXPECT_FALSE(isInArena(arena, second));
+    EXPECT_FALSE(isInArena(arena, third));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % alignof(uint64_t), 0u);
+
+    // Smaller allocations can still use the remaining stack storage
+    auto* fourth = arena.allocate<uint64_t>(8);
+    EXPECT_TRUE(isInArena(arena, fourth));
+
+    // All allocations are independently writable
+    for (uint64_t i = 0; i < 200; i++)
+    {
+        first[i] = i;
+        second[i] = i + 1000;
+    }
+
+    for (uint64_t i = 0; i < 1024; i++)
+    {
+        third[i] = i + 2000;
+    }
+
+    for (uint64_t i = 0; i < 200; i++)
+    {
+        EXPECT_EQ(first[i], i);
+        EXPECT_EQ(second[i], i + 1000);
+    }
+
+    EXPECT_EQ(third[1023], 3023u);
+}
+
+/** @brief Test that patches larger than the stack storage are cloned. */
+TEST(PNextPatch, test_clone_path_overflow)
+{
+    StackArena arena;
+
+    // Fill the stack storage so that clones must use the heap
+    arena.allocate<std::byte>(2048);
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo {};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.waitSemaphoreValueCount = 7;
+
+    VkFrameBoundaryEXT frameInfo {};
+    frameInfo.sType = VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT;
+    frameInfo.pNext = &timelineInfo;
+
+    const void* pNext = &frameInfo;
+    auto* copy = clonePNextPath<VkTimelineSemaphoreSubmitInfo>(arena,
+                                                               pNext,
+                                                               VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_FALSE(isInArena(arena, copy));
+    EXPECT_FALSE(isInArena(arena, pNext));
+    EXPECT_EQ(copy->waitSemaphoreValueCount, 7u);
+    EXPECT_EQ(static_cast<const VkFrameBoundaryEXT*>(pNext)->pNext, copy);
+    EXPECT_EQ(frameInfo.pNext, &timelineInfo);
+}
@@ -0,0 +1,613 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The implementation of the GPU timestamp query manager unit tests.
+ */
+#include "framework/timestamp_queries.hpp"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+/**
+ * @brief The state of the fake driver device.
+ */
+struct FakeDevice
+{
+    /**
+     * @brief The number of live fences.
+     */
+    uint32_t fenceCount {0};
+
+    /**
+     * @brief The number of live query pools.
+     */
+    uint32_t queryPoolCount {0};
+
+    /**
+     * @brief The fences that have signaled.
+     */
+    std::unordered_set<VkFence> signaledFences;
+
+    /**
+     * @brief The fences submitted to a queue, in submit order.
+     */
+    std::vector<VkFence> submittedFences;
+
+    /**
+     * @brief The values of written queries, keyed by pool and index.
+     */
+    std::map<std::pair<VkQueryPool, uint32_t>, uint64_t> queryValues;
+
+    /**
+     * @brief The result returned by vkQueueSubmit.
+     */
+    VkResult submitResult {VK_SUCCESS};
+
+    /**
+     * @brief Signal fences in vkWaitForFences to emulate GPU completion.
+     */
+    bool signalOnWait {true};
+};
+
+static FakeDevice g_fake;
+
+/**
+ * @brief Create a unique fake non-dispatchable or dispatchable handle.
+ */
+template<typename T>
+T createHandle()
+{
+    static uint64_t nextHandle {1};
+    return reinterpret_cast<T>(static_cast<uintptr_t>(nextHandle++));
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR VkResult VKAPI_CALL fake_vkCreateFence(VkDevice /* device */,
+                                                         const VkFenceCreateInfo* /* pCreateInfo */,
+                                                         const VkAllocationCallbacks* /* pAllocator */,
+                                                         VkFence* pFence)
+{
+    *pFence = createHandle<VkFence>();
+    g_fake.fenceCount++;
+    return VK_SUCCESS;
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR void VKAPI_CALL fake_vkDestroyFence(VkDevice /* device */,
+                                                      VkFence fence,
+                                                      const VkAllocationCallbacks* /* pAllocator */)
+{
+    g_fake.signaledFences.erase(fence);
+    g_fake.fenceCount--;
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR VkResult VKAPI_CALL fake_vkCreateQueryPool(VkDevice /* device */,
+                                                             const VkQueryPoolCreateInfo* /* pCreateInfo */,
+                                                             const VkAllocationCallbacks* /* pAllocator */,
+                                                             VkQueryPool* pQueryPool)
+{
+    *pQueryPool = createHandle<VkQueryPool>();
+    g_fake.queryPoolCount++;
+    return VK_SUCCESS;
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR void VKAPI_CALL fake_vkDestroyQueryPool(VkDevice /* device */,
+                                                          VkQueryPool /* queryPool */,
+                                                          const VkAllocationCallbacks* /* pAllocator */)
+{
+    g_fake.queryPoolCount--;
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR VkResult VKAPI_CALL fake_vkGetFenceStatus(VkDevice /* device */, VkFence fence)
+{
+    return g_fake.signaledFences.contains(fence) ? VK_SUCCESS : VK_NOT_READY;
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR VkResult VKAPI_CALL fake_vkResetFences(VkDevice /* device */,
+                                                         uint32_t fenceCount,
+                                                         const VkFence* pFences)
+{
+    for (uint32_t i = 0; i < fenceCount; i++)
+    {
+        g_fake.signaledFences.erase(pFences[i]);
+    }
+
+    return VK_SUCCESS;
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR VkResult VKAPI_CALL fake_vkWaitForFences(VkDevice /* device */,
+                                                           uint32_t fenceCount,
+                                                           const VkFence* pFences,
+                                                           VkBool32 /* waitAll */,
+                                                           uint64_t /* timeout */)
+{
+    if (!g_fake.signalOnWait)
+    {
+        return VK_TIMEOUT;
+    }
+
+    for (uint32_t i = 0; i < fenceCount; i++)
+    {
+        g_fake.signaledFences.insert(pFences[i]);
+    }
+
+    return VK_SUCCESS;
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR VkResult VKAPI_CALL fake_vkQueueSubmit(VkQueue /* queue */,
+                                                         uint32_t /* submitCount */,
+                                                         const VkSubmitInfo* /* pSubmits */,
+                                                         VkFence fence)
+{
+    if (g_fake.submitResult == VK_SUCCESS)
+    {
+        g_fake.submittedFences.push_back(fence);
+    }
+
+    return g_fake.submitResult;
+}
+
+/* Fake driver implementation. */
+static VKAPI_ATTR VkResult VKAPI_CALL fake_vkGetQueryPoolResults(VkDevice /* device */,
+                                                                 VkQueryPool queryPool,
+                                                                 uint32_t firstQuery,
+                                                                 uint32_t queryCount,
+                                                                 size_t /* dataSize */,
+                                                                 void* pData,
+                                                                 VkDeviceSize stride,
+                                                                 VkQueryResultFlags /* flags */)
+{
+    VkResult result = VK_SUCCESS;
+    for (uint32_t i = 0; i < queryCount; i++)
+    {
+        auto* data = reinterpret_cast<uint64_t*>(static_cast<uint8_t*>(pData) + i * stride);
+
+        auto it = g_fake.queryValues.find({queryPool, firstQuery + i});
+        if (it == g_fake.queryValues.end())
+        {
+            data[1] = 0;
+            result = VK_NOT_READY;
+            continue;
+        }
+
+        data[0] = it->second;
+        data[1] = 1;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Reset the fake device and get a dispatch table that calls into it.
+ */
+static DeviceDispatchTable makeFakeDriver()
+{
+    g_fake = FakeDevice {};
+
+    DeviceDispatchTable driver {};
+    driver.vkCreateFence = fake_vkCreateFence;
+    driver.vkCreateQueryPool = fake_vkCreateQueryPool;
+    driver.vkDestroyFence = fake_vkDestroyFence;
+    driver.vkDestroyQueryPool = fake_vkDestroyQueryPool;
+    driver.vkGetFenceStatus = fake_vkGetFenceStatus;
+    driver.vkGetQueryPoolResults = fake_vkGetQueryPoolResults;
+    driver.vkQueueSubmit = fake_vkQueueSubmit;
+    driver.vkResetFences = fake_vkResetFences;
+    driver.vkWaitForFences = fake_vkWaitForFences;
+    return driver;
+}
+
+/**
+ * @brief Emulate the GPU writing a query pair.
+ */
+static void writeQueries(const TimestampQuery& query, uint64_t start, uint64_t end)
+{
+    g_fake.queryValues[{query.pool, query.index}] = start;
+    g_fake.queryValues[{query.pool, query.index + 1}] = end;
+}
+
+/**
+ * @brief Emulate a submit of a single command buffer, returning its fence.
+ */
+static VkFence submitCommandBuffer(TimestampQueryManager& manager, VkQueue queue, VkCommandBuffer commandBuffer)
+{
+    std::vector<TimestampQuery> queries;
+    manager.collectQueries(commandBuffer, queries);
+    return manager.acquireSubmitSlot(queue, std::move(queries));
+}
+
+/** @brief Test that nested workloads end in reverse order. */
+TEST(TimestampQueries, test_begin_end_pairing)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 4);
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+
+    auto outer = manager.beginWorkload(commandBuffer, 1);
+    auto inner = manager.beginWorkload(commandBuffer, 2);
+    ASSERT_TRUE(outer.has_value());
+    ASSERT_TRUE(inner.has_value());
+    EXPECT_EQ(outer->tagID, 1u);
+    EXPECT_EQ(inner->tagID, 2u);
+    EXPECT_FALSE(outer->pool == inner->pool && outer->index == inner->index);
+
+    auto innerEnd = manager.endWorkload(commandBuffer);
+    auto outerEnd = manager.endWorkload(commandBuffer);
+    ASSERT_TRUE(innerEnd.has_value());
+    ASSERT_TRUE(outerEnd.has_value());
+    EXPECT_EQ(innerEnd->tagID, 2u);
+    EXPECT_EQ(outerEnd->tagID, 1u);
+
+    // Unbalanced ends, such as workloads begun in another command buffer
+    EXPECT_FALSE(manager.endWorkload(commandBuffer).has_value());
+    EXPECT_FALSE(manager.endWorkload(createHandle<VkCommandBuffer>()).has_value());
+}
+
+/** @brief Test that queries are released when a command buffer is reset. */
+TEST(TimestampQueries, test_reset_command_buffer)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 4);
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+
+    manager.beginWorkload(commandBuffer, 1);
+    manager.endWorkload(commandBuffer);
+    manager.resetCommandBuffer(commandBuffer);
+
+    std::vector<TimestampQuery> queries;
+    manager.collectQueries(commandBuffer, queries);
+    EXPECT_TRUE(queries.empty());
+    EXPECT_FALSE(manager.endWorkload(commandBuffer).has_value());
+}
+
+/** @brief Test that executed secondary queries are submitted with the primary. */
+TEST(TimestampQueries, test_execute_commands)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 4);
+    auto primary = createHandle<VkCommandBuffer>();
+    auto secondary = createHandle<VkCommandBuffer>();
+
+    manager.beginWorkload(secondary, 2);
+    manager.endWorkload(secondary);
+
+    manager.beginWorkload(primary, 1);
+    manager.endWorkload(primary);
+    manager.executeCommands(primary, secondary);
+
+    std::vector<TimestampQuery> queries;
+    manager.collectQueries(primary, queries);
+    ASSERT_EQ(queries.size(), 2u);
+    EXPECT_EQ(queries[0].tagID, 1u);
+    EXPECT_EQ(queries[1].tagID, 2u);
+
+    // Re-recording the primary drops the executed secondary queries
+    manager.resetCommandBuffer(primary);
+    queries.clear();
+    manager.collectQueries(primary, queries);
+    EXPECT_TRUE(queries.empty());
+
+    queries.clear();
+    manager.collectQueries(secondary, queries);
+    EXPECT_EQ(queries.size(), 1u);
+}
+
+/** @brief Test that command buffers from transfer-only pools are not timed. */
+TEST(TimestampQueries, test_untimed_command_pool)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 4);
+
+    auto transferPool = createHandle<VkCommandPool>();
+    auto computePool = createHandle<VkCommandPool>();
+    manager.createCommandPool(transferPool, VK_QUEUE_TRANSFER_BIT);
+    manager.createCommandPool(computePool, VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+    manager.allocateCommandBuffers(transferPool, 1, &commandBuffer);
+    EXPECT_FALSE(manager.beginWorkload(commandBuffer, 1).has_value());
+
+    // Drivers may reuse the handle of a freed command buffer
+    manager.allocateCommandBuffers(computePool, 1, &commandBuffer);
+    EXPECT_TRUE(manager.beginWorkload(commandBuffer, 2).has_value());
+}
+
+/** @brief Test that queries are not allocated beyond the limit. */
+TEST(TimestampQueries, test_query_limit)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 1024, 4);
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+
+    // Each workload uses a pair of queries
+    for (uint64_t i = 0; i < 512; i++)
+    {
+        ASSERT_TRUE(manager.beginWorkload(commandBuffer, i).has_value());
+    }
+
+    EXPECT_FALSE(manager.beginWorkload(commandBuffer, 512).has_value());
+    EXPECT_EQ(manager.getAllocatedQueryCount(), 1024u);
+    EXPECT_EQ(g_fake.queryPoolCount, 1u);
+
+    // Released queries can be reused
+    manager.resetCommandBuffer(commandBuffer);
+    EXPECT_TRUE(manager.beginWorkload(commandBuffer, 513).has_value());
+    EXPECT_EQ(manager.getAllocatedQueryCount(), 1024u);
+}
+
+/** @brief Test that a full ring reports the oldest submit. */
+TEST(TimestampQueries, test_ring_full)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 2);
+    auto queue = createHandle<VkQueue>();
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+
+    manager.beginWorkload(commandBuffer, 1);
+    manager.endWorkload(commandBuffer);
+
+    EXPECT_EQ(manager.getRingFullFence(queue), VK_NULL_HANDLE);
+    VkFence fence1 = submitCommandBuffer(manager, queue, commandBuffer);
+    EXPECT_EQ(manager.getRingFullFence(queue), VK_NULL_HANDLE);
+    VkFence fence2 = submitCommandBuffer(manager, queue, commandBuffer);
+    ASSERT_NE(fence1, VK_NULL_HANDLE);
+    ASSERT_NE(fence2, VK_NULL_HANDLE);
+    EXPECT_NE(fence1, fence2);
+
+    EXPECT_EQ(manager.getRingFullFence(queue), fence1);
+    EXPECT_EQ(submitCommandBuffer(manager, queue, commandBuffer), VK_NULL_HANDLE);
+
+    // Other queues have their own ring
+    EXPECT_EQ(manager.getRingFullFence(createHandle<VkQueue>()), VK_NULL_HANDLE);
+
+    // Retiring the oldest submit frees a slot
+    g_fake.signaledFences.insert(fence1);
+    manager.poll();
+    EXPECT_EQ(manager.getRingFullFence(queue), VK_NULL_HANDLE);
+}
+
+/** @brief Test that a released slot drops its queries and reuses its fence. */
+TEST(TimestampQueries, test_release_submit_slot)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 1);
+    auto queue = createHandle<VkQueue>();
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+
+    auto query = manager.beginWorkload(commandBuffer, 1);
+    manager.endWorkload(commandBuffer);
+    ASSERT_TRUE(query.has_value());
+    writeQueries(*query, 100, 200);
+
+    VkFence fence = submitCommandBuffer(manager, queue, commandBuffer);
+    ASSERT_NE(fence, VK_NULL_HANDLE);
+    EXPECT_EQ(manager.getRingFullFence(queue), fence);
+
+    manager.releaseSubmitSlot(queue, fence);
+    EXPECT_EQ(manager.getRingFullFence(queue), VK_NULL_HANDLE);
+    EXPECT_TRUE(manager.poll().empty());
+
+    // The unsignaled fence is recycled for the next submit
+    EXPECT_EQ(submitCommandBuffer(manager, queue, commandBuffer), fence);
+    EXPECT_EQ(g_fake.fenceCount, 1u);
+}
+
+/** @brief Test that submits on a queue are retired in order. */
+TEST(TimestampQueries, test_poll_in_order)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 4);
+    auto queue = createHandle<VkQueue>();
+    auto commandBuffer1 = createHandle<VkCommandBuffer>();
+    auto commandBuffer2 = createHandle<VkCommandBuffer>();
+
+    auto query1 = manager.beginWorkload(commandBuffer1, 1);
+    manager.endWorkload(commandBuffer1);
+    auto query2 = manager.beginWorkload(commandBuffer2, 2);
+    manager.endWorkload(commandBuffer2);
+    ASSERT_TRUE(query1.has_value());
+    ASSERT_TRUE(query2.has_value());
+
+    VkFence fence1 = submitCommandBuffer(manager, queue, commandBuffer1);
+    VkFence fence2 = submitCommandBuffer(manager, queue, commandBuffer2);
+    writeQueries(*query1, 100, 200);
+    writeQueries(*query2, 300, 400);
+
+    // A later submit cannot retire before an earlier one
+    g_fake.signaledFences.insert(fence2);
+    EXPECT_TRUE(manager.poll().empty());
+
+    g_fake.signaledFences.insert(fence1);
+    auto results = manager.poll();
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].tagID, 1u);
+    EXPECT_EQ(results[0].queue, queue);
+    EXPECT_EQ(results[0].startTimestamp, 100u);
+    EXPECT_EQ(results[0].endTimestamp, 200u);
+    EXPECT_EQ(results[1].tagID, 2u);
+    EXPECT_EQ(results[1].startTimestamp, 300u);
+    EXPECT_EQ(results[1].endTimestamp, 400u);
+
+    // Retired fences are reset before reuse
+    EXPECT_TRUE(g_fake.signaledFences.empty());
+    EXPECT_TRUE(manager.poll().empty());
+}
+
+/** @brief Test that workloads with unavailable queries are not reported. */
+TEST(TimestampQueries, test_poll_unavailable)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 4);
+    auto queue = createHandle<VkQueue>();
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+
+    auto query1 = manager.beginWorkload(commandBuffer, 1);
+    manager.endWorkload(commandBuffer);
+    auto query2 = manager.beginWorkload(commandBuffer, 2);
+    ASSERT_TRUE(query1.has_value());
+    ASSERT_TRUE(query2.has_value());
+
+    // The second workload never ends, so only the start is written
+    writeQueries(*query1, 100, 200);
+    g_fake.queryValues[{query2->pool, query2->index}] = 300;
+
+    VkFence fence = submitCommandBuffer(manager, queue, commandBuffer);
+    g_fake.signaledFences.insert(fence);
+
+    auto results = manager.poll();
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].tagID, 1u);
+}
+
+/** @brief Test that raw timestamps are masked and scaled. */
+TEST(TimestampQueries, test_to_nanoseconds)
+{
+    auto driver = makeFakeDriver();
+
+    TimestampQueryManager manager1(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 4);
+    EXPECT_EQ(manager1.toNanoseconds(1ull << 62), 1ull << 62);
+    EXPECT_EQ(manager1.toNanoseconds(1000), 1000u);
+
+    TimestampQueryManager manager2(driver, VK_NULL_HANDLE, 2.5f, 8, 4096, 4);
+    EXPECT_EQ(manager2.toNanoseconds(0x1FF), 0xFFu * 5 / 2);
+    EXPECT_EQ(manager2.toNanoseconds(0x100), 0u);
+
+    TimestampQueryManager manager3(driver, VK_NULL_HANDLE, 0.5f, 36, 4096, 4);
+    EXPECT_EQ(manager3.toNanoseconds((1ull << 36) + 10), 5u);
+}
+
+/** @brief Test that the fence submit waits for a full ring to drain. */
+TEST(TimestampQueries, test_submit_fence_ring_full)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 1);
+    auto queue = createHandle<VkQueue>();
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+    std::mutex lock;
+
+    manager.beginWorkload(commandBuffer, 1);
+    manager.endWorkload(commandBuffer);
+
+    uint32_t pollCount {0};
+    auto poll = [&]()
+    {
+        pollCount++;
+        manager.poll();
+    };
+
+    std::vector<TimestampQuery> queries;
+    manager.collectQueries(commandBuffer, queries);
+    submitTimestampFence(manager, driver, VK_NULL_HANDLE, queue, std::move(queries), lock, poll);
+    ASSERT_EQ(g_fake.submittedFences.size(), 1u);
+    EXPECT_EQ(pollCount, 0u);
+
+    // The second submit must retire the first before it can take its slot
+    queries.clear();
+    manager.collectQueries(commandBuffer, queries);
+    submitTimestampFence(manager, driver, VK_NULL_HANDLE, queue, std::move(queries), lock, poll);
+    EXPECT_EQ(g_fake.submittedFences.size(), 2u);
+    EXPECT_EQ(pollCount, 1u);
+    EXPECT_EQ(manager.getRingFullFence(queue), g_fake.submittedFences[1]);
+
+    // Submits with no queries do not use a slot
+    submitTimestampFence(manager, driver, VK_NULL_HANDLE, queue, {}, lock, poll);
+    EXPECT_EQ(g_fake.submittedFences.size(), 2u);
+    EXPECT_EQ(pollCount, 1u);
+}
+
+/** @brief Test that a failed fence submit releases its slot. */
+TEST(TimestampQueries, test_submit_fence_failed)
+{
+    auto driver = makeFakeDriver();
+    TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 1);
+    auto queue = createHandle<VkQueue>();
+    auto commandBuffer = createHandle<VkCommandBuffer>();
+    std::mutex lock;
+
+    manager.beginWorkload(commandBuffer, 1);
+    manager.endWorkload(commandBuffer);
+
+    uint32_t pollCount {0};
+    auto poll = [&]()
+    {
+        pollCount++;
+    };
+
+    std::vector<TimestampQuery> queries;
+    manager.collectQueries(commandBuffer, queries);
+    g_fake.submitResult = VK_ERROR_DEVICE_LOST;
+    submitTimestampFence(manager, driver, VK_NULL_HANDLE, queue, std::move(queries), lock, poll);
+
+    // A fence that never signals must not block later submits
+    EXPECT_EQ(manager.getRingFullFence(queue), VK_NULL_HANDLE);
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+
+    g_fake.submitResult = VK_SUCCESS;
+    queries.clear();
+    manager.collectQueries(commandBuffer, queries);
+    submitTimestampFence(manager, driver, VK_NULL_HANDLE, queue, std::move(queries), lock, poll);
+    EXPECT_EQ(g_fake.submittedFences.size(), 1u);
+    EXPECT_EQ(pollCount, 0u);
+}
+
+/** @brief Test that the manager destroys all driver objects it created. */
+TEST(TimestampQueries, test_destroy)
+{
+    auto driver = makeFakeDriver();
+    {
+        TimestampQueryManager manager(driver, VK_NULL_HANDLE, 1.0f, 64, 4096, 4);
+        auto queue = createHandle<VkQueue>();
+        auto commandBuffer = createHandle<VkCommandBuffer>();
+
+        manager.beginWorkload(commandBuffer, 1);
+        manager.endWorkload(commandBuffer);
+
+        VkFence fence = submitCommandBuffer(manager, queue, commandBuffer);
+        submitCommandBuffer(manager, queue, commandBuffer);
+        g_fake.signaledFences.insert(fence);
+        manager.poll();
+
+        EXPECT_EQ(g_fake.fenceCount, 2u);
+        EXPECT_EQ(g_fake.queryPoolCount, 1u);
+    }
+
+    EXPECT_EQ(g_fake.fenceCount, 0u);
+    EXPECT_EQ(g_fake.queryPoolCount, 0u);
+}
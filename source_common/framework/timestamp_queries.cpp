@@ -0,0 +1,477 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines the layer-owned GPU timestamp queries used to time workloads.
+ */
+
+#include "framework/timestamp_queries.hpp"
+
+#include "framework/utils.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+/* See header for documentation. */
+TimestampQueryManager::TimestampQueryManager(const DeviceDispatchTable& _driver,
+                                             VkDevice _device,
+                                             float _timestampPeriod,
+                                             uint32_t validBits,
+                                             uint32_t _maxQueryCount,
+                                             uint32_t _ringSize)
+    : driver(_driver),
+      device(_device),
+      timestampPeriod(static_cast<double>(_timestampPeriod)),
+      timestampMask(validBits >= 64 ? ~0ull : (1ull << validBits) - 1ull),
+      maxQueryCount(_maxQueryCount),
+      ringSize(_ringSize)
+{
+}
+
+/* See header for documentation. */
+TimestampQueryManager::~TimestampQueryManager()
+{
+    for (auto& it : queueRings)
+    {
+        for (auto& submit : it.second)
+        {
+            driver.vkDestroyFence(device, submit.fence, nullptr);
+        }
+    }
+
+    for (auto fence : freeFences)
+    {
+        driver.vkDestroyFence(device, fence, nullptr);
+    }
+
+    for (auto pool : pools)
+    {
+        driver.vkDestroyQueryPool(device, pool, nullptr);
+    }
+}
+
+/* See header for documentation. */
+bool TimestampQueryManager::allocatePool()
+{
+    if (allocatedQueryCount + POOL_QUERY_COUNT > maxQueryCount)
+    {
+        return false;
+    }
+
+    VkQueryPoolCreateInfo createInfo {
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = POOL_QUERY_COUNT,
+        .pipelineStatistics = 0,
+    };
+
+    VkQueryPool pool {VK_NULL_HANDLE};
+    VkResult result = driver.vkCreateQueryPool(device, &createInfo, nullptr, &pool);
+    if (result != VK_SUCCESS)
+    {
+        LAYER_ERR("Failed to create timestamp query pool: %d", result);
+        return false;
+    }
+
+    pools.push_back(pool);
+    allocatedQueryCount += POOL_QUERY_COUNT;
+
+    for (uint32_t i = 0; i < POOL_QUERY_COUNT; i += 2)
+    {
+        freeQueries.push_back({pool, i, 0});
+    }
+
+    return true;
+}
+
+/* See header for documentation. */
+void TimestampQueryManager::createCommandPool(VkCommandPool commandPool, VkQueueFlags queueFlags)
+{
+    // vkCmdResetQueryPool() needs graphics or compute support
+    if (!(queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)))
+    {
+        untimedCommandPools.insert(commandPool);
+    }
+}
+
+/* See header for documentation. */
+void TimestampQueryManager::destroyCommandPool(VkCommandPool commandPool)
+{
+    untimedCommandPools.erase(commandPool);
+}
+
+/* See header for documentation. */
+void TimestampQueryManager::allocateCommandBuffers(VkCommandPool commandPool,
+                                                   uint32_t commandBufferCount,
+                                                   const VkCommandBuffer* pCommandBuffers)
+{
+    bool isUntimed = untimedCommandPools.contains(commandPool);
+    for (uint32_t i = 0; i < commandBufferCount; i++)
+    {
+        if (isUntimed)
+        {
+            untimedCommandBuffers.insert(pCommandBuffers[i]);
+        }
+        else
+        {
+            untimedCommandBuffers.erase(pCommandBuffers[i]);
+        }
+    }
+}
+
+/* See header for documentation. */
+std::optional<TimestampQuery> TimestampQueryManager::beginWorkload(VkCommandBuffer commandBuffer, uint64_t tagID)
+{
+    if (untimedCommandBuffers.contains(commandBuffer))
+    {
+        return std::nullopt;
+    }
+
+    if (freeQueries.empty() && !allocatePool())
+    {
+        if (!reportedExhausted)
+        {
+            LAYER_LOG("Timestamp query limit reached, some workloads will not be timed");
+            reportedExhausted = true;
+        }
+
+        return std::nullopt;
+    }
+
+    TimestampQuery query = freeQueries.front();
+    freeQueries.pop_front();
+    query.tagID = tagID;
+
+    auto& state = commandBuffers[commandBuffer];
+    state.open.push_back(state.owned.size());
+    state.owned.push_back(query);
+    return query;
+}
+
+/* See header for documentation. */
+std::optional<TimestampQuery> TimestampQueryManager::endWorkload(VkCommandBuffer commandBuffer)
+{
+    auto it = commandBuffers.find(commandBuffer);
+    if (it == commandBuffers.end() || it->second.open.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto& state = it->second;
+    size_t index = state.open.back();
+    state.open.pop_back();
+    return state.owned[index];
+}
+
+/* See header for documentation. */
+void TimestampQueryManager::executeCommands(VkCommandBuffer primary, VkCommandBuffer secondary)
+{
+    auto it = commandBuffers.find(secondary);
+    if (it == commandBuffers.end())
+    {
+        return;
+    }
+
+    const auto& source = it->second;
+    auto& dest = commandBuffers[primary].executed;
+    dest.insert(dest.end(), source.owned.begin(), source.owned.end());
+    dest.insert(dest.end(), source.executed.begin(), source.executed.end());
+}
+
+/* See header for documentation. */
+void TimestampQueryManager::resetCommandBuffer(VkCommandBuffer commandBuffer)
+{
+    auto it = commandBuffers.find(commandBuffer);
+    if (it == commandBuffers.end())
+    {
+        return;
+    }
+
+    // Only owned queries are returned, executed queries belong to secondaries
+    for (const auto& query : it->second.owned)
+    {
+        freeQueries.push_back({query.pool, query.index, 0});
+    }
+
+    commandBuffers.erase(it);
+}
+
+/* See header for documentation. */
+void TimestampQueryManager::collectQueries(VkCommandBuffer commandBuffer,
+                                           std::vector<TimestampQuery>& queries) const
+{
+    auto it = commandBuffers.find(commandBuffer);
+    if (it == commandBuffers.end())
+    {
+        return;
+    }
+
+    const auto& state = it->second;
+    queries.insert(queries.end(), state.owned.begin(), state.owned.end());
+    queries.insert(queries.end(), state.executed.begin(), state.executed.end());
+}
+
+/* See header for documentation. */
+VkFence TimestampQueryManager::getRingFullFence(VkQueue queue) const
+{
+    auto it = queueRings.find(queue);
+    if (it == queueRings.end() || it->second.size() < ringSize)
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return it->second.front().fence;
+}
+
+/* See header for documentation. */
+VkFence TimestampQueryManager::acquireSubmitSlot(VkQueue queue, std::vector<TimestampQuery>&& queries)
+{
+    auto& ring = queueRings[queue];
+    if (ring.size() >= ringSize)
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    VkFence fence {VK_NULL_HANDLE};
+    if (!freeFences.empty())
+    {
+        fence = freeFences.back();
+        freeFences.pop_back();
+    }
+    else
+    {
+        VkFenceCreateInfo createInfo {
+            .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+        };
+
+        VkResult result = driver.vkCreateFence(device, &createInfo, nullptr, &fence);
+        if (result != VK_SUCCESS)
+        {
+            LAYER_ERR("Failed to create timestamp fence: %d", result);
+            return VK_NULL_HANDLE;
+        }
+    }
+
+    ring.push_back({fence, std::move(queries)});
+    return fence;
+}
+
+/* See header for documentation. */
+void TimestampQueryManager::releaseSubmitSlot(VkQueue queue, VkFence fence)
+{
+    auto& ring = queueRings[queue];
+    auto it = std::find_if(ring.begin(), ring.end(), [fence](const PendingSubmit& submit) {
+        return submit.fence == fence;
+    });
+
+    if (it == ring.end())
+    {
+        return;
+    }
+
+    // The fence was never submitted so it is still unsignaled
+    freeFences.push_back(fence);
+    ring.erase(it);
+}
+
+/* See header for documentation. */
+std::vector<TimestampResult> TimestampQueryManager::poll()
+{
+    std::vector<TimestampResult> results;
+
+    for (auto& [queue, ring] : queueRings)
+    {
+        // Submits to a single queue complete in order
+        while (!ring.empty())
+        {
+            auto& submit = ring.front();
+            if (driver.vkGetFenceStatus(device, submit.fence) != VK_SUCCESS)
+            {
+                break;
+            }
+
+            readResults(queue, submit, results);
+
+            driver.vkResetFences(device, 1, &submit.fence);
+            freeFences.push_back(submit.fence);
+            ring.pop_front();
+        }
+    }
+
+    return results;
+}
+
+/* See header for documentation. */
+void TimestampQueryManager::readResults(VkQueue queue,
+                                        const PendingSubmit& submit,
+                                        std::vector<TimestampResult>& results)
+{
+    for (const auto& query : submit.queries)
+    {
+        // Start value, start availability, end value, end availability
+        std::array<uint64_t, 4> data {};
+
+        // Returns VK_NOT_READY if any query was unavailable, so ignore the
+        // return code and rely on the per-query availability values instead
+        driver.vkGetQueryPoolResults(device,
+                                     query.pool,
+                                     query.index,
+                                     2,
+                                     sizeof(data),
+                                     data.data(),
+                                     2 * sizeof(uint64_t),
+                                     VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+        // Workloads that were not ended in this command buffer are skipped
+        if (!data[1] || !data[3])
+        {
+            continue;
+        }
+
+        results.push_back({
+            query.tagID,
+            queue,
+            toNanoseconds(data[0]),
+            toNanoseconds(data[2]),
+        });
+    }
+}
+
+/* See header for documentation. */
+uint64_t TimestampQueryManager::toNanoseconds(uint64_t ticks) const
+{
+    return static_cast<uint64_t>(static_cast<double>(ticks & timestampMask) * timestampPeriod);
+}
+
+/* See header for documentation. */
+bool isSynchronization2Enabled(const VkDeviceCreateInfo& createInfo)
+{
+    auto* config1 = vku::FindStructInPNextChain<VkPhysicalDeviceSynchronization2Features>(createInfo.pNext);
+    if (config1 && config1->synchronization2)
+    {
+        return true;
+    }
+
+    auto* config2 = vku::FindStructInPNextChain<VkPhysicalDeviceVulkan13Features>(createInfo.pNext);
+    return config2 && config2->synchronization2;
+}
+
+/* See header for documentation. */
+void submitTimestampFence(TimestampQueryManager& timestamps,
+                          const DeviceDispatchTable& driver,
+                          VkDevice device,
+                          VkQueue queue,
+                          std::vector<TimestampQuery>&& queries,
+                          std::mutex& lock,
+                          const std::function<void()>& poll)
+{
+    if (queries.empty())
+    {
+        return;
+    }
+
+    // Hold the lock to access layer-wide global store
+    std::unique_lock<std::mutex> queryLock {lock};
+
+    // If the ring is full wait for the oldest submit to retire. This uses a
+    // short timeout because another thread may retire the fence while we wait
+    VkFence oldest = timestamps.getRingFullFence(queue);
+    while (oldest != VK_NULL_HANDLE)
+    {
+        queryLock.unlock();
+        driver.vkWaitForFences(device, 1, &oldest, VK_TRUE, 1000000);
+        queryLock.lock();
+
+        poll();
+        oldest = timestamps.getRingFullFence(queue);
+    }
+
+    VkFence fence = timestamps.acquireSubmitSlot(queue, std::move(queries));
+
+    // Release the lock to call into the driver
+    queryLock.unlock();
+    if (fence == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    VkResult result = driver.vkQueueSubmit(queue, 0, nullptr, fence);
+    if (result != VK_SUCCESS)
+    {
+        // The fence will never signal, so release the slot to avoid blocking
+        // later submits waiting for the ring to drain
+        LAYER_ERR("Failed to submit timestamp fence: %d", result);
+
+        queryLock.lock();
+        timestamps.releaseSubmitSlot(queue, fence);
+    }
+}
+
+/* See header for documentation. */
+VkQueueFlags getQueueFamilyFlags(const InstanceDispatchTable& driver,
+                                 VkPhysicalDevice physicalDevice,
+                                 uint32_t queueFamilyIndex)
+{
+    uint32_t familyCount {0};
+    driver.vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, nullptr);
+
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    driver.vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, families.data());
+
+    if (queueFamilyIndex >= familyCount)
+    {
+        return 0;
+    }
+
+    return families[queueFamilyIndex].queueFlags;
+}
+
+/* See header for documentation. */
+uint32_t getTimestampValidBits(const InstanceDispatchTable& driver,
+                               VkPhysicalDevice physicalDevice,
+                               const VkDeviceCreateInfo& createInfo)
+{
+    uint32_t familyCount {0};
+    driver.vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, nullptr);
+
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    driver.vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, families.data());
+
+    uint32_t validBits {64};
+    for (uint32_t i = 0; i < createInfo.queueCreateInfoCount; i++)
+    {
+        uint32_t family = createInfo.pQueueCreateInfos[i].queueFamilyIndex;
+        validBits = std::min(validBits, families[family].timestampValidBits);
+    }
+
+    return validBits;
+}
@@ -0,0 +1,498 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the layer-owned GPU timestamp queries used to time workloads.
+ *
+ * Role summary
+ * ============
+ *
+ * Layers that need GPU timing wrap each workload with a pair of timestamp
+ * writes into layer-owned query pools. This gives self-contained GPU timing
+ * on platforms where the driver does not provide Perfetto render stages data.
+ *
+ * Query slots must be known when the command buffer is recorded, so each pair
+ * of queries is owned by the command buffer that writes it until that command
+ * buffer is reset, re-recorded, or freed. Freed pairs are returned to a FIFO
+ * so that they are reused as late as possible.
+ *
+ * Queries are reset in the command buffer before they are written, so that
+ * command buffers can be submitted more than once. Resets are only supported
+ * on queues with graphics or compute support, so command buffers allocated
+ * from pools for other queue families, such as dedicated transfer queues, are
+ * not timed.
+ *
+ * Each queue has a ring of in-flight submits, each with a layer-owned fence
+ * and the list of queries written by that submit. Results are read back
+ * asynchronously once the fence has signaled, so readback never stalls the
+ * GPU. If a ring is full the caller must wait for the oldest submit to retire
+ * before submitting more timed work. The @c submitTimestampFence() helper
+ * implements this protocol for layers.
+ *
+ * Key properties
+ * ==============
+ *
+ * This class only uses the driver dispatch table, and does not depend on the
+ * rest of the layer, so it can be exercised using a stub driver.
+ *
+ * This class is not thread-safe, and must be used with the layer-wide lock
+ * held. It never calls a blocking driver function itself.
+ */
+
+#pragma once
+
+#include "framework/device_dispatch_table.hpp"
+#include "framework/instance_dispatch_table.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @brief A pair of timestamp queries allocated to a single workload.
+ *
+ * The start timestamp is written to @c index and the end to @c index + 1.
+ */
+struct TimestampQuery
+{
+    /**
+     * @brief The layer-owned query pool containing the pair.
+     */
+    VkQueryPool pool;
+
+    /**
+     * @brief The index of the first query in the pair.
+     */
+    uint32_t index;
+
+    /**
+     * @brief The unique tag ID of the workload.
+     */
+    uint64_t tagID;
+};
+
+/**
+ * @brief The GPU execution time of a single workload.
+ */
+struct TimestampResult
+{
+    /**
+     * @brief The unique tag ID of the workload.
+     */
+    uint64_t tagID;
+
+    /**
+     * @brief The queue the workload was submitted to.
+     */
+    VkQueue queue;
+
+    /**
+     * @brief The start timestamp, in GPU domain nanoseconds.
+     */
+    uint64_t startTimestamp;
+
+    /**
+     * @brief The end timestamp, in GPU domain nanoseconds.
+     */
+    uint64_t endTimestamp;
+};
+
+/**
+ * @brief Manages layer-owned timestamp queries and their asynchronous readback.
+ */
+class TimestampQueryManager
+{
+public:
+    /**
+     * @brief Construct a new query manager for a device.
+     *
+     * @param driver            The driver dispatch table for the device.
+     * @param device            The device handle.
+     * @param timestampPeriod   The number of nanoseconds per timestamp tick.
+     * @param validBits         The minimum valid timestamp bits for all queues.
+     * @param maxQueryCount     The maximum number of queries to allocate.
+     * @param ringSize          The number of in-flight submits per queue.
+     */
+    TimestampQueryManager(const DeviceDispatchTable& driver,
+                          VkDevice device,
+                          float timestampPeriod,
+                          uint32_t validBits,
+                          uint32_t maxQueryCount,
+                          uint32_t ringSize);
+
+    /**
+     * @brief Destroy the manager, releasing all layer-owned driver objects.
+     *
+     * The device must be idle, and the driver device must still exist.
+     */
+    ~TimestampQueryManager();
+
+    /**
+     * @brief Record the queue capabilities of a new command pool.
+     *
+     * @param commandPool   The command pool being created.
+     * @param queueFlags    The capabilities of the pool's queue family.
+     */
+    void createCommandPool(VkCommandPool commandPool, VkQueueFlags queueFlags);
+
+    /**
+     * @brief Forget a command pool that is being destroyed.
+     *
+     * The caller must reset the command buffers of the pool separately.
+     *
+     * @param commandPool   The command pool being destroyed.
+     */
+    void destroyCommandPool(VkCommandPool commandPool);
+
+    /**
+     * @brief Record the command pool that new command buffers belong to.
+     *
+     * @param commandPool          The command pool allocated from.
+     * @param commandBufferCount   The number of command buffers allocated.
+     * @param pCommandBuffers      The allocated command buffers.
+     */
+    void allocateCommandBuffers(VkCommandPool commandPool,
+                                uint32_t commandBufferCount,
+                                const VkCommandBuffer* pCommandBuffers);
+
+    /**
+     * @brief Allocate a query pair for a workload starting in a command buffer.
+     *
+     * The caller must reset the pair in the command buffer before writing it.
+     *
+     * @param commandBuffer   The command buffer being recorded.
+     * @param tagID           The unique tag ID of the workload.
+     *
+     * @return The allocated pair, or @c std::nullopt if no queries are free or
+     *         the command buffer cannot be timed.
+     */
+    std::optional<TimestampQuery> beginWorkload(VkCommandBuffer commandBuffer, uint64_t tagID);
+
+    /**
+     * @brief Get the query pair for the workload ending in a command buffer.
+     *
+     * Workloads that started in another command buffer, such as suspended
+     * dynamic render passes, have no end query and are never reported.
+     *
+     * @param commandBuffer   The command buffer being recorded.
+     *
+     * @return The open pair, or @c std::nullopt if the workload is not timed.
+     */
+    std::optional<TimestampQuery> endWorkload(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Record execution of a secondary command buffer in a primary.
+     *
+     * @param primary     The primary command buffer being recorded.
+     * @param secondary   The secondary command buffer being executed.
+     */
+    void executeCommands(VkCommandBuffer primary, VkCommandBuffer secondary);
+
+    /**
+     * @brief Release all queries owned by a command buffer.
+     *
+     * Must be called when a command buffer is reset, re-recorded, or freed.
+     *
+     * @param commandBuffer   The command buffer being reset.
+     */
+    void resetCommandBuffer(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Append the queries written by a command buffer to a submit list.
+     *
+     * @param commandBuffer   The command buffer being submitted.
+     * @param queries         The list to append to.
+     */
+    void collectQueries(VkCommandBuffer commandBuffer, std::vector<TimestampQuery>& queries) const;
+
+    /**
+     * @brief Get the fence of the oldest submit if a queue's ring is full.
+     *
+     * The caller must wait for this fence, without the layer-wide lock held,
+     * and then call @c poll() before calling @c acquireSubmitSlot().
+     *
+     * @param queue   The queue being submitted to.
+     *
+     * @return The fence to wait for, or @c VK_NULL_HANDLE if a slot is free.
+     */
+    VkFence getRingFullFence(VkQueue queue) const;
+
+    /**
+     * @brief Allocate a ring slot for a submit of timed workloads.
+     *
+     * The caller must submit the returned fence to the queue after the
+     * application workload, so that it signals when the queries are written.
+     *
+     * @param queue     The queue being submitted to.
+     * @param queries   The queries written by the submit.
+     *
+     * @return The fence to signal, or @c VK_NULL_HANDLE on error.
+     */
+    VkFence acquireSubmitSlot(VkQueue queue, std::vector<TimestampQuery>&& queries);
+
+    /**
+     * @brief Release a ring slot whose fence could not be submitted.
+     *
+     * The queries of the submit are dropped without being read, and the
+     * unsignaled fence is returned to the free list.
+     *
+     * @param queue   The queue the slot was acquired for.
+     * @param fence   The fence returned by @c acquireSubmitSlot().
+     */
+    void releaseSubmitSlot(VkQueue queue, VkFence fence);
+
+    /**
+     * @brief Read back the results of all retired submits.
+     *
+     * Submits on each queue are retired in order, stopping at the first
+     * submit that is still in flight.
+     *
+     * @return The results of all available workloads.
+     */
+    std::vector<TimestampResult> poll();
+
+    /**
+     * @brief Get the number of queries allocated from the driver.
+     */
+    uint32_t getAllocatedQueryCount() const { return allocatedQueryCount; }
+
+    /**
+     * @brief Convert a raw timestamp value to nanoseconds.
+     *
+     * @param ticks   The raw timestamp value.
+     *
+     * @return The timestamp in nanoseconds.
+     */
+    uint64_t toNanoseconds(uint64_t ticks) const;
+
+private:
+    /**
+     * @brief The number of queries in each layer-owned query pool.
+     */
+    static const uint32_t POOL_QUERY_COUNT {1024};
+
+    /**
+     * @brief The query state of a single command buffer.
+     */
+    struct CommandBufferQueries
+    {
+        /**
+         * @brief The query pairs owned by this command buffer.
+         */
+        std::vector<TimestampQuery> owned;
+
+        /**
+         * @brief The query pairs owned by executed secondary command buffers.
+         */
+        std::vector<TimestampQuery> executed;
+
+        /**
+         * @brief The indices into @c owned of the currently open workloads.
+         */
+        std::vector<size_t> open;
+    };
+
+    /**
+     * @brief A single in-flight submit in a queue ring.
+     */
+    struct PendingSubmit
+    {
+        /**
+         * @brief The fence signaled when the submit has completed.
+         */
+        VkFence fence;
+
+        /**
+         * @brief The queries written by the submit.
+         */
+        std::vector<TimestampQuery> queries;
+    };
+
+    /**
+     * @brief Allocate a new query pool and add its pairs to the free list.
+     *
+     * @return @c true if a pool was allocated, @c false otherwise.
+     */
+    bool allocatePool();
+
+    /**
+     * @brief Read back the results of a retired submit.
+     *
+     * @param queue     The queue the submit was made to.
+     * @param submit    The retired submit.
+     * @param results   The list to append results to.
+     */
+    void readResults(VkQueue queue, const PendingSubmit& submit, std::vector<TimestampResult>& results);
+
+private:
+    /**
+     * @brief The driver dispatch table for the device.
+     */
+    const DeviceDispatchTable& driver;
+
+    /**
+     * @brief The device handle.
+     */
+    const VkDevice device;
+
+    /**
+     * @brief The number of nanoseconds per timestamp tick.
+     */
+    const double timestampPeriod;
+
+    /**
+     * @brief The mask of valid timestamp bits.
+     */
+    const uint64_t timestampMask;
+
+    /**
+     * @brief The maximum number of queries to allocate.
+     */
+    const uint32_t maxQueryCount;
+
+    /**
+     * @brief The number of in-flight submits per queue.
+     */
+    const size_t ringSize;
+
+    /**
+     * @brief The number of queries allocated from the driver.
+     */
+    uint32_t allocatedQueryCount {0};
+
+    /**
+     * @brief Has the query limit been reported to the user?
+     */
+    bool reportedExhausted {false};
+
+    /**
+     * @brief The layer-owned query pools.
+     */
+    std::vector<VkQueryPool> pools;
+
+    /**
+     * @brief The free query pairs, reused in FIFO order.
+     */
+    std::deque<TimestampQuery> freeQueries;
+
+    /**
+     * @brief The layer-owned fences not currently in use.
+     */
+    std::vector<VkFence> freeFences;
+
+    /**
+     * @brief The query state of each command buffer.
+     */
+    std::unordered_map<VkCommandBuffer, CommandBufferQueries> commandBuffers;
+
+    /**
+     * @brief The command pools whose queue family cannot reset queries.
+     */
+    std::unordered_set<VkCommandPool> untimedCommandPools;
+
+    /**
+     * @brief The command buffers allocated from untimed command pools.
+     *
+     * Freed command buffers are only removed when the handle is reused by a
+     * later allocation, as freed handles are never recorded.
+     */
+    std::unordered_set<VkCommandBuffer> untimedCommandBuffers;
+
+    /**
+     * @brief The ring of in-flight submits for each queue.
+     */
+    std::unordered_map<VkQueue, std::deque<PendingSubmit>> queueRings;
+};
+
+/**
+ * @brief Test if synchronization2 is enabled in a device create info.
+ *
+ * Layer-owned timestamps are written with vkCmdWriteTimestamp2(), so callers
+ * must check this before creating a @c TimestampQueryManager.
+ *
+ * @param createInfo   The create info used to create the device.
+ *
+ * @return @c true if the feature is enabled, @c false otherwise.
+ */
+bool isSynchronization2Enabled(const VkDeviceCreateInfo& createInfo);
+
+/**
+ * @brief Submit a layer-owned fence to track completion of timed workloads.
+ *
+ * This must be called without @p lock held, after the application submit.
+ * The fence is submitted in a separate empty submit so that the layer never
+ * needs to modify the application's fence usage. If the ring for the queue is
+ * full this blocks until the oldest submit has retired.
+ *
+ * @param timestamps   The query manager for the device.
+ * @param driver       The device driver dispatch table.
+ * @param device       The device the queue belongs to.
+ * @param queue        The queue being submitted to.
+ * @param queries      The timestamp queries written by the application submit.
+ * @param lock         The layer-wide lock that guards @p timestamps.
+ * @param poll         Callback to retire completed submits, called with
+ *                     @p lock held while waiting for a full ring.
+ */
+void submitTimestampFence(TimestampQueryManager& timestamps,
+                          const DeviceDispatchTable& driver,
+                          VkDevice device,
+                          VkQueue queue,
+                          std::vector<TimestampQuery>&& queries,
+                          std::mutex& lock,
+                          const std::function<void()>& poll);
+
+/**
+ * @brief Get the capabilities of a queue family.
+ *
+ * @param driver             The instance driver dispatch table.
+ * @param physicalDevice     The physical device to query.
+ * @param queueFamilyIndex   The index of the queue family.
+ *
+ * @return The queue family capabilities, or zero if the index is invalid.
+ */
+VkQueueFlags getQueueFamilyFlags(const InstanceDispatchTable& driver,
+                                 VkPhysicalDevice physicalDevice,
+                                 uint32_t queueFamilyIndex);
+
+/**
+ * @brief Get the minimum number of valid timestamp bits for the queues of a device.
+ *
+ * @param driver           The instance driver dispatch table.
+ * @param physicalDevice   The physical device the device was created for.
+ * @param createInfo       The create info used to create the device.
+ *
+ * @return The minimum number of valid bits, or zero if any queue cannot time.
+ */
+uint32_t getTimestampValidBits(const InstanceDispatchTable& driver,
+                               VkPhysicalDevice physicalDevice,
+                               const VkDeviceCreateInfo& createInfo);
@@ -0,0 +1,219 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The implementation of a test harness for running a layer on the null driver.
+ */
+
+#include "null_driver/layer_harness.hpp"
+
+#include "null_driver/null_driver.hpp"
+
+#include <vulkan/vk_layer.h>
+
+#include <dlfcn.h>
+
+namespace NullDriver
+{
+
+/* See header for documentation. */
+LayerHarness::LayerHarness(const std::string& layerPath)
+{
+    if (!loadLayer(layerPath))
+    {
+        return;
+    }
+
+    if (!createInstance())
+    {
+        return;
+    }
+
+    createDevice();
+}
+
+/* See header for documentation. */
+LayerHarness::~LayerHarness()
+{
+    if (device)
+    {
+        auto fpDestroyDevice = getDeviceFunction<PFN_vkDestroyDevice>("vkDestroyDevice");
+        fpDestroyDevice(device, nullptr);
+    }
+
+    if (instance)
+    {
+        auto fpDestroyInstanceRaw = getInstanceProcAddr("vkDestroyInstance");
+        auto fpDestroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(fpDestroyInstanceRaw);
+        fpDestroyInstance(instance, nullptr);
+    }
+
+    if (library)
+    {
+        dlclose(library);
+    }
+}
+
+/* See header for documentation. */
+PFN_vkVoidFunction LayerHarness::getInstanceProcAddr(const char* name) const
+{
+    return fpGetInstanceProcAddr(instance, name);
+}
+
+/* See header for documentation. */
+PFN_vkVoidFunction LayerHarness::getDeviceProcAddr(const char* name) const
+{
+    return fpGetDeviceProcAddr(device, name);
+}
+
+/* See header for documentation. */
+bool LayerHarness::loadLayer(const std::string& layerPath)
+{
+    // No layer so use the null driver directly
+    if (layerPath.empty())
+    {
+        fpGetInstanceProcAddr = NullDriver::getInstanceProcAddr;
+        fpGetDeviceProcAddr = NullDriver::getDeviceProcAddr;
+        return true;
+    }
+
+    library = dlopen(layerPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!library)
+    {
+        return false;
+    }
+
+    fpGetInstanceProcAddr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(library, "vkGetInstanceProcAddr"));
+    fpGetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(dlsym(library, "vkGetDeviceProcAddr"));
+
+    return fpGetInstanceProcAddr && fpGetDeviceProcAddr;
+}
+
+/* See header for documentation. */
+bool LayerHarness::createInstance()
+{
+    // Chain the layer to the null driver, as the loader would for a driver
+    VkLayerInstanceLink link {};
+    link.pNext = nullptr;
+    link.pfnNextGetInstanceProcAddr = NullDriver::getInstanceProcAddr;
+    link.pfnNextGetPhysicalDeviceProcAddr = nullptr;
+
+    VkLayerInstanceCreateInfo chainInfo {};
+    chainInfo.sType = VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO;
+    chainInfo.pNext = nullptr;
+    chainInfo.function = VK_LAYER_LINK_INFO;
+    chainInfo.u.pLayerInfo = &link;
+
+    VkApplicationInfo appInfo {};
+    appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    appInfo.pApplicationName = "layer_harness";
+    appInfo.apiVersion = VK_API_VERSION_1_3;
+
+    const char* extensions[] {VK_EXT_DEBUG_UTILS_EXTENSION_NAME};
+
+    VkInstanceCreateInfo createInfo {};
+    createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    createInfo.pNext = &chainInfo;
+    createInfo.pApplicationInfo = &appInfo;
+    createInfo.enabledExtensionCount = 1;
+    createInfo.ppEnabledExtensionNames = extensions;
+
+    auto fpCreateInstance = reinterpret_cast<PFN_vkCreateInstance>(fpGetInstanceProcAddr(nullptr, "vkCreateInstance"));
+    if (!fpCreateInstance)
+    {
+        return false;
+    }
+
+    VkInstance newInstance {VK_NULL_HANDLE};
+    if (fpCreateInstance(&createInfo, nullptr, &newInstance) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    instance = newInstance;
+
+    auto fpEnumeratePhysicalDevicesRaw = getInstanceProcAddr("vkEnumeratePhysicalDevices");
+    auto fpEnumeratePhysicalDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(fpEnumeratePhysicalDevicesRaw);
+
+    uint32_t count = 1;
+    auto result = fpEnumeratePhysicalDevices(instance, &count, &physicalDevice);
+    return (result == VK_SUCCESS) && (count == 1);
+}
+
+/* See header for documentation. */
+bool LayerHarness::createDevice()
+{
+    // Chain the layer to the null driver, as the loader would for a driver
+    VkLayerDeviceLink link {};
+    link.pNext = nullptr;
+    link.pfnNextGetInstanceProcAddr = NullDriver::getInstanceProcAddr;
+    link.pfnNextGetDeviceProcAddr = NullDriver::getDeviceProcAddr;
+
+    VkLayerDeviceCreateInfo chainInfo {};
+    chainInfo.sType = VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO;
+    chainInfo.pNext = nullptr;
+    chainInfo.function = VK_LAYER_LINK_INFO;
+    chainInfo.u.pLayerInfo = &link;
+
+    float priority = 1.0f;
+
+    VkDeviceQueueCreateInfo queueInfo {};
+    queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueInfo.queueFamilyIndex = getQueueFamilyIndex();
+    queueInfo.queueCount = 1;
+    queueInfo.pQueuePriorities = &priority;
+
+    const char* extensions[] {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+
+    VkDeviceCreateInfo createInfo {};
+    createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    createInfo.pNext = &chainInfo;
+    createInfo.queueCreateInfoCount = 1;
+    createInfo.pQueueCreateInfos = &queueInfo;
+    createInfo.enabledExtensionCount = 1;
+    createInfo.ppEnabledExtensionNames = extensions;
+
+    auto fpCreateDevice = reinterpret_cast<PFN_vkCreateDevice>(getInstanceProcAddr("vkCreateDevice"));
+    if (!fpCreateDevice)
+    {
+        return false;
+    }
+
+    VkDevice newDevice {VK_NULL_HANDLE};
+    if (fpCreateDevice(physicalDevice, &createInfo, nullptr, &newDevice) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    device = newDevice;
+
+    auto fpGetDeviceQueue = getDeviceFunction<PFN_vkGetDeviceQueue>("vkGetDeviceQueue");
+    fpGetDeviceQueue(device, getQueueFamilyIndex(), 0, &queue);
+
+    return queue != VK_NULL_HANDLE;
+}
+
+}
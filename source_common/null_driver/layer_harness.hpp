@@ -0,0 +1,194 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The declaration of a test harness for running a layer on the null driver.
+ */
+
+#pragma once
+
+#include <string>
+
+#include <vulkan/vulkan.h>
+
+namespace NullDriver
+{
+
+/**
+ * @brief A harness that loads a layer on top of the null driver.
+ *
+ * The harness emulates the parts of the Vulkan loader that a layer relies
+ * on, chaining the layer procedure address lookups to the null driver, and
+ * creates an instance and a device with a single queue through the layer.
+ * Callers can then use the layer entry points to drive synthetic workloads.
+ */
+class LayerHarness
+{
+public:
+    /**
+     * @brief Load a layer and create an instance and device through it.
+     *
+     * Check @c isValid() after construction to determine if setup succeeded.
+     *
+     * @param layerPath   The path of the layer library to load, or an empty
+     *                    string to use the null driver without a layer.
+     */
+    LayerHarness(const std::string& layerPath);
+
+    /**
+     * @brief Destroy the device and instance, and unload the layer.
+     */
+    ~LayerHarness();
+
+    LayerHarness(const LayerHarness&) = delete;
+
+    LayerHarness& operator=(const LayerHarness&) = delete;
+
+    /**
+     * @brief Is this harness ready for use?
+     *
+     * @return @c true if the layer loaded and the device queue was created.
+     */
+    bool isValid() const { return queue != VK_NULL_HANDLE; }
+
+    /**
+     * @brief Get the instance created through the layer.
+     */
+    VkInstance getInstance() const { return instance; }
+
+    /**
+     * @brief Get the physical device used to create the device.
+     */
+    VkPhysicalDevice getPhysicalDevice() const { return physicalDevice; }
+
+    /**
+     * @brief Get the device created through the layer.
+     */
+    VkDevice getDevice() const { return device; }
+
+    /**
+     * @brief Get the queue created through the layer.
+     */
+    VkQueue getQueue() const { return queue; }
+
+    /**
+     * @brief Get the queue family index of the queue.
+     */
+    uint32_t getQueueFamilyIndex() const { return 0; }
+
+    /**
+     * @brief Get an instance function from the top of the layer stack.
+     *
+     * @param name   The name of the function.
+     *
+     * @return The function pointer, or @c nullptr if not found.
+     */
+    PFN_vkVoidFunction getInstanceProcAddr(const char* name) const;
+
+    /**
+     * @brief Get a device function from the top of the layer stack.
+     *
+     * @param name   The name of the function.
+     *
+     * @return The function pointer, or @c nullptr if not found.
+     */
+    PFN_vkVoidFunction getDeviceProcAddr(const char* name) const;
+
+    /**
+     * @brief Get a typed device function from the top of the layer stack.
+     *
+     * @param name   The name of the function.
+     *
+     * @return The function pointer, or @c nullptr if not found.
+     */
+    template<typename T>
+    T getDeviceFunction(const char* name) const
+    {
+        return reinterpret_cast<T>(getDeviceProcAddr(name));
+    }
+
+private:
+    /**
+     * @brief Load the layer library and its entry points.
+     *
+     * @param layerPath   The path of the layer library to load.
+     *
+     * @return @c true on success, @c false otherwise.
+     */
+    bool loadLayer(const std::string& layerPath);
+
+    /**
+     * @brief Create the instance through the layer.
+     *
+     * @return @c true on success, @c false otherwise.
+     */
+    bool createInstance();
+
+    /**
+     * @brief Create the device and get its queue through the layer.
+     *
+     * @return @c true on success, @c false otherwise.
+     */
+    bool createDevice();
+
+private:
+    /**
+     * @brief The loaded layer library, or @c nullptr if not using a layer.
+     */
+    void* library {nullptr};
+
+    /**
+     * @brief The instance procedure address lookup at the top of the stack.
+     */
+    PFN_vkGetInstanceProcAddr fpGetInstanceProcAddr {nullptr};
+
+    /**
+     * @brief The device procedure address lookup at the top of the stack.
+     */
+    PFN_vkGetDeviceProcAddr fpGetDeviceProcAddr {nullptr};
+
+    /**
+     * @brief The instance.
+     */
+    VkInstance instance {VK_NULL_HANDLE};
+
+    /**
+     * @brief The physical device.
+     */
+    VkPhysicalDevice physicalDevice {VK_NULL_HANDLE};
+
+    /**
+     * @brief The device.
+     */
+    VkDevice device {VK_NULL_HANDLE};
+
+    /**
+     * @brief The queue.
+     */
+    VkQueue queue {VK_NULL_HANDLE};
+};
+
+}
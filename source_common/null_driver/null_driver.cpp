@@ -0,0 +1,768 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The implementation of the manually written null driver functions.
+ *
+ * Functions are written manually here if they create dispatchable objects, or
+ * if they must return valid capability data to allow a layer to initialize.
+ * All other functions use the generated stubs in null_driver_functions.cpp.
+ */
+
+#include "null_driver/null_driver.hpp"
+
+#include "null_driver/null_driver_stubs.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NullDriver
+{
+
+/**
+ * @brief The number of queues exposed by the single queue family.
+ */
+static constexpr uint32_t QUEUE_COUNT {4};
+
+/**
+ * @brief The physical device object.
+ *
+ * All dispatchable objects must start with storage for the loader dispatch
+ * key. Child objects copy the key of their parent object.
+ */
+struct PhysicalDevice
+{
+    void* loaderData {nullptr};
+};
+
+/**
+ * @brief The instance object.
+ */
+struct Instance
+{
+    void* loaderData {nullptr};
+
+    /**
+     * @brief The single physical device exposed by the driver.
+     */
+    PhysicalDevice physicalDevice;
+};
+
+/**
+ * @brief The queue object.
+ */
+struct Queue
+{
+    void* loaderData {nullptr};
+};
+
+/**
+ * @brief The command buffer object.
+ */
+struct CommandBuffer
+{
+    void* loaderData {nullptr};
+};
+
+/**
+ * @brief A device memory allocation.
+ */
+struct DeviceMemory
+{
+    /**
+     * @brief The size of the allocation.
+     */
+    VkDeviceSize size {0};
+
+    /**
+     * @brief Host storage, allocated lazily when the memory is first mapped.
+     */
+    std::vector<uint8_t> data;
+};
+
+/**
+ * @brief The device object.
+ */
+struct Device
+{
+    void* loaderData {nullptr};
+
+    /**
+     * @brief The queues in the single queue family.
+     */
+    Queue queues[QUEUE_COUNT];
+
+    /**
+     * @brief Lock protecting the object tracking.
+     */
+    std::mutex lock;
+
+    /**
+     * @brief The command buffers allocated from each command pool.
+     */
+    std::unordered_map<VkCommandPool, std::unordered_map<VkCommandBuffer, std::unique_ptr<CommandBuffer>>>
+        commandBuffers;
+
+    /**
+     * @brief The device memory allocations.
+     */
+    std::unordered_map<VkDeviceMemory, DeviceMemory> memory;
+};
+
+/**
+ * @brief The instance extensions advertised by the driver.
+ */
+static const VkExtensionProperties instanceExtensions[] {
+    {VK_EXT_DEBUG_UTILS_EXTENSION_NAME, VK_EXT_DEBUG_UTILS_SPEC_VERSION},
+    {VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_SPEC_VERSION},
+    {VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_SURFACE_SPEC_VERSION},
+};
+
+/**
+ * @brief The device extensions advertised by the driver.
+ */
+static const VkExtensionProperties deviceExtensions[] {
+    {VK_EXT_IMAGE_COMPRESSION_CONTROL_EXTENSION_NAME, VK_EXT_IMAGE_COMPRESSION_CONTROL_SPEC_VERSION},
+    {VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME, VK_KHR_DYNAMIC_RENDERING_SPEC_VERSION},
+    {VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_SWAPCHAIN_SPEC_VERSION},
+    {VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME, VK_KHR_SYNCHRONIZATION_2_SPEC_VERSION},
+    {VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, VK_KHR_TIMELINE_SEMAPHORE_SPEC_VERSION},
+};
+
+/**
+ * @brief Return a fixed property list using the Vulkan two-call idiom.
+ *
+ * @param properties   The full list of properties.
+ * @param pCount       The count of properties, updated on return.
+ * @param pProperties  The output list, or @c nullptr to query the count.
+ *
+ * @return @c VK_INCOMPLETE if the output list was too small.
+ */
+template<typename T, size_t N>
+static VkResult enumerateProperties(const T (&properties)[N], uint32_t* pCount, T* pProperties)
+{
+    if (!pProperties)
+    {
+        *pCount = static_cast<uint32_t>(N);
+        return VK_SUCCESS;
+    }
+
+    uint32_t count = std::min(*pCount, static_cast<uint32_t>(N));
+    std::memcpy(pProperties, properties, count * sizeof(T));
+    *pCount = count;
+
+    return count < N ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+/**
+ * @brief Enable every feature in an extension feature structure.
+ *
+ * This assumes that the structure only contains VkBool32 feature flags after
+ * the structure header, which is true for all of the structures used here.
+ *
+ * @param feature   The feature structure to update.
+ */
+template<typename T>
+static void enableAllFeatures(VkBaseOutStructure* feature)
+{
+    constexpr size_t start = sizeof(VkBaseOutStructure);
+    constexpr size_t count = (sizeof(T) - start) / sizeof(VkBool32);
+
+    auto* flags = reinterpret_cast<VkBool32*>(reinterpret_cast<uint8_t*>(feature) + start);
+    for (size_t i = 0; i < count; i++)
+    {
+        flags[i] = VK_TRUE;
+    }
+}
+
+/**
+ * @brief Get the device object from a handle.
+ */
+static Device* getDevice(VkDevice device)
+{
+    return reinterpret_cast<Device*>(device);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateInstanceVersion(uint32_t* pApiVersion)
+{
+    *pApiVersion = VK_API_VERSION_1_3;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateInstanceExtensionProperties(const char* pLayerName,
+                                                                                 uint32_t* pPropertyCount,
+                                                                                 VkExtensionProperties* pProperties)
+{
+    if (pLayerName)
+    {
+        return VK_ERROR_LAYER_NOT_PRESENT;
+    }
+
+    return enumerateProperties(instanceExtensions, pPropertyCount, pProperties);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateInstance(const VkInstanceCreateInfo* /* pCreateInfo */,
+                                                           const VkAllocationCallbacks* /* pAllocator */,
+                                                           VkInstance* pInstance)
+{
+    auto* instance = new Instance();
+    instance->loaderData = instance;
+    instance->physicalDevice.loaderData = instance->loaderData;
+
+    *pInstance = reinterpret_cast<VkInstance>(instance);
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyInstance(VkInstance instance,
+                                                        const VkAllocationCallbacks* /* pAllocator */)
+{
+    delete reinterpret_cast<Instance*>(instance);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumeratePhysicalDevices(VkInstance instance,
+                                                                     uint32_t* pPhysicalDeviceCount,
+                                                                     VkPhysicalDevice* pPhysicalDevices)
+{
+    if (!pPhysicalDevices)
+    {
+        *pPhysicalDeviceCount = 1;
+        return VK_SUCCESS;
+    }
+
+    if (*pPhysicalDeviceCount == 0)
+    {
+        return VK_INCOMPLETE;
+    }
+
+    auto* layer = reinterpret_cast<Instance*>(instance);
+    pPhysicalDevices[0] = reinterpret_cast<VkPhysicalDevice>(&layer->physicalDevice);
+    *pPhysicalDeviceCount = 1;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateDeviceExtensionProperties(
+    VkPhysicalDevice /* physicalDevice */,
+    const char* pLayerName,
+    uint32_t* pPropertyCount,
+    VkExtensionProperties* pProperties)
+{
+    if (pLayerName)
+    {
+        return VK_ERROR_LAYER_NOT_PRESENT;
+    }
+
+    return enumerateProperties(deviceExtensions, pPropertyCount, pProperties);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceProperties(VkPhysicalDevice /* physicalDevice */,
+                                                                    VkPhysicalDeviceProperties* pProperties)
+{
+    *pProperties = {};
+    pProperties->apiVersion = VK_API_VERSION_1_3;
+    pProperties->driverVersion = 1;
+    pProperties->deviceType = VK_PHYSICAL_DEVICE_TYPE_CPU;
+    std::strncpy(pProperties->deviceName, "Null driver", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+
+    auto& limits = pProperties->limits;
+    limits.maxImageDimension1D = 16384;
+    limits.maxImageDimension2D = 16384;
+    limits.maxImageDimension3D = 2048;
+    limits.maxImageArrayLayers = 2048;
+    limits.maxMemoryAllocationCount = 4096;
+    limits.maxBoundDescriptorSets = 8;
+    limits.maxPushConstantsSize = 256;
+    limits.maxColorAttachments = 8;
+    limits.maxComputeWorkGroupCount[0] = 65535;
+    limits.maxComputeWorkGroupCount[1] = 65535;
+    limits.maxComputeWorkGroupCount[2] = 65535;
+    limits.timestampComputeAndGraphics = VK_TRUE;
+    limits.timestampPeriod = 1.0f;
+    limits.nonCoherentAtomSize = 64;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice,
+                                                                     VkPhysicalDeviceProperties2* pProperties)
+{
+    null_vkGetPhysicalDeviceProperties(physicalDevice, &pProperties->properties);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFeatures(VkPhysicalDevice /* physicalDevice */,
+                                                                  VkPhysicalDeviceFeatures* pFeatures)
+{
+    auto* flags = reinterpret_cast<VkBool32*>(pFeatures);
+    for (size_t i = 0; i < sizeof(VkPhysicalDeviceFeatures) / sizeof(VkBool32); i++)
+    {
+        flags[i] = VK_TRUE;
+    }
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice,
+                                                                   VkPhysicalDeviceFeatures2* pFeatures)
+{
+    null_vkGetPhysicalDeviceFeatures(physicalDevice, &pFeatures->features);
+
+    // Enable features for the core versions and advertised extensions
+    auto* feature = reinterpret_cast<VkBaseOutStructure*>(pFeatures->pNext);
+    for (; feature; feature = feature->pNext)
+    {
+        switch (feature->sType)
+        {
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES:
+            enableAllFeatures<VkPhysicalDeviceVulkan11Features>(feature);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES:
+            enableAllFeatures<VkPhysicalDeviceVulkan12Features>(feature);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES:
+            enableAllFeatures<VkPhysicalDeviceVulkan13Features>(feature);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES:
+            enableAllFeatures<VkPhysicalDeviceDynamicRenderingFeatures>(feature);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT:
+            enableAllFeatures<VkPhysicalDeviceImageCompressionControlFeaturesEXT>(feature);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES:
+            enableAllFeatures<VkPhysicalDeviceSynchronization2Features>(feature);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES:
+            enableAllFeatures<VkPhysicalDeviceTimelineSemaphoreFeatures>(feature);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL
+    null_vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice /* physicalDevice */,
+                                                  uint32_t* pQueueFamilyPropertyCount,
+                                                  VkQueueFamilyProperties* pQueueFamilyProperties)
+{
+    if (!pQueueFamilyProperties)
+    {
+        *pQueueFamilyPropertyCount = 1;
+        return;
+    }
+
+    if (*pQueueFamilyPropertyCount == 0)
+    {
+        return;
+    }
+
+    auto& family = pQueueFamilyProperties[0];
+    family.queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    family.queueCount = QUEUE_COUNT;
+    family.timestampValidBits = 64;
+    family.minImageTransferGranularity = {1, 1, 1};
+    *pQueueFamilyPropertyCount = 1;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL
+    null_vkGetPhysicalDeviceQueueFamilyProperties2(VkPhysicalDevice physicalDevice,
+                                                   uint32_t* pQueueFamilyPropertyCount,
+                                                   VkQueueFamilyProperties2* pQueueFamilyProperties)
+{
+    if (!pQueueFamilyProperties)
+    {
+        *pQueueFamilyPropertyCount = 1;
+        return;
+    }
+
+    if (*pQueueFamilyPropertyCount == 0)
+    {
+        return;
+    }
+
+    null_vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice,
+                                                  pQueueFamilyPropertyCount,
+                                                  &pQueueFamilyProperties[0].queueFamilyProperties);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL
+    null_vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice /* physicalDevice */,
+                                             VkPhysicalDeviceMemoryProperties* pMemoryProperties)
+{
+    *pMemoryProperties = {};
+
+    pMemoryProperties->memoryHeapCount = 1;
+    pMemoryProperties->memoryHeaps[0].size = 1024ull * 1024ull * 1024ull;
+    pMemoryProperties->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+
+    pMemoryProperties->memoryTypeCount = 1;
+    pMemoryProperties->memoryTypes[0].heapIndex = 0;
+    pMemoryProperties->memoryTypes[0].propertyFlags =
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL
+    null_vkGetPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice,
+                                              VkPhysicalDeviceMemoryProperties2* pMemoryProperties)
+{
+    null_vkGetPhysicalDeviceMemoryProperties(physicalDevice, &pMemoryProperties->memoryProperties);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL
+    null_vkGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice /* physicalDevice */,
+                                                  VkFormat /* format */,
+                                                  VkImageType /* type */,
+                                                  VkImageTiling /* tiling */,
+                                                  VkImageUsageFlags /* usage */,
+                                                  VkImageCreateFlags /* flags */,
+                                                  VkImageFormatProperties* pImageFormatProperties)
+{
+    pImageFormatProperties->maxExtent = {16384, 16384, 2048};
+    pImageFormatProperties->maxMipLevels = 15;
+    pImageFormatProperties->maxArrayLayers = 2048;
+    pImageFormatProperties->sampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    pImageFormatProperties->maxResourceSize = 1ull << 32;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL
+    null_vkGetPhysicalDeviceImageFormatProperties2(VkPhysicalDevice physicalDevice,
+                                                   const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo,
+                                                   VkImageFormatProperties2* pImageFormatProperties)
+{
+    return null_vkGetPhysicalDeviceImageFormatProperties(physicalDevice,
+                                                         pImageFormatInfo->format,
+                                                         pImageFormatInfo->type,
+                                                         pImageFormatInfo->tiling,
+                                                         pImageFormatInfo->usage,
+                                                         pImageFormatInfo->flags,
+                                                         &pImageFormatProperties->imageFormatProperties);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDevice(VkPhysicalDevice /* physicalDevice */,
+                                                         const VkDeviceCreateInfo* /* pCreateInfo */,
+                                                         const VkAllocationCallbacks* /* pAllocator */,
+                                                         VkDevice* pDevice)
+{
+    auto* device = new Device();
+    device->loaderData = device;
+    for (auto& queue : device->queues)
+    {
+        queue.loaderData = device->loaderData;
+    }
+
+    *pDevice = reinterpret_cast<VkDevice>(device);
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* /* pAllocator */)
+{
+    delete getDevice(device);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceQueue(VkDevice device,
+                                                       uint32_t queueFamilyIndex,
+                                                       uint32_t queueIndex,
+                                                       VkQueue* pQueue)
+{
+    if (queueFamilyIndex != 0 || queueIndex >= QUEUE_COUNT)
+    {
+        *pQueue = VK_NULL_HANDLE;
+        return;
+    }
+
+    *pQueue = reinterpret_cast<VkQueue>(&getDevice(device)->queues[queueIndex]);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceQueue2(VkDevice device,
+                                                        const VkDeviceQueueInfo2* pQueueInfo,
+                                                        VkQueue* pQueue)
+{
+    null_vkGetDeviceQueue(device, pQueueInfo->queueFamilyIndex, pQueueInfo->queueIndex, pQueue);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAllocateCommandBuffers(VkDevice device,
+                                                                   const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                                                   VkCommandBuffer* pCommandBuffers)
+{
+    auto* layer = getDevice(device);
+    std::lock_guard<std::mutex> lock {layer->lock};
+
+    auto& poolBuffers = layer->commandBuffers[pAllocateInfo->commandPool];
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++)
+    {
+        auto commandBuffer = std::make_unique<CommandBuffer>();
+        commandBuffer->loaderData = layer->loaderData;
+
+        pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(commandBuffer.get());
+        poolBuffers.emplace(pCommandBuffers[i], std::move(commandBuffer));
+    }
+
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkFreeCommandBuffers(VkDevice device,
+                                                           VkCommandPool commandPool,
+                                                           uint32_t commandBufferCount,
+                                                           const VkCommandBuffer* pCommandBuffers)
+{
+    auto* layer = getDevice(device);
+    std::lock_guard<std::mutex> lock {layer->lock};
+
+    auto& poolBuffers = layer->commandBuffers[commandPool];
+    for (uint32_t i = 0; i < commandBufferCount; i++)
+    {
+        poolBuffers.erase(pCommandBuffers[i]);
+    }
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyCommandPool(VkDevice device,
+                                                           VkCommandPool commandPool,
+                                                           const VkAllocationCallbacks* /* pAllocator */)
+{
+    auto* layer = getDevice(device);
+    std::lock_guard<std::mutex> lock {layer->lock};
+
+    // Destroying a pool implicitly frees all of its command buffers
+    layer->commandBuffers.erase(commandPool);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAllocateDescriptorSets(VkDevice /* device */,
+                                                                   const VkDescriptorSetAllocateInfo* pAllocateInfo,
+                                                                   VkDescriptorSet* pDescriptorSets)
+{
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++)
+    {
+        pDescriptorSets[i] = createHandle<VkDescriptorSet>();
+    }
+
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAllocateMemory(VkDevice device,
+                                                           const VkMemoryAllocateInfo* pAllocateInfo,
+                                                           const VkAllocationCallbacks* /* pAllocator */,
+                                                           VkDeviceMemory* pMemory)
+{
+    auto* layer = getDevice(device);
+    std::lock_guard<std::mutex> lock {layer->lock};
+
+    *pMemory = createHandle<VkDeviceMemory>();
+    layer->memory[*pMemory].size = pAllocateInfo->allocationSize;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkFreeMemory(VkDevice device,
+                                                   VkDeviceMemory memory,
+                                                   const VkAllocationCallbacks* /* pAllocator */)
+{
+    auto* layer = getDevice(device);
+    std::lock_guard<std::mutex> lock {layer->lock};
+
+    layer->memory.erase(memory);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkMapMemory(VkDevice device,
+                                                      VkDeviceMemory memory,
+                                                      VkDeviceSize offset,
+                                                      VkDeviceSize /* size */,
+                                                      VkMemoryMapFlags /* flags */,
+                                                      void** ppData)
+{
+    auto* layer = getDevice(device);
+    std::lock_guard<std::mutex> lock {layer->lock};
+
+    auto it = layer->memory.find(memory);
+    if (it == layer->memory.end())
+    {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+
+    // Allocate host storage on first use so unmapped memory costs nothing
+    auto& allocation = it->second;
+    if (allocation.data.empty())
+    {
+        allocation.data.resize(allocation.size);
+    }
+
+    *ppData = allocation.data.data() + offset;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkMapMemory2(VkDevice device,
+                                                       const VkMemoryMapInfo* pMemoryMapInfo,
+                                                       void** ppData)
+{
+    return null_vkMapMemory(device,
+                            pMemoryMapInfo->memory,
+                            pMemoryMapInfo->offset,
+                            pMemoryMapInfo->size,
+                            pMemoryMapInfo->flags,
+                            ppData);
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetEventStatus(VkDevice /* device */, VkEvent /* event */)
+{
+    // Work completes immediately, so events are always signaled
+    return VK_EVENT_SET;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetQueryPoolResults(VkDevice /* device */,
+                                                                VkQueryPool /* queryPool */,
+                                                                uint32_t /* firstQuery */,
+                                                                uint32_t /* queryCount */,
+                                                                size_t dataSize,
+                                                                void* pData,
+                                                                VkDeviceSize /* stride */,
+                                                                VkQueryResultFlags /* flags */)
+{
+    if (pData)
+    {
+        std::memset(pData, 0, dataSize);
+    }
+
+    return VK_SUCCESS;
+}
+
+#define ENTRY(fnc) {#fnc, reinterpret_cast<PFN_vkVoidFunction>(null_##fnc)}
+#define ENTRY_ALIAS(fnc, impl) {#fnc, reinterpret_cast<PFN_vkVoidFunction>(null_##impl)}
+
+/**
+ * @brief Get a manually implemented function by name.
+ *
+ * @param name   The name of the function to look up.
+ *
+ * @return The function pointer, or @c nullptr if not manually implemented.
+ */
+static PFN_vkVoidFunction getManualFunction(const char* name)
+{
+    static const std::unordered_map<std::string_view, PFN_vkVoidFunction> functions {
+        ENTRY(vkAllocateCommandBuffers),
+        ENTRY(vkAllocateDescriptorSets),
+        ENTRY(vkAllocateMemory),
+        ENTRY(vkCreateDevice),
+        ENTRY(vkCreateInstance),
+        ENTRY(vkDestroyCommandPool),
+        ENTRY(vkDestroyDevice),
+        ENTRY(vkDestroyInstance),
+        ENTRY(vkEnumerateDeviceExtensionProperties),
+        ENTRY(vkEnumerateInstanceExtensionProperties),
+        ENTRY(vkEnumerateInstanceVersion),
+        ENTRY(vkEnumeratePhysicalDevices),
+        ENTRY(vkFreeCommandBuffers),
+        ENTRY(vkFreeMemory),
+        ENTRY(vkGetDeviceQueue),
+        ENTRY(vkGetDeviceQueue2),
+        ENTRY(vkGetEventStatus),
+        ENTRY(vkGetPhysicalDeviceFeatures),
+        ENTRY(vkGetPhysicalDeviceFeatures2),
+        ENTRY_ALIAS(vkGetPhysicalDeviceFeatures2KHR, vkGetPhysicalDeviceFeatures2),
+        ENTRY(vkGetPhysicalDeviceImageFormatProperties),
+        ENTRY(vkGetPhysicalDeviceImageFormatProperties2),
+        ENTRY_ALIAS(vkGetPhysicalDeviceImageFormatProperties2KHR, vkGetPhysicalDeviceImageFormatProperties2),
+        ENTRY(vkGetPhysicalDeviceMemoryProperties),
+        ENTRY(vkGetPhysicalDeviceMemoryProperties2),
+        ENTRY_ALIAS(vkGetPhysicalDeviceMemoryProperties2KHR, vkGetPhysicalDeviceMemoryProperties2),
+        ENTRY(vkGetPhysicalDeviceProperties),
+        ENTRY(vkGetPhysicalDeviceProperties2),
+        ENTRY_ALIAS(vkGetPhysicalDeviceProperties2KHR, vkGetPhysicalDeviceProperties2),
+        ENTRY(vkGetPhysicalDeviceQueueFamilyProperties),
+        ENTRY(vkGetPhysicalDeviceQueueFamilyProperties2),
+        ENTRY_ALIAS(vkGetPhysicalDeviceQueueFamilyProperties2KHR, vkGetPhysicalDeviceQueueFamilyProperties2),
+        ENTRY(vkGetQueryPoolResults),
+        ENTRY(vkMapMemory),
+        ENTRY(vkMapMemory2),
+        ENTRY_ALIAS(vkMapMemory2KHR, vkMapMemory2),
+        {"vkGetDeviceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(getDeviceProcAddr)},
+        {"vkGetInstanceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(getInstanceProcAddr)},
+    };
+
+    auto it = functions.find(name);
+    if (it == functions.end())
+    {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+#undef ENTRY
+#undef ENTRY_ALIAS
+
+/* See header for documentation. */
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr(VkInstance /* instance */, const char* name)
+{
+    PFN_vkVoidFunction function = getManualFunction(name);
+    if (function)
+    {
+        return function;
+    }
+
+    return getStubFunction(name);
+}
+
+/* See header for documentation. */
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getDeviceProcAddr(VkDevice /* device */, const char* name)
+{
+    PFN_vkVoidFunction function = getManualFunction(name);
+    if (function)
+    {
+        return function;
+    }
+
+    return getStubFunction(name);
+}
+
+}
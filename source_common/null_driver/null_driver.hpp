@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The declaration of the headless null driver.
+ *
+ * Module summary
+ * ==============
+ *
+ * The null driver is a minimal Vulkan implementation that can be installed
+ * beneath a layer in place of a real driver. It allows the layers to be
+ * exercised by synthetic workloads on machines without a GPU, such as CI
+ * servers, so that layer CPU overheads can be measured and tested off-device.
+ *
+ * The driver exposes a single physical device that supports Vulkan 1.3 with
+ * one universal queue family. Every API entry point is implemented, but most
+ * functions are cheap stubs that do no work beyond returning success. Stubs
+ * zero any scalar outputs, such as query result counts, so callers see empty
+ * query results, and return unique handle values for created objects so that
+ * layers that track state by handle see distinct objects.
+ *
+ * Dispatchable objects are real allocations with loader-compatible storage for
+ * the dispatch key, so the layer framework can use them exactly as it would
+ * use objects from a real driver.
+ *
+ * Usage
+ * =====
+ *
+ * The driver is not an installable client driver, and is not discovered by the
+ * Vulkan loader. It is used by chaining the driver procedure address lookup
+ * functions beneath a layer in a VkLayerInstanceLink and VkLayerDeviceLink
+ * during instance and device creation. See LayerHarness for a helper that
+ * handles this setup.
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+namespace NullDriver
+{
+
+/**
+ * @brief Get a null driver function by name.
+ *
+ * @param instance   The instance being queried, or @c nullptr for global
+ *                   functions.
+ * @param name       The name of the function to look up.
+ *
+ * @return The function pointer, or @c nullptr if not implemented.
+ */
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr(
+    VkInstance instance,
+    const char* name);
+
+/**
+ * @brief Get a null driver function by name.
+ *
+ * @param device   The device being queried.
+ * @param name     The name of the function to look up.
+ *
+ * @return The function pointer, or @c nullptr if not implemented.
+ */
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getDeviceProcAddr(
+    VkDevice device,
+    const char* name);
+
+}
@@ -0,0 +1,5991 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2024-2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+// clang-format off
+
+#include <string_view>
+#include <unordered_map>
+
+#include <vulkan/vulkan.h>
+
+#include "null_driver/null_driver_stubs.hpp"
+
+namespace NullDriver
+{
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAcquireNextImage2KHR(
+    VkDevice /* device */,
+    const VkAcquireNextImageInfoKHR* /* pAcquireInfo */,
+    uint32_t* pImageIndex
+) {
+    *pImageIndex = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAcquireNextImageKHR(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    uint64_t /* timeout */,
+    VkSemaphore /* semaphore */,
+    VkFence /* fence */,
+    uint32_t* pImageIndex
+) {
+    *pImageIndex = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAcquireProfilingLockKHR(
+    VkDevice /* device */,
+    const VkAcquireProfilingLockInfoKHR* /* pInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBeginCommandBuffer(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCommandBufferBeginInfo* /* pBeginInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindBufferMemory(
+    VkDevice /* device */,
+    VkBuffer /* buffer */,
+    VkDeviceMemory /* memory */,
+    VkDeviceSize /* memoryOffset */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindBufferMemory2(
+    VkDevice /* device */,
+    uint32_t /* bindInfoCount */,
+    const VkBindBufferMemoryInfo* /* pBindInfos */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindBufferMemory2KHR(
+    VkDevice /* device */,
+    uint32_t /* bindInfoCount */,
+    const VkBindBufferMemoryInfo* /* pBindInfos */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindDataGraphPipelineSessionMemoryARM(
+    VkDevice /* device */,
+    uint32_t /* bindInfoCount */,
+    const VkBindDataGraphPipelineSessionMemoryInfoARM* /* pBindInfos */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindImageMemory(
+    VkDevice /* device */,
+    VkImage /* image */,
+    VkDeviceMemory /* memory */,
+    VkDeviceSize /* memoryOffset */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindImageMemory2(
+    VkDevice /* device */,
+    uint32_t /* bindInfoCount */,
+    const VkBindImageMemoryInfo* /* pBindInfos */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindImageMemory2KHR(
+    VkDevice /* device */,
+    uint32_t /* bindInfoCount */,
+    const VkBindImageMemoryInfo* /* pBindInfos */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindTensorMemoryARM(
+    VkDevice /* device */,
+    uint32_t /* bindInfoCount */,
+    const VkBindTensorMemoryInfoARM* /* pBindInfos */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBuildAccelerationStructuresKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    uint32_t /* infoCount */,
+    const VkAccelerationStructureBuildGeometryInfoKHR* /* pInfos */,
+    const VkAccelerationStructureBuildRangeInfoKHR* const* /* ppBuildRangeInfos */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBuildMicromapsEXT(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    uint32_t /* infoCount */,
+    const VkMicromapBuildInfoEXT* /* pInfos */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkClearShaderInstrumentationMetricsARM(
+    VkDevice /* device */,
+    VkShaderInstrumentationARM /* instrumentation */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginConditionalRendering2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkConditionalRenderingBeginInfo2EXT* /* pConditionalRenderingBegin */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginConditionalRenderingEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkConditionalRenderingBeginInfoEXT* /* pConditionalRenderingBegin */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginCustomResolveEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBeginCustomResolveInfoEXT* /* pBeginCustomResolveInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginDebugUtilsLabelEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDebugUtilsLabelEXT* /* pLabelInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginQuery(
+    VkCommandBuffer /* commandBuffer */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* query */,
+    VkQueryControlFlags /* flags */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginQueryIndexedEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* query */,
+    VkQueryControlFlags /* flags */,
+    uint32_t /* index */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginRenderPass(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderPassBeginInfo* /* pRenderPassBegin */,
+    VkSubpassContents /* contents */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginRenderPass2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderPassBeginInfo* /* pRenderPassBegin */,
+    const VkSubpassBeginInfo* /* pSubpassBeginInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginRenderPass2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderPassBeginInfo* /* pRenderPassBegin */,
+    const VkSubpassBeginInfo* /* pSubpassBeginInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginRendering(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderingInfo* /* pRenderingInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginRenderingKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderingInfo* /* pRenderingInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginShaderInstrumentationARM(
+    VkCommandBuffer /* commandBuffer */,
+    VkShaderInstrumentationARM /* instrumentation */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginTransformFeedback2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstCounterRange */,
+    uint32_t /* counterRangeCount */,
+    const VkBindTransformFeedbackBuffer2InfoEXT* /* pCounterInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginTransformFeedbackEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstCounterBuffer */,
+    uint32_t /* counterBufferCount */,
+    const VkBuffer* /* pCounterBuffers */,
+    const VkDeviceSize* /* pCounterBufferOffsets */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBindDescriptorBufferEmbeddedSamplersInfoEXT* /* pBindDescriptorBufferEmbeddedSamplersInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindDescriptorBufferEmbeddedSamplersEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineBindPoint /* pipelineBindPoint */,
+    VkPipelineLayout /* layout */,
+    uint32_t /* set */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindDescriptorBuffersEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* bufferCount */,
+    const VkDescriptorBufferBindingInfoEXT* /* pBindingInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindDescriptorSets(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineBindPoint /* pipelineBindPoint */,
+    VkPipelineLayout /* layout */,
+    uint32_t /* firstSet */,
+    uint32_t /* descriptorSetCount */,
+    const VkDescriptorSet* /* pDescriptorSets */,
+    uint32_t /* dynamicOffsetCount */,
+    const uint32_t* /* pDynamicOffsets */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindDescriptorSets2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBindDescriptorSetsInfo* /* pBindDescriptorSetsInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindDescriptorSets2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBindDescriptorSetsInfo* /* pBindDescriptorSetsInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindIndexBuffer(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    VkIndexType /* indexType */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindIndexBuffer2(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    VkDeviceSize /* size */,
+    VkIndexType /* indexType */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindIndexBuffer2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    VkDeviceSize /* size */,
+    VkIndexType /* indexType */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindIndexBuffer3KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBindIndexBuffer3InfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindPipeline(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineBindPoint /* pipelineBindPoint */,
+    VkPipeline /* pipeline */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindResourceHeapEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBindHeapInfoEXT* /* pBindInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindSamplerHeapEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBindHeapInfoEXT* /* pBindInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindShadersEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* stageCount */,
+    const VkShaderStageFlagBits* /* pStages */,
+    const VkShaderEXT* /* pShaders */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindTransformFeedbackBuffers2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstBinding */,
+    uint32_t /* bindingCount */,
+    const VkBindTransformFeedbackBuffer2InfoEXT* /* pBindingInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindTransformFeedbackBuffersEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstBinding */,
+    uint32_t /* bindingCount */,
+    const VkBuffer* /* pBuffers */,
+    const VkDeviceSize* /* pOffsets */,
+    const VkDeviceSize* /* pSizes */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindVertexBuffers(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstBinding */,
+    uint32_t /* bindingCount */,
+    const VkBuffer* /* pBuffers */,
+    const VkDeviceSize* /* pOffsets */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindVertexBuffers2(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstBinding */,
+    uint32_t /* bindingCount */,
+    const VkBuffer* /* pBuffers */,
+    const VkDeviceSize* /* pOffsets */,
+    const VkDeviceSize* /* pSizes */,
+    const VkDeviceSize* /* pStrides */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindVertexBuffers2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstBinding */,
+    uint32_t /* bindingCount */,
+    const VkBuffer* /* pBuffers */,
+    const VkDeviceSize* /* pOffsets */,
+    const VkDeviceSize* /* pSizes */,
+    const VkDeviceSize* /* pStrides */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindVertexBuffers3KHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstBinding */,
+    uint32_t /* bindingCount */,
+    const VkBindVertexBuffer3InfoKHR* /* pBindingInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBlitImage(
+    VkCommandBuffer /* commandBuffer */,
+    VkImage /* srcImage */,
+    VkImageLayout /* srcImageLayout */,
+    VkImage /* dstImage */,
+    VkImageLayout /* dstImageLayout */,
+    uint32_t /* regionCount */,
+    const VkImageBlit* /* pRegions */,
+    VkFilter /* filter */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBlitImage2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBlitImageInfo2* /* pBlitImageInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBlitImage2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkBlitImageInfo2* /* pBlitImageInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBuildAccelerationStructuresIndirectKHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* infoCount */,
+    const VkAccelerationStructureBuildGeometryInfoKHR* /* pInfos */,
+    const VkDeviceAddress* /* pIndirectDeviceAddresses */,
+    const uint32_t* /* pIndirectStrides */,
+    const uint32_t* const* /* ppMaxPrimitiveCounts */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBuildAccelerationStructuresKHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* infoCount */,
+    const VkAccelerationStructureBuildGeometryInfoKHR* /* pInfos */,
+    const VkAccelerationStructureBuildRangeInfoKHR* const* /* ppBuildRangeInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBuildMicromapsEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* infoCount */,
+    const VkMicromapBuildInfoEXT* /* pInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdClearAttachments(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* attachmentCount */,
+    const VkClearAttachment* /* pAttachments */,
+    uint32_t /* rectCount */,
+    const VkClearRect* /* pRects */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdClearColorImage(
+    VkCommandBuffer /* commandBuffer */,
+    VkImage /* image */,
+    VkImageLayout /* imageLayout */,
+    const VkClearColorValue* /* pColor */,
+    uint32_t /* rangeCount */,
+    const VkImageSubresourceRange* /* pRanges */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdClearDepthStencilImage(
+    VkCommandBuffer /* commandBuffer */,
+    VkImage /* image */,
+    VkImageLayout /* imageLayout */,
+    const VkClearDepthStencilValue* /* pDepthStencil */,
+    uint32_t /* rangeCount */,
+    const VkImageSubresourceRange* /* pRanges */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyAccelerationStructureKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyAccelerationStructureInfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyAccelerationStructureToMemoryKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyAccelerationStructureToMemoryInfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBuffer(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* srcBuffer */,
+    VkBuffer /* dstBuffer */,
+    uint32_t /* regionCount */,
+    const VkBufferCopy* /* pRegions */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBuffer2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyBufferInfo2* /* pCopyBufferInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBuffer2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyBufferInfo2* /* pCopyBufferInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBufferToImage(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* srcBuffer */,
+    VkImage /* dstImage */,
+    VkImageLayout /* dstImageLayout */,
+    uint32_t /* regionCount */,
+    const VkBufferImageCopy* /* pRegions */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBufferToImage2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyBufferToImageInfo2* /* pCopyBufferToImageInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBufferToImage2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyBufferToImageInfo2* /* pCopyBufferToImageInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImage(
+    VkCommandBuffer /* commandBuffer */,
+    VkImage /* srcImage */,
+    VkImageLayout /* srcImageLayout */,
+    VkImage /* dstImage */,
+    VkImageLayout /* dstImageLayout */,
+    uint32_t /* regionCount */,
+    const VkImageCopy* /* pRegions */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImage2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyImageInfo2* /* pCopyImageInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImage2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyImageInfo2* /* pCopyImageInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImageToBuffer(
+    VkCommandBuffer /* commandBuffer */,
+    VkImage /* srcImage */,
+    VkImageLayout /* srcImageLayout */,
+    VkBuffer /* dstBuffer */,
+    uint32_t /* regionCount */,
+    const VkBufferImageCopy* /* pRegions */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImageToBuffer2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyImageToBufferInfo2* /* pCopyImageToBufferInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImageToBuffer2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyImageToBufferInfo2* /* pCopyImageToBufferInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImageToMemoryKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyDeviceMemoryImageInfoKHR* /* pCopyMemoryInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyMemoryIndirectKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyMemoryIndirectInfoKHR* /* pCopyMemoryIndirectInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyMemoryKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyDeviceMemoryInfoKHR* /* pCopyMemoryInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyMemoryToAccelerationStructureKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyMemoryToAccelerationStructureInfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyMemoryToImageIndirectKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyMemoryToImageIndirectInfoKHR* /* pCopyMemoryToImageIndirectInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyMemoryToImageKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyDeviceMemoryImageInfoKHR* /* pCopyMemoryInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyMemoryToMicromapEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyMemoryToMicromapInfoEXT* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyMicromapEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyMicromapInfoEXT* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyMicromapToMemoryEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyMicromapToMemoryInfoEXT* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyQueryPoolResults(
+    VkCommandBuffer /* commandBuffer */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* firstQuery */,
+    uint32_t /* queryCount */,
+    VkBuffer /* dstBuffer */,
+    VkDeviceSize /* dstOffset */,
+    VkDeviceSize /* stride */,
+    VkQueryResultFlags /* flags */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyQueryPoolResultsToMemoryKHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* firstQuery */,
+    uint32_t /* queryCount */,
+    const VkStridedDeviceAddressRangeKHR* /* pDstRange */,
+    VkAddressCommandFlagsKHR /* dstFlags */,
+    VkQueryResultFlags /* queryResultFlags */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyTensorARM(
+    VkCommandBuffer /* commandBuffer */,
+    const VkCopyTensorInfoARM* /* pCopyTensorInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDebugMarkerBeginEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDebugMarkerMarkerInfoEXT* /* pMarkerInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDebugMarkerEndEXT(
+    VkCommandBuffer /* commandBuffer */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDebugMarkerInsertEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDebugMarkerMarkerInfoEXT* /* pMarkerInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDecompressMemoryEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDecompressMemoryInfoEXT* /* pDecompressMemoryInfoEXT */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDecompressMemoryIndirectCountEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkMemoryDecompressionMethodFlagsEXT /* decompressionMethod */,
+    VkDeviceAddress /* indirectCommandsAddress */,
+    VkDeviceAddress /* indirectCommandsCountAddress */,
+    uint32_t /* maxDecompressionCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatch(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* groupCountX */,
+    uint32_t /* groupCountY */,
+    uint32_t /* groupCountZ */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatchBase(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* baseGroupX */,
+    uint32_t /* baseGroupY */,
+    uint32_t /* baseGroupZ */,
+    uint32_t /* groupCountX */,
+    uint32_t /* groupCountY */,
+    uint32_t /* groupCountZ */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatchBaseKHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* baseGroupX */,
+    uint32_t /* baseGroupY */,
+    uint32_t /* baseGroupZ */,
+    uint32_t /* groupCountX */,
+    uint32_t /* groupCountY */,
+    uint32_t /* groupCountZ */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatchDataGraphARM(
+    VkCommandBuffer /* commandBuffer */,
+    VkDataGraphPipelineSessionARM /* session */,
+    const VkDataGraphPipelineDispatchInfoARM* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatchIndirect(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatchIndirect2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDispatchIndirect2InfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDraw(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* vertexCount */,
+    uint32_t /* instanceCount */,
+    uint32_t /* firstVertex */,
+    uint32_t /* firstInstance */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexed(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* indexCount */,
+    uint32_t /* instanceCount */,
+    uint32_t /* firstIndex */,
+    int32_t /* vertexOffset */,
+    uint32_t /* firstInstance */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexedIndirect(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    uint32_t /* drawCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexedIndirect2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDrawIndirect2InfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexedIndirectCount(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    VkBuffer /* countBuffer */,
+    VkDeviceSize /* countBufferOffset */,
+    uint32_t /* maxDrawCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexedIndirectCount2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDrawIndirectCount2InfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexedIndirectCountKHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    VkBuffer /* countBuffer */,
+    VkDeviceSize /* countBufferOffset */,
+    uint32_t /* maxDrawCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirect(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    uint32_t /* drawCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirect2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDrawIndirect2InfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirectByteCount2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* instanceCount */,
+    uint32_t /* firstInstance */,
+    const VkBindTransformFeedbackBuffer2InfoEXT* /* pCounterInfo */,
+    uint32_t /* counterOffset */,
+    uint32_t /* vertexStride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirectByteCountEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* instanceCount */,
+    uint32_t /* firstInstance */,
+    VkBuffer /* counterBuffer */,
+    VkDeviceSize /* counterBufferOffset */,
+    uint32_t /* counterOffset */,
+    uint32_t /* vertexStride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirectCount(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    VkBuffer /* countBuffer */,
+    VkDeviceSize /* countBufferOffset */,
+    uint32_t /* maxDrawCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirectCount2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDrawIndirectCount2InfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirectCountKHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    VkBuffer /* countBuffer */,
+    VkDeviceSize /* countBufferOffset */,
+    uint32_t /* maxDrawCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawMeshTasksEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* groupCountX */,
+    uint32_t /* groupCountY */,
+    uint32_t /* groupCountZ */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawMeshTasksIndirect2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDrawIndirect2InfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawMeshTasksIndirectCount2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDrawIndirectCount2InfoKHR* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawMeshTasksIndirectCountEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    VkBuffer /* countBuffer */,
+    VkDeviceSize /* countBufferOffset */,
+    uint32_t /* maxDrawCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawMeshTasksIndirectEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* buffer */,
+    VkDeviceSize /* offset */,
+    uint32_t /* drawCount */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawMultiEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* drawCount */,
+    const VkMultiDrawInfoEXT* /* pVertexInfo */,
+    uint32_t /* instanceCount */,
+    uint32_t /* firstInstance */,
+    uint32_t /* stride */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawMultiIndexedEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* drawCount */,
+    const VkMultiDrawIndexedInfoEXT* /* pIndexInfo */,
+    uint32_t /* instanceCount */,
+    uint32_t /* firstInstance */,
+    uint32_t /* stride */,
+    const int32_t* /* pVertexOffset */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndConditionalRenderingEXT(
+    VkCommandBuffer /* commandBuffer */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndDebugUtilsLabelEXT(
+    VkCommandBuffer /* commandBuffer */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndQuery(
+    VkCommandBuffer /* commandBuffer */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* query */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndQueryIndexedEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* query */,
+    uint32_t /* index */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRenderPass(
+    VkCommandBuffer /* commandBuffer */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRenderPass2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkSubpassEndInfo* /* pSubpassEndInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRenderPass2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkSubpassEndInfo* /* pSubpassEndInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRendering(
+    VkCommandBuffer /* commandBuffer */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRendering2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderingEndInfoKHR* /* pRenderingEndInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRendering2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderingEndInfoKHR* /* pRenderingEndInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRenderingKHR(
+    VkCommandBuffer /* commandBuffer */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndShaderInstrumentationARM(
+    VkCommandBuffer /* commandBuffer */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndTransformFeedback2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstCounterRange */,
+    uint32_t /* counterRangeCount */,
+    const VkBindTransformFeedbackBuffer2InfoEXT* /* pCounterInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndTransformFeedbackEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstCounterBuffer */,
+    uint32_t /* counterBufferCount */,
+    const VkBuffer* /* pCounterBuffers */,
+    const VkDeviceSize* /* pCounterBufferOffsets */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdExecuteCommands(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* commandBufferCount */,
+    const VkCommandBuffer* /* pCommandBuffers */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdExecuteGeneratedCommandsEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* isPreprocessed */,
+    const VkGeneratedCommandsInfoEXT* /* pGeneratedCommandsInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdFillBuffer(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* dstBuffer */,
+    VkDeviceSize /* dstOffset */,
+    VkDeviceSize /* size */,
+    uint32_t /* data */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdFillMemoryKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDeviceAddressRangeKHR* /* pDstRange */,
+    VkAddressCommandFlagsKHR /* dstFlags */,
+    uint32_t /* data */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdInsertDebugUtilsLabelEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDebugUtilsLabelEXT* /* pLabelInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdNextSubpass(
+    VkCommandBuffer /* commandBuffer */,
+    VkSubpassContents /* contents */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdNextSubpass2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkSubpassBeginInfo* /* pSubpassBeginInfo */,
+    const VkSubpassEndInfo* /* pSubpassEndInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdNextSubpass2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkSubpassBeginInfo* /* pSubpassBeginInfo */,
+    const VkSubpassEndInfo* /* pSubpassEndInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPipelineBarrier(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineStageFlags /* srcStageMask */,
+    VkPipelineStageFlags /* dstStageMask */,
+    VkDependencyFlags /* dependencyFlags */,
+    uint32_t /* memoryBarrierCount */,
+    const VkMemoryBarrier* /* pMemoryBarriers */,
+    uint32_t /* bufferMemoryBarrierCount */,
+    const VkBufferMemoryBarrier* /* pBufferMemoryBarriers */,
+    uint32_t /* imageMemoryBarrierCount */,
+    const VkImageMemoryBarrier* /* pImageMemoryBarriers */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPipelineBarrier2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDependencyInfo* /* pDependencyInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPipelineBarrier2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDependencyInfo* /* pDependencyInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPreprocessGeneratedCommandsEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkGeneratedCommandsInfoEXT* /* pGeneratedCommandsInfo */,
+    VkCommandBuffer /* stateCommandBuffer */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushConstants(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineLayout /* layout */,
+    VkShaderStageFlags /* stageFlags */,
+    uint32_t /* offset */,
+    uint32_t /* size */,
+    const void* /* pValues */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushConstants2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkPushConstantsInfo* /* pPushConstantsInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushConstants2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkPushConstantsInfo* /* pPushConstantsInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDataEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkPushDataInfoEXT* /* pPushDataInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDescriptorSet(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineBindPoint /* pipelineBindPoint */,
+    VkPipelineLayout /* layout */,
+    uint32_t /* set */,
+    uint32_t /* descriptorWriteCount */,
+    const VkWriteDescriptorSet* /* pDescriptorWrites */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDescriptorSet2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkPushDescriptorSetInfo* /* pPushDescriptorSetInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDescriptorSet2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkPushDescriptorSetInfo* /* pPushDescriptorSetInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDescriptorSetKHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineBindPoint /* pipelineBindPoint */,
+    VkPipelineLayout /* layout */,
+    uint32_t /* set */,
+    uint32_t /* descriptorWriteCount */,
+    const VkWriteDescriptorSet* /* pDescriptorWrites */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDescriptorSetWithTemplate(
+    VkCommandBuffer /* commandBuffer */,
+    VkDescriptorUpdateTemplate /* descriptorUpdateTemplate */,
+    VkPipelineLayout /* layout */,
+    uint32_t /* set */,
+    const void* /* pData */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDescriptorSetWithTemplate2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkPushDescriptorSetWithTemplateInfo* /* pPushDescriptorSetWithTemplateInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDescriptorSetWithTemplate2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkPushDescriptorSetWithTemplateInfo* /* pPushDescriptorSetWithTemplateInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushDescriptorSetWithTemplateKHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkDescriptorUpdateTemplate /* descriptorUpdateTemplate */,
+    VkPipelineLayout /* layout */,
+    uint32_t /* set */,
+    const void* /* pData */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResetEvent(
+    VkCommandBuffer /* commandBuffer */,
+    VkEvent /* event */,
+    VkPipelineStageFlags /* stageMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResetEvent2(
+    VkCommandBuffer /* commandBuffer */,
+    VkEvent /* event */,
+    VkPipelineStageFlags2 /* stageMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResetEvent2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkEvent /* event */,
+    VkPipelineStageFlags2 /* stageMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResetQueryPool(
+    VkCommandBuffer /* commandBuffer */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* firstQuery */,
+    uint32_t /* queryCount */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResolveImage(
+    VkCommandBuffer /* commandBuffer */,
+    VkImage /* srcImage */,
+    VkImageLayout /* srcImageLayout */,
+    VkImage /* dstImage */,
+    VkImageLayout /* dstImageLayout */,
+    uint32_t /* regionCount */,
+    const VkImageResolve* /* pRegions */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResolveImage2(
+    VkCommandBuffer /* commandBuffer */,
+    const VkResolveImageInfo2* /* pResolveImageInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResolveImage2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkResolveImageInfo2* /* pResolveImageInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetAlphaToCoverageEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* alphaToCoverageEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetAlphaToOneEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* alphaToOneEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetAttachmentFeedbackLoopEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkImageAspectFlags /* aspectMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetBlendConstants(
+    VkCommandBuffer /* commandBuffer */,
+    const float /* blendConstants */[4]
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetColorBlendAdvancedEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstAttachment */,
+    uint32_t /* attachmentCount */,
+    const VkColorBlendAdvancedEXT* /* pColorBlendAdvanced */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetColorBlendEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstAttachment */,
+    uint32_t /* attachmentCount */,
+    const VkBool32* /* pColorBlendEnables */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetColorBlendEquationEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstAttachment */,
+    uint32_t /* attachmentCount */,
+    const VkColorBlendEquationEXT* /* pColorBlendEquations */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetColorWriteEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* attachmentCount */,
+    const VkBool32* /* pColorWriteEnables */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetColorWriteMaskEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstAttachment */,
+    uint32_t /* attachmentCount */,
+    const VkColorComponentFlags* /* pColorWriteMasks */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetConservativeRasterizationModeEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkConservativeRasterizationModeEXT /* conservativeRasterizationMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCoverageModulationModeNV(
+    VkCommandBuffer /* commandBuffer */,
+    VkCoverageModulationModeNV /* coverageModulationMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCoverageModulationTableEnableNV(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* coverageModulationTableEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCoverageModulationTableNV(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* coverageModulationTableCount */,
+    const float* /* pCoverageModulationTable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCoverageReductionModeNV(
+    VkCommandBuffer /* commandBuffer */,
+    VkCoverageReductionModeNV /* coverageReductionMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCoverageToColorEnableNV(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* coverageToColorEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCoverageToColorLocationNV(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* coverageToColorLocation */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCullMode(
+    VkCommandBuffer /* commandBuffer */,
+    VkCullModeFlags /* cullMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCullModeEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkCullModeFlags /* cullMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBias(
+    VkCommandBuffer /* commandBuffer */,
+    float /* depthBiasConstantFactor */,
+    float /* depthBiasClamp */,
+    float /* depthBiasSlopeFactor */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBias2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDepthBiasInfoEXT* /* pDepthBiasInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBiasEnable(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthBiasEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBiasEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthBiasEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBounds(
+    VkCommandBuffer /* commandBuffer */,
+    float /* minDepthBounds */,
+    float /* maxDepthBounds */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBoundsTestEnable(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthBoundsTestEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBoundsTestEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthBoundsTestEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthClampEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthClampEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthClampRangeEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkDepthClampModeEXT /* depthClampMode */,
+    const VkDepthClampRangeEXT* /* pDepthClampRange */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthClipEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthClipEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthClipNegativeOneToOneEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* negativeOneToOne */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthCompareOp(
+    VkCommandBuffer /* commandBuffer */,
+    VkCompareOp /* depthCompareOp */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthCompareOpEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkCompareOp /* depthCompareOp */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthTestEnable(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthTestEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthTestEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthTestEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthWriteEnable(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthWriteEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthWriteEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* depthWriteEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDescriptorBufferOffsets2EXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkSetDescriptorBufferOffsetsInfoEXT* /* pSetDescriptorBufferOffsetsInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDescriptorBufferOffsetsEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineBindPoint /* pipelineBindPoint */,
+    VkPipelineLayout /* layout */,
+    uint32_t /* firstSet */,
+    uint32_t /* setCount */,
+    const uint32_t* /* pBufferIndices */,
+    const VkDeviceSize* /* pOffsets */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDeviceMask(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* deviceMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDeviceMaskKHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* deviceMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDiscardRectangleEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstDiscardRectangle */,
+    uint32_t /* discardRectangleCount */,
+    const VkRect2D* /* pDiscardRectangles */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDiscardRectangleEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* discardRectangleEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDiscardRectangleModeEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkDiscardRectangleModeEXT /* discardRectangleMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDispatchParametersARM(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDispatchParametersARM* /* pDispatchParameters */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetEvent(
+    VkCommandBuffer /* commandBuffer */,
+    VkEvent /* event */,
+    VkPipelineStageFlags /* stageMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetEvent2(
+    VkCommandBuffer /* commandBuffer */,
+    VkEvent /* event */,
+    const VkDependencyInfo* /* pDependencyInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetEvent2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkEvent /* event */,
+    const VkDependencyInfo* /* pDependencyInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetExtraPrimitiveOverestimationSizeEXT(
+    VkCommandBuffer /* commandBuffer */,
+    float /* extraPrimitiveOverestimationSize */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetFragmentShadingRateKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkExtent2D* /* pFragmentSize */,
+    const VkFragmentShadingRateCombinerOpKHR /* combinerOps */[2]
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetFrontFace(
+    VkCommandBuffer /* commandBuffer */,
+    VkFrontFace /* frontFace */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetFrontFaceEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkFrontFace /* frontFace */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLineRasterizationModeEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkLineRasterizationModeEXT /* lineRasterizationMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLineStipple(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* lineStippleFactor */,
+    uint16_t /* lineStipplePattern */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLineStippleEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* lineStippleFactor */,
+    uint16_t /* lineStipplePattern */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLineStippleEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* stippledLineEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLineStippleKHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* lineStippleFactor */,
+    uint16_t /* lineStipplePattern */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLineWidth(
+    VkCommandBuffer /* commandBuffer */,
+    float /* lineWidth */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLogicOpEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkLogicOp /* logicOp */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLogicOpEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* logicOpEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPatchControlPointsEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* patchControlPoints */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPolygonModeEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkPolygonMode /* polygonMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPrimitiveRestartEnable(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* primitiveRestartEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPrimitiveRestartEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* primitiveRestartEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPrimitiveRestartIndexEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* primitiveRestartIndex */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPrimitiveTopology(
+    VkCommandBuffer /* commandBuffer */,
+    VkPrimitiveTopology /* primitiveTopology */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPrimitiveTopologyEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkPrimitiveTopology /* primitiveTopology */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetProvokingVertexModeEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkProvokingVertexModeEXT /* provokingVertexMode */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRasterizationSamplesEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkSampleCountFlagBits /* rasterizationSamples */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRasterizationStreamEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* rasterizationStream */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRasterizerDiscardEnable(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* rasterizerDiscardEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRasterizerDiscardEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* rasterizerDiscardEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRayTracingPipelineStackSizeKHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* pipelineStackSize */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRenderingAttachmentLocations(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderingAttachmentLocationInfo* /* pLocationInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRenderingAttachmentLocationsKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderingAttachmentLocationInfo* /* pLocationInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRenderingInputAttachmentIndices(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderingInputAttachmentIndexInfo* /* pInputAttachmentIndexInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRenderingInputAttachmentIndicesKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkRenderingInputAttachmentIndexInfo* /* pInputAttachmentIndexInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRepresentativeFragmentTestEnableNV(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* representativeFragmentTestEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetSampleLocationsEXT(
+    VkCommandBuffer /* commandBuffer */,
+    const VkSampleLocationsInfoEXT* /* pSampleLocationsInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetSampleLocationsEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* sampleLocationsEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetSampleMaskEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkSampleCountFlagBits /* samples */,
+    const VkSampleMask* /* pSampleMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetScissor(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstScissor */,
+    uint32_t /* scissorCount */,
+    const VkRect2D* /* pScissors */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetScissorWithCount(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* scissorCount */,
+    const VkRect2D* /* pScissors */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetScissorWithCountEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* scissorCount */,
+    const VkRect2D* /* pScissors */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetShadingRateImageEnableNV(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* shadingRateImageEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilCompareMask(
+    VkCommandBuffer /* commandBuffer */,
+    VkStencilFaceFlags /* faceMask */,
+    uint32_t /* compareMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilOp(
+    VkCommandBuffer /* commandBuffer */,
+    VkStencilFaceFlags /* faceMask */,
+    VkStencilOp /* failOp */,
+    VkStencilOp /* passOp */,
+    VkStencilOp /* depthFailOp */,
+    VkCompareOp /* compareOp */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilOpEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkStencilFaceFlags /* faceMask */,
+    VkStencilOp /* failOp */,
+    VkStencilOp /* passOp */,
+    VkStencilOp /* depthFailOp */,
+    VkCompareOp /* compareOp */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilReference(
+    VkCommandBuffer /* commandBuffer */,
+    VkStencilFaceFlags /* faceMask */,
+    uint32_t /* reference */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilTestEnable(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* stencilTestEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilTestEnableEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* stencilTestEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilWriteMask(
+    VkCommandBuffer /* commandBuffer */,
+    VkStencilFaceFlags /* faceMask */,
+    uint32_t /* writeMask */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetTessellationDomainOriginEXT(
+    VkCommandBuffer /* commandBuffer */,
+    VkTessellationDomainOrigin /* domainOrigin */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetVertexInputEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* vertexBindingDescriptionCount */,
+    const VkVertexInputBindingDescription2EXT* /* pVertexBindingDescriptions */,
+    uint32_t /* vertexAttributeDescriptionCount */,
+    const VkVertexInputAttributeDescription2EXT* /* pVertexAttributeDescriptions */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetViewport(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstViewport */,
+    uint32_t /* viewportCount */,
+    const VkViewport* /* pViewports */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetViewportSwizzleNV(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* firstViewport */,
+    uint32_t /* viewportCount */,
+    const VkViewportSwizzleNV* /* pViewportSwizzles */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetViewportWScalingEnableNV(
+    VkCommandBuffer /* commandBuffer */,
+    VkBool32 /* viewportWScalingEnable */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetViewportWithCount(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* viewportCount */,
+    const VkViewport* /* pViewports */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetViewportWithCountEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* viewportCount */,
+    const VkViewport* /* pViewports */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdTraceRaysIndirect2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkDeviceAddress /* indirectDeviceAddress */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdTraceRaysIndirectKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkStridedDeviceAddressRegionKHR* /* pRaygenShaderBindingTable */,
+    const VkStridedDeviceAddressRegionKHR* /* pMissShaderBindingTable */,
+    const VkStridedDeviceAddressRegionKHR* /* pHitShaderBindingTable */,
+    const VkStridedDeviceAddressRegionKHR* /* pCallableShaderBindingTable */,
+    VkDeviceAddress /* indirectDeviceAddress */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdTraceRaysKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkStridedDeviceAddressRegionKHR* /* pRaygenShaderBindingTable */,
+    const VkStridedDeviceAddressRegionKHR* /* pMissShaderBindingTable */,
+    const VkStridedDeviceAddressRegionKHR* /* pHitShaderBindingTable */,
+    const VkStridedDeviceAddressRegionKHR* /* pCallableShaderBindingTable */,
+    uint32_t /* width */,
+    uint32_t /* height */,
+    uint32_t /* depth */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdUpdateBuffer(
+    VkCommandBuffer /* commandBuffer */,
+    VkBuffer /* dstBuffer */,
+    VkDeviceSize /* dstOffset */,
+    VkDeviceSize /* dataSize */,
+    const void* /* pData */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdUpdateMemoryKHR(
+    VkCommandBuffer /* commandBuffer */,
+    const VkDeviceAddressRangeKHR* /* pDstRange */,
+    VkAddressCommandFlagsKHR /* dstFlags */,
+    VkDeviceSize /* dataSize */,
+    const void* /* pData */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWaitEvents(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* eventCount */,
+    const VkEvent* /* pEvents */,
+    VkPipelineStageFlags /* srcStageMask */,
+    VkPipelineStageFlags /* dstStageMask */,
+    uint32_t /* memoryBarrierCount */,
+    const VkMemoryBarrier* /* pMemoryBarriers */,
+    uint32_t /* bufferMemoryBarrierCount */,
+    const VkBufferMemoryBarrier* /* pBufferMemoryBarriers */,
+    uint32_t /* imageMemoryBarrierCount */,
+    const VkImageMemoryBarrier* /* pImageMemoryBarriers */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWaitEvents2(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* eventCount */,
+    const VkEvent* /* pEvents */,
+    const VkDependencyInfo* /* pDependencyInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWaitEvents2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* eventCount */,
+    const VkEvent* /* pEvents */,
+    const VkDependencyInfo* /* pDependencyInfos */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteAccelerationStructuresPropertiesKHR(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* accelerationStructureCount */,
+    const VkAccelerationStructureKHR* /* pAccelerationStructures */,
+    VkQueryType /* queryType */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* firstQuery */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteBufferMarker2AMD(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineStageFlags2 /* stage */,
+    VkBuffer /* dstBuffer */,
+    VkDeviceSize /* dstOffset */,
+    uint32_t /* marker */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteMarkerToMemoryAMD(
+    VkCommandBuffer /* commandBuffer */,
+    const VkMemoryMarkerInfoAMD* /* pInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteMicromapsPropertiesEXT(
+    VkCommandBuffer /* commandBuffer */,
+    uint32_t /* micromapCount */,
+    const VkMicromapEXT* /* pMicromaps */,
+    VkQueryType /* queryType */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* firstQuery */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteTimestamp(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineStageFlagBits /* pipelineStage */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* query */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteTimestamp2(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineStageFlags2 /* stage */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* query */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteTimestamp2KHR(
+    VkCommandBuffer /* commandBuffer */,
+    VkPipelineStageFlags2 /* stage */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* query */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyAccelerationStructureKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    const VkCopyAccelerationStructureInfoKHR* /* pInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyAccelerationStructureToMemoryKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    const VkCopyAccelerationStructureToMemoryInfoKHR* /* pInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyImageToImage(
+    VkDevice /* device */,
+    const VkCopyImageToImageInfo* /* pCopyImageToImageInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyImageToImageEXT(
+    VkDevice /* device */,
+    const VkCopyImageToImageInfo* /* pCopyImageToImageInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyImageToMemory(
+    VkDevice /* device */,
+    const VkCopyImageToMemoryInfo* /* pCopyImageToMemoryInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyImageToMemoryEXT(
+    VkDevice /* device */,
+    const VkCopyImageToMemoryInfo* /* pCopyImageToMemoryInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyMemoryToAccelerationStructureKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    const VkCopyMemoryToAccelerationStructureInfoKHR* /* pInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyMemoryToImage(
+    VkDevice /* device */,
+    const VkCopyMemoryToImageInfo* /* pCopyMemoryToImageInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyMemoryToImageEXT(
+    VkDevice /* device */,
+    const VkCopyMemoryToImageInfo* /* pCopyMemoryToImageInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyMemoryToMicromapEXT(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    const VkCopyMemoryToMicromapInfoEXT* /* pInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyMicromapEXT(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    const VkCopyMicromapInfoEXT* /* pInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCopyMicromapToMemoryEXT(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    const VkCopyMicromapToMemoryInfoEXT* /* pInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateAccelerationStructure2KHR(
+    VkDevice /* device */,
+    const VkAccelerationStructureCreateInfo2KHR* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkAccelerationStructureKHR* pAccelerationStructure
+) {
+    *pAccelerationStructure = createHandle<VkAccelerationStructureKHR>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateAccelerationStructureKHR(
+    VkDevice /* device */,
+    const VkAccelerationStructureCreateInfoKHR* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkAccelerationStructureKHR* pAccelerationStructure
+) {
+    *pAccelerationStructure = createHandle<VkAccelerationStructureKHR>();
+    return VK_SUCCESS;
+}
+
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateAndroidSurfaceKHR(
+    VkInstance /* instance */,
+    const VkAndroidSurfaceCreateInfoKHR* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkSurfaceKHR* pSurface
+) {
+    *pSurface = createHandle<VkSurfaceKHR>();
+    return VK_SUCCESS;
+}
+
+#endif
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateBuffer(
+    VkDevice /* device */,
+    const VkBufferCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkBuffer* pBuffer
+) {
+    *pBuffer = createHandle<VkBuffer>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateBufferView(
+    VkDevice /* device */,
+    const VkBufferViewCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkBufferView* pView
+) {
+    *pView = createHandle<VkBufferView>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateCommandPool(
+    VkDevice /* device */,
+    const VkCommandPoolCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkCommandPool* pCommandPool
+) {
+    *pCommandPool = createHandle<VkCommandPool>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateComputePipelines(
+    VkDevice /* device */,
+    VkPipelineCache /* pipelineCache */,
+    uint32_t createInfoCount,
+    const VkComputePipelineCreateInfo* /* pCreateInfos */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPipeline* pPipelines
+) {
+    for (uint32_t i = 0; i < createInfoCount; i++)
+    {
+        pPipelines[i] = createHandle<VkPipeline>();
+    }
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDataGraphPipelineSessionARM(
+    VkDevice /* device */,
+    const VkDataGraphPipelineSessionCreateInfoARM* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDataGraphPipelineSessionARM* pSession
+) {
+    *pSession = createHandle<VkDataGraphPipelineSessionARM>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDataGraphPipelinesARM(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    VkPipelineCache /* pipelineCache */,
+    uint32_t createInfoCount,
+    const VkDataGraphPipelineCreateInfoARM* /* pCreateInfos */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPipeline* pPipelines
+) {
+    for (uint32_t i = 0; i < createInfoCount; i++)
+    {
+        pPipelines[i] = createHandle<VkPipeline>();
+    }
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDebugReportCallbackEXT(
+    VkInstance /* instance */,
+    const VkDebugReportCallbackCreateInfoEXT* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDebugReportCallbackEXT* pCallback
+) {
+    *pCallback = createHandle<VkDebugReportCallbackEXT>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDebugUtilsMessengerEXT(
+    VkInstance /* instance */,
+    const VkDebugUtilsMessengerCreateInfoEXT* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDebugUtilsMessengerEXT* pMessenger
+) {
+    *pMessenger = createHandle<VkDebugUtilsMessengerEXT>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDeferredOperationKHR(
+    VkDevice /* device */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDeferredOperationKHR* pDeferredOperation
+) {
+    *pDeferredOperation = createHandle<VkDeferredOperationKHR>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDescriptorPool(
+    VkDevice /* device */,
+    const VkDescriptorPoolCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDescriptorPool* pDescriptorPool
+) {
+    *pDescriptorPool = createHandle<VkDescriptorPool>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDescriptorSetLayout(
+    VkDevice /* device */,
+    const VkDescriptorSetLayoutCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDescriptorSetLayout* pSetLayout
+) {
+    *pSetLayout = createHandle<VkDescriptorSetLayout>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDescriptorUpdateTemplate(
+    VkDevice /* device */,
+    const VkDescriptorUpdateTemplateCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate
+) {
+    *pDescriptorUpdateTemplate = createHandle<VkDescriptorUpdateTemplate>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDescriptorUpdateTemplateKHR(
+    VkDevice /* device */,
+    const VkDescriptorUpdateTemplateCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate
+) {
+    *pDescriptorUpdateTemplate = createHandle<VkDescriptorUpdateTemplate>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDisplayModeKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkDisplayKHR /* display */,
+    const VkDisplayModeCreateInfoKHR* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkDisplayModeKHR* pMode
+) {
+    *pMode = createHandle<VkDisplayModeKHR>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDisplayPlaneSurfaceKHR(
+    VkInstance /* instance */,
+    const VkDisplaySurfaceCreateInfoKHR* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkSurfaceKHR* pSurface
+) {
+    *pSurface = createHandle<VkSurfaceKHR>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateEvent(
+    VkDevice /* device */,
+    const VkEventCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkEvent* pEvent
+) {
+    *pEvent = createHandle<VkEvent>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateFence(
+    VkDevice /* device */,
+    const VkFenceCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkFence* pFence
+) {
+    *pFence = createHandle<VkFence>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateFramebuffer(
+    VkDevice /* device */,
+    const VkFramebufferCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkFramebuffer* pFramebuffer
+) {
+    *pFramebuffer = createHandle<VkFramebuffer>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateGraphicsPipelines(
+    VkDevice /* device */,
+    VkPipelineCache /* pipelineCache */,
+    uint32_t createInfoCount,
+    const VkGraphicsPipelineCreateInfo* /* pCreateInfos */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPipeline* pPipelines
+) {
+    for (uint32_t i = 0; i < createInfoCount; i++)
+    {
+        pPipelines[i] = createHandle<VkPipeline>();
+    }
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateImage(
+    VkDevice /* device */,
+    const VkImageCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkImage* pImage
+) {
+    *pImage = createHandle<VkImage>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateImageView(
+    VkDevice /* device */,
+    const VkImageViewCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkImageView* pView
+) {
+    *pView = createHandle<VkImageView>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateIndirectCommandsLayoutEXT(
+    VkDevice /* device */,
+    const VkIndirectCommandsLayoutCreateInfoEXT* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkIndirectCommandsLayoutEXT* pIndirectCommandsLayout
+) {
+    *pIndirectCommandsLayout = createHandle<VkIndirectCommandsLayoutEXT>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateIndirectExecutionSetEXT(
+    VkDevice /* device */,
+    const VkIndirectExecutionSetCreateInfoEXT* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkIndirectExecutionSetEXT* pIndirectExecutionSet
+) {
+    *pIndirectExecutionSet = createHandle<VkIndirectExecutionSetEXT>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateMicromapEXT(
+    VkDevice /* device */,
+    const VkMicromapCreateInfoEXT* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkMicromapEXT* pMicromap
+) {
+    *pMicromap = createHandle<VkMicromapEXT>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreatePipelineBinariesKHR(
+    VkDevice /* device */,
+    const VkPipelineBinaryCreateInfoKHR* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPipelineBinaryHandlesInfoKHR* /* pBinaries */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreatePipelineCache(
+    VkDevice /* device */,
+    const VkPipelineCacheCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPipelineCache* pPipelineCache
+) {
+    *pPipelineCache = createHandle<VkPipelineCache>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreatePipelineLayout(
+    VkDevice /* device */,
+    const VkPipelineLayoutCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPipelineLayout* pPipelineLayout
+) {
+    *pPipelineLayout = createHandle<VkPipelineLayout>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreatePrivateDataSlot(
+    VkDevice /* device */,
+    const VkPrivateDataSlotCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPrivateDataSlot* pPrivateDataSlot
+) {
+    *pPrivateDataSlot = createHandle<VkPrivateDataSlot>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreatePrivateDataSlotEXT(
+    VkDevice /* device */,
+    const VkPrivateDataSlotCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPrivateDataSlot* pPrivateDataSlot
+) {
+    *pPrivateDataSlot = createHandle<VkPrivateDataSlot>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateQueryPool(
+    VkDevice /* device */,
+    const VkQueryPoolCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkQueryPool* pQueryPool
+) {
+    *pQueryPool = createHandle<VkQueryPool>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateRayTracingPipelinesKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* deferredOperation */,
+    VkPipelineCache /* pipelineCache */,
+    uint32_t createInfoCount,
+    const VkRayTracingPipelineCreateInfoKHR* /* pCreateInfos */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkPipeline* pPipelines
+) {
+    for (uint32_t i = 0; i < createInfoCount; i++)
+    {
+        pPipelines[i] = createHandle<VkPipeline>();
+    }
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateRenderPass(
+    VkDevice /* device */,
+    const VkRenderPassCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkRenderPass* pRenderPass
+) {
+    *pRenderPass = createHandle<VkRenderPass>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateRenderPass2(
+    VkDevice /* device */,
+    const VkRenderPassCreateInfo2* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkRenderPass* pRenderPass
+) {
+    *pRenderPass = createHandle<VkRenderPass>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateRenderPass2KHR(
+    VkDevice /* device */,
+    const VkRenderPassCreateInfo2* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkRenderPass* pRenderPass
+) {
+    *pRenderPass = createHandle<VkRenderPass>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSampler(
+    VkDevice /* device */,
+    const VkSamplerCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkSampler* pSampler
+) {
+    *pSampler = createHandle<VkSampler>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSamplerYcbcrConversion(
+    VkDevice /* device */,
+    const VkSamplerYcbcrConversionCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkSamplerYcbcrConversion* pYcbcrConversion
+) {
+    *pYcbcrConversion = createHandle<VkSamplerYcbcrConversion>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSamplerYcbcrConversionKHR(
+    VkDevice /* device */,
+    const VkSamplerYcbcrConversionCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkSamplerYcbcrConversion* pYcbcrConversion
+) {
+    *pYcbcrConversion = createHandle<VkSamplerYcbcrConversion>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSemaphore(
+    VkDevice /* device */,
+    const VkSemaphoreCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkSemaphore* pSemaphore
+) {
+    *pSemaphore = createHandle<VkSemaphore>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateShaderInstrumentationARM(
+    VkDevice /* device */,
+    const VkShaderInstrumentationCreateInfoARM* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkShaderInstrumentationARM* pInstrumentation
+) {
+    *pInstrumentation = createHandle<VkShaderInstrumentationARM>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateShaderModule(
+    VkDevice /* device */,
+    const VkShaderModuleCreateInfo* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkShaderModule* pShaderModule
+) {
+    *pShaderModule = createHandle<VkShaderModule>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateShadersEXT(
+    VkDevice /* device */,
+    uint32_t createInfoCount,
+    const VkShaderCreateInfoEXT* /* pCreateInfos */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkShaderEXT* pShaders
+) {
+    for (uint32_t i = 0; i < createInfoCount; i++)
+    {
+        pShaders[i] = createHandle<VkShaderEXT>();
+    }
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSharedSwapchainsKHR(
+    VkDevice /* device */,
+    uint32_t swapchainCount,
+    const VkSwapchainCreateInfoKHR* /* pCreateInfos */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkSwapchainKHR* pSwapchains
+) {
+    for (uint32_t i = 0; i < swapchainCount; i++)
+    {
+        pSwapchains[i] = createHandle<VkSwapchainKHR>();
+    }
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSwapchainKHR(
+    VkDevice /* device */,
+    const VkSwapchainCreateInfoKHR* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkSwapchainKHR* pSwapchain
+) {
+    *pSwapchain = createHandle<VkSwapchainKHR>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateTensorARM(
+    VkDevice /* device */,
+    const VkTensorCreateInfoARM* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkTensorARM* pTensor
+) {
+    *pTensor = createHandle<VkTensorARM>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateTensorViewARM(
+    VkDevice /* device */,
+    const VkTensorViewCreateInfoARM* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkTensorViewARM* pView
+) {
+    *pView = createHandle<VkTensorViewARM>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateValidationCacheEXT(
+    VkDevice /* device */,
+    const VkValidationCacheCreateInfoEXT* /* pCreateInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkValidationCacheEXT* pValidationCache
+) {
+    *pValidationCache = createHandle<VkValidationCacheEXT>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkDebugMarkerSetObjectNameEXT(
+    VkDevice /* device */,
+    const VkDebugMarkerObjectNameInfoEXT* /* pNameInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkDebugMarkerSetObjectTagEXT(
+    VkDevice /* device */,
+    const VkDebugMarkerObjectTagInfoEXT* /* pTagInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDebugReportMessageEXT(
+    VkInstance /* instance */,
+    VkDebugReportFlagsEXT /* flags */,
+    VkDebugReportObjectTypeEXT /* objectType */,
+    uint64_t /* object */,
+    size_t /* location */,
+    int32_t /* messageCode */,
+    const char* /* pLayerPrefix */,
+    const char* /* pMessage */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkDeferredOperationJoinKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* operation */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyAccelerationStructureKHR(
+    VkDevice /* device */,
+    VkAccelerationStructureKHR /* accelerationStructure */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyBuffer(
+    VkDevice /* device */,
+    VkBuffer /* buffer */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyBufferView(
+    VkDevice /* device */,
+    VkBufferView /* bufferView */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDataGraphPipelineSessionARM(
+    VkDevice /* device */,
+    VkDataGraphPipelineSessionARM /* session */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDebugReportCallbackEXT(
+    VkInstance /* instance */,
+    VkDebugReportCallbackEXT /* callback */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDebugUtilsMessengerEXT(
+    VkInstance /* instance */,
+    VkDebugUtilsMessengerEXT /* messenger */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDeferredOperationKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* operation */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDescriptorPool(
+    VkDevice /* device */,
+    VkDescriptorPool /* descriptorPool */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDescriptorSetLayout(
+    VkDevice /* device */,
+    VkDescriptorSetLayout /* descriptorSetLayout */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDescriptorUpdateTemplate(
+    VkDevice /* device */,
+    VkDescriptorUpdateTemplate /* descriptorUpdateTemplate */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDescriptorUpdateTemplateKHR(
+    VkDevice /* device */,
+    VkDescriptorUpdateTemplate /* descriptorUpdateTemplate */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyEvent(
+    VkDevice /* device */,
+    VkEvent /* event */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyFence(
+    VkDevice /* device */,
+    VkFence /* fence */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyFramebuffer(
+    VkDevice /* device */,
+    VkFramebuffer /* framebuffer */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyImage(
+    VkDevice /* device */,
+    VkImage /* image */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyImageView(
+    VkDevice /* device */,
+    VkImageView /* imageView */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyIndirectCommandsLayoutEXT(
+    VkDevice /* device */,
+    VkIndirectCommandsLayoutEXT /* indirectCommandsLayout */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyIndirectExecutionSetEXT(
+    VkDevice /* device */,
+    VkIndirectExecutionSetEXT /* indirectExecutionSet */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyMicromapEXT(
+    VkDevice /* device */,
+    VkMicromapEXT /* micromap */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPipeline(
+    VkDevice /* device */,
+    VkPipeline /* pipeline */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPipelineBinaryKHR(
+    VkDevice /* device */,
+    VkPipelineBinaryKHR /* pipelineBinary */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPipelineCache(
+    VkDevice /* device */,
+    VkPipelineCache /* pipelineCache */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPipelineLayout(
+    VkDevice /* device */,
+    VkPipelineLayout /* pipelineLayout */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPrivateDataSlot(
+    VkDevice /* device */,
+    VkPrivateDataSlot /* privateDataSlot */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPrivateDataSlotEXT(
+    VkDevice /* device */,
+    VkPrivateDataSlot /* privateDataSlot */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyQueryPool(
+    VkDevice /* device */,
+    VkQueryPool /* queryPool */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyRenderPass(
+    VkDevice /* device */,
+    VkRenderPass /* renderPass */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySampler(
+    VkDevice /* device */,
+    VkSampler /* sampler */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySamplerYcbcrConversion(
+    VkDevice /* device */,
+    VkSamplerYcbcrConversion /* ycbcrConversion */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySamplerYcbcrConversionKHR(
+    VkDevice /* device */,
+    VkSamplerYcbcrConversion /* ycbcrConversion */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySemaphore(
+    VkDevice /* device */,
+    VkSemaphore /* semaphore */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyShaderEXT(
+    VkDevice /* device */,
+    VkShaderEXT /* shader */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyShaderInstrumentationARM(
+    VkDevice /* device */,
+    VkShaderInstrumentationARM /* instrumentation */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyShaderModule(
+    VkDevice /* device */,
+    VkShaderModule /* shaderModule */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySurfaceKHR(
+    VkInstance /* instance */,
+    VkSurfaceKHR /* surface */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySwapchainKHR(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyTensorARM(
+    VkDevice /* device */,
+    VkTensorARM /* tensor */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyTensorViewARM(
+    VkDevice /* device */,
+    VkTensorViewARM /* tensorView */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyValidationCacheEXT(
+    VkDevice /* device */,
+    VkValidationCacheEXT /* validationCache */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkDeviceWaitIdle(
+    VkDevice /* device */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkDisplayPowerControlEXT(
+    VkDevice /* device */,
+    VkDisplayKHR /* display */,
+    const VkDisplayPowerInfoEXT* /* pDisplayPowerInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEndCommandBuffer(
+    VkCommandBuffer /* commandBuffer */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateDeviceLayerProperties(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pPropertyCount,
+    VkLayerProperties* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateInstanceLayerProperties(
+    uint32_t* pPropertyCount,
+    VkLayerProperties* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumeratePhysicalDeviceGroups(
+    VkInstance /* instance */,
+    uint32_t* pPhysicalDeviceGroupCount,
+    VkPhysicalDeviceGroupProperties* /* pPhysicalDeviceGroupProperties */
+) {
+    *pPhysicalDeviceGroupCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumeratePhysicalDeviceGroupsKHR(
+    VkInstance /* instance */,
+    uint32_t* pPhysicalDeviceGroupCount,
+    VkPhysicalDeviceGroupProperties* /* pPhysicalDeviceGroupProperties */
+) {
+    *pPhysicalDeviceGroupCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t /* queueFamilyIndex */,
+    uint32_t* pCounterCount,
+    VkPerformanceCounterARM* /* pCounters */,
+    VkPerformanceCounterDescriptionARM* /* pCounterDescriptions */
+) {
+    *pCounterCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t /* queueFamilyIndex */,
+    uint32_t* pCounterCount,
+    VkPerformanceCounterKHR* /* pCounters */,
+    VkPerformanceCounterDescriptionKHR* /* pCounterDescriptions */
+) {
+    *pCounterCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pDescriptionCount,
+    VkShaderInstrumentationMetricDescriptionARM* /* pDescriptions */
+) {
+    *pDescriptionCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkFlushMappedMemoryRanges(
+    VkDevice /* device */,
+    uint32_t /* memoryRangeCount */,
+    const VkMappedMemoryRange* /* pMemoryRanges */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkFreeDescriptorSets(
+    VkDevice /* device */,
+    VkDescriptorPool /* descriptorPool */,
+    uint32_t /* descriptorSetCount */,
+    const VkDescriptorSet* /* pDescriptorSets */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetAccelerationStructureBuildSizesKHR(
+    VkDevice /* device */,
+    VkAccelerationStructureBuildTypeKHR /* buildType */,
+    const VkAccelerationStructureBuildGeometryInfoKHR* /* pBuildInfo */,
+    const uint32_t* /* pMaxPrimitiveCounts */,
+    VkAccelerationStructureBuildSizesInfoKHR* /* pSizeInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL null_vkGetAccelerationStructureDeviceAddressKHR(
+    VkDevice /* device */,
+    const VkAccelerationStructureDeviceAddressInfoKHR* /* pInfo */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(
+    VkDevice /* device */,
+    const VkAccelerationStructureCaptureDescriptorDataInfoEXT* /* pInfo */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL null_vkGetBufferDeviceAddress(
+    VkDevice /* device */,
+    const VkBufferDeviceAddressInfo* /* pInfo */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL null_vkGetBufferDeviceAddressEXT(
+    VkDevice /* device */,
+    const VkBufferDeviceAddressInfo* /* pInfo */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL null_vkGetBufferDeviceAddressKHR(
+    VkDevice /* device */,
+    const VkBufferDeviceAddressInfo* /* pInfo */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetBufferMemoryRequirements(
+    VkDevice /* device */,
+    VkBuffer /* buffer */,
+    VkMemoryRequirements* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetBufferMemoryRequirements2(
+    VkDevice /* device */,
+    const VkBufferMemoryRequirementsInfo2* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetBufferMemoryRequirements2KHR(
+    VkDevice /* device */,
+    const VkBufferMemoryRequirementsInfo2* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR uint64_t VKAPI_CALL null_vkGetBufferOpaqueCaptureAddress(
+    VkDevice /* device */,
+    const VkBufferDeviceAddressInfo* /* pInfo */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR uint64_t VKAPI_CALL null_vkGetBufferOpaqueCaptureAddressKHR(
+    VkDevice /* device */,
+    const VkBufferDeviceAddressInfo* /* pInfo */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetBufferOpaqueCaptureDescriptorDataEXT(
+    VkDevice /* device */,
+    const VkBufferCaptureDescriptorDataInfoEXT* /* pInfo */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetCalibratedTimestampsEXT(
+    VkDevice /* device */,
+    uint32_t /* timestampCount */,
+    const VkCalibratedTimestampInfoKHR* /* pTimestampInfos */,
+    uint64_t* pTimestamps,
+    uint64_t* pMaxDeviation
+) {
+    *pTimestamps = 0;
+    *pMaxDeviation = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetCalibratedTimestampsKHR(
+    VkDevice /* device */,
+    uint32_t /* timestampCount */,
+    const VkCalibratedTimestampInfoKHR* /* pTimestampInfos */,
+    uint64_t* pTimestamps,
+    uint64_t* pMaxDeviation
+) {
+    *pTimestamps = 0;
+    *pMaxDeviation = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDataGraphPipelineAvailablePropertiesARM(
+    VkDevice /* device */,
+    const VkDataGraphPipelineInfoARM* /* pPipelineInfo */,
+    uint32_t* pPropertiesCount,
+    VkDataGraphPipelinePropertyARM* /* pProperties */
+) {
+    *pPropertiesCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDataGraphPipelinePropertiesARM(
+    VkDevice /* device */,
+    const VkDataGraphPipelineInfoARM* /* pPipelineInfo */,
+    uint32_t /* propertiesCount */,
+    VkDataGraphPipelinePropertyQueryResultARM* /* pProperties */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDataGraphPipelineSessionBindPointRequirementsARM(
+    VkDevice /* device */,
+    const VkDataGraphPipelineSessionBindPointRequirementsInfoARM* /* pInfo */,
+    uint32_t* pBindPointRequirementCount,
+    VkDataGraphPipelineSessionBindPointRequirementARM* /* pBindPointRequirements */
+) {
+    *pBindPointRequirementCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDataGraphPipelineSessionMemoryRequirementsARM(
+    VkDevice /* device */,
+    const VkDataGraphPipelineSessionMemoryRequirementsInfoARM* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR uint32_t VKAPI_CALL null_vkGetDeferredOperationMaxConcurrencyKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* operation */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDeferredOperationResultKHR(
+    VkDevice /* device */,
+    VkDeferredOperationKHR /* operation */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDescriptorEXT(
+    VkDevice /* device */,
+    const VkDescriptorGetInfoEXT* /* pDescriptorInfo */,
+    size_t /* dataSize */,
+    void* /* pDescriptor */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDescriptorSetLayoutBindingOffsetEXT(
+    VkDevice /* device */,
+    VkDescriptorSetLayout /* layout */,
+    uint32_t /* binding */,
+    VkDeviceSize* pOffset
+) {
+    *pOffset = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDescriptorSetLayoutSizeEXT(
+    VkDevice /* device */,
+    VkDescriptorSetLayout /* layout */,
+    VkDeviceSize* pLayoutSizeInBytes
+) {
+    *pLayoutSizeInBytes = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDescriptorSetLayoutSupport(
+    VkDevice /* device */,
+    const VkDescriptorSetLayoutCreateInfo* /* pCreateInfo */,
+    VkDescriptorSetLayoutSupport* /* pSupport */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDescriptorSetLayoutSupportKHR(
+    VkDevice /* device */,
+    const VkDescriptorSetLayoutCreateInfo* /* pCreateInfo */,
+    VkDescriptorSetLayoutSupport* /* pSupport */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceAccelerationStructureCompatibilityKHR(
+    VkDevice /* device */,
+    const VkAccelerationStructureVersionInfoKHR* /* pVersionInfo */,
+    VkAccelerationStructureCompatibilityKHR* /* pCompatibility */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceBufferMemoryRequirements(
+    VkDevice /* device */,
+    const VkDeviceBufferMemoryRequirements* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceBufferMemoryRequirementsKHR(
+    VkDevice /* device */,
+    const VkDeviceBufferMemoryRequirements* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDeviceFaultDebugInfoKHR(
+    VkDevice /* device */,
+    VkDeviceFaultDebugInfoKHR* /* pDebugInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDeviceFaultInfoEXT(
+    VkDevice /* device */,
+    VkDeviceFaultCountsEXT* /* pFaultCounts */,
+    VkDeviceFaultInfoEXT* /* pFaultInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDeviceFaultReportsKHR(
+    VkDevice /* device */,
+    uint64_t /* timeout */,
+    uint32_t* pFaultCounts,
+    VkDeviceFaultInfoKHR* /* pFaultInfo */
+) {
+    *pFaultCounts = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceGroupPeerMemoryFeatures(
+    VkDevice /* device */,
+    uint32_t /* heapIndex */,
+    uint32_t /* localDeviceIndex */,
+    uint32_t /* remoteDeviceIndex */,
+    VkPeerMemoryFeatureFlags* /* pPeerMemoryFeatures */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceGroupPeerMemoryFeaturesKHR(
+    VkDevice /* device */,
+    uint32_t /* heapIndex */,
+    uint32_t /* localDeviceIndex */,
+    uint32_t /* remoteDeviceIndex */,
+    VkPeerMemoryFeatureFlags* /* pPeerMemoryFeatures */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDeviceGroupPresentCapabilitiesKHR(
+    VkDevice /* device */,
+    VkDeviceGroupPresentCapabilitiesKHR* /* pDeviceGroupPresentCapabilities */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDeviceGroupSurfacePresentModesKHR(
+    VkDevice /* device */,
+    VkSurfaceKHR /* surface */,
+    VkDeviceGroupPresentModeFlagsKHR* /* pModes */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceImageMemoryRequirements(
+    VkDevice /* device */,
+    const VkDeviceImageMemoryRequirements* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceImageMemoryRequirementsKHR(
+    VkDevice /* device */,
+    const VkDeviceImageMemoryRequirements* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceImageSparseMemoryRequirements(
+    VkDevice /* device */,
+    const VkDeviceImageMemoryRequirements* /* pInfo */,
+    uint32_t* pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2* /* pSparseMemoryRequirements */
+) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceImageSparseMemoryRequirementsKHR(
+    VkDevice /* device */,
+    const VkDeviceImageMemoryRequirements* /* pInfo */,
+    uint32_t* pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2* /* pSparseMemoryRequirements */
+) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceImageSubresourceLayout(
+    VkDevice /* device */,
+    const VkDeviceImageSubresourceInfo* /* pInfo */,
+    VkSubresourceLayout2* /* pLayout */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceImageSubresourceLayoutKHR(
+    VkDevice /* device */,
+    const VkDeviceImageSubresourceInfo* /* pInfo */,
+    VkSubresourceLayout2* /* pLayout */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceMemoryCommitment(
+    VkDevice /* device */,
+    VkDeviceMemory /* memory */,
+    VkDeviceSize* pCommittedMemoryInBytes
+) {
+    *pCommittedMemoryInBytes = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR uint64_t VKAPI_CALL null_vkGetDeviceMemoryOpaqueCaptureAddress(
+    VkDevice /* device */,
+    const VkDeviceMemoryOpaqueCaptureAddressInfo* /* pInfo */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR uint64_t VKAPI_CALL null_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
+    VkDevice /* device */,
+    const VkDeviceMemoryOpaqueCaptureAddressInfo* /* pInfo */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceMicromapCompatibilityEXT(
+    VkDevice /* device */,
+    const VkMicromapVersionInfoEXT* /* pVersionInfo */,
+    VkAccelerationStructureCompatibilityKHR* /* pCompatibility */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceTensorMemoryRequirementsARM(
+    VkDevice /* device */,
+    const VkDeviceTensorMemoryRequirementsARM* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayModeProperties2KHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkDisplayKHR /* display */,
+    uint32_t* pPropertyCount,
+    VkDisplayModeProperties2KHR* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayModePropertiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkDisplayKHR /* display */,
+    uint32_t* pPropertyCount,
+    VkDisplayModePropertiesKHR* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayPlaneCapabilities2KHR(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkDisplayPlaneInfo2KHR* /* pDisplayPlaneInfo */,
+    VkDisplayPlaneCapabilities2KHR* /* pCapabilities */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayPlaneCapabilitiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkDisplayModeKHR /* mode */,
+    uint32_t /* planeIndex */,
+    VkDisplayPlaneCapabilitiesKHR* /* pCapabilities */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayPlaneSupportedDisplaysKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t /* planeIndex */,
+    uint32_t* pDisplayCount,
+    VkDisplayKHR* /* pDisplays */
+) {
+    *pDisplayCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetFenceFdKHR(
+    VkDevice /* device */,
+    const VkFenceGetFdInfoKHR* /* pGetFdInfo */,
+    int* /* pFd */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetFenceStatus(
+    VkDevice /* device */,
+    VkFence /* fence */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetGeneratedCommandsMemoryRequirementsEXT(
+    VkDevice /* device */,
+    const VkGeneratedCommandsMemoryRequirementsInfoEXT* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetImageDrmFormatModifierPropertiesEXT(
+    VkDevice /* device */,
+    VkImage /* image */,
+    VkImageDrmFormatModifierPropertiesEXT* /* pProperties */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageMemoryRequirements(
+    VkDevice /* device */,
+    VkImage /* image */,
+    VkMemoryRequirements* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageMemoryRequirements2(
+    VkDevice /* device */,
+    const VkImageMemoryRequirementsInfo2* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageMemoryRequirements2KHR(
+    VkDevice /* device */,
+    const VkImageMemoryRequirementsInfo2* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetImageOpaqueCaptureDataEXT(
+    VkDevice /* device */,
+    uint32_t /* imageCount */,
+    const VkImage* /* pImages */,
+    VkHostAddressRangeEXT* /* pDatas */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetImageOpaqueCaptureDescriptorDataEXT(
+    VkDevice /* device */,
+    const VkImageCaptureDescriptorDataInfoEXT* /* pInfo */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSparseMemoryRequirements(
+    VkDevice /* device */,
+    VkImage /* image */,
+    uint32_t* pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements* /* pSparseMemoryRequirements */
+) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSparseMemoryRequirements2(
+    VkDevice /* device */,
+    const VkImageSparseMemoryRequirementsInfo2* /* pInfo */,
+    uint32_t* pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2* /* pSparseMemoryRequirements */
+) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSparseMemoryRequirements2KHR(
+    VkDevice /* device */,
+    const VkImageSparseMemoryRequirementsInfo2* /* pInfo */,
+    uint32_t* pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2* /* pSparseMemoryRequirements */
+) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSubresourceLayout(
+    VkDevice /* device */,
+    VkImage /* image */,
+    const VkImageSubresource* /* pSubresource */,
+    VkSubresourceLayout* /* pLayout */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSubresourceLayout2(
+    VkDevice /* device */,
+    VkImage /* image */,
+    const VkImageSubresource2* /* pSubresource */,
+    VkSubresourceLayout2* /* pLayout */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSubresourceLayout2EXT(
+    VkDevice /* device */,
+    VkImage /* image */,
+    const VkImageSubresource2* /* pSubresource */,
+    VkSubresourceLayout2* /* pLayout */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSubresourceLayout2KHR(
+    VkDevice /* device */,
+    VkImage /* image */,
+    const VkImageSubresource2* /* pSubresource */,
+    VkSubresourceLayout2* /* pLayout */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetImageViewOpaqueCaptureDescriptorDataEXT(
+    VkDevice /* device */,
+    const VkImageViewCaptureDescriptorDataInfoEXT* /* pInfo */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetMemoryFdKHR(
+    VkDevice /* device */,
+    const VkMemoryGetFdInfoKHR* /* pGetFdInfo */,
+    int* /* pFd */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetMemoryFdPropertiesKHR(
+    VkDevice /* device */,
+    VkExternalMemoryHandleTypeFlagBits /* handleType */,
+    int /* fd */,
+    VkMemoryFdPropertiesKHR* /* pMemoryFdProperties */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetMemoryHostPointerPropertiesEXT(
+    VkDevice /* device */,
+    VkExternalMemoryHandleTypeFlagBits /* handleType */,
+    const void* /* pHostPointer */,
+    VkMemoryHostPointerPropertiesEXT* /* pMemoryHostPointerProperties */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetMicromapBuildSizesEXT(
+    VkDevice /* device */,
+    VkAccelerationStructureBuildTypeKHR /* buildType */,
+    const VkMicromapBuildInfoEXT* /* pBuildInfo */,
+    VkMicromapBuildSizesInfoEXT* /* pSizeInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPastPresentationTimingEXT(
+    VkDevice /* device */,
+    const VkPastPresentationTimingInfoEXT* /* pPastPresentationTimingInfo */,
+    VkPastPresentationTimingPropertiesEXT* /* pPastPresentationTimingProperties */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pTimeDomainCount,
+    VkTimeDomainKHR* /* pTimeDomains */
+) {
+    *pTimeDomainCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceCalibrateableTimeDomainsKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pTimeDomainCount,
+    VkTimeDomainKHR* /* pTimeDomains */
+) {
+    *pTimeDomainCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceCooperativeMatrixProperties2EXT(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceCooperativeMatrixInfo2EXT* /* pCooperativeMatrixInfo */,
+    uint32_t* pPropertyCount,
+    VkCooperativeMatrixProperties2EXT* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pPropertyCount,
+    VkCooperativeMatrixPropertiesKHR* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkDeviceSize VKAPI_CALL null_vkGetPhysicalDeviceDescriptorSizeEXT(
+    VkPhysicalDevice /* physicalDevice */,
+    VkDescriptorType /* descriptorType */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pPropertyCount,
+    VkDisplayPlaneProperties2KHR* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pPropertyCount,
+    VkDisplayPlanePropertiesKHR* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceDisplayProperties2KHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pPropertyCount,
+    VkDisplayProperties2KHR* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceDisplayPropertiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pPropertyCount,
+    VkDisplayPropertiesKHR* /* pProperties */
+) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalBufferProperties(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceExternalBufferInfo* /* pExternalBufferInfo */,
+    VkExternalBufferProperties* /* pExternalBufferProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceExternalBufferInfo* /* pExternalBufferInfo */,
+    VkExternalBufferProperties* /* pExternalBufferProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalFenceProperties(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceExternalFenceInfo* /* pExternalFenceInfo */,
+    VkExternalFenceProperties* /* pExternalFenceProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalFencePropertiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceExternalFenceInfo* /* pExternalFenceInfo */,
+    VkExternalFenceProperties* /* pExternalFenceProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalSemaphoreProperties(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceExternalSemaphoreInfo* /* pExternalSemaphoreInfo */,
+    VkExternalSemaphoreProperties* /* pExternalSemaphoreProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceExternalSemaphoreInfo* /* pExternalSemaphoreInfo */,
+    VkExternalSemaphoreProperties* /* pExternalSemaphoreProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalTensorPropertiesARM(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceExternalTensorInfoARM* /* pExternalTensorInfo */,
+    VkExternalTensorPropertiesARM* /* pExternalTensorProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFormatProperties(
+    VkPhysicalDevice /* physicalDevice */,
+    VkFormat /* format */,
+    VkFormatProperties* /* pFormatProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFormatProperties2(
+    VkPhysicalDevice /* physicalDevice */,
+    VkFormat /* format */,
+    VkFormatProperties2* /* pFormatProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFormatProperties2KHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkFormat /* format */,
+    VkFormatProperties2* /* pFormatProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceFragmentShadingRatesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pFragmentShadingRateCount,
+    VkPhysicalDeviceFragmentShadingRateKHR* /* pFragmentShadingRates */
+) {
+    *pFragmentShadingRateCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceMultisamplePropertiesEXT(
+    VkPhysicalDevice /* physicalDevice */,
+    VkSampleCountFlagBits /* samples */,
+    VkMultisamplePropertiesEXT* /* pMultisampleProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDevicePresentRectanglesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkSurfaceKHR /* surface */,
+    uint32_t* pRectCount,
+    VkRect2D* /* pRects */
+) {
+    *pRectCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t /* queueFamilyIndex */,
+    const VkQueueFamilyDataGraphPropertiesARM* /* pQueueFamilyDataGraphProperties */,
+    VkBaseOutStructure* /* pProperties */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t /* queueFamilyIndex */,
+    const VkQueueFamilyDataGraphPropertiesARM* /* pQueueFamilyDataGraphProperties */,
+    const VkDataGraphOpticalFlowImageFormatInfoARM* /* pOpticalFlowImageFormatInfo */,
+    uint32_t* pFormatCount,
+    VkDataGraphOpticalFlowImageFormatPropertiesARM* /* pImageFormatProperties */
+) {
+    *pFormatCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceQueueFamilyDataGraphProcessingEngineInfoARM* /* pQueueFamilyDataGraphProcessingEngineInfo */,
+    VkQueueFamilyDataGraphProcessingEnginePropertiesARM* /* pQueueFamilyDataGraphProcessingEngineProperties */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t /* queueFamilyIndex */,
+    uint32_t* pQueueFamilyDataGraphPropertyCount,
+    VkQueueFamilyDataGraphPropertiesARM* /* pQueueFamilyDataGraphProperties */
+) {
+    *pQueueFamilyDataGraphPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkQueryPoolPerformanceCreateInfoKHR* /* pPerformanceQueryCreateInfo */,
+    uint32_t* pNumPasses
+) {
+    *pNumPasses = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceSparseImageFormatProperties(
+    VkPhysicalDevice /* physicalDevice */,
+    VkFormat /* format */,
+    VkImageType /* type */,
+    VkSampleCountFlagBits /* samples */,
+    VkImageUsageFlags /* usage */,
+    VkImageTiling /* tiling */,
+    uint32_t* pPropertyCount,
+    VkSparseImageFormatProperties* /* pProperties */
+) {
+    *pPropertyCount = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceSparseImageFormatProperties2(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceSparseImageFormatInfo2* /* pFormatInfo */,
+    uint32_t* pPropertyCount,
+    VkSparseImageFormatProperties2* /* pProperties */
+) {
+    *pPropertyCount = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceSparseImageFormatInfo2* /* pFormatInfo */,
+    uint32_t* pPropertyCount,
+    VkSparseImageFormatProperties2* /* pProperties */
+) {
+    *pPropertyCount = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
+    VkPhysicalDevice /* physicalDevice */,
+    VkSurfaceKHR /* surface */,
+    VkSurfaceCapabilities2EXT* /* pSurfaceCapabilities */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceSurfaceInfo2KHR* /* pSurfaceInfo */,
+    VkSurfaceCapabilities2KHR* /* pSurfaceCapabilities */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkSurfaceKHR /* surface */,
+    VkSurfaceCapabilitiesKHR* /* pSurfaceCapabilities */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceFormats2KHR(
+    VkPhysicalDevice /* physicalDevice */,
+    const VkPhysicalDeviceSurfaceInfo2KHR* /* pSurfaceInfo */,
+    uint32_t* pSurfaceFormatCount,
+    VkSurfaceFormat2KHR* /* pSurfaceFormats */
+) {
+    *pSurfaceFormatCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceFormatsKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkSurfaceKHR /* surface */,
+    uint32_t* pSurfaceFormatCount,
+    VkSurfaceFormatKHR* /* pSurfaceFormats */
+) {
+    *pSurfaceFormatCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfacePresentModesKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    VkSurfaceKHR /* surface */,
+    uint32_t* pPresentModeCount,
+    VkPresentModeKHR* /* pPresentModes */
+) {
+    *pPresentModeCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceSupportKHR(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t /* queueFamilyIndex */,
+    VkSurfaceKHR /* surface */,
+    VkBool32* pSupported
+) {
+    *pSupported = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceToolProperties(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pToolCount,
+    VkPhysicalDeviceToolProperties* /* pToolProperties */
+) {
+    *pToolCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceToolPropertiesEXT(
+    VkPhysicalDevice /* physicalDevice */,
+    uint32_t* pToolCount,
+    VkPhysicalDeviceToolProperties* /* pToolProperties */
+) {
+    *pToolCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPipelineBinaryDataKHR(
+    VkDevice /* device */,
+    const VkPipelineBinaryDataInfoKHR* /* pInfo */,
+    VkPipelineBinaryKeyKHR* /* pPipelineBinaryKey */,
+    size_t* pPipelineBinaryDataSize,
+    void* /* pPipelineBinaryData */
+) {
+    *pPipelineBinaryDataSize = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPipelineCacheData(
+    VkDevice /* device */,
+    VkPipelineCache /* pipelineCache */,
+    size_t* pDataSize,
+    void* /* pData */
+) {
+    *pDataSize = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPipelineExecutableInternalRepresentationsKHR(
+    VkDevice /* device */,
+    const VkPipelineExecutableInfoKHR* /* pExecutableInfo */,
+    uint32_t* pInternalRepresentationCount,
+    VkPipelineExecutableInternalRepresentationKHR* /* pInternalRepresentations */
+) {
+    *pInternalRepresentationCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPipelineExecutablePropertiesKHR(
+    VkDevice /* device */,
+    const VkPipelineInfoKHR* /* pPipelineInfo */,
+    uint32_t* pExecutableCount,
+    VkPipelineExecutablePropertiesKHR* /* pProperties */
+) {
+    *pExecutableCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPipelineExecutableStatisticsKHR(
+    VkDevice /* device */,
+    const VkPipelineExecutableInfoKHR* /* pExecutableInfo */,
+    uint32_t* pStatisticCount,
+    VkPipelineExecutableStatisticKHR* /* pStatistics */
+) {
+    *pStatisticCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPipelineKeyKHR(
+    VkDevice /* device */,
+    const VkPipelineCreateInfoKHR* /* pPipelineCreateInfo */,
+    VkPipelineBinaryKeyKHR* /* pPipelineKey */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPipelinePropertiesEXT(
+    VkDevice /* device */,
+    const VkPipelineInfoKHR* /* pPipelineInfo */,
+    VkBaseOutStructure* /* pPipelineProperties */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPrivateData(
+    VkDevice /* device */,
+    VkObjectType /* objectType */,
+    uint64_t /* objectHandle */,
+    VkPrivateDataSlot /* privateDataSlot */,
+    uint64_t* pData
+) {
+    *pData = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPrivateDataEXT(
+    VkDevice /* device */,
+    VkObjectType /* objectType */,
+    uint64_t /* objectHandle */,
+    VkPrivateDataSlot /* privateDataSlot */,
+    uint64_t* pData
+) {
+    *pData = 0;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(
+    VkDevice /* device */,
+    VkPipeline /* pipeline */,
+    uint32_t /* firstGroup */,
+    uint32_t /* groupCount */,
+    size_t /* dataSize */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetRayTracingShaderGroupHandlesKHR(
+    VkDevice /* device */,
+    VkPipeline /* pipeline */,
+    uint32_t /* firstGroup */,
+    uint32_t /* groupCount */,
+    size_t /* dataSize */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkDeviceSize VKAPI_CALL null_vkGetRayTracingShaderGroupStackSizeKHR(
+    VkDevice /* device */,
+    VkPipeline /* pipeline */,
+    uint32_t /* group */,
+    VkShaderGroupShaderKHR /* groupShader */
+) {
+    return {};
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetRenderAreaGranularity(
+    VkDevice /* device */,
+    VkRenderPass /* renderPass */,
+    VkExtent2D* /* pGranularity */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetRenderingAreaGranularity(
+    VkDevice /* device */,
+    const VkRenderingAreaInfo* /* pRenderingAreaInfo */,
+    VkExtent2D* /* pGranularity */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetRenderingAreaGranularityKHR(
+    VkDevice /* device */,
+    const VkRenderingAreaInfo* /* pRenderingAreaInfo */,
+    VkExtent2D* /* pGranularity */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSamplerOpaqueCaptureDescriptorDataEXT(
+    VkDevice /* device */,
+    const VkSamplerCaptureDescriptorDataInfoEXT* /* pInfo */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSemaphoreCounterValue(
+    VkDevice /* device */,
+    VkSemaphore /* semaphore */,
+    uint64_t* pValue
+) {
+    *pValue = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSemaphoreCounterValueKHR(
+    VkDevice /* device */,
+    VkSemaphore /* semaphore */,
+    uint64_t* pValue
+) {
+    *pValue = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSemaphoreFdKHR(
+    VkDevice /* device */,
+    const VkSemaphoreGetFdInfoKHR* /* pGetFdInfo */,
+    int* /* pFd */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetShaderBinaryDataEXT(
+    VkDevice /* device */,
+    VkShaderEXT /* shader */,
+    size_t* pDataSize,
+    void* /* pData */
+) {
+    *pDataSize = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetShaderInstrumentationValuesARM(
+    VkDevice /* device */,
+    VkShaderInstrumentationARM /* instrumentation */,
+    uint32_t* pMetricBlockCount,
+    void* /* pMetricValues */,
+    VkShaderInstrumentationValuesFlagsARM /* flags */
+) {
+    *pMetricBlockCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetShaderModuleCreateInfoIdentifierEXT(
+    VkDevice /* device */,
+    const VkShaderModuleCreateInfo* /* pCreateInfo */,
+    VkShaderModuleIdentifierEXT* /* pIdentifier */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetShaderModuleIdentifierEXT(
+    VkDevice /* device */,
+    VkShaderModule /* shaderModule */,
+    VkShaderModuleIdentifierEXT* /* pIdentifier */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSwapchainCounterEXT(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    VkSurfaceCounterFlagBitsEXT /* counter */,
+    uint64_t* pCounterValue
+) {
+    *pCounterValue = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSwapchainImagesKHR(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    uint32_t* pSwapchainImageCount,
+    VkImage* /* pSwapchainImages */
+) {
+    *pSwapchainImageCount = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSwapchainStatusKHR(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSwapchainTimeDomainPropertiesEXT(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    VkSwapchainTimeDomainPropertiesEXT* /* pSwapchainTimeDomainProperties */,
+    uint64_t* pTimeDomainsCounter
+) {
+    *pTimeDomainsCounter = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSwapchainTimingPropertiesEXT(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    VkSwapchainTimingPropertiesEXT* /* pSwapchainTimingProperties */,
+    uint64_t* pSwapchainTimingPropertiesCounter
+) {
+    *pSwapchainTimingPropertiesCounter = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkGetTensorMemoryRequirementsARM(
+    VkDevice /* device */,
+    const VkTensorMemoryRequirementsInfoARM* /* pInfo */,
+    VkMemoryRequirements2* /* pMemoryRequirements */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetTensorOpaqueCaptureDataARM(
+    VkDevice /* device */,
+    uint32_t /* tensorCount */,
+    const VkTensorARM* /* pTensors */,
+    VkHostAddressRangeEXT* /* pDatas */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetTensorOpaqueCaptureDescriptorDataARM(
+    VkDevice /* device */,
+    const VkTensorCaptureDescriptorDataInfoARM* /* pInfo */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetTensorViewOpaqueCaptureDescriptorDataARM(
+    VkDevice /* device */,
+    const VkTensorViewCaptureDescriptorDataInfoARM* /* pInfo */,
+    void* /* pData */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetValidationCacheDataEXT(
+    VkDevice /* device */,
+    VkValidationCacheEXT /* validationCache */,
+    size_t* pDataSize,
+    void* /* pData */
+) {
+    *pDataSize = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkImportFenceFdKHR(
+    VkDevice /* device */,
+    const VkImportFenceFdInfoKHR* /* pImportFenceFdInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkImportSemaphoreFdKHR(
+    VkDevice /* device */,
+    const VkImportSemaphoreFdInfoKHR* /* pImportSemaphoreFdInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkInvalidateMappedMemoryRanges(
+    VkDevice /* device */,
+    uint32_t /* memoryRangeCount */,
+    const VkMappedMemoryRange* /* pMemoryRanges */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkMergePipelineCaches(
+    VkDevice /* device */,
+    VkPipelineCache /* dstCache */,
+    uint32_t /* srcCacheCount */,
+    const VkPipelineCache* /* pSrcCaches */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkMergeValidationCachesEXT(
+    VkDevice /* device */,
+    VkValidationCacheEXT /* dstCache */,
+    uint32_t /* srcCacheCount */,
+    const VkValidationCacheEXT* /* pSrcCaches */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkQueueBeginDebugUtilsLabelEXT(
+    VkQueue /* queue */,
+    const VkDebugUtilsLabelEXT* /* pLabelInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueBindSparse(
+    VkQueue /* queue */,
+    uint32_t /* bindInfoCount */,
+    const VkBindSparseInfo* /* pBindInfo */,
+    VkFence /* fence */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkQueueEndDebugUtilsLabelEXT(
+    VkQueue /* queue */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkQueueInsertDebugUtilsLabelEXT(
+    VkQueue /* queue */,
+    const VkDebugUtilsLabelEXT* /* pLabelInfo */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueuePresentKHR(
+    VkQueue /* queue */,
+    const VkPresentInfoKHR* /* pPresentInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueSubmit(
+    VkQueue /* queue */,
+    uint32_t /* submitCount */,
+    const VkSubmitInfo* /* pSubmits */,
+    VkFence /* fence */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueSubmit2(
+    VkQueue /* queue */,
+    uint32_t /* submitCount */,
+    const VkSubmitInfo2* /* pSubmits */,
+    VkFence /* fence */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueSubmit2KHR(
+    VkQueue /* queue */,
+    uint32_t /* submitCount */,
+    const VkSubmitInfo2* /* pSubmits */,
+    VkFence /* fence */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueWaitIdle(
+    VkQueue /* queue */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkRegisterCustomBorderColorEXT(
+    VkDevice /* device */,
+    const VkSamplerCustomBorderColorCreateInfoEXT* /* pBorderColor */,
+    VkBool32 /* requestIndex */,
+    uint32_t* pIndex
+) {
+    *pIndex = 0;
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkRegisterDeviceEventEXT(
+    VkDevice /* device */,
+    const VkDeviceEventInfoEXT* /* pDeviceEventInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkFence* pFence
+) {
+    *pFence = createHandle<VkFence>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkRegisterDisplayEventEXT(
+    VkDevice /* device */,
+    VkDisplayKHR /* display */,
+    const VkDisplayEventInfoEXT* /* pDisplayEventInfo */,
+    const VkAllocationCallbacks* /* pAllocator */,
+    VkFence* pFence
+) {
+    *pFence = createHandle<VkFence>();
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkReleaseCapturedPipelineDataKHR(
+    VkDevice /* device */,
+    const VkReleaseCapturedPipelineDataInfoKHR* /* pInfo */,
+    const VkAllocationCallbacks* /* pAllocator */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkReleaseDisplayEXT(
+    VkPhysicalDevice /* physicalDevice */,
+    VkDisplayKHR /* display */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkReleaseProfilingLockKHR(
+    VkDevice /* device */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkReleaseSwapchainImagesEXT(
+    VkDevice /* device */,
+    const VkReleaseSwapchainImagesInfoKHR* /* pReleaseInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkReleaseSwapchainImagesKHR(
+    VkDevice /* device */,
+    const VkReleaseSwapchainImagesInfoKHR* /* pReleaseInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetCommandBuffer(
+    VkCommandBuffer /* commandBuffer */,
+    VkCommandBufferResetFlags /* flags */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetCommandPool(
+    VkDevice /* device */,
+    VkCommandPool /* commandPool */,
+    VkCommandPoolResetFlags /* flags */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetDescriptorPool(
+    VkDevice /* device */,
+    VkDescriptorPool /* descriptorPool */,
+    VkDescriptorPoolResetFlags /* flags */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetEvent(
+    VkDevice /* device */,
+    VkEvent /* event */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetFences(
+    VkDevice /* device */,
+    uint32_t /* fenceCount */,
+    const VkFence* /* pFences */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkResetQueryPool(
+    VkDevice /* device */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* firstQuery */,
+    uint32_t /* queryCount */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkResetQueryPoolEXT(
+    VkDevice /* device */,
+    VkQueryPool /* queryPool */,
+    uint32_t /* firstQuery */,
+    uint32_t /* queryCount */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSetDebugUtilsObjectNameEXT(
+    VkDevice /* device */,
+    const VkDebugUtilsObjectNameInfoEXT* /* pNameInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSetDebugUtilsObjectTagEXT(
+    VkDevice /* device */,
+    const VkDebugUtilsObjectTagInfoEXT* /* pTagInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkSetDeviceMemoryPriorityEXT(
+    VkDevice /* device */,
+    VkDeviceMemory /* memory */,
+    float /* priority */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSetEvent(
+    VkDevice /* device */,
+    VkEvent /* event */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkSetHdrMetadataEXT(
+    VkDevice /* device */,
+    uint32_t /* swapchainCount */,
+    const VkSwapchainKHR* /* pSwapchains */,
+    const VkHdrMetadataEXT* /* pMetadata */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSetPrivateData(
+    VkDevice /* device */,
+    VkObjectType /* objectType */,
+    uint64_t /* objectHandle */,
+    VkPrivateDataSlot /* privateDataSlot */,
+    uint64_t /* data */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSetPrivateDataEXT(
+    VkDevice /* device */,
+    VkObjectType /* objectType */,
+    uint64_t /* objectHandle */,
+    VkPrivateDataSlot /* privateDataSlot */,
+    uint64_t /* data */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSetSwapchainPresentTimingQueueSizeEXT(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    uint32_t /* size */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSignalSemaphore(
+    VkDevice /* device */,
+    const VkSemaphoreSignalInfo* /* pSignalInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSignalSemaphoreKHR(
+    VkDevice /* device */,
+    const VkSemaphoreSignalInfo* /* pSignalInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkSubmitDebugUtilsMessageEXT(
+    VkInstance /* instance */,
+    VkDebugUtilsMessageSeverityFlagBitsEXT /* messageSeverity */,
+    VkDebugUtilsMessageTypeFlagsEXT /* messageTypes */,
+    const VkDebugUtilsMessengerCallbackDataEXT* /* pCallbackData */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkTransitionImageLayout(
+    VkDevice /* device */,
+    uint32_t /* transitionCount */,
+    const VkHostImageLayoutTransitionInfo* /* pTransitions */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkTransitionImageLayoutEXT(
+    VkDevice /* device */,
+    uint32_t /* transitionCount */,
+    const VkHostImageLayoutTransitionInfo* /* pTransitions */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkTrimCommandPool(
+    VkDevice /* device */,
+    VkCommandPool /* commandPool */,
+    VkCommandPoolTrimFlags /* flags */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkTrimCommandPoolKHR(
+    VkDevice /* device */,
+    VkCommandPool /* commandPool */,
+    VkCommandPoolTrimFlags /* flags */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkUnmapMemory(
+    VkDevice /* device */,
+    VkDeviceMemory /* memory */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkUnmapMemory2(
+    VkDevice /* device */,
+    const VkMemoryUnmapInfo* /* pMemoryUnmapInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkUnmapMemory2KHR(
+    VkDevice /* device */,
+    const VkMemoryUnmapInfo* /* pMemoryUnmapInfo */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkUnregisterCustomBorderColorEXT(
+    VkDevice /* device */,
+    uint32_t /* index */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkUpdateDescriptorSetWithTemplate(
+    VkDevice /* device */,
+    VkDescriptorSet /* descriptorSet */,
+    VkDescriptorUpdateTemplate /* descriptorUpdateTemplate */,
+    const void* /* pData */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkUpdateDescriptorSetWithTemplateKHR(
+    VkDevice /* device */,
+    VkDescriptorSet /* descriptorSet */,
+    VkDescriptorUpdateTemplate /* descriptorUpdateTemplate */,
+    const void* /* pData */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkUpdateDescriptorSets(
+    VkDevice /* device */,
+    uint32_t /* descriptorWriteCount */,
+    const VkWriteDescriptorSet* /* pDescriptorWrites */,
+    uint32_t /* descriptorCopyCount */,
+    const VkCopyDescriptorSet* /* pDescriptorCopies */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkUpdateIndirectExecutionSetPipelineEXT(
+    VkDevice /* device */,
+    VkIndirectExecutionSetEXT /* indirectExecutionSet */,
+    uint32_t /* executionSetWriteCount */,
+    const VkWriteIndirectExecutionSetPipelineEXT* /* pExecutionSetWrites */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR void VKAPI_CALL null_vkUpdateIndirectExecutionSetShaderEXT(
+    VkDevice /* device */,
+    VkIndirectExecutionSetEXT /* indirectExecutionSet */,
+    uint32_t /* executionSetWriteCount */,
+    const VkWriteIndirectExecutionSetShaderEXT* /* pExecutionSetWrites */
+) {
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWaitForFences(
+    VkDevice /* device */,
+    uint32_t /* fenceCount */,
+    const VkFence* /* pFences */,
+    VkBool32 /* waitAll */,
+    uint64_t /* timeout */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWaitForPresent2KHR(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    const VkPresentWait2InfoKHR* /* pPresentWait2Info */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWaitForPresentKHR(
+    VkDevice /* device */,
+    VkSwapchainKHR /* swapchain */,
+    uint64_t /* presentId */,
+    uint64_t /* timeout */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWaitSemaphores(
+    VkDevice /* device */,
+    const VkSemaphoreWaitInfo* /* pWaitInfo */,
+    uint64_t /* timeout */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWaitSemaphoresKHR(
+    VkDevice /* device */,
+    const VkSemaphoreWaitInfo* /* pWaitInfo */,
+    uint64_t /* timeout */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWriteAccelerationStructuresPropertiesKHR(
+    VkDevice /* device */,
+    uint32_t /* accelerationStructureCount */,
+    const VkAccelerationStructureKHR* /* pAccelerationStructures */,
+    VkQueryType /* queryType */,
+    size_t /* dataSize */,
+    void* /* pData */,
+    size_t /* stride */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWriteMicromapsPropertiesEXT(
+    VkDevice /* device */,
+    uint32_t /* micromapCount */,
+    const VkMicromapEXT* /* pMicromaps */,
+    VkQueryType /* queryType */,
+    size_t /* dataSize */,
+    void* /* pData */,
+    size_t /* stride */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWriteResourceDescriptorsEXT(
+    VkDevice /* device */,
+    uint32_t /* resourceCount */,
+    const VkResourceDescriptorInfoEXT* /* pResources */,
+    const VkHostAddressRangeEXT* /* pDescriptors */
+) {
+    return VK_SUCCESS;
+}
+
+/* See Vulkan API for documentation. */
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWriteSamplerDescriptorsEXT(
+    VkDevice /* device */,
+    uint32_t /* samplerCount */,
+    const VkSamplerCreateInfo* /* pSamplers */,
+    const VkHostAddressRangeEXT* /* pDescriptors */
+) {
+    return VK_SUCCESS;
+}
+
+#define ENTRY(fnc) { #fnc, reinterpret_cast<PFN_vkVoidFunction>(null_##fnc) }
+
+/* See header for documentation. */
+PFN_vkVoidFunction getStubFunction(
+    const char* name
+) {
+    static const std::unordered_map<std::string_view, PFN_vkVoidFunction> functions {
+    ENTRY(vkAcquireNextImage2KHR),
+    ENTRY(vkAcquireNextImageKHR),
+    ENTRY(vkAcquireProfilingLockKHR),
+    ENTRY(vkBeginCommandBuffer),
+    ENTRY(vkBindBufferMemory),
+    ENTRY(vkBindBufferMemory2),
+    ENTRY(vkBindBufferMemory2KHR),
+    ENTRY(vkBindDataGraphPipelineSessionMemoryARM),
+    ENTRY(vkBindImageMemory),
+    ENTRY(vkBindImageMemory2),
+    ENTRY(vkBindImageMemory2KHR),
+    ENTRY(vkBindTensorMemoryARM),
+    ENTRY(vkBuildAccelerationStructuresKHR),
+    ENTRY(vkBuildMicromapsEXT),
+    ENTRY(vkClearShaderInstrumentationMetricsARM),
+    ENTRY(vkCmdBeginConditionalRendering2EXT),
+    ENTRY(vkCmdBeginConditionalRenderingEXT),
+    ENTRY(vkCmdBeginCustomResolveEXT),
+    ENTRY(vkCmdBeginDebugUtilsLabelEXT),
+    ENTRY(vkCmdBeginQuery),
+    ENTRY(vkCmdBeginQueryIndexedEXT),
+    ENTRY(vkCmdBeginRenderPass),
+    ENTRY(vkCmdBeginRenderPass2),
+    ENTRY(vkCmdBeginRenderPass2KHR),
+    ENTRY(vkCmdBeginRendering),
+    ENTRY(vkCmdBeginRenderingKHR),
+    ENTRY(vkCmdBeginShaderInstrumentationARM),
+    ENTRY(vkCmdBeginTransformFeedback2EXT),
+    ENTRY(vkCmdBeginTransformFeedbackEXT),
+    ENTRY(vkCmdBindDescriptorBufferEmbeddedSamplers2EXT),
+    ENTRY(vkCmdBindDescriptorBufferEmbeddedSamplersEXT),
+    ENTRY(vkCmdBindDescriptorBuffersEXT),
+    ENTRY(vkCmdBindDescriptorSets),
+    ENTRY(vkCmdBindDescriptorSets2),
+    ENTRY(vkCmdBindDescriptorSets2KHR),
+    ENTRY(vkCmdBindIndexBuffer),
+    ENTRY(vkCmdBindIndexBuffer2),
+    ENTRY(vkCmdBindIndexBuffer2KHR),
+    ENTRY(vkCmdBindIndexBuffer3KHR),
+    ENTRY(vkCmdBindPipeline),
+    ENTRY(vkCmdBindResourceHeapEXT),
+    ENTRY(vkCmdBindSamplerHeapEXT),
+    ENTRY(vkCmdBindShadersEXT),
+    ENTRY(vkCmdBindTransformFeedbackBuffers2EXT),
+    ENTRY(vkCmdBindTransformFeedbackBuffersEXT),
+    ENTRY(vkCmdBindVertexBuffers),
+    ENTRY(vkCmdBindVertexBuffers2),
+    ENTRY(vkCmdBindVertexBuffers2EXT),
+    ENTRY(vkCmdBindVertexBuffers3KHR),
+    ENTRY(vkCmdBlitImage),
+    ENTRY(vkCmdBlitImage2),
+    ENTRY(vkCmdBlitImage2KHR),
+    ENTRY(vkCmdBuildAccelerationStructuresIndirectKHR),
+    ENTRY(vkCmdBuildAccelerationStructuresKHR),
+    ENTRY(vkCmdBuildMicromapsEXT),
+    ENTRY(vkCmdClearAttachments),
+    ENTRY(vkCmdClearColorImage),
+    ENTRY(vkCmdClearDepthStencilImage),
+    ENTRY(vkCmdCopyAccelerationStructureKHR),
+    ENTRY(vkCmdCopyAccelerationStructureToMemoryKHR),
+    ENTRY(vkCmdCopyBuffer),
+    ENTRY(vkCmdCopyBuffer2),
+    ENTRY(vkCmdCopyBuffer2KHR),
+    ENTRY(vkCmdCopyBufferToImage),
+    ENTRY(vkCmdCopyBufferToImage2),
+    ENTRY(vkCmdCopyBufferToImage2KHR),
+    ENTRY(vkCmdCopyImage),
+    ENTRY(vkCmdCopyImage2),
+    ENTRY(vkCmdCopyImage2KHR),
+    ENTRY(vkCmdCopyImageToBuffer),
+    ENTRY(vkCmdCopyImageToBuffer2),
+    ENTRY(vkCmdCopyImageToBuffer2KHR),
+    ENTRY(vkCmdCopyImageToMemoryKHR),
+    ENTRY(vkCmdCopyMemoryIndirectKHR),
+    ENTRY(vkCmdCopyMemoryKHR),
+    ENTRY(vkCmdCopyMemoryToAccelerationStructureKHR),
+    ENTRY(vkCmdCopyMemoryToImageIndirectKHR),
+    ENTRY(vkCmdCopyMemoryToImageKHR),
+    ENTRY(vkCmdCopyMemoryToMicromapEXT),
+    ENTRY(vkCmdCopyMicromapEXT),
+    ENTRY(vkCmdCopyMicromapToMemoryEXT),
+    ENTRY(vkCmdCopyQueryPoolResults),
+    ENTRY(vkCmdCopyQueryPoolResultsToMemoryKHR),
+    ENTRY(vkCmdCopyTensorARM),
+    ENTRY(vkCmdDebugMarkerBeginEXT),
+    ENTRY(vkCmdDebugMarkerEndEXT),
+    ENTRY(vkCmdDebugMarkerInsertEXT),
+    ENTRY(vkCmdDecompressMemoryEXT),
+    ENTRY(vkCmdDecompressMemoryIndirectCountEXT),
+    ENTRY(vkCmdDispatch),
+    ENTRY(vkCmdDispatchBase),
+    ENTRY(vkCmdDispatchBaseKHR),
+    ENTRY(vkCmdDispatchDataGraphARM),
+    ENTRY(vkCmdDispatchIndirect),
+    ENTRY(vkCmdDispatchIndirect2KHR),
+    ENTRY(vkCmdDraw),
+    ENTRY(vkCmdDrawIndexed),
+    ENTRY(vkCmdDrawIndexedIndirect),
+    ENTRY(vkCmdDrawIndexedIndirect2KHR),
+    ENTRY(vkCmdDrawIndexedIndirectCount),
+    ENTRY(vkCmdDrawIndexedIndirectCount2KHR),
+    ENTRY(vkCmdDrawIndexedIndirectCountKHR),
+    ENTRY(vkCmdDrawIndirect),
+    ENTRY(vkCmdDrawIndirect2KHR),
+    ENTRY(vkCmdDrawIndirectByteCount2EXT),
+    ENTRY(vkCmdDrawIndirectByteCountEXT),
+    ENTRY(vkCmdDrawIndirectCount),
+    ENTRY(vkCmdDrawIndirectCount2KHR),
+    ENTRY(vkCmdDrawIndirectCountKHR),
+    ENTRY(vkCmdDrawMeshTasksEXT),
+    ENTRY(vkCmdDrawMeshTasksIndirect2EXT),
+    ENTRY(vkCmdDrawMeshTasksIndirectCount2EXT),
+    ENTRY(vkCmdDrawMeshTasksIndirectCountEXT),
+    ENTRY(vkCmdDrawMeshTasksIndirectEXT),
+    ENTRY(vkCmdDrawMultiEXT),
+    ENTRY(vkCmdDrawMultiIndexedEXT),
+    ENTRY(vkCmdEndConditionalRenderingEXT),
+    ENTRY(vkCmdEndDebugUtilsLabelEXT),
+    ENTRY(vkCmdEndQuery),
+    ENTRY(vkCmdEndQueryIndexedEXT),
+    ENTRY(vkCmdEndRenderPass),
+    ENTRY(vkCmdEndRenderPass2),
+    ENTRY(vkCmdEndRenderPass2KHR),
+    ENTRY(vkCmdEndRendering),
+    ENTRY(vkCmdEndRendering2EXT),
+    ENTRY(vkCmdEndRendering2KHR),
+    ENTRY(vkCmdEndRenderingKHR),
+    ENTRY(vkCmdEndShaderInstrumentationARM),
+    ENTRY(vkCmdEndTransformFeedback2EXT),
+    ENTRY(vkCmdEndTransformFeedbackEXT),
+    ENTRY(vkCmdExecuteCommands),
+    ENTRY(vkCmdExecuteGeneratedCommandsEXT),
+    ENTRY(vkCmdFillBuffer),
+    ENTRY(vkCmdFillMemoryKHR),
+    ENTRY(vkCmdInsertDebugUtilsLabelEXT),
+    ENTRY(vkCmdNextSubpass),
+    ENTRY(vkCmdNextSubpass2),
+    ENTRY(vkCmdNextSubpass2KHR),
+    ENTRY(vkCmdPipelineBarrier),
+    ENTRY(vkCmdPipelineBarrier2),
+    ENTRY(vkCmdPipelineBarrier2KHR),
+    ENTRY(vkCmdPreprocessGeneratedCommandsEXT),
+    ENTRY(vkCmdPushConstants),
+    ENTRY(vkCmdPushConstants2),
+    ENTRY(vkCmdPushConstants2KHR),
+    ENTRY(vkCmdPushDataEXT),
+    ENTRY(vkCmdPushDescriptorSet),
+    ENTRY(vkCmdPushDescriptorSet2),
+    ENTRY(vkCmdPushDescriptorSet2KHR),
+    ENTRY(vkCmdPushDescriptorSetKHR),
+    ENTRY(vkCmdPushDescriptorSetWithTemplate),
+    ENTRY(vkCmdPushDescriptorSetWithTemplate2),
+    ENTRY(vkCmdPushDescriptorSetWithTemplate2KHR),
+    ENTRY(vkCmdPushDescriptorSetWithTemplateKHR),
+    ENTRY(vkCmdResetEvent),
+    ENTRY(vkCmdResetEvent2),
+    ENTRY(vkCmdResetEvent2KHR),
+    ENTRY(vkCmdResetQueryPool),
+    ENTRY(vkCmdResolveImage),
+    ENTRY(vkCmdResolveImage2),
+    ENTRY(vkCmdResolveImage2KHR),
+    ENTRY(vkCmdSetAlphaToCoverageEnableEXT),
+    ENTRY(vkCmdSetAlphaToOneEnableEXT),
+    ENTRY(vkCmdSetAttachmentFeedbackLoopEnableEXT),
+    ENTRY(vkCmdSetBlendConstants),
+    ENTRY(vkCmdSetColorBlendAdvancedEXT),
+    ENTRY(vkCmdSetColorBlendEnableEXT),
+    ENTRY(vkCmdSetColorBlendEquationEXT),
+    ENTRY(vkCmdSetColorWriteEnableEXT),
+    ENTRY(vkCmdSetColorWriteMaskEXT),
+    ENTRY(vkCmdSetConservativeRasterizationModeEXT),
+    ENTRY(vkCmdSetCoverageModulationModeNV),
+    ENTRY(vkCmdSetCoverageModulationTableEnableNV),
+    ENTRY(vkCmdSetCoverageModulationTableNV),
+    ENTRY(vkCmdSetCoverageReductionModeNV),
+    ENTRY(vkCmdSetCoverageToColorEnableNV),
+    ENTRY(vkCmdSetCoverageToColorLocationNV),
+    ENTRY(vkCmdSetCullMode),
+    ENTRY(vkCmdSetCullModeEXT),
+    ENTRY(vkCmdSetDepthBias),
+    ENTRY(vkCmdSetDepthBias2EXT),
+    ENTRY(vkCmdSetDepthBiasEnable),
+    ENTRY(vkCmdSetDepthBiasEnableEXT),
+    ENTRY(vkCmdSetDepthBounds),
+    ENTRY(vkCmdSetDepthBoundsTestEnable),
+    ENTRY(vkCmdSetDepthBoundsTestEnableEXT),
+    ENTRY(vkCmdSetDepthClampEnableEXT),
+    ENTRY(vkCmdSetDepthClampRangeEXT),
+    ENTRY(vkCmdSetDepthClipEnableEXT),
+    ENTRY(vkCmdSetDepthClipNegativeOneToOneEXT),
+    ENTRY(vkCmdSetDepthCompareOp),
+    ENTRY(vkCmdSetDepthCompareOpEXT),
+    ENTRY(vkCmdSetDepthTestEnable),
+    ENTRY(vkCmdSetDepthTestEnableEXT),
+    ENTRY(vkCmdSetDepthWriteEnable),
+    ENTRY(vkCmdSetDepthWriteEnableEXT),
+    ENTRY(vkCmdSetDescriptorBufferOffsets2EXT),
+    ENTRY(vkCmdSetDescriptorBufferOffsetsEXT),
+    ENTRY(vkCmdSetDeviceMask),
+    ENTRY(vkCmdSetDeviceMaskKHR),
+    ENTRY(vkCmdSetDiscardRectangleEXT),
+    ENTRY(vkCmdSetDiscardRectangleEnableEXT),
+    ENTRY(vkCmdSetDiscardRectangleModeEXT),
+    ENTRY(vkCmdSetDispatchParametersARM),
+    ENTRY(vkCmdSetEvent),
+    ENTRY(vkCmdSetEvent2),
+    ENTRY(vkCmdSetEvent2KHR),
+    ENTRY(vkCmdSetExtraPrimitiveOverestimationSizeEXT),
+    ENTRY(vkCmdSetFragmentShadingRateKHR),
+    ENTRY(vkCmdSetFrontFace),
+    ENTRY(vkCmdSetFrontFaceEXT),
+    ENTRY(vkCmdSetLineRasterizationModeEXT),
+    ENTRY(vkCmdSetLineStipple),
+    ENTRY(vkCmdSetLineStippleEXT),
+    ENTRY(vkCmdSetLineStippleEnableEXT),
+    ENTRY(vkCmdSetLineStippleKHR),
+    ENTRY(vkCmdSetLineWidth),
+    ENTRY(vkCmdSetLogicOpEXT),
+    ENTRY(vkCmdSetLogicOpEnableEXT),
+    ENTRY(vkCmdSetPatchControlPointsEXT),
+    ENTRY(vkCmdSetPolygonModeEXT),
+    ENTRY(vkCmdSetPrimitiveRestartEnable),
+    ENTRY(vkCmdSetPrimitiveRestartEnableEXT),
+    ENTRY(vkCmdSetPrimitiveRestartIndexEXT),
+    ENTRY(vkCmdSetPrimitiveTopology),
+    ENTRY(vkCmdSetPrimitiveTopologyEXT),
+    ENTRY(vkCmdSetProvokingVertexModeEXT),
+    ENTRY(vkCmdSetRasterizationSamplesEXT),
+    ENTRY(vkCmdSetRasterizationStreamEXT),
+    ENTRY(vkCmdSetRasterizerDiscardEnable),
+    ENTRY(vkCmdSetRasterizerDiscardEnableEXT),
+    ENTRY(vkCmdSetRayTracingPipelineStackSizeKHR),
+    ENTRY(vkCmdSetRenderingAttachmentLocations),
+    ENTRY(vkCmdSetRenderingAttachmentLocationsKHR),
+    ENTRY(vkCmdSetRenderingInputAttachmentIndices),
+    ENTRY(vkCmdSetRenderingInputAttachmentIndicesKHR),
+    ENTRY(vkCmdSetRepresentativeFragmentTestEnableNV),
+    ENTRY(vkCmdSetSampleLocationsEXT),
+    ENTRY(vkCmdSetSampleLocationsEnableEXT),
+    ENTRY(vkCmdSetSampleMaskEXT),
+    ENTRY(vkCmdSetScissor),
+    ENTRY(vkCmdSetScissorWithCount),
+    ENTRY(vkCmdSetScissorWithCountEXT),
+    ENTRY(vkCmdSetShadingRateImageEnableNV),
+    ENTRY(vkCmdSetStencilCompareMask),
+    ENTRY(vkCmdSetStencilOp),
+    ENTRY(vkCmdSetStencilOpEXT),
+    ENTRY(vkCmdSetStencilReference),
+    ENTRY(vkCmdSetStencilTestEnable),
+    ENTRY(vkCmdSetStencilTestEnableEXT),
+    ENTRY(vkCmdSetStencilWriteMask),
+    ENTRY(vkCmdSetTessellationDomainOriginEXT),
+    ENTRY(vkCmdSetVertexInputEXT),
+    ENTRY(vkCmdSetViewport),
+    ENTRY(vkCmdSetViewportSwizzleNV),
+    ENTRY(vkCmdSetViewportWScalingEnableNV),
+    ENTRY(vkCmdSetViewportWithCount),
+    ENTRY(vkCmdSetViewportWithCountEXT),
+    ENTRY(vkCmdTraceRaysIndirect2KHR),
+    ENTRY(vkCmdTraceRaysIndirectKHR),
+    ENTRY(vkCmdTraceRaysKHR),
+    ENTRY(vkCmdUpdateBuffer),
+    ENTRY(vkCmdUpdateMemoryKHR),
+    ENTRY(vkCmdWaitEvents),
+    ENTRY(vkCmdWaitEvents2),
+    ENTRY(vkCmdWaitEvents2KHR),
+    ENTRY(vkCmdWriteAccelerationStructuresPropertiesKHR),
+    ENTRY(vkCmdWriteBufferMarker2AMD),
+    ENTRY(vkCmdWriteMarkerToMemoryAMD),
+    ENTRY(vkCmdWriteMicromapsPropertiesEXT),
+    ENTRY(vkCmdWriteTimestamp),
+    ENTRY(vkCmdWriteTimestamp2),
+    ENTRY(vkCmdWriteTimestamp2KHR),
+    ENTRY(vkCopyAccelerationStructureKHR),
+    ENTRY(vkCopyAccelerationStructureToMemoryKHR),
+    ENTRY(vkCopyImageToImage),
+    ENTRY(vkCopyImageToImageEXT),
+    ENTRY(vkCopyImageToMemory),
+    ENTRY(vkCopyImageToMemoryEXT),
+    ENTRY(vkCopyMemoryToAccelerationStructureKHR),
+    ENTRY(vkCopyMemoryToImage),
+    ENTRY(vkCopyMemoryToImageEXT),
+    ENTRY(vkCopyMemoryToMicromapEXT),
+    ENTRY(vkCopyMicromapEXT),
+    ENTRY(vkCopyMicromapToMemoryEXT),
+    ENTRY(vkCreateAccelerationStructure2KHR),
+    ENTRY(vkCreateAccelerationStructureKHR),
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    ENTRY(vkCreateAndroidSurfaceKHR),
+#endif
+    ENTRY(vkCreateBuffer),
+    ENTRY(vkCreateBufferView),
+    ENTRY(vkCreateCommandPool),
+    ENTRY(vkCreateComputePipelines),
+    ENTRY(vkCreateDataGraphPipelineSessionARM),
+    ENTRY(vkCreateDataGraphPipelinesARM),
+    ENTRY(vkCreateDebugReportCallbackEXT),
+    ENTRY(vkCreateDebugUtilsMessengerEXT),
+    ENTRY(vkCreateDeferredOperationKHR),
+    ENTRY(vkCreateDescriptorPool),
+    ENTRY(vkCreateDescriptorSetLayout),
+    ENTRY(vkCreateDescriptorUpdateTemplate),
+    ENTRY(vkCreateDescriptorUpdateTemplateKHR),
+    ENTRY(vkCreateDisplayModeKHR),
+    ENTRY(vkCreateDisplayPlaneSurfaceKHR),
+    ENTRY(vkCreateEvent),
+    ENTRY(vkCreateFence),
+    ENTRY(vkCreateFramebuffer),
+    ENTRY(vkCreateGraphicsPipelines),
+    ENTRY(vkCreateImage),
+    ENTRY(vkCreateImageView),
+    ENTRY(vkCreateIndirectCommandsLayoutEXT),
+    ENTRY(vkCreateIndirectExecutionSetEXT),
+    ENTRY(vkCreateMicromapEXT),
+    ENTRY(vkCreatePipelineBinariesKHR),
+    ENTRY(vkCreatePipelineCache),
+    ENTRY(vkCreatePipelineLayout),
+    ENTRY(vkCreatePrivateDataSlot),
+    ENTRY(vkCreatePrivateDataSlotEXT),
+    ENTRY(vkCreateQueryPool),
+    ENTRY(vkCreateRayTracingPipelinesKHR),
+    ENTRY(vkCreateRenderPass),
+    ENTRY(vkCreateRenderPass2),
+    ENTRY(vkCreateRenderPass2KHR),
+    ENTRY(vkCreateSampler),
+    ENTRY(vkCreateSamplerYcbcrConversion),
+    ENTRY(vkCreateSamplerYcbcrConversionKHR),
+    ENTRY(vkCreateSemaphore),
+    ENTRY(vkCreateShaderInstrumentationARM),
+    ENTRY(vkCreateShaderModule),
+    ENTRY(vkCreateShadersEXT),
+    ENTRY(vkCreateSharedSwapchainsKHR),
+    ENTRY(vkCreateSwapchainKHR),
+    ENTRY(vkCreateTensorARM),
+    ENTRY(vkCreateTensorViewARM),
+    ENTRY(vkCreateValidationCacheEXT),
+    ENTRY(vkDebugMarkerSetObjectNameEXT),
+    ENTRY(vkDebugMarkerSetObjectTagEXT),
+    ENTRY(vkDebugReportMessageEXT),
+    ENTRY(vkDeferredOperationJoinKHR),
+    ENTRY(vkDestroyAccelerationStructureKHR),
+    ENTRY(vkDestroyBuffer),
+    ENTRY(vkDestroyBufferView),
+    ENTRY(vkDestroyDataGraphPipelineSessionARM),
+    ENTRY(vkDestroyDebugReportCallbackEXT),
+    ENTRY(vkDestroyDebugUtilsMessengerEXT),
+    ENTRY(vkDestroyDeferredOperationKHR),
+    ENTRY(vkDestroyDescriptorPool),
+    ENTRY(vkDestroyDescriptorSetLayout),
+    ENTRY(vkDestroyDescriptorUpdateTemplate),
+    ENTRY(vkDestroyDescriptorUpdateTemplateKHR),
+    ENTRY(vkDestroyEvent),
+    ENTRY(vkDestroyFence),
+    ENTRY(vkDestroyFramebuffer),
+    ENTRY(vkDestroyImage),
+    ENTRY(vkDestroyImageView),
+    ENTRY(vkDestroyIndirectCommandsLayoutEXT),
+    ENTRY(vkDestroyIndirectExecutionSetEXT),
+    ENTRY(vkDestroyMicromapEXT),
+    ENTRY(vkDestroyPipeline),
+    ENTRY(vkDestroyPipelineBinaryKHR),
+    ENTRY(vkDestroyPipelineCache),
+    ENTRY(vkDestroyPipelineLayout),
+    ENTRY(vkDestroyPrivateDataSlot),
+    ENTRY(vkDestroyPrivateDataSlotEXT),
+    ENTRY(vkDestroyQueryPool),
+    ENTRY(vkDestroyRenderPass),
+    ENTRY(vkDestroySampler),
+    ENTRY(vkDestroySamplerYcbcrConversion),
+    ENTRY(vkDestroySamplerYcbcrConversionKHR),
+    ENTRY(vkDestroySemaphore),
+    ENTRY(vkDestroyShaderEXT),
+    ENTRY(vkDestroyShaderInstrumentationARM),
+    ENTRY(vkDestroyShaderModule),
+    ENTRY(vkDestroySurfaceKHR),
+    ENTRY(vkDestroySwapchainKHR),
+    ENTRY(vkDestroyTensorARM),
+    ENTRY(vkDestroyTensorViewARM),
+    ENTRY(vkDestroyValidationCacheEXT),
+    ENTRY(vkDeviceWaitIdle),
+    ENTRY(vkDisplayPowerControlEXT),
+    ENTRY(vkEndCommandBuffer),
+    ENTRY(vkEnumerateDeviceLayerProperties),
+    ENTRY(vkEnumerateInstanceLayerProperties),
+    ENTRY(vkEnumeratePhysicalDeviceGroups),
+    ENTRY(vkEnumeratePhysicalDeviceGroupsKHR),
+    ENTRY(vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM),
+    ENTRY(vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR),
+    ENTRY(vkEnumeratePhysicalDeviceShaderInstrumentationMetricsARM),
+    ENTRY(vkFlushMappedMemoryRanges),
+    ENTRY(vkFreeDescriptorSets),
+    ENTRY(vkGetAccelerationStructureBuildSizesKHR),
+    ENTRY(vkGetAccelerationStructureDeviceAddressKHR),
+    ENTRY(vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT),
+    ENTRY(vkGetBufferDeviceAddress),
+    ENTRY(vkGetBufferDeviceAddressEXT),
+    ENTRY(vkGetBufferDeviceAddressKHR),
+    ENTRY(vkGetBufferMemoryRequirements),
+    ENTRY(vkGetBufferMemoryRequirements2),
+    ENTRY(vkGetBufferMemoryRequirements2KHR),
+    ENTRY(vkGetBufferOpaqueCaptureAddress),
+    ENTRY(vkGetBufferOpaqueCaptureAddressKHR),
+    ENTRY(vkGetBufferOpaqueCaptureDescriptorDataEXT),
+    ENTRY(vkGetCalibratedTimestampsEXT),
+    ENTRY(vkGetCalibratedTimestampsKHR),
+    ENTRY(vkGetDataGraphPipelineAvailablePropertiesARM),
+    ENTRY(vkGetDataGraphPipelinePropertiesARM),
+    ENTRY(vkGetDataGraphPipelineSessionBindPointRequirementsARM),
+    ENTRY(vkGetDataGraphPipelineSessionMemoryRequirementsARM),
+    ENTRY(vkGetDeferredOperationMaxConcurrencyKHR),
+    ENTRY(vkGetDeferredOperationResultKHR),
+    ENTRY(vkGetDescriptorEXT),
+    ENTRY(vkGetDescriptorSetLayoutBindingOffsetEXT),
+    ENTRY(vkGetDescriptorSetLayoutSizeEXT),
+    ENTRY(vkGetDescriptorSetLayoutSupport),
+    ENTRY(vkGetDescriptorSetLayoutSupportKHR),
+    ENTRY(vkGetDeviceAccelerationStructureCompatibilityKHR),
+    ENTRY(vkGetDeviceBufferMemoryRequirements),
+    ENTRY(vkGetDeviceBufferMemoryRequirementsKHR),
+    ENTRY(vkGetDeviceFaultDebugInfoKHR),
+    ENTRY(vkGetDeviceFaultInfoEXT),
+    ENTRY(vkGetDeviceFaultReportsKHR),
+    ENTRY(vkGetDeviceGroupPeerMemoryFeatures),
+    ENTRY(vkGetDeviceGroupPeerMemoryFeaturesKHR),
+    ENTRY(vkGetDeviceGroupPresentCapabilitiesKHR),
+    ENTRY(vkGetDeviceGroupSurfacePresentModesKHR),
+    ENTRY(vkGetDeviceImageMemoryRequirements),
+    ENTRY(vkGetDeviceImageMemoryRequirementsKHR),
+    ENTRY(vkGetDeviceImageSparseMemoryRequirements),
+    ENTRY(vkGetDeviceImageSparseMemoryRequirementsKHR),
+    ENTRY(vkGetDeviceImageSubresourceLayout),
+    ENTRY(vkGetDeviceImageSubresourceLayoutKHR),
+    ENTRY(vkGetDeviceMemoryCommitment),
+    ENTRY(vkGetDeviceMemoryOpaqueCaptureAddress),
+    ENTRY(vkGetDeviceMemoryOpaqueCaptureAddressKHR),
+    ENTRY(vkGetDeviceMicromapCompatibilityEXT),
+    ENTRY(vkGetDeviceTensorMemoryRequirementsARM),
+    ENTRY(vkGetDisplayModeProperties2KHR),
+    ENTRY(vkGetDisplayModePropertiesKHR),
+    ENTRY(vkGetDisplayPlaneCapabilities2KHR),
+    ENTRY(vkGetDisplayPlaneCapabilitiesKHR),
+    ENTRY(vkGetDisplayPlaneSupportedDisplaysKHR),
+    ENTRY(vkGetFenceFdKHR),
+    ENTRY(vkGetFenceStatus),
+    ENTRY(vkGetGeneratedCommandsMemoryRequirementsEXT),
+    ENTRY(vkGetImageDrmFormatModifierPropertiesEXT),
+    ENTRY(vkGetImageMemoryRequirements),
+    ENTRY(vkGetImageMemoryRequirements2),
+    ENTRY(vkGetImageMemoryRequirements2KHR),
+    ENTRY(vkGetImageOpaqueCaptureDataEXT),
+    ENTRY(vkGetImageOpaqueCaptureDescriptorDataEXT),
+    ENTRY(vkGetImageSparseMemoryRequirements),
+    ENTRY(vkGetImageSparseMemoryRequirements2),
+    ENTRY(vkGetImageSparseMemoryRequirements2KHR),
+    ENTRY(vkGetImageSubresourceLayout),
+    ENTRY(vkGetImageSubresourceLayout2),
+    ENTRY(vkGetImageSubresourceLayout2EXT),
+    ENTRY(vkGetImageSubresourceLayout2KHR),
+    ENTRY(vkGetImageViewOpaqueCaptureDescriptorDataEXT),
+    ENTRY(vkGetMemoryFdKHR),
+    ENTRY(vkGetMemoryFdPropertiesKHR),
+    ENTRY(vkGetMemoryHostPointerPropertiesEXT),
+    ENTRY(vkGetMicromapBuildSizesEXT),
+    ENTRY(vkGetPastPresentationTimingEXT),
+    ENTRY(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT),
+    ENTRY(vkGetPhysicalDeviceCalibrateableTimeDomainsKHR),
+    ENTRY(vkGetPhysicalDeviceCooperativeMatrixProperties2EXT),
+    ENTRY(vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR),
+    ENTRY(vkGetPhysicalDeviceDescriptorSizeEXT),
+    ENTRY(vkGetPhysicalDeviceDisplayPlaneProperties2KHR),
+    ENTRY(vkGetPhysicalDeviceDisplayPlanePropertiesKHR),
+    ENTRY(vkGetPhysicalDeviceDisplayProperties2KHR),
+    ENTRY(vkGetPhysicalDeviceDisplayPropertiesKHR),
+    ENTRY(vkGetPhysicalDeviceExternalBufferProperties),
+    ENTRY(vkGetPhysicalDeviceExternalBufferPropertiesKHR),
+    ENTRY(vkGetPhysicalDeviceExternalFenceProperties),
+    ENTRY(vkGetPhysicalDeviceExternalFencePropertiesKHR),
+    ENTRY(vkGetPhysicalDeviceExternalSemaphoreProperties),
+    ENTRY(vkGetPhysicalDeviceExternalSemaphorePropertiesKHR),
+    ENTRY(vkGetPhysicalDeviceExternalTensorPropertiesARM),
+    ENTRY(vkGetPhysicalDeviceFormatProperties),
+    ENTRY(vkGetPhysicalDeviceFormatProperties2),
+    ENTRY(vkGetPhysicalDeviceFormatProperties2KHR),
+    ENTRY(vkGetPhysicalDeviceFragmentShadingRatesKHR),
+    ENTRY(vkGetPhysicalDeviceMultisamplePropertiesEXT),
+    ENTRY(vkGetPhysicalDevicePresentRectanglesKHR),
+    ENTRY(vkGetPhysicalDeviceQueueFamilyDataGraphEngineOperationPropertiesARM),
+    ENTRY(vkGetPhysicalDeviceQueueFamilyDataGraphOpticalFlowImageFormatsARM),
+    ENTRY(vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM),
+    ENTRY(vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM),
+    ENTRY(vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR),
+    ENTRY(vkGetPhysicalDeviceSparseImageFormatProperties),
+    ENTRY(vkGetPhysicalDeviceSparseImageFormatProperties2),
+    ENTRY(vkGetPhysicalDeviceSparseImageFormatProperties2KHR),
+    ENTRY(vkGetPhysicalDeviceSurfaceCapabilities2EXT),
+    ENTRY(vkGetPhysicalDeviceSurfaceCapabilities2KHR),
+    ENTRY(vkGetPhysicalDeviceSurfaceCapabilitiesKHR),
+    ENTRY(vkGetPhysicalDeviceSurfaceFormats2KHR),
+    ENTRY(vkGetPhysicalDeviceSurfaceFormatsKHR),
+    ENTRY(vkGetPhysicalDeviceSurfacePresentModesKHR),
+    ENTRY(vkGetPhysicalDeviceSurfaceSupportKHR),
+    ENTRY(vkGetPhysicalDeviceToolProperties),
+    ENTRY(vkGetPhysicalDeviceToolPropertiesEXT),
+    ENTRY(vkGetPipelineBinaryDataKHR),
+    ENTRY(vkGetPipelineCacheData),
+    ENTRY(vkGetPipelineExecutableInternalRepresentationsKHR),
+    ENTRY(vkGetPipelineExecutablePropertiesKHR),
+    ENTRY(vkGetPipelineExecutableStatisticsKHR),
+    ENTRY(vkGetPipelineKeyKHR),
+    ENTRY(vkGetPipelinePropertiesEXT),
+    ENTRY(vkGetPrivateData),
+    ENTRY(vkGetPrivateDataEXT),
+    ENTRY(vkGetRayTracingCaptureReplayShaderGroupHandlesKHR),
+    ENTRY(vkGetRayTracingShaderGroupHandlesKHR),
+    ENTRY(vkGetRayTracingShaderGroupStackSizeKHR),
+    ENTRY(vkGetRenderAreaGranularity),
+    ENTRY(vkGetRenderingAreaGranularity),
+    ENTRY(vkGetRenderingAreaGranularityKHR),
+    ENTRY(vkGetSamplerOpaqueCaptureDescriptorDataEXT),
+    ENTRY(vkGetSemaphoreCounterValue),
+    ENTRY(vkGetSemaphoreCounterValueKHR),
+    ENTRY(vkGetSemaphoreFdKHR),
+    ENTRY(vkGetShaderBinaryDataEXT),
+    ENTRY(vkGetShaderInstrumentationValuesARM),
+    ENTRY(vkGetShaderModuleCreateInfoIdentifierEXT),
+    ENTRY(vkGetShaderModuleIdentifierEXT),
+    ENTRY(vkGetSwapchainCounterEXT),
+    ENTRY(vkGetSwapchainImagesKHR),
+    ENTRY(vkGetSwapchainStatusKHR),
+    ENTRY(vkGetSwapchainTimeDomainPropertiesEXT),
+    ENTRY(vkGetSwapchainTimingPropertiesEXT),
+    ENTRY(vkGetTensorMemoryRequirementsARM),
+    ENTRY(vkGetTensorOpaqueCaptureDataARM),
+    ENTRY(vkGetTensorOpaqueCaptureDescriptorDataARM),
+    ENTRY(vkGetTensorViewOpaqueCaptureDescriptorDataARM),
+    ENTRY(vkGetValidationCacheDataEXT),
+    ENTRY(vkImportFenceFdKHR),
+    ENTRY(vkImportSemaphoreFdKHR),
+    ENTRY(vkInvalidateMappedMemoryRanges),
+    ENTRY(vkMergePipelineCaches),
+    ENTRY(vkMergeValidationCachesEXT),
+    ENTRY(vkQueueBeginDebugUtilsLabelEXT),
+    ENTRY(vkQueueBindSparse),
+    ENTRY(vkQueueEndDebugUtilsLabelEXT),
+    ENTRY(vkQueueInsertDebugUtilsLabelEXT),
+    ENTRY(vkQueuePresentKHR),
+    ENTRY(vkQueueSubmit),
+    ENTRY(vkQueueSubmit2),
+    ENTRY(vkQueueSubmit2KHR),
+    ENTRY(vkQueueWaitIdle),
+    ENTRY(vkRegisterCustomBorderColorEXT),
+    ENTRY(vkRegisterDeviceEventEXT),
+    ENTRY(vkRegisterDisplayEventEXT),
+    ENTRY(vkReleaseCapturedPipelineDataKHR),
+    ENTRY(vkReleaseDisplayEXT),
+    ENTRY(vkReleaseProfilingLockKHR),
+    ENTRY(vkReleaseSwapchainImagesEXT),
+    ENTRY(vkReleaseSwapchainImagesKHR),
+    ENTRY(vkResetCommandBuffer),
+    ENTRY(vkResetCommandPool),
+    ENTRY(vkResetDescriptorPool),
+    ENTRY(vkResetEvent),
+    ENTRY(vkResetFences),
+    ENTRY(vkResetQueryPool),
+    ENTRY(vkResetQueryPoolEXT),
+    ENTRY(vkSetDebugUtilsObjectNameEXT),
+    ENTRY(vkSetDebugUtilsObjectTagEXT),
+    ENTRY(vkSetDeviceMemoryPriorityEXT),
+    ENTRY(vkSetEvent),
+    ENTRY(vkSetHdrMetadataEXT),
+    ENTRY(vkSetPrivateData),
+    ENTRY(vkSetPrivateDataEXT),
+    ENTRY(vkSetSwapchainPresentTimingQueueSizeEXT),
+    ENTRY(vkSignalSemaphore),
+    ENTRY(vkSignalSemaphoreKHR),
+    ENTRY(vkSubmitDebugUtilsMessageEXT),
+    ENTRY(vkTransitionImageLayout),
+    ENTRY(vkTransitionImageLayoutEXT),
+    ENTRY(vkTrimCommandPool),
+    ENTRY(vkTrimCommandPoolKHR),
+    ENTRY(vkUnmapMemory),
+    ENTRY(vkUnmapMemory2),
+    ENTRY(vkUnmapMemory2KHR),
+    ENTRY(vkUnregisterCustomBorderColorEXT),
+    ENTRY(vkUpdateDescriptorSetWithTemplate),
+    ENTRY(vkUpdateDescriptorSetWithTemplateKHR),
+    ENTRY(vkUpdateDescriptorSets),
+    ENTRY(vkUpdateIndirectExecutionSetPipelineEXT),
+    ENTRY(vkUpdateIndirectExecutionSetShaderEXT),
+    ENTRY(vkWaitForFences),
+    ENTRY(vkWaitForPresent2KHR),
+    ENTRY(vkWaitForPresentKHR),
+    ENTRY(vkWaitSemaphores),
+    ENTRY(vkWaitSemaphoresKHR),
+    ENTRY(vkWriteAccelerationStructuresPropertiesKHR),
+    ENTRY(vkWriteMicromapsPropertiesEXT),
+    ENTRY(vkWriteResourceDescriptorsEXT),
+    ENTRY(vkWriteSamplerDescriptorsEXT),
+    };
+
+    auto it = functions.find(name);
+    if (it == functions.end())
+    {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+#undef ENTRY
+
+}
+
+// clang-format on
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Internal declarations shared by the null driver implementation files.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include <vulkan/vulkan.h>
+
+namespace NullDriver
+{
+
+/**
+ * @brief Create a new unique non-dispatchable handle value.
+ *
+ * Handle values are never dereferenced, so they are allocated from a global
+ * counter rather than backed by real allocations.
+ *
+ * @return The new handle.
+ */
+template<typename T>
+T createHandle()
+{
+    static std::atomic<uint64_t> nextHandle { 1 };
+    uint64_t handle = nextHandle.fetch_add(1, std::memory_order_relaxed);
+
+    // Non-dispatchable handles are pointers on 64-bit platforms
+    if constexpr (std::is_pointer_v<T>)
+    {
+        return reinterpret_cast<T>(static_cast<uintptr_t>(handle));
+    }
+    else
+    {
+        return static_cast<T>(handle);
+    }
+}
+
+/**
+ * @brief Get a generated stub function by name.
+ *
+ * @param name   The name of the function to look up.
+ *
+ * @return The function pointer, or @c nullptr if no stub exists.
+ */
+PFN_vkVoidFunction getStubFunction(
+    const char* name);
+
+}
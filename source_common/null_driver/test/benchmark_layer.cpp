@@ -0,0 +1,841 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * A benchmark for the per-call CPU overhead of a layer.
+ *
+ * The benchmark loads a layer on top of the null driver and replays a
+ * synthetic frame workload through it. Each frame, a set of worker threads
+ * record command buffers containing a configurable mix of render passes,
+ * draws, dispatches, and debug labels, and the main thread then submits and
+ * presents the frame.
+ *
+ * The same workload is run on the null driver without a layer to give a
+ * baseline, so the reported overhead is the cost added by the layer.
+ */
+#include "null_driver/layer_harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace NullDriver;
+
+/**
+ * @brief The benchmark workload configuration.
+ */
+struct Options
+{
+    /** The path of the layer library to test, or empty for baseline only. */
+    std::string layerPath;
+
+    /** The number of recording threads. */
+    uint32_t threads {4};
+
+    /** The number of command buffers recorded per thread per frame. */
+    uint32_t commandBuffers {4};
+
+    /** The number of untimed warm-up frames. */
+    uint32_t warmupFrames {20};
+
+    /** The number of timed frames. */
+    uint32_t frames {200};
+
+    /** The number of render passes per command buffer. */
+    uint32_t renderPasses {4};
+
+    /** The number of draws per render pass. */
+    uint32_t draws {100};
+
+    /** The number of dispatches per command buffer. */
+    uint32_t dispatches {16};
+
+    /** The nesting depth of debug labels around each render pass and dispatch block. */
+    uint32_t labels {1};
+};
+
+/**
+ * @brief The types of command that are timed separately.
+ */
+enum CallType
+{
+    CALL_COMMAND_BUFFER,
+    CALL_RENDER_PASS,
+    CALL_LABEL,
+    CALL_DRAW,
+    CALL_DISPATCH,
+    CALL_TYPE_COUNT
+};
+
+/**
+ * @brief The display names of the command types.
+ */
+static const char* callTypeNames[CALL_TYPE_COUNT] {
+    "vkBegin/EndCommandBuffer",
+    "vkCmdBegin/EndRenderPass",
+    "vkCmdBegin/EndDebugUtilsLabel",
+    "vkCmdDraw",
+    "vkCmdDispatch",
+};
+
+/**
+ * @brief Accumulated timing for one command type.
+ */
+struct CallStats
+{
+    /** The number of calls made. */
+    uint64_t calls {0};
+
+    /** The total time spent in the calls, in nanoseconds. */
+    uint64_t nanoseconds {0};
+};
+
+using CallStatsArray = std::array<CallStats, CALL_TYPE_COUNT>;
+
+/**
+ * @brief The results of a benchmark run.
+ */
+struct Results
+{
+    /** The per-command timings, summed over all threads. */
+    CallStatsArray calls {};
+
+    /** The submit latency of each frame, in microseconds. */
+    std::vector<double> submitTimes;
+
+    /** The present latency of each frame, in microseconds. */
+    std::vector<double> presentTimes;
+
+    /** The growth in resident memory over the timed frames, in bytes. */
+    int64_t memoryGrowth {0};
+};
+
+/**
+ * @brief The device functions used by the benchmark.
+ */
+struct DeviceFunctions
+{
+    PFN_vkCreateCommandPool vkCreateCommandPool;
+    PFN_vkDestroyCommandPool vkDestroyCommandPool;
+    PFN_vkResetCommandPool vkResetCommandPool;
+    PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers;
+    PFN_vkBeginCommandBuffer vkBeginCommandBuffer;
+    PFN_vkEndCommandBuffer vkEndCommandBuffer;
+    PFN_vkCreateRenderPass vkCreateRenderPass;
+    PFN_vkDestroyRenderPass vkDestroyRenderPass;
+    PFN_vkCreateFramebuffer vkCreateFramebuffer;
+    PFN_vkDestroyFramebuffer vkDestroyFramebuffer;
+    PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR;
+    PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR;
+    PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass;
+    PFN_vkCmdEndRenderPass vkCmdEndRenderPass;
+    PFN_vkCmdBeginDebugUtilsLabelEXT vkCmdBeginDebugUtilsLabelEXT;
+    PFN_vkCmdEndDebugUtilsLabelEXT vkCmdEndDebugUtilsLabelEXT;
+    PFN_vkCmdDraw vkCmdDraw;
+    PFN_vkCmdDispatch vkCmdDispatch;
+    PFN_vkQueueSubmit vkQueueSubmit;
+    PFN_vkQueuePresentKHR vkQueuePresentKHR;
+};
+
+/**
+ * @brief The objects shared by all recording threads.
+ */
+struct SharedResources
+{
+    VkRenderPass renderPass {VK_NULL_HANDLE};
+    VkFramebuffer framebuffer {VK_NULL_HANDLE};
+    VkSwapchainKHR swapchain {VK_NULL_HANDLE};
+};
+
+/**
+ * @brief The objects and timings owned by one recording thread.
+ */
+struct ThreadState
+{
+    VkCommandPool commandPool {VK_NULL_HANDLE};
+    std::vector<VkCommandBuffer> commandBuffers;
+    CallStatsArray calls {};
+};
+
+/**
+ * @brief The size of the render target.
+ */
+static constexpr VkExtent2D RENDER_EXTENT {1920, 1080};
+
+/**
+ * @brief Get the current time in nanoseconds.
+ */
+static uint64_t getTimeNs()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+/**
+ * @brief Get the resident set size of the process, in bytes.
+ */
+static int64_t getResidentBytes()
+{
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file)
+    {
+        return 0;
+    }
+
+    long pages {0};
+    long residentPages {0};
+    int count = fscanf(file, "%ld %ld", &pages, &residentPages);
+    fclose(file);
+
+    if (count != 2)
+    {
+        return 0;
+    }
+
+    return static_cast<int64_t>(residentPages) * sysconf(_SC_PAGESIZE);
+}
+
+/**
+ * @brief Load the device functions from the top of the layer stack.
+ *
+ * @param harness     The layer harness.
+ * @param functions   The function table to populate.
+ *
+ * @return @c true if all functions were found, @c false otherwise.
+ */
+static bool loadFunctions(const LayerHarness& harness, DeviceFunctions& functions)
+{
+#define LOAD(fnc)                                                    \
+    functions.fnc = harness.getDeviceFunction<PFN_##fnc>(#fnc);      \
+    if (!functions.fnc)                                              \
+    {                                                                \
+        printf("ERROR: Failed to load %s\n", #fnc);                  \
+        return false;                                                \
+    }
+
+    LOAD(vkCreateCommandPool);
+    LOAD(vkDestroyCommandPool);
+    LOAD(vkResetCommandPool);
+    LOAD(vkAllocateCommandBuffers);
+    LOAD(vkBeginCommandBuffer);
+    LOAD(vkEndCommandBuffer);
+    LOAD(vkCreateRenderPass);
+    LOAD(vkDestroyRenderPass);
+    LOAD(vkCreateFramebuffer);
+    LOAD(vkDestroyFramebuffer);
+    LOAD(vkCreateSwapchainKHR);
+    LOAD(vkDestroySwapchainKHR);
+    LOAD(vkCmdBeginRenderPass);
+    LOAD(vkCmdEndRenderPass);
+    LOAD(vkCmdBeginDebugUtilsLabelEXT);
+    LOAD(vkCmdEndDebugUtilsLabelEXT);
+    LOAD(vkCmdDraw);
+    LOAD(vkCmdDispatch);
+    LOAD(vkQueueSubmit);
+    LOAD(vkQueuePresentKHR);
+
+#undef LOAD
+    return true;
+}
+
+/**
+ * @brief Create the objects shared by all recording threads.
+ *
+ * @param device      The device.
+ * @param functions   The device functions.
+ * @param resources   The resources to populate.
+ *
+ * @return @c true on success, @c false otherwise.
+ */
+static bool createSharedResources(VkDevice device, const DeviceFunctions& functions, SharedResources& resources)
+{
+    VkAttachmentDescription attachment {};
+    attachment.format = VK_FORMAT_R8G8B8A8_UNORM;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    VkAttachmentReference colorReference {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    VkSubpassDescription subpass {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorReference;
+
+    VkRenderPassCreateInfo renderPassInfo {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &attachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+
+    if (functions.vkCreateRenderPass(device, &renderPassInfo, nullptr, &resources.renderPass) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    // The null driver never dereferences image views, so no view is needed
+    VkImageView imageView {VK_NULL_HANDLE};
+
+    VkFramebufferCreateInfo framebufferInfo {};
+    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebufferInfo.renderPass = resources.renderPass;
+    framebufferInfo.attachmentCount = 1;
+    framebufferInfo.pAttachments = &imageView;
+    framebufferInfo.width = RENDER_EXTENT.width;
+    framebufferInfo.height = RENDER_EXTENT.height;
+    framebufferInfo.layers = 1;
+
+    if (functions.vkCreateFramebuffer(device, &framebufferInfo, nullptr, &resources.framebuffer) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    VkSwapchainCreateInfoKHR swapchainInfo {};
+    swapchainInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+    swapchainInfo.minImageCount = 3;
+    swapchainInfo.imageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+    swapchainInfo.imageColorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+    swapchainInfo.imageExtent = RENDER_EXTENT;
+    swapchainInfo.imageArrayLayers = 1;
+    swapchainInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    swapchainInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    swapchainInfo.preTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    swapchainInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    swapchainInfo.presentMode = VK_PRESENT_MODE_FIFO_KHR;
+
+    return functions.vkCreateSwapchainKHR(device, &swapchainInfo, nullptr, &resources.swapchain) == VK_SUCCESS;
+}
+
+/**
+ * @brief Destroy the objects shared by all recording threads.
+ *
+ * @param device      The device.
+ * @param functions   The device functions.
+ * @param resources   The resources to destroy.
+ */
+static void destroySharedResources(VkDevice device, const DeviceFunctions& functions, SharedResources& resources)
+{
+    if (resources.swapchain)
+    {
+        functions.vkDestroySwapchainKHR(device, resources.swapchain, nullptr);
+    }
+
+    if (resources.framebuffer)
+    {
+        functions.vkDestroyFramebuffer(device, resources.framebuffer, nullptr);
+    }
+
+    if (resources.renderPass)
+    {
+        functions.vkDestroyRenderPass(device, resources.renderPass, nullptr);
+    }
+}
+
+/**
+ * @brief Record nested debug label regions opening or closing.
+ *
+ * @param functions       The device functions.
+ * @param commandBuffer   The command buffer to record.
+ * @param depth           The number of labels to open or close.
+ * @param begin           @c true to open labels, @c false to close them.
+ * @param calls           The timing stats to update.
+ */
+static void recordLabels(const DeviceFunctions& functions,
+                         VkCommandBuffer commandBuffer,
+                         uint32_t depth,
+                         bool begin,
+                         CallStatsArray& calls)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+
+    VkDebugUtilsLabelEXT label {};
+    label.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+    label.pLabelName = "Benchmark label";
+
+    uint64_t start = getTimeNs();
+    for (uint32_t i = 0; i < depth; i++)
+    {
+        if (begin)
+        {
+            functions.vkCmdBeginDebugUtilsLabelEXT(commandBuffer, &label);
+        }
+        else
+        {
+            functions.vkCmdEndDebugUtilsLabelEXT(commandBuffer);
+        }
+    }
+
+    calls[CALL_LABEL].nanoseconds += getTimeNs() - start;
+    calls[CALL_LABEL].calls += depth;
+}
+
+/**
+ * @brief Record one command buffer of the synthetic workload.
+ *
+ * Commands are timed in blocks of the same type so that timer overhead is
+ * amortized over many calls for the high frequency commands.
+ *
+ * @param functions       The device functions.
+ * @param options         The workload configuration.
+ * @param resources       The shared resources.
+ * @param commandBuffer   The command buffer to record.
+ * @param calls           The timing stats to update.
+ */
+static void recordCommandBuffer(const DeviceFunctions& functions,
+                                const Options& options,
+                                const SharedResources& resources,
+                                VkCommandBuffer commandBuffer,
+                                CallStatsArray& calls)
+{
+    VkCommandBufferBeginInfo beginInfo {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    uint64_t start = getTimeNs();
+    functions.vkBeginCommandBuffer(commandBuffer, &beginInfo);
+    calls[CALL_COMMAND_BUFFER].nanoseconds += getTimeNs() - start;
+    calls[CALL_COMMAND_BUFFER].calls += 1;
+
+    VkClearValue clearValue {};
+
+    VkRenderPassBeginInfo renderPassBegin {};
+    renderPassBegin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassBegin.renderPass = resources.renderPass;
+    renderPassBegin.framebuffer = resources.framebuffer;
+    renderPassBegin.renderArea.extent = RENDER_EXTENT;
+    renderPassBegin.clearValueCount = 1;
+    renderPassBegin.pClearValues = &clearValue;
+
+    for (uint32_t i = 0; i < options.renderPasses; i++)
+    {
+        recordLabels(functions, commandBuffer, options.labels, true, calls);
+
+        start = getTimeNs();
+        functions.vkCmdBeginRenderPass(commandBuffer, &renderPassBegin, VK_SUBPASS_CONTENTS_INLINE);
+        calls[CALL_RENDER_PASS].nanoseconds += getTimeNs() - start;
+
+        start = getTimeNs();
+        for (uint32_t j = 0; j < options.draws; j++)
+        {
+            functions.vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+        }
+        calls[CALL_DRAW].nanoseconds += getTimeNs() - start;
+        calls[CALL_DRAW].calls += options.draws;
+
+        start = getTimeNs();
+        functions.vkCmdEndRenderPass(commandBuffer);
+        calls[CALL_RENDER_PASS].nanoseconds += getTimeNs() - start;
+        calls[CALL_RENDER_PASS].calls += 2;
+
+        recordLabels(functions, commandBuffer, options.labels, false, calls);
+    }
+
+    if (options.dispatches)
+    {
+        recordLabels(functions, commandBuffer, options.labels, true, calls);
+
+        start = getTimeNs();
+        for (uint32_t j = 0; j < options.dispatches; j++)
+        {
+            functions.vkCmdDispatch(commandBuffer, 64, 64, 1);
+        }
+        calls[CALL_DISPATCH].nanoseconds += getTimeNs() - start;
+        calls[CALL_DISPATCH].calls += options.dispatches;
+
+        recordLabels(functions, commandBuffer, options.labels, false, calls);
+    }
+
+    start = getTimeNs();
+    functions.vkEndCommandBuffer(commandBuffer);
+    calls[CALL_COMMAND_BUFFER].nanoseconds += getTimeNs() - start;
+    calls[CALL_COMMAND_BUFFER].calls += 1;
+}
+
+/**
+ * @brief Run the benchmark workload on a layer.
+ *
+ * @param layerPath   The path of the layer library, or empty for no layer.
+ * @param options     The workload configuration.
+ * @param results     The results to populate.
+ *
+ * @return @c true on success, @c false otherwise.
+ */
+static bool runBenchmark(const std::string& layerPath, const Options& options, Results& results)
+{
+    LayerHarness harness(layerPath);
+    if (!harness.isValid())
+    {
+        printf("ERROR: Failed to create device for layer '%s'\n", layerPath.c_str());
+        return false;
+    }
+
+    VkDevice device = harness.getDevice();
+    VkQueue queue = harness.getQueue();
+
+    DeviceFunctions functions {};
+    if (!loadFunctions(harness, functions))
+    {
+        return false;
+    }
+
+    SharedResources resources;
+    if (!createSharedResources(device, functions, resources))
+    {
+        printf("ERROR: Failed to create shared resources\n");
+        destroySharedResources(device, functions, resources);
+        return false;
+    }
+
+    // Allocate per-thread command pools and command buffers
+    std::vector<ThreadState> threads(options.threads);
+    for (auto& thread : threads)
+    {
+        VkCommandPoolCreateInfo poolInfo {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = harness.getQueueFamilyIndex();
+        functions.vkCreateCommandPool(device, &poolInfo, nullptr, &thread.commandPool);
+
+        VkCommandBufferAllocateInfo allocInfo {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = thread.commandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = options.commandBuffers;
+
+        thread.commandBuffers.resize(options.commandBuffers);
+        functions.vkAllocateCommandBuffers(device, &allocInfo, thread.commandBuffers.data());
+    }
+
+    std::vector<VkCommandBuffer> submitBuffers;
+    for (const auto& thread : threads)
+    {
+        submitBuffers.insert(submitBuffers.end(), thread.commandBuffers.begin(), thread.commandBuffers.end());
+    }
+
+    VkSubmitInfo submitInfo {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = static_cast<uint32_t>(submitBuffers.size());
+    submitInfo.pCommandBuffers = submitBuffers.data();
+
+    uint32_t imageIndex {0};
+
+    VkPresentInfoKHR presentInfo {};
+    presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+    presentInfo.swapchainCount = 1;
+    presentInfo.pSwapchains = &resources.swapchain;
+    presentInfo.pImageIndices = &imageIndex;
+
+    int64_t startMemory {0};
+    uint32_t totalFrames = options.warmupFrames + options.frames;
+    for (uint32_t frame = 0; frame < totalFrames; frame++)
+    {
+        bool timed = frame >= options.warmupFrames;
+        if (frame == options.warmupFrames)
+        {
+            startMemory = getResidentBytes();
+            for (auto& thread : threads)
+            {
+                thread.calls = {};
+            }
+        }
+
+        // Record the frame command buffers in parallel
+        std::vector<std::thread> workers;
+        for (auto& thread : threads)
+        {
+            workers.emplace_back([&]() {
+                functions.vkResetCommandPool(device, thread.commandPool, 0);
+                for (auto commandBuffer : thread.commandBuffers)
+                {
+                    recordCommandBuffer(functions, options, resources, commandBuffer, thread.calls);
+                }
+            });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        // Submit and present the frame
+        uint64_t start = getTimeNs();
+        functions.vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
+        uint64_t mid = getTimeNs();
+        functions.vkQueuePresentKHR(queue, &presentInfo);
+        uint64_t end = getTimeNs();
+
+        if (timed)
+        {
+            results.submitTimes.push_back(static_cast<double>(mid - start) / 1000.0);
+            results.presentTimes.push_back(static_cast<double>(end - mid) / 1000.0);
+        }
+
+        imageIndex = (imageIndex + 1) % 3;
+    }
+
+    results.memoryGrowth = getResidentBytes() - startMemory;
+
+    for (const auto& thread : threads)
+    {
+        for (size_t i = 0; i < CALL_TYPE_COUNT; i++)
+        {
+            results.calls[i].calls += thread.calls[i].calls;
+            results.calls[i].nanoseconds += thread.calls[i].nanoseconds;
+        }
+
+        functions.vkDestroyCommandPool(device, thread.commandPool, nullptr);
+    }
+
+    destroySharedResources(device, functions, resources);
+    return true;
+}
+
+/**
+ * @brief Get the time per call for a timing stat, in nanoseconds.
+ */
+static double getNsPerCall(const CallStats& stats)
+{
+    if (stats.calls == 0)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(stats.nanoseconds) / static_cast<double>(stats.calls);
+}
+
+/**
+ * @brief Get a percentile of a list of samples.
+ *
+ * @param samples      The samples, which will be sorted.
+ * @param percentile   The percentile to return, between 0 and 1.
+ */
+static double getPercentile(std::vector<double>& samples, double percentile)
+{
+    if (samples.empty())
+    {
+        return 0.0;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    size_t index = static_cast<size_t>(percentile * static_cast<double>(samples.size() - 1));
+    return samples[index];
+}
+
+/**
+ * @brief Print the results of a benchmark run.
+ *
+ * @param name       The name of the run.
+ * @param options    The workload configuration.
+ * @param results    The results to print.
+ * @param baseline   The baseline results to compare against, or @c nullptr.
+ */
+static void printResults(const char* name, const Options& options, Results& results, Results* baseline)
+{
+    printf("%s\n", name);
+    printf("  %-32s %12s %10s %10s\n", "Command", "Calls", "ns/call", "Overhead");
+
+    CallStats total {};
+    CallStats baseTotal {};
+    for (size_t i = 0; i < CALL_TYPE_COUNT; i++)
+    {
+        const auto& stats = results.calls[i];
+        total.calls += stats.calls;
+        total.nanoseconds += stats.nanoseconds;
+
+        double nsPerCall = getNsPerCall(stats);
+        if (baseline)
+        {
+            const auto& baseStats = baseline->calls[i];
+            baseTotal.calls += baseStats.calls;
+            baseTotal.nanoseconds += baseStats.nanoseconds;
+
+            double overhead = nsPerCall - getNsPerCall(baseStats);
+            printf("  %-32s %12" PRIu64 " %10.1f %10.1f\n", callTypeNames[i], stats.calls, nsPerCall, overhead);
+        }
+        else
+        {
+            printf("  %-32s %12" PRIu64 " %10.1f\n", callTypeNames[i], stats.calls, nsPerCall);
+        }
+    }
+
+    double nsPerCall = getNsPerCall(total);
+    if (baseline)
+    {
+        double overhead = nsPerCall - getNsPerCall(baseTotal);
+        printf("  %-32s %12" PRIu64 " %10.1f %10.1f\n", "All commands", total.calls, nsPerCall, overhead);
+    }
+    else
+    {
+        printf("  %-32s %12" PRIu64 " %10.1f\n", "All commands", total.calls, nsPerCall);
+    }
+
+    printf("  %-32s median %8.1f us, p99 %8.1f us\n",
+           "vkQueueSubmit",
+           getPercentile(results.submitTimes, 0.5),
+           getPercentile(results.submitTimes, 0.99));
+
+    printf("  %-32s median %8.1f us, p99 %8.1f us\n",
+           "vkQueuePresentKHR",
+           getPercentile(results.presentTimes, 0.5),
+           getPercentile(results.presentTimes, 0.99));
+
+    double growthKB = static_cast<double>(results.memoryGrowth) / 1024.0;
+    double growthPerFrame = static_cast<double>(results.memoryGrowth) / static_cast<double>(options.frames);
+    printf("  %-32s %.1f KB over %u frames (%.1f bytes/frame)\n\n",
+           "Memory growth",
+           growthKB, options.frames, growthPerFrame);
+}
+
+/**
+ * @brief Print the command line usage.
+ */
+static void printUsage(const char* program)
+{
+    printf("Usage: %s [options]\n", program);
+    printf("  --layer <path>           Layer library to benchmark; baseline only if omitted\n");
+    printf("  --threads <n>            Recording threads (default 4)\n");
+    printf("  --command-buffers <n>    Command buffers per thread per frame (default 4)\n");
+    printf("  --frames <n>             Timed frames (default 200)\n");
+    printf("  --warmup-frames <n>      Untimed warm-up frames (default 20)\n");
+    printf("  --render-passes <n>      Render passes per command buffer (default 4)\n");
+    printf("  --draws <n>              Draws per render pass (default 100)\n");
+    printf("  --dispatches <n>         Dispatches per command buffer (default 16)\n");
+    printf("  --labels <n>             Debug label depth per region (default 1)\n");
+}
+
+/**
+ * @brief Parse the command line options.
+ *
+ * @param argc      The number of arguments.
+ * @param argv      The argument values.
+ * @param options   The options to populate.
+ *
+ * @return @c true on success, @c false if the options were invalid.
+ */
+static bool parseOptions(int argc, char** argv, Options& options)
+{
+    struct
+    {
+        const char* name;
+        uint32_t* value;
+    } counts[] {
+        {"--threads", &options.threads},
+        {"--command-buffers", &options.commandBuffers},
+        {"--frames", &options.frames},
+        {"--warmup-frames", &options.warmupFrames},
+        {"--render-passes", &options.renderPasses},
+        {"--draws", &options.draws},
+        {"--dispatches", &options.dispatches},
+        {"--labels", &options.labels},
+    };
+
+    for (int i = 1; i < argc; i++)
+    {
+        // All options take a value
+        if (i + 1 >= argc)
+        {
+            return false;
+        }
+
+        const char* arg = argv[i];
+        const char* value = argv[++i];
+
+        if (!strcmp(arg, "--layer"))
+        {
+            options.layerPath = value;
+            continue;
+        }
+
+        auto it = std::find_if(std::begin(counts), std::end(counts), [&](const auto& count) {
+            return !strcmp(arg, count.name);
+        });
+
+        if (it == std::end(counts))
+        {
+            return false;
+        }
+
+        *(it->value) = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+    }
+
+    return (options.threads > 0) && (options.commandBuffers > 0) && (options.frames > 0);
+}
+
+/**
+ * @brief Benchmark entry point.
+ */
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    printf("Workload: %u threads x %u command buffers, %u frames\n",
+           options.threads, options.commandBuffers, options.frames);
+    printf("  Per command buffer: %u render passes x %u draws, %u dispatches, label depth %u\n\n",
+           options.renderPasses, options.draws, options.dispatches, options.labels);
+
+    Results baseline;
+    if (!runBenchmark("", options, baseline))
+    {
+        return 1;
+    }
+
+    printResults("Null driver", options, baseline, nullptr);
+
+    if (options.layerPath.empty())
+    {
+        return 0;
+    }
+
+    Results layer;
+    if (!runBenchmark(options.layerPath, options, layer))
+    {
+        return 1;
+    }
+
+    printResults(options.layerPath.c_str(), options, layer, &baseline);
+    return 0;
+}
@@ -0,0 +1,314 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The implementation of the layer smoke tests.
+ *
+ * These tests load built layer libraries on top of the null driver, and drive
+ * a few frames of a simple workload through each layer. The layers to test
+ * are given as a colon-separated list of library paths in the
+ * LGL_TEST_LAYERS environment variable, and the tests are skipped if it is
+ * not set.
+ */
+#include "null_driver/layer_harness.hpp"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace NullDriver;
+
+/**
+ * @brief The number of frames to run through each layer.
+ */
+static constexpr uint32_t FRAME_COUNT {3};
+
+/**
+ * @brief The device functions used by the tests.
+ */
+struct DeviceFunctions
+{
+    PFN_vkCreateCommandPool vkCreateCommandPool;
+    PFN_vkDestroyCommandPool vkDestroyCommandPool;
+    PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers;
+    PFN_vkBeginCommandBuffer vkBeginCommandBuffer;
+    PFN_vkEndCommandBuffer vkEndCommandBuffer;
+    PFN_vkCreateRenderPass vkCreateRenderPass;
+    PFN_vkDestroyRenderPass vkDestroyRenderPass;
+    PFN_vkCreateFramebuffer vkCreateFramebuffer;
+    PFN_vkDestroyFramebuffer vkDestroyFramebuffer;
+    PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR;
+    PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR;
+    PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass;
+    PFN_vkCmdEndRenderPass vkCmdEndRenderPass;
+    PFN_vkCmdBeginDebugUtilsLabelEXT vkCmdBeginDebugUtilsLabelEXT;
+    PFN_vkCmdEndDebugUtilsLabelEXT vkCmdEndDebugUtilsLabelEXT;
+    PFN_vkCmdDraw vkCmdDraw;
+    PFN_vkCmdDispatch vkCmdDispatch;
+    PFN_vkQueueSubmit vkQueueSubmit;
+    PFN_vkQueuePresentKHR vkQueuePresentKHR;
+};
+
+/**
+ * @brief Get the layer libraries to test.
+ *
+ * @return The library paths, which may be empty.
+ */
+static std::vector<std::string> getTestLayers()
+{
+    std::vector<std::string> layers;
+
+    const char* value = std::getenv("LGL_TEST_LAYERS");
+    if (!value)
+    {
+        return layers;
+    }
+
+    std::stringstream paths(value);
+    std::string path;
+    while (std::getline(paths, path, ':'))
+    {
+        if (!path.empty())
+        {
+            layers.push_back(path);
+        }
+    }
+
+    return layers;
+}
+
+/**
+ * @brief Load the device functions from the top of the layer stack.
+ *
+ * @param harness     The layer harness.
+ * @param functions   The function table to populate.
+ *
+ * @return @c true if all functions were found, @c false otherwise.
+ */
+static bool loadFunctions(const LayerHarness& harness, DeviceFunctions& functions)
+{
+#define LOAD(fnc)                                                    \
+    functions.fnc = harness.getDeviceFunction<PFN_##fnc>(#fnc);      \
+    if (!functions.fnc)                                              \
+    {                                                                \
+        return false;                                                \
+    }
+
+    LOAD(vkCreateCommandPool);
+    LOAD(vkDestroyCommandPool);
+    LOAD(vkAllocateCommandBuffers);
+    LOAD(vkBeginCommandBuffer);
+    LOAD(vkEndCommandBuffer);
+    LOAD(vkCreateRenderPass);
+    LOAD(vkDestroyRenderPass);
+    LOAD(vkCreateFramebuffer);
+    LOAD(vkDestroyFramebuffer);
+    LOAD(vkCreateSwapchainKHR);
+    LOAD(vkDestroySwapchainKHR);
+    LOAD(vkCmdBeginRenderPass);
+    LOAD(vkCmdEndRenderPass);
+    LOAD(vkCmdBeginDebugUtilsLabelEXT);
+    LOAD(vkCmdEndDebugUtilsLabelEXT);
+    LOAD(vkCmdDraw);
+    LOAD(vkCmdDispatch);
+    LOAD(vkQueueSubmit);
+    LOAD(vkQueuePresentKHR);
+
+#undef LOAD
+    return true;
+}
+
+/**
+ * @brief Record, submit, and present a few frames through a layer.
+ *
+ * @param layerPath   The path of the layer library to test.
+ */
+static void runFrames(const std::string& layerPath)
+{
+    LayerHarness harness(layerPath);
+    ASSERT_TRUE(harness.isValid());
+
+    DeviceFunctions functions {};
+    ASSERT_TRUE(loadFunctions(harness, functions));
+
+    VkDevice device = harness.getDevice();
+    VkQueue queue = harness.getQueue();
+
+    // Create the render pass, framebuffer, and swapchain
+    VkAttachmentDescription attachment {};
+    attachment.format = VK_FORMAT_R8G8B8A8_UNORM;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    VkAttachmentReference colorReference {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    VkSubpassDescription subpass {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorReference;
+
+    VkRenderPassCreateInfo renderPassInfo {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &attachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+
+    VkRenderPass renderPass {VK_NULL_HANDLE};
+    ASSERT_EQ(functions.vkCreateRenderPass(device, &renderPassInfo, nullptr, &renderPass), VK_SUCCESS);
+
+    // The null driver never dereferences image views, so no view is needed
+    VkImageView imageView {VK_NULL_HANDLE};
+    VkExtent2D extent {640, 480};
+
+    VkFramebufferCreateInfo framebufferInfo {};
+    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebufferInfo.renderPass = renderPass;
+    framebufferInfo.attachmentCount = 1;
+    framebufferInfo.pAttachments = &imageView;
+    framebufferInfo.width = extent.width;
+    framebufferInfo.height = extent.height;
+    framebufferInfo.layers = 1;
+
+    VkFramebuffer framebuffer {VK_NULL_HANDLE};
+    ASSERT_EQ(functions.vkCreateFramebuffer(device, &framebufferInfo, nullptr, &framebuffer), VK_SUCCESS);
+
+    VkSwapchainCreateInfoKHR swapchainInfo {};
+    swapchainInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+    swapchainInfo.minImageCount = 3;
+    swapchainInfo.imageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+    swapchainInfo.imageColorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+    swapchainInfo.imageExtent = extent;
+    swapchainInfo.imageArrayLayers = 1;
+    swapchainInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    swapchainInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    swapchainInfo.preTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    swapchainInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    swapchainInfo.presentMode = VK_PRESENT_MODE_FIFO_KHR;
+
+    VkSwapchainKHR swapchain {VK_NULL_HANDLE};
+    ASSERT_EQ(functions.vkCreateSwapchainKHR(device, &swapchainInfo, nullptr, &swapchain), VK_SUCCESS);
+
+    // Create the command buffer
+    VkCommandPoolCreateInfo poolInfo {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = harness.getQueueFamilyIndex();
+
+    VkCommandPool commandPool {VK_NULL_HANDLE};
+    ASSERT_EQ(functions.vkCreateCommandPool(device, &poolInfo, nullptr, &commandPool), VK_SUCCESS);
+
+    VkCommandBufferAllocateInfo allocInfo {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = commandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+
+    VkCommandBuffer commandBuffer {VK_NULL_HANDLE};
+    ASSERT_EQ(functions.vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer), VK_SUCCESS);
+
+    for (uint32_t frame = 0; frame < FRAME_COUNT; frame++)
+    {
+        // Record a render pass and a compute dispatch inside a debug label
+        VkCommandBufferBeginInfo beginInfo {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        ASSERT_EQ(functions.vkBeginCommandBuffer(commandBuffer, &beginInfo), VK_SUCCESS);
+
+        VkDebugUtilsLabelEXT label {};
+        label.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+        label.pLabelName = "Frame";
+        functions.vkCmdBeginDebugUtilsLabelEXT(commandBuffer, &label);
+
+        VkClearValue clearValue {};
+        VkRenderPassBeginInfo renderPassBegin {};
+        renderPassBegin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassBegin.renderPass = renderPass;
+        renderPassBegin.framebuffer = framebuffer;
+        renderPassBegin.renderArea.extent = extent;
+        renderPassBegin.clearValueCount = 1;
+        renderPassBegin.pClearValues = &clearValue;
+
+        functions.vkCmdBeginRenderPass(commandBuffer, &renderPassBegin, VK_SUBPASS_CONTENTS_INLINE);
+        functions.vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+        functions.vkCmdDraw(commandBuffer, 6, 2, 0, 0);
+        functions.vkCmdEndRenderPass(commandBuffer);
+
+        functions.vkCmdDispatch(commandBuffer, 8, 8, 1);
+        functions.vkCmdEndDebugUtilsLabelEXT(commandBuffer);
+        ASSERT_EQ(functions.vkEndCommandBuffer(commandBuffer), VK_SUCCESS);
+
+        // Submit and present the frame
+        VkSubmitInfo submitInfo {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+        ASSERT_EQ(functions.vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE), VK_SUCCESS);
+
+        uint32_t imageIndex {frame % swapchainInfo.minImageCount};
+        VkPresentInfoKHR presentInfo {};
+        presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        presentInfo.swapchainCount = 1;
+        presentInfo.pSwapchains = &swapchain;
+        presentInfo.pImageIndices = &imageIndex;
+        ASSERT_EQ(functions.vkQueuePresentKHR(queue, &presentInfo), VK_SUCCESS);
+    }
+
+    functions.vkDestroyCommandPool(device, commandPool, nullptr);
+    functions.vkDestroySwapchainKHR(device, swapchain, nullptr);
+    functions.vkDestroyFramebuffer(device, framebuffer, nullptr);
+    functions.vkDestroyRenderPass(device, renderPass, nullptr);
+}
+
+/** @brief Test that frames can be run without a layer. */
+TEST(Layers, test_null_driver_frames)
+{
+    runFrames("");
+}
+
+/** @brief Test that frames can be run through each layer under test. */
+TEST(Layers, test_layer_frames)
+{
+    auto layers = getTestLayers();
+    if (layers.empty())
+    {
+        GTEST_SKIP() << "LGL_TEST_LAYERS is not set";
+    }
+
+    for (const auto& layer : layers)
+    {
+        SCOPED_TRACE(layer);
+        runFrames(layer);
+    }
+}
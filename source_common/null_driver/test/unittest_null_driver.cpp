@@ -0,0 +1,188 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The implementation of the null driver unit tests.
+ */
+#include "null_driver/layer_harness.hpp"
+#include "null_driver/null_driver.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace NullDriver;
+
+/**
+ * @brief Get the dispatch key of a dispatchable object.
+ */
+template<typename T>
+void* getDispatchKey(T object)
+{
+    return *reinterpret_cast<void**>(object);
+}
+
+/** @brief Test that the harness can create a device with no layer. */
+TEST(NullDriver, test_harness_create)
+{
+    LayerHarness harness("");
+    ASSERT_TRUE(harness.isValid());
+
+    EXPECT_NE(harness.getInstance(), nullptr);
+    EXPECT_NE(harness.getPhysicalDevice(), nullptr);
+    EXPECT_NE(harness.getDevice(), nullptr);
+    EXPECT_NE(harness.getQueue(), nullptr);
+}
+
+/** @brief Test that the harness fails cleanly for a missing layer. */
+TEST(NullDriver, test_harness_missing_layer)
+{
+    LayerHarness harness("./this_layer_does_not_exist.so");
+    EXPECT_FALSE(harness.isValid());
+}
+
+/** @brief Test that child objects share their parent dispatch key. */
+TEST(NullDriver, test_dispatch_keys)
+{
+    LayerHarness harness("");
+    ASSERT_TRUE(harness.isValid());
+
+    VkDevice device = harness.getDevice();
+
+    EXPECT_EQ(getDispatchKey(harness.getPhysicalDevice()), getDispatchKey(harness.getInstance()));
+    EXPECT_EQ(getDispatchKey(harness.getQueue()), getDispatchKey(device));
+
+    auto fpCreateCommandPool = harness.getDeviceFunction<PFN_vkCreateCommandPool>("vkCreateCommandPool");
+    auto fpDestroyCommandPool = harness.getDeviceFunction<PFN_vkDestroyCommandPool>("vkDestroyCommandPool");
+    auto fpAllocateCommandBuffers = harness.getDeviceFunction<PFN_vkAllocateCommandBuffers>("vkAllocateCommandBuffers");
+    ASSERT_NE(fpCreateCommandPool, nullptr);
+    ASSERT_NE(fpDestroyCommandPool, nullptr);
+    ASSERT_NE(fpAllocateCommandBuffers, nullptr);
+
+    VkCommandPoolCreateInfo poolInfo {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.queueFamilyIndex = harness.getQueueFamilyIndex();
+
+    VkCommandPool pool {VK_NULL_HANDLE};
+    ASSERT_EQ(fpCreateCommandPool(device, &poolInfo, nullptr, &pool), VK_SUCCESS);
+
+    VkCommandBufferAllocateInfo allocInfo {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = pool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 2;
+
+    VkCommandBuffer commandBuffers[2] {};
+    ASSERT_EQ(fpAllocateCommandBuffers(device, &allocInfo, commandBuffers), VK_SUCCESS);
+
+    EXPECT_NE(commandBuffers[0], commandBuffers[1]);
+    EXPECT_EQ(getDispatchKey(commandBuffers[0]), getDispatchKey(device));
+    EXPECT_EQ(getDispatchKey(commandBuffers[1]), getDispatchKey(device));
+
+    fpDestroyCommandPool(device, pool, nullptr);
+}
+
+/** @brief Test that created non-dispatchable handles are unique. */
+TEST(NullDriver, test_unique_handles)
+{
+    LayerHarness harness("");
+    ASSERT_TRUE(harness.isValid());
+
+    auto fpCreateFence = harness.getDeviceFunction<PFN_vkCreateFence>("vkCreateFence");
+    ASSERT_NE(fpCreateFence, nullptr);
+
+    VkFenceCreateInfo createInfo {};
+    createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence fence1 {VK_NULL_HANDLE};
+    VkFence fence2 {VK_NULL_HANDLE};
+    EXPECT_EQ(fpCreateFence(harness.getDevice(), &createInfo, nullptr, &fence1), VK_SUCCESS);
+    EXPECT_EQ(fpCreateFence(harness.getDevice(), &createInfo, nullptr, &fence2), VK_SUCCESS);
+
+    EXPECT_NE(fence1, VK_NULL_HANDLE);
+    EXPECT_NE(fence2, VK_NULL_HANDLE);
+    EXPECT_NE(fence1, fence2);
+}
+
+/** @brief Test that stubbed queries return empty results. */
+TEST(NullDriver, test_stub_empty_query)
+{
+    LayerHarness harness("");
+    ASSERT_TRUE(harness.isValid());
+
+    auto fpGetSwapchainImages = harness.getDeviceFunction<PFN_vkGetSwapchainImagesKHR>("vkGetSwapchainImagesKHR");
+    ASSERT_NE(fpGetSwapchainImages, nullptr);
+
+    uint32_t count = 16;
+    EXPECT_EQ(fpGetSwapchainImages(harness.getDevice(), VK_NULL_HANDLE, &count, nullptr), VK_SUCCESS);
+    EXPECT_EQ(count, 0u);
+}
+
+/** @brief Test that device memory can be mapped and written. */
+TEST(NullDriver, test_map_memory)
+{
+    LayerHarness harness("");
+    ASSERT_TRUE(harness.isValid());
+
+    VkDevice device = harness.getDevice();
+    auto fpAllocateMemory = harness.getDeviceFunction<PFN_vkAllocateMemory>("vkAllocateMemory");
+    auto fpMapMemory = harness.getDeviceFunction<PFN_vkMapMemory>("vkMapMemory");
+    auto fpFreeMemory = harness.getDeviceFunction<PFN_vkFreeMemory>("vkFreeMemory");
+
+    VkMemoryAllocateInfo allocInfo {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = 256;
+
+    VkDeviceMemory memory {VK_NULL_HANDLE};
+    ASSERT_EQ(fpAllocateMemory(device, &allocInfo, nullptr, &memory), VK_SUCCESS);
+
+    void* data {nullptr};
+    ASSERT_EQ(fpMapMemory(device, memory, 128, VK_WHOLE_SIZE, 0, &data), VK_SUCCESS);
+    ASSERT_NE(data, nullptr);
+
+    // Writes must not fault
+    static_cast<uint8_t*>(data)[127] = 0xFF;
+
+    fpFreeMemory(device, memory, nullptr);
+}
+
+/** @brief Test that events always report as signaled. */
+TEST(NullDriver, test_event_status)
+{
+    LayerHarness harness("");
+    ASSERT_TRUE(harness.isValid());
+
+    auto fpGetEventStatus = harness.getDeviceFunction<PFN_vkGetEventStatus>("vkGetEventStatus");
+    ASSERT_NE(fpGetEventStatus, nullptr);
+
+    EXPECT_EQ(fpGetEventStatus(harness.getDevice(), VK_NULL_HANDLE), VK_EVENT_SET);
+}
+
+/** @brief Test that unknown functions are not returned. */
+TEST(NullDriver, test_unknown_function)
+{
+    EXPECT_EQ(getInstanceProcAddr(nullptr, "vkNotARealFunction"), nullptr);
+    EXPECT_NE(getInstanceProcAddr(nullptr, "vkCreateInstance"), nullptr);
+    EXPECT_NE(getInstanceProcAddr(nullptr, "vkEnumerateInstanceVersion"), nullptr);
+}
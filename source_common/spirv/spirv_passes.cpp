@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines the standard SPIR-V rewrite passes.
+ */
+
+#include "spirv/spirv_passes.hpp"
+
+namespace Spirv
+{
+
+namespace
+{
+
+/**
+ * @brief Build the list of decorate opcodes from the decorate table.
+ */
+constexpr std::array<uint16_t, DECORATE_OPCODES.size()> makeDecorateOpcodeList()
+{
+    std::array<uint16_t, DECORATE_OPCODES.size()> opcodes {};
+    for (size_t i = 0; i < DECORATE_OPCODES.size(); i++)
+    {
+        opcodes[i] = DECORATE_OPCODES[i].opcode;
+    }
+
+    return opcodes;
+}
+
+constexpr auto DECORATE_OPCODE_LIST = makeDecorateOpcodeList();
+
+}
+
+/* See header for documentation. */
+std::span<const uint16_t> RemoveRelaxedPrecisionPass::getOpcodes() const
+{
+    return DECORATE_OPCODE_LIST;
+}
+
+/* See header for documentation. */
+PassAction RemoveRelaxedPrecisionPass::visit(
+    std::span<const uint32_t> instruction,
+    std::vector<uint32_t>& rewrite
+) {
+    (void)rewrite;
+
+    size_t offset = getDecorationOffset(getOpcode(instruction[0]));
+    if (offset && offset < instruction.size() &&
+        instruction[offset] == DECORATION_RELAXED_PRECISION)
+    {
+        return PassAction::DROP;
+    }
+
+    return PassAction::KEEP;
+}
+
+/* See header for documentation. */
+std::span<const uint16_t> AppendNopPass::getOpcodes() const
+{
+    return {};
+}
+
+/* See header for documentation. */
+PassAction AppendNopPass::visit(
+    std::span<const uint32_t> instruction,
+    std::vector<uint32_t>& rewrite
+) {
+    (void)instruction;
+    (void)rewrite;
+    return PassAction::KEEP;
+}
+
+/* See header for documentation. */
+void AppendNopPass::finish(
+    std::vector<uint32_t>& code
+) {
+    code.push_back(makeWord0(OPCODE_NOP, 1));
+}
+
+}
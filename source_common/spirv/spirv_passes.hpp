@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares the standard SPIR-V rewrite passes.
+ */
+
+#pragma once
+
+#include "spirv/spirv_pipeline.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Spirv
+{
+
+/**
+ * @brief Opcode IDs for interesting SPIR-V opcodes.
+ */
+static constexpr uint16_t OPCODE_NOP {0};
+static constexpr uint16_t OPCODE_DECORATE {71};
+static constexpr uint16_t OPCODE_MEMBER_DECORATE {72};
+static constexpr uint16_t OPCODE_DECORATE_ID {332};
+static constexpr uint16_t OPCODE_DECORATE_STRING {5632};
+static constexpr uint16_t OPCODE_MEMBER_DECORATE_STRING {5633};
+
+/**
+ * @brief Decoration IDs for interesting SPIR-V decorations.
+ */
+static constexpr uint32_t DECORATION_RELAXED_PRECISION {0};
+
+/**
+ * @brief A decorate opcode and the word offset of its decoration ID.
+ */
+struct DecorateOpcode
+{
+    /**
+     * @brief The decorate opcode.
+     */
+    uint16_t opcode;
+
+    /**
+     * @brief The word offset of the decoration ID in the instruction.
+     */
+    uint16_t decorationOffset;
+};
+
+/**
+ * @brief Table of decorate opcodes.
+ */
+static constexpr std::array<DecorateOpcode, 5> DECORATE_OPCODES {{
+    {OPCODE_DECORATE, 2},
+    {OPCODE_MEMBER_DECORATE, 3},
+    {OPCODE_DECORATE_ID, 2},
+    {OPCODE_DECORATE_STRING, 2},
+    {OPCODE_MEMBER_DECORATE_STRING, 3},
+}};
+
+/**
+ * @brief Get the word offset of the decoration ID for a decorate opcode.
+ *
+ * @param opcode   The instruction opcode.
+ *
+ * @return The word offset, or zero if not a decorate opcode.
+ */
+constexpr uint16_t getDecorationOffset(uint16_t opcode)
+{
+    for (const auto& entry : DECORATE_OPCODES)
+    {
+        if (entry.opcode == opcode)
+        {
+            return entry.decorationOffset;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief A pass that removes all RelaxedPrecision decorations.
+ */
+class RemoveRelaxedPrecisionPass : public Pass
+{
+public:
+    /* See base class for documentation. */
+    std::span<const uint16_t> getOpcodes() const override;
+
+    /* See base class for documentation. */
+    PassAction visit(
+        std::span<const uint32_t> instruction,
+        std::vector<uint32_t>& rewrite) override;
+};
+
+/**
+ * @brief A pass that appends an OpNop to change the module hash.
+ *
+ * The module is functionally the same, but will not match any driver-side
+ * cache entries for the original module.
+ */
+class AppendNopPass : public Pass
+{
+public:
+    /* See base class for documentation. */
+    std::span<const uint16_t> getOpcodes() const override;
+
+    /* See base class for documentation. */
+    PassAction visit(
+        std::span<const uint32_t> instruction,
+        std::vector<uint32_t>& rewrite) override;
+
+    /* See base class for documentation. */
+    void finish(
+        std::vector<uint32_t>& code) override;
+};
+
+}
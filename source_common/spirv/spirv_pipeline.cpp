@@ -0,0 +1,198 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Defines a single-pass SPIR-V rewriting pipeline.
+ */
+
+#include "spirv/spirv_pipeline.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Spirv
+{
+
+/* See header for documentation. */
+void Pipeline::addPass(
+    std::unique_ptr<Pass> pass
+) {
+    size_t index = passes.size();
+    assert(index < 32 && "Too many passes in pipeline");
+
+    for (uint16_t opcode : pass->getOpcodes())
+    {
+        auto end = opcodePasses.begin() + opcodeCount;
+        auto it = std::lower_bound(opcodePasses.begin(), end, opcode,
+            [](const OpcodePasses& entry, uint16_t value) { return entry.opcode < value; });
+
+        if (it == end || it->opcode != opcode)
+        {
+            assert(opcodeCount < MAX_OPCODES && "Too many opcodes in pipeline");
+            if (opcodeCount == MAX_OPCODES)
+            {
+                continue;
+            }
+
+            std::move_backward(it, end, end + 1);
+            *it = { opcode, 0 };
+            opcodeCount++;
+        }
+
+        it->mask |= 1U << index;
+    }
+
+    passes.push_back(std::move(pass));
+}
+
+/* See header for documentation. */
+uint32_t Pipeline::getOpcodePasses(
+    uint16_t opcode
+) const {
+    auto begin = opcodePasses.begin();
+    auto end = begin + opcodeCount;
+    auto it = std::lower_bound(begin, end, opcode,
+        [](const OpcodePasses& entry, uint16_t value) { return entry.opcode < value; });
+
+    return (it != end && it->opcode == opcode) ? it->mask : 0;
+}
+
+/* See header for documentation. */
+void Pipeline::flush(
+    std::span<const uint32_t> code,
+    size_t end
+) {
+    // Allocate the output once on first modification, with some headroom
+    // for passes that add instructions
+    if (!modified)
+    {
+        output.clear();
+        output.reserve(code.size() + code.size() / 16 + HEADER_WORDS);
+        modified = true;
+    }
+
+    output.insert(output.end(), code.begin() + flushed, code.begin() + end);
+    flushed = end;
+}
+
+/* See header for documentation. */
+std::span<const uint32_t> Pipeline::run(
+    std::span<const uint32_t> code
+) {
+    modified = false;
+    flushed = 0;
+
+    // This should never happen, but skip invalid modules
+    if (code.size() < HEADER_WORDS || code[0] != MAGIC_NUMBER || passes.empty())
+    {
+        return code;
+    }
+
+    size_t i = HEADER_WORDS;
+    while (i < code.size())
+    {
+        uint32_t word0 = code[i];
+        uint16_t opcode = getOpcode(word0);
+        uint16_t wordCount = getWordCount(word0);
+
+        // This should never happen, but avoids infinite loop on bad input
+        if (wordCount == 0 || (code.size() - i) < wordCount)
+        {
+            modified = false;
+            return code;
+        }
+
+        uint32_t mask = getOpcodePasses(opcode);
+        if (!mask)
+        {
+            i += wordCount;
+            continue;
+        }
+
+        // Apply each interested pass in order, with later passes seeing the
+        // output of earlier passes
+        std::span<const uint32_t> instruction = code.subspan(i, wordCount);
+        bool changed = false;
+
+        for (size_t p = 0; p < passes.size() && instruction.size(); p++)
+        {
+            if (!(mask & (1U << p)))
+            {
+                continue;
+            }
+
+            rewrite.clear();
+            PassAction action = passes[p]->visit(instruction, rewrite);
+            if (action == PassAction::KEEP)
+            {
+                continue;
+            }
+
+            changed = true;
+            if (action == PassAction::DROP)
+            {
+                instruction = {};
+            }
+            else
+            {
+                current.swap(rewrite);
+                instruction = current;
+            }
+        }
+
+        if (changed)
+        {
+            flush(code, i);
+            output.insert(output.end(), instruction.begin(), instruction.end());
+            flushed = i + wordCount;
+        }
+
+        i += wordCount;
+    }
+
+    // Let passes append instructions at the end of the module
+    rewrite.clear();
+    for (auto& pass : passes)
+    {
+        pass->finish(rewrite);
+    }
+
+    if (!rewrite.empty())
+    {
+        flush(code, code.size());
+        output.insert(output.end(), rewrite.begin(), rewrite.end());
+    }
+
+    if (!modified)
+    {
+        return code;
+    }
+
+    flush(code, code.size());
+    return output;
+}
+
+}
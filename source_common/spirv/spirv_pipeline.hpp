@@ -0,0 +1,296 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * Declares a single-pass SPIR-V rewriting pipeline.
+ *
+ * Role summary
+ * ============
+ *
+ * Layers that modify shader modules need to apply one or more rewrite passes
+ * to the SPIR-V binary passed by the application. The pipeline walks the
+ * instructions in a module once, and for each instruction runs only the
+ * passes that registered an interest in that opcode. Passes can keep, drop,
+ * or rewrite instructions, and can append instructions at the end of the
+ * module.
+ *
+ * The pipeline is copy-on-write: unmodified runs of instructions are copied
+ * into the output in bulk, and if no pass modifies the module the pipeline
+ * returns the input without making a copy.
+ *
+ * Threading
+ * =========
+ *
+ * A pipeline is not thread-safe, and the output of a run is only valid until
+ * the next run. Use one pipeline per thread, or one per call.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Spirv
+{
+
+/**
+ * @brief The number of words in the SPIR-V module header.
+ */
+static constexpr size_t HEADER_WORDS {5};
+
+/**
+ * @brief The SPIR-V module magic number.
+ */
+static constexpr uint32_t MAGIC_NUMBER {0x07230203};
+
+/**
+ * @brief Get the opcode of an instruction.
+ *
+ * @param word0   The first word of the instruction.
+ */
+constexpr uint16_t getOpcode(uint32_t word0)
+{
+    return static_cast<uint16_t>(word0 & 0xFFFF);
+}
+
+/**
+ * @brief Get the word count of an instruction.
+ *
+ * @param word0   The first word of the instruction.
+ */
+constexpr uint16_t getWordCount(uint32_t word0)
+{
+    return static_cast<uint16_t>(word0 >> 16);
+}
+
+/**
+ * @brief Make the first word of an instruction.
+ *
+ * @param opcode      The instruction opcode.
+ * @param wordCount   The instruction word count, including the first word.
+ */
+constexpr uint32_t makeWord0(uint16_t opcode, uint16_t wordCount)
+{
+    return (static_cast<uint32_t>(wordCount) << 16) | opcode;
+}
+
+/**
+ * @brief The action a pass takes for an instruction.
+ */
+enum class PassAction
+{
+    /** Keep the instruction unmodified. */
+    KEEP,
+    /** Drop the instruction from the module. */
+    DROP,
+    /** Replace the instruction with the words in the rewrite buffer. */
+    REWRITE
+};
+
+/**
+ * @brief A rewrite pass that can be run in a pipeline.
+ */
+class Pass
+{
+public:
+    /**
+     * @brief Destroy the pass.
+     */
+    virtual ~Pass() = default;
+
+    /**
+     * @brief Get the opcodes that this pass needs to visit.
+     *
+     * @return The opcodes. The pass is only called for these instructions.
+     */
+    virtual std::span<const uint16_t> getOpcodes() const = 0;
+
+    /**
+     * @brief Visit an instruction.
+     *
+     * @param instruction   The instruction words, including the first word.
+     * @param rewrite       Storage for the replacement instruction words,
+     *                      which is empty on entry. Only used if the action
+     *                      is @c PassAction::REWRITE. The replacement may be
+     *                      more than one instruction.
+     *
+     * @return The action to take for the instruction.
+     */
+    virtual PassAction visit(
+        std::span<const uint32_t> instruction,
+        std::vector<uint32_t>& rewrite) = 0;
+
+    /**
+     * @brief Append instructions at the end of the module.
+     *
+     * @param code   The output words to append to.
+     */
+    virtual void finish(
+        std::vector<uint32_t>& code)
+    {
+        (void)code;
+    }
+};
+
+/**
+ * @brief A pipeline of rewrite passes applied in a single walk of a module.
+ */
+class Pipeline
+{
+public:
+    /**
+     * @brief Add a pass to the pipeline.
+     *
+     * Passes are applied to each instruction in the order they are added.
+     *
+     * @param pass   The pass to add.
+     */
+    void addPass(
+        std::unique_ptr<Pass> pass);
+
+    /**
+     * @brief Test if the pipeline has any passes.
+     */
+    bool empty() const
+    {
+        return passes.empty();
+    }
+
+    /**
+     * @brief Run the pipeline on a module.
+     *
+     * @param code   The input module. Must remain valid while the result is
+     *               in use, because it is returned if no pass modifies it.
+     *
+     * @return The output module, which is either @c code or storage owned by
+     *         the pipeline that is valid until the next run. An invalid
+     *         module is returned unmodified.
+     */
+    std::span<const uint32_t> run(
+        std::span<const uint32_t> code);
+
+    /**
+     * @brief Test if the last run modified the module.
+     */
+    bool isModified() const
+    {
+        return modified;
+    }
+
+private:
+    /**
+     * @brief Copy the output up to a word offset in the input module.
+     *
+     * Creates the output on first use.
+     *
+     * @param code   The input module.
+     * @param end    The word offset to copy up to.
+     */
+    void flush(
+        std::span<const uint32_t> code,
+        size_t end);
+
+    /**
+     * @brief Get the bitmask of passes interested in an opcode.
+     *
+     * @param opcode   The instruction opcode.
+     *
+     * @return The pass bitmask, or zero if no pass is interested.
+     */
+    uint32_t getOpcodePasses(
+        uint16_t opcode) const;
+
+    /**
+     * @brief The maximum number of distinct opcodes passes can visit.
+     */
+    static constexpr size_t MAX_OPCODES {32};
+
+    /**
+     * @brief The bitmask of passes interested in an opcode.
+     */
+    struct OpcodePasses
+    {
+        /**
+         * @brief The instruction opcode.
+         */
+        uint16_t opcode;
+
+        /**
+         * @brief The bitmask of interested passes.
+         */
+        uint32_t mask;
+    };
+
+    /**
+     * @brief The passes in the pipeline, in application order.
+     */
+    std::vector<std::unique_ptr<Pass>> passes;
+
+    /**
+     * @brief The opcodes that passes are interested in, sorted by opcode.
+     *
+     * Only the first @c opcodeCount entries are valid. Passes only visit a
+     * handful of opcodes, so this is much smaller than a table indexed by
+     * opcode and cheap to build for every pipeline.
+     */
+    std::array<OpcodePasses, MAX_OPCODES> opcodePasses {};
+
+    /**
+     * @brief The number of valid entries in @c opcodePasses.
+     */
+    size_t opcodeCount {0};
+
+    /**
+     * @brief The output module storage.
+     */
+    std::vector<uint32_t> output;
+
+    /**
+     * @brief The instruction storage for rewrites.
+     */
+    std::vector<uint32_t> current;
+
+    /**
+     * @brief The rewrite buffer passed to each pass.
+     */
+    std::vector<uint32_t> rewrite;
+
+    /**
+     * @brief The offset in the input of the first word not yet in the output.
+     */
+    size_t flushed {0};
+
+    /**
+     * @brief Did the last run modify the module?
+     */
+    bool modified {false};
+};
+
+}
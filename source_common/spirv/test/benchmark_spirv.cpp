@@ -0,0 +1,199 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * A benchmark for the SPIR-V pipeline on large modules.
+ *
+ * The benchmark compares the pipeline against the previous implementation of
+ * the support layer shader passes, which copied the module once per pass.
+ */
+#include "spirv/spirv_passes.hpp"
+#include "spirv/spirv_pipeline.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Spirv;
+
+/**
+ * @brief The size of the test modules, in bytes.
+ */
+static constexpr size_t MODULE_BYTES {1024 * 1024};
+
+/**
+ * @brief The number of timed iterations for each test.
+ */
+static constexpr size_t ITERATIONS {50};
+
+/**
+ * @brief Make a module of approximately the benchmark size.
+ *
+ * @param relaxedFraction   The fraction of decorations that are RelaxedPrecision.
+ */
+static std::vector<uint32_t> makeModule(double relaxedFraction)
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    std::vector<uint32_t> code { MAGIC_NUMBER, 0x00010000, 0, 1024 * 1024, 0 };
+    size_t words = MODULE_BYTES / sizeof(uint32_t);
+
+    uint32_t id = 1;
+    while (code.size() < words)
+    {
+        // Roughly one decoration for every four arithmetic instructions
+        if (dist(rng) < 0.2)
+        {
+            uint32_t decoration = (dist(rng) < relaxedFraction) ? DECORATION_RELAXED_PRECISION : 1;
+            code.insert(code.end(), { makeWord0(OPCODE_DECORATE, 3), id, decoration });
+        }
+        else
+        {
+            code.insert(code.end(), { makeWord0(129, 5), 1, id, id + 1, id + 2 });
+            id++;
+        }
+    }
+
+    return code;
+}
+
+/**
+ * @brief The previous implementation of relaxed precision removal.
+ */
+static std::vector<uint32_t> legacyRemoveRelaxedPrecision(const std::vector<uint32_t>& originalCode)
+{
+    std::vector<uint32_t> code;
+    for (size_t i = 0; i < HEADER_WORDS; i++)
+    {
+        code.push_back(originalCode[i]);
+    }
+
+    for (size_t i = HEADER_WORDS; i < originalCode.size(); /* Increment in loop. */)
+    {
+        uint32_t opWord0 = originalCode[i];
+        uint16_t opCode = getOpcode(opWord0);
+        uint16_t opWordCount = getWordCount(opWord0);
+        if (opWordCount == 0)
+        {
+            break;
+        }
+
+        bool keep {true};
+        size_t offset = getDecorationOffset(opCode);
+        if (offset && originalCode[i + offset] == DECORATION_RELAXED_PRECISION)
+        {
+            keep = false;
+        }
+
+        if (keep)
+        {
+            for (size_t opI = 0; opI < opWordCount; opI++)
+            {
+                code.push_back(originalCode[i + opI]);
+            }
+        }
+
+        i += opWordCount;
+    }
+
+    return code;
+}
+
+/**
+ * @brief The previous implementation of hash fuzzing.
+ */
+static std::vector<uint32_t> legacyFuzz(const std::vector<uint32_t>& originalCode)
+{
+    std::vector<uint32_t> code = originalCode;
+    code.push_back(makeWord0(OPCODE_NOP, 1));
+    return code;
+}
+
+/**
+ * @brief Time a test function and print the median time.
+ *
+ * @param name   The test name.
+ * @param func   The test function, returning the output size in words.
+ */
+static void runTest(const char* name, const std::function<size_t()>& func)
+{
+    std::vector<double> times;
+    size_t outputWords = 0;
+
+    for (size_t i = 0; i < ITERATIONS; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        outputWords = func();
+        auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    std::sort(times.begin(), times.end());
+    printf("%-40s %10.1f us  (%zu words)\n", name, times[times.size() / 2], outputWords);
+}
+
+/**
+ * @brief Benchmark entry point.
+ */
+int main()
+{
+    for (double fraction : { 0.0, 0.5 })
+    {
+        auto code = makeModule(fraction);
+        printf("Module: %zu bytes, %.0f%% relaxed precision decorations\n",
+               code.size() * sizeof(uint32_t), fraction * 100.0);
+
+        runTest("legacy: relaxed", [&]() {
+            return legacyRemoveRelaxedPrecision(code).size();
+        });
+
+        runTest("legacy: relaxed + fuzz", [&]() {
+            return legacyFuzz(legacyRemoveRelaxedPrecision(code)).size();
+        });
+
+        Pipeline relaxed;
+        relaxed.addPass(std::make_unique<RemoveRelaxedPrecisionPass>());
+        runTest("pipeline: relaxed", [&]() {
+            return relaxed.run(code).size();
+        });
+
+        Pipeline both;
+        both.addPass(std::make_unique<RemoveRelaxedPrecisionPass>());
+        both.addPass(std::make_unique<AppendNopPass>());
+        runTest("pipeline: relaxed + fuzz", [&]() {
+            return both.run(code).size();
+        });
+
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * ----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ * ----------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * The implementation of the SPIR-V pipeline unit tests.
+ */
+#include "spirv/spirv_passes.hpp"
+#include "spirv/spirv_pipeline.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Spirv;
+
+static constexpr uint16_t OPCODE_FADD {129};
+
+/**
+ * @brief Make a module header.
+ */
+std::vector<uint32_t> makeTestModule()
+{
+    return { MAGIC_NUMBER, 0x00010000, 0, 16, 0 };
+}
+
+/**
+ * @brief Append an OpDecorate instruction to a module.
+ */
+void addDecorate(std::vector<uint32_t>& code, uint32_t target, uint32_t decoration)
+{
+    code.insert(code.end(), { makeWord0(OPCODE_DECORATE, 3), target, decoration });
+}
+
+/**
+ * @brief Append an OpMemberDecorate instruction to a module.
+ */
+void addMemberDecorate(std::vector<uint32_t>& code, uint32_t target, uint32_t member, uint32_t decoration)
+{
+    code.insert(code.end(), { makeWord0(OPCODE_MEMBER_DECORATE, 4), target, member, decoration });
+}
+
+/**
+ * @brief Append an OpFAdd instruction to a module.
+ */
+void addFAdd(std::vector<uint32_t>& code, uint32_t result)
+{
+    code.insert(code.end(), { makeWord0(OPCODE_FADD, 5), 1, result, 2, 3 });
+}
+
+/**
+ * @brief Test pass that rewrites OpFAdd result IDs.
+ */
+class RenumberPass : public Pass
+{
+public:
+    std::span<const uint16_t> getOpcodes() const override
+    {
+        static const uint16_t opcodes[] { OPCODE_FADD };
+        return opcodes;
+    }
+
+    PassAction visit(std::span<const uint32_t> instruction, std::vector<uint32_t>& rewrite) override
+    {
+        rewrite.assign(instruction.begin(), instruction.end());
+        rewrite[2] += 100;
+        return PassAction::REWRITE;
+    }
+};
+
+/** @brief Test that a pipeline without passes returns the input. */
+TEST(Spirv, test_no_passes)
+{
+    auto code = makeTestModule();
+    addFAdd(code, 10);
+
+    Pipeline pipeline;
+    auto result = pipeline.run(code);
+
+    EXPECT_FALSE(pipeline.isModified());
+    EXPECT_EQ(result.data(), code.data());
+    EXPECT_EQ(result.size(), code.size());
+}
+
+/** @brief Test that an unmodified module is returned without a copy. */
+TEST(Spirv, test_unmodified_is_borrowed)
+{
+    auto code = makeTestModule();
+    addDecorate(code, 10, 1);
+    addFAdd(code, 10);
+
+    Pipeline pipeline;
+    pipeline.addPass(std::make_unique<RemoveRelaxedPrecisionPass>());
+    auto result = pipeline.run(code);
+
+    EXPECT_FALSE(pipeline.isModified());
+    EXPECT_EQ(result.data(), code.data());
+    EXPECT_EQ(result.size(), code.size());
+}
+
+/** @brief Test removal of relaxed precision decorations. */
+TEST(Spirv, test_remove_relaxed_precision)
+{
+    auto code = makeTestModule();
+    addDecorate(code, 10, DECORATION_RELAXED_PRECISION);
+    addDecorate(code, 11, 1);
+    addMemberDecorate(code, 12, 0, DECORATION_RELAXED_PRECISION);
+    addFAdd(code, 10);
+
+    auto expected = makeTestModule();
+    addDecorate(expected, 11, 1);
+    addFAdd(expected, 10);
+
+    Pipeline pipeline;
+    pipeline.addPass(std::make_unique<RemoveRelaxedPrecisionPass>());
+    auto result = pipeline.run(code);
+
+    EXPECT_TRUE(pipeline.isModified());
+    EXPECT_EQ(std::vector<uint32_t>(result.begin(), result.end()), expected);
+}
+
+/** @brief Test appending a NOP at the end of the module. */
+TEST(Spirv, test_append_nop)
+{
+    auto code = makeTestModule();
+    addFAdd(code, 10);
+
+    auto expected = code;
+    expected.push_back(makeWord0(OPCODE_NOP, 1));
+
+    Pipeline pipeline;
+    pipeline.addPass(std::make_unique<AppendNopPass>());
+    auto result = pipeline.run(code);
+
+    EXPECT_TRUE(pipeline.isModified());
+    EXPECT_EQ(std::vector<uint32_t>(result.begin(), result.end()), expected);
+}
+
+/** @brief Test multiple passes applied in a single run. */
+TEST(Spirv, test_multiple_passes)
+{
+    auto code = makeTestModule();
+    addDecorate(code, 10, DECORATION_RELAXED_PRECISION);
+    addFAdd(code, 10);
+    addDecorate(code, 11, 1);
+    addFAdd(code, 11);
+
+    auto expected = makeTestModule();
+    addFAdd(expected, 110);
+    addDecorate(expected, 11, 1);
+    addFAdd(expected, 111);
+    expected.push_back(makeWord0(OPCODE_NOP, 1));
+
+    Pipeline pipeline;
+    pipeline.addPass(std::make_unique<RemoveRelaxedPrecisionPass>());
+    pipeline.addPass(std::make_unique<RenumberPass>());
+    pipeline.addPass(std::make_unique<AppendNopPass>());
+    auto result = pipeline.run(code);
+
+    EXPECT_TRUE(pipeline.isModified());
+    EXPECT_EQ(std::vector<uint32_t>(result.begin(), result.end()), expected);
+}
+
+/** @brief Test that a pipeline can be reused. */
+TEST(Spirv, test_pipeline_reuse)
+{
+    auto code1 = makeTestModule();
+    addDecorate(code1, 10, DECORATION_RELAXED_PRECISION);
+
+    auto code2 = makeTestModule();
+    addDecorate(code2, 10, 1);
+
+    Pipeline pipeline;
+    pipeline.addPass(std::make_unique<RemoveRelaxedPrecisionPass>());
+
+    auto result = pipeline.run(code1);
+    EXPECT_TRUE(pipeline.isModified());
+    EXPECT_EQ(std::vector<uint32_t>(result.begin(), result.end()), makeTestModule());
+
+    result = pipeline.run(code2);
+    EXPECT_FALSE(pipeline.isModified());
+    EXPECT_EQ(result.data(), code2.data());
+}
+
+/** @brief Test that invalid modules are returned unmodified. */
+TEST(Spirv, test_invalid_module)
+{
+    Pipeline pipeline;
+    pipeline.addPass(std::make_unique<RemoveRelaxedPrecisionPass>());
+
+    // Bad magic number
+    std::vector<uint32_t> code { 0, 0, 0, 0, 0 };
+    auto result = pipeline.run(code);
+    EXPECT_FALSE(pipeline.isModified());
+    EXPECT_EQ(result.data(), code.data());
+
+    // Zero length instruction after a modified instruction
+    code = makeTestModule();
+    addDecorate(code, 10, DECORATION_RELAXED_PRECISION);
+    code.push_back(0);
+    result = pipeline.run(code);
+    EXPECT_FALSE(pipeline.isModified());
+    EXPECT_EQ(result.data(), code.data());
+
+    // Truncated instruction
+    code = makeTestModule();
+    addFAdd(code, 10);
+    code.pop_back();
+    result = pipeline.run(code);
+    EXPECT_FALSE(pipeline.isModified());
+    EXPECT_EQ(result.data(), code.data());
+}
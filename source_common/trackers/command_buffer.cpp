@@ -210,6 +210,7 @@ uint64_t CommandBuffer::accelerationStructureBuild(LCSAccelerationStructureBuild
                                                    int64_t primitiveCount)
 {
     uint64_t tagID = Tracker::LCSWorkload::assignTagID();
+    stats.incAccelerationStructureBuildCount();
 
     // Add a workload to the command stream
     auto workload = std::make_shared<LCSAccelerationStructureBuild>(tagID, buildType, primitiveCount);
@@ -225,6 +226,7 @@ uint64_t CommandBuffer::accelerationStructureTransfer(LCSAccelerationStructureTr
                                                       int64_t byteCount)
 {
     uint64_t tagID = Tracker::LCSWorkload::assignTagID();
+    stats.incAccelerationStructureTransferCount();
 
     // Add a workload to the command stream
     auto workload = std::make_shared<LCSAccelerationStructureTransfer>(tagID, transferType, byteCount);
@@ -79,6 +79,14 @@ public:
      */
     const std::vector<LCSInstruction>& getSubmitCommandStream() const { return workloadCommandStream; }
 
+    /**
+     * @brief Get the layer submit-time command stream for modification.
+     *
+     * Only valid while recording, when the command buffer is externally
+     * synchronized by the application.
+     */
+    std::vector<LCSInstruction>& getSubmitCommandStream() { return workloadCommandStream; }
+
     /**
      * @brief Begin recording a render pass.
      *
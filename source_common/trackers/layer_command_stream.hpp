@@ -72,6 +72,29 @@ public:
      */
     static uint64_t assignTagID() { return nextTagID.fetch_add(1, std::memory_order_relaxed); }
 
+    /**
+     * @brief Get the layer instrumentation slot recorded for this workload.
+     *
+     * @return The slot, or @c NO_INSTRUMENTATION_SLOT if the workload was not
+     *         recorded with instrumentation.
+     */
+    uint32_t getInstrumentationSlot() const { return instrumentationSlot; }
+
+    /**
+     * @brief Set the layer instrumentation slot recorded for this workload.
+     *
+     * Layers set this at record time, while the command buffer is externally
+     * synchronized, so that submit-time processing can read it without a lock.
+     *
+     * @param slot   The layer-defined slot index.
+     */
+    void setInstrumentationSlot(uint32_t slot) { instrumentationSlot = slot; }
+
+    /**
+     * @brief Slot value for workloads recorded without instrumentation.
+     */
+    static constexpr uint32_t NO_INSTRUMENTATION_SLOT {UINT32_MAX};
+
 protected:
     /**
      * @brief The assigned tagID for this workload.
@@ -80,6 +103,11 @@ protected:
      */
     uint64_t tagID;
 
+    /**
+     * @brief The layer instrumentation slot recorded for this workload.
+     */
+    uint32_t instrumentationSlot {NO_INSTRUMENTATION_SLOT};
+
     /**
      * @brief Create a new workload.
      *
@@ -584,6 +612,13 @@ public:
      */
     const WorkloadType& getWorkload() const { return *workload; }
 
+    /**
+     * @brief Get the stored workload for modification
+     *
+     * @return The workload
+     */
+    WorkloadType& getWorkload() { return *workload; }
+
 private:
     /**
      * @brief The stored workload
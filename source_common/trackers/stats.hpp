@@ -89,6 +89,16 @@ public:
      */
     void incImageTransferCount() { imageTransferCount += 1; }
 
+    /**
+     * @brief Increment the acceleration structure build counter.
+     */
+    void incAccelerationStructureBuildCount() { accelerationStructureBuildCount += 1; }
+
+    /**
+     * @brief Increment the acceleration structure transfer counter.
+     */
+    void incAccelerationStructureTransferCount() { accelerationStructureTransferCount += 1; }
+
     /**
      * @brief Increment all counters with values from another stats object.
      */
@@ -97,11 +107,13 @@ public:
         frameCount += other.frameCount;
         renderPassCount += other.renderPassCount;
         drawCallCount += other.drawCallCount;
-        dispatchCount = other.dispatchCount;
-        dispatchDataGraphCount = other.dispatchDataGraphCount;
-        traceRaysCount = other.traceRaysCount;
-        bufferTransferCount = other.bufferTransferCount;
-        imageTransferCount = other.imageTransferCount;
+        dispatchCount += other.dispatchCount;
+        dispatchDataGraphCount += other.dispatchDataGraphCount;
+        traceRaysCount += other.traceRaysCount;
+        bufferTransferCount += other.bufferTransferCount;
+        imageTransferCount += other.imageTransferCount;
+        accelerationStructureBuildCount += other.accelerationStructureBuildCount;
+        accelerationStructureTransferCount += other.accelerationStructureTransferCount;
     }
 
     /**
@@ -117,6 +129,8 @@ public:
         traceRaysCount = 0;
         bufferTransferCount = 0;
         imageTransferCount = 0;
+        accelerationStructureBuildCount = 0;
+        accelerationStructureTransferCount = 0;
     }
 
     /**
@@ -159,6 +173,16 @@ public:
      */
     uint64_t getImageTransferCount() const { return imageTransferCount; }
 
+    /**
+     * @brief Get the acceleration structure build counter.
+     */
+    uint64_t getAccelerationStructureBuildCount() const { return accelerationStructureBuildCount; }
+
+    /**
+     * @brief Get the acceleration structure transfer counter.
+     */
+    uint64_t getAccelerationStructureTransferCount() const { return accelerationStructureTransferCount; }
+
 private:
     /**
      * @brief The number of frames tracked.
@@ -199,6 +223,16 @@ private:
      * @brief The number of image transfers tracked.
      */
     uint64_t imageTransferCount {0};
+
+    /**
+     * @brief The number of acceleration structure builds tracked.
+     */
+    uint64_t accelerationStructureBuildCount {0};
+
+    /**
+     * @brief The number of acceleration structure transfers tracked.
+     */
+    uint64_t accelerationStructureTransferCount {0};
 };
 
 }